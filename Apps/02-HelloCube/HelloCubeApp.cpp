@@ -177,12 +177,15 @@ public:
 
         m_render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
 
-        // Create index buffer for cube mesh
-        m_index_buffer = GetRenderContext().CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(m_cube_mesh.GetIndexDataSize(), GetIndexFormat(m_cube_mesh.GetIndex(0))));
+        // Create index buffer for cube mesh in the narrowest index format, which is 16-bit for small meshes
+        const PixelFormat     index_format    = m_cube_mesh.GetIndexFormat();
+        const Data::Size      index_data_size = m_cube_mesh.GetIndexDataSize(index_format);
+        const Mesh::Indices16 cube_indices    = m_cube_mesh.GetIndices16();
+        m_index_buffer = GetRenderContext().CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(index_data_size, index_format));
         m_index_buffer.SetName("Cube Index Buffer");
         m_index_buffer.SetData(m_render_cmd_queue, {
-            reinterpret_cast<Data::ConstRawPtr>(m_cube_mesh.GetIndices().data()), // NOSONAR
-            m_cube_mesh.GetIndexDataSize()
+            reinterpret_cast<Data::ConstRawPtr>(cube_indices.data()), // NOSONAR
+            index_data_size
         });
 
 #ifdef UNIFORMS_BUFFER_ENABLED
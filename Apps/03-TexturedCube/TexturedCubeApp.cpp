@@ -84,13 +84,14 @@ void TexturedCubeApp::Init()
     });
     m_vertex_buffer_set = rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer });
 
-    // Create index buffer for cube mesh
-    const Data::Size index_data_size = cube_mesh.GetIndexDataSize();
-    const gfx::PixelFormat index_format = gfx::GetIndexFormat(cube_mesh.GetIndex(0));
+    // Create index buffer for cube mesh in the narrowest index format, which is 16-bit for small meshes
+    const gfx::PixelFormat     index_format    = cube_mesh.GetIndexFormat();
+    const Data::Size           index_data_size = cube_mesh.GetIndexDataSize(index_format);
+    const gfx::Mesh::Indices16 cube_indices    = cube_mesh.GetIndices16();
     m_index_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForIndexBuffer(index_data_size, index_format));
     m_index_buffer.SetName("Cube Index Buffer");
     m_index_buffer.SetData(render_cmd_queue, {
-        reinterpret_cast<Data::ConstRawPtr>(cube_mesh.GetIndices().data()), // NOSONAR
+        reinterpret_cast<Data::ConstRawPtr>(cube_indices.data()), // NOSONAR
         index_data_size
     });
 
@@ -29,10 +29,12 @@ Tutorial demonstrating parallel rendering with Methane graphics API
 #include <Methane/Graphics/CubeMesh.hpp>
 #include <Methane/Data/TimeAnimation.h>
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
 
 #include <taskflow/algorithm/for_each.hpp>
 #include <taskflow/algorithm/sort.hpp>
 #include <cmath>
+#include <future>
 #include <random>
 #include <algorithm>
 
@@ -128,38 +130,33 @@ void ParallelRenderingApp::Init()
     // Create cube mesh
     gfx::CubeMesh<CubeVertex> cube_mesh(CubeVertex::layout);
 
-    // Create render state with program
-    rhi::RenderState::Settings render_state_settings
-    {
-        GetRenderContext().CreateProgram(
-            rhi::Program::Settings
+    // Create render state with program asynchronously, while mesh buffers and textures are created
+    rhi::RenderState::Settings render_state_settings{ {}, GetScreenRenderPattern() };
+    render_state_settings.depth.enabled = true;
+    std::future<rhi::RenderState> render_state_future = GetRenderContext().CreateRenderStateAsync(
+        rhi::Program::Settings
+        {
+            rhi::Program::ShaderSet
             {
-                rhi::Program::ShaderSet
-                {
-                    { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "ParallelRendering", "CubeVS" } } },
-                    { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "ParallelRendering", "CubePS" } } },
-                },
-                rhi::ProgramInputBufferLayouts
-                {
-                    rhi::Program::InputBufferLayout
-                    {
-                        rhi::Program::InputBufferLayout::ArgumentSemantics { cube_mesh.GetVertexLayout().GetSemantics() }
-                    }
-                },
-                rhi::ProgramArgumentAccessors
+                { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "ParallelRendering", "CubeVS" } } },
+                { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "ParallelRendering", "CubePS" } } },
+            },
+            rhi::ProgramInputBufferLayouts
+            {
+                rhi::Program::InputBufferLayout
                 {
-                    { { rhi::ShaderType::All,   "g_uniforms"      }, rhi::ProgramArgumentAccessor::Type::Mutable, true },
-                    { { rhi::ShaderType::Pixel, "g_texture_array" }, rhi::ProgramArgumentAccessor::Type::Constant },
-                    { { rhi::ShaderType::Pixel, "g_sampler"       }, rhi::ProgramArgumentAccessor::Type::Constant },
-                },
-                GetScreenRenderPattern().GetAttachmentFormats()
-            }
-        ),
-        GetScreenRenderPattern()
-    };
-    render_state_settings.program.SetName("Render Pipeline State");
-    render_state_settings.depth.enabled = true;
-    m_render_state = GetRenderContext().CreateRenderState( render_state_settings);
+                    rhi::Program::InputBufferLayout::ArgumentSemantics { cube_mesh.GetVertexLayout().GetSemantics() }
+                }
+            },
+            rhi::ProgramArgumentAccessors
+            {
+                { { rhi::ShaderType::All,   "g_uniforms"      }, rhi::ProgramArgumentAccessor::Type::Mutable, true },
+                { { rhi::ShaderType::Pixel, "g_texture_array" }, rhi::ProgramArgumentAccessor::Type::Constant },
+                { { rhi::ShaderType::Pixel, "g_sampler"       }, rhi::ProgramArgumentAccessor::Type::Constant },
+            },
+            GetScreenRenderPattern().GetAttachmentFormats()
+        },
+        render_state_settings);
 
     // Create cube mesh buffer resources
     const uint32_t cubes_count = m_settings.GetTotalCubesCount();
@@ -185,20 +182,25 @@ void ParallelRenderingApp::Init()
         }
     );
 
+    // Wait for render state creation completion before program bindings are created
+    m_render_state = render_state_future.get();
+    const rhi::Program render_program = m_render_state.GetProgram();
+    render_program.SetName("Render Pipeline State");
+
     // Create frame buffer resources
     const Data::Size uniforms_data_size = m_cube_array_buffers_ptr->GetUniformsBufferSize();
     const Data::Size uniform_data_size = MeshBuffers::GetUniformSize();
     tf::Taskflow program_bindings_task_flow;
     for(ParallelRenderingFrame& frame : GetFrames())
     {
-        // Create buffer for uniforms array related to all cube instances
-        frame.cubes_array.uniforms_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForConstantBuffer(uniforms_data_size, true, true));
-        frame.cubes_array.uniforms_buffer.SetName(fmt::format("Uniforms Buffer {}", frame.index));
+        // Allocate dynamic constants for uniforms array related to all cube instances,
+        // which are rebound to the constants allocated in the frame with the same index on first render
+        frame.uniforms_constants = GetRenderContext().AllocateDynamicConstants(uniforms_data_size);
 
         // Configure program resource bindings
         frame.cubes_array.program_bindings_per_instance.resize(cubes_count);
-        frame.cubes_array.program_bindings_per_instance[0] = render_state_settings.program.CreateBindings({
-            { { rhi::ShaderType::All,   "g_uniforms"      }, { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(0U), uniform_data_size } } },
+        frame.cubes_array.program_bindings_per_instance[0] = render_program.CreateBindings({
+            { { rhi::ShaderType::All,   "g_uniforms"      }, { { *frame.uniforms_constants.buffer_ptr, frame.uniforms_constants.offset + m_cube_array_buffers_ptr->GetUniformsBufferOffset(0U), uniform_data_size } } },
             { { rhi::ShaderType::Pixel, "g_texture_array" }, { { m_texture_array.GetInterface()   } } },
             { { rhi::ShaderType::Pixel, "g_sampler"       }, { { m_texture_sampler.GetInterface() } } },
         }, frame.index);
@@ -212,7 +214,7 @@ void ParallelRenderingApp::Init()
                 cube_program_bindings = rhi::ProgramBindings(frame.cubes_array.program_bindings_per_instance[0], {
                     {
                         { rhi::ShaderType::All, "g_uniforms" },
-                        { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), uniform_data_size } }
+                        { { *frame.uniforms_constants.buffer_ptr, frame.uniforms_constants.offset + m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), uniform_data_size } }
                     }
                 }, frame.index);
                 cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
@@ -255,6 +257,9 @@ void ParallelRenderingApp::Init()
 
     // Initialize cube parameters
     m_cube_array_parameters = InitializeCubeArrayParameters();
+    m_cube_bounding_spheres.Resize(cubes_count);
+    m_visible_cube_indices.reserve(cubes_count);
+    m_visible_cube_indices_per_thread.resize(m_settings.render_thread_count);
 
     // Update initial resource states before asteroids drawing without applying barriers on GPU to let automatic state propagation from Common state work
     m_cube_array_buffers_ptr->CreateBeginningResourceBarriers().ApplyTransitions();
@@ -297,6 +302,7 @@ ParallelRenderingApp::CubeArrayParameters ParallelRenderingApp::InitializeCubeAr
 
             CubeParameters& cube_params = cube_array_parameters[cube_index];
             cube_params.model_matrix = hlslpp::mul(scale_matrix, translation_matrix);
+            cube_params.bounding_radius = cs * std::sqrt(3.F) / 2.F; // unit cube is enclosed in sphere with half diagonal radius
             cube_params.rotation_speed_y = rotation_speed_distribution(rng);
             cube_params.rotation_speed_z = rotation_speed_distribution(rng);
 
@@ -364,7 +370,7 @@ bool ParallelRenderingApp::Update()
     if (!UserInterfaceApp::Update())
         return false;
 
-    // Update MVP-matrices for all cube instances so that they are positioned in a cube grid
+    // Update MVP-matrices and bounding spheres for all cube instances so that they are positioned in a cube grid
     tf::Taskflow task_flow;
     task_flow.for_each_index(0U, static_cast<uint32_t>(m_cube_array_parameters.size()), 1U,
         [this](const uint32_t cube_index)
@@ -374,9 +380,27 @@ bool ParallelRenderingApp::Update()
             uniforms.mvp_matrix = hlslpp::transpose(hlslpp::mul(cube_params.model_matrix, m_camera.GetViewProjMatrix()));
             uniforms.texture_index = cube_params.thread_index;
             m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
+
+            const hlslpp::float4 cube_center = hlslpp::mul(hlslpp::float4(0.F, 0.F, 0.F, 1.F), cube_params.model_matrix);
+            m_cube_bounding_spheres.Set(cube_index, cube_center.xyz, cube_params.bounding_radius);
         });
 
-    GetRenderContext().GetParallelExecutor().run(task_flow).get();
+    tf::Executor& parallel_executor = GetRenderContext().GetParallelExecutor();
+    parallel_executor.run(task_flow).get();
+
+    // Compact list of visible cubes is rendered instead of all cube instances
+    gfx::FrustumCulling::Cull(m_camera.GetFrustum(), m_cube_bounding_spheres, m_visible_cube_indices, &parallel_executor);
+
+    // Visible cubes are distributed between parallel render command lists by their thread index,
+    // so that the thread index label on cube faces matches the actual rendering thread
+    if (m_settings.parallel_rendering_enabled)
+    {
+        for(gfx::FrustumCulling::VisibleIndices& thread_visible_cube_indices : m_visible_cube_indices_per_thread)
+            thread_visible_cube_indices.clear();
+
+        for(const Data::Index cube_index : m_visible_cube_indices)
+            m_visible_cube_indices_per_thread[m_cube_array_parameters[cube_index].thread_index].push_back(cube_index);
+    }
     return true;
 }
 
@@ -386,10 +410,12 @@ bool ParallelRenderingApp::Render()
     if (!UserInterfaceApp::Render())
         return false;
 
-    // Update uniforms buffer related to current frame
-    const ParallelRenderingFrame& frame  = GetCurrentFrame();
+    // Write uniforms of all cube instances to dynamic constants of the current frame without buffer data upload
+    ParallelRenderingFrame& frame = GetCurrentFrame();
     const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
-    frame.cubes_array.uniforms_buffer.SetData(render_cmd_queue, m_cube_array_buffers_ptr->GetFinalPassUniformsSubresource());
+    const rhi::RenderContext::DynamicConstants uniforms_constants = GetRenderContext().AllocateDynamicConstants(m_cube_array_buffers_ptr->GetUniformsBufferSize());
+    m_cube_array_buffers_ptr->WriteFinalPassUniforms(uniforms_constants);
+    BindCubesUniforms(frame, uniforms_constants);
 
     // Render cube instances of 'CUBE_MAP_ARRAY_SIZE' count
     if (m_settings.parallel_rendering_enabled)
@@ -400,16 +426,14 @@ bool ParallelRenderingApp::Render()
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
         const std::vector<rhi::RenderCommandList>& render_cmd_lists = frame.parallel_render_cmd_list.GetParallelCommandLists();
-        const uint32_t instance_count_per_command_list = Data::DivCeil(m_cube_array_buffers_ptr->GetInstanceCount(), static_cast<uint32_t>(render_cmd_lists.size()));
+        META_CHECK_ARG_EQUAL(render_cmd_lists.size(), m_visible_cube_indices_per_thread.size());
 
-        // Generate thread tasks for each of parallel render command lists to encode cubes rendering commands
+        // Generate thread tasks for each of parallel render command lists to encode rendering commands of cubes with the same thread index
         tf::Taskflow render_task_flow;
         render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
-            [this, &frame, &render_cmd_lists, instance_count_per_command_list](const uint32_t cmd_list_index)
+            [this, &frame, &render_cmd_lists](const uint32_t cmd_list_index)
             {
-                const uint32_t begin_instance_index = cmd_list_index * instance_count_per_command_list;
-                const uint32_t end_instance_index = std::min(begin_instance_index + instance_count_per_command_list, m_cube_array_buffers_ptr->GetInstanceCount());
-                RenderCubesRange(render_cmd_lists[cmd_list_index], frame.cubes_array.program_bindings_per_instance, begin_instance_index, end_instance_index);
+                RenderCubes(render_cmd_lists[cmd_list_index], frame.cubes_array.program_bindings_per_instance, m_visible_cube_indices_per_thread[cmd_list_index]);
             }
         );
 
@@ -417,7 +441,7 @@ bool ParallelRenderingApp::Render()
         GetRenderContext().GetParallelExecutor().run(render_task_flow).get();
 #else
         // The same parallel rendering is done inside of MeshBuffers::DrawParallel helper function
-        m_cube_array_buffers_ptr->DrawParallel(*frame.parallel_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
+        m_cube_array_buffers_ptr->DrawParallel(frame.parallel_render_cmd_list, frame.cubes_array.program_bindings_per_instance, m_visible_cube_indices_per_thread);
 #endif
 
         RenderOverlay(frame.parallel_render_cmd_list.GetParallelCommandLists().back());
@@ -430,9 +454,9 @@ bool ParallelRenderingApp::Render()
         frame.serial_render_cmd_list.SetViewState(GetViewState());
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
-        RenderCubesRange(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
+        RenderCubes(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, m_visible_cube_indices);
 #else
-        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance);
+        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, m_visible_cube_indices);
 #endif
 
         RenderOverlay(frame.serial_render_cmd_list);
@@ -445,26 +469,51 @@ bool ParallelRenderingApp::Render()
     return true;
 }
 
-void ParallelRenderingApp::RenderCubesRange(const rhi::RenderCommandList& render_cmd_list,
-                                            const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
-                                            uint32_t begin_instance_index, const uint32_t end_instance_index) const
+void ParallelRenderingApp::BindCubesUniforms(ParallelRenderingFrame& frame, const rhi::RenderContext::DynamicConstants& uniforms_constants) const
+{
+    META_FUNCTION_TASK();
+    // Dynamic constants are allocated at the same location in every frame with the same index,
+    // so cube program bindings are updated only on first frames rendering after initialization
+    if (frame.uniforms_constants.buffer_ptr == uniforms_constants.buffer_ptr &&
+        frame.uniforms_constants.offset == uniforms_constants.offset)
+        return;
+
+    const Data::Size uniform_data_size = MeshBuffers::GetUniformSize();
+    tf::Taskflow program_bindings_task_flow;
+    program_bindings_task_flow.for_each_index(0U, static_cast<uint32_t>(frame.cubes_array.program_bindings_per_instance.size()), 1U,
+        [this, &frame, &uniforms_constants, uniform_data_size](const uint32_t cube_index)
+        {
+            frame.cubes_array.program_bindings_per_instance[cube_index].Get({ rhi::ShaderType::All, "g_uniforms" }).SetResourceViews({
+                { *uniforms_constants.buffer_ptr, uniforms_constants.offset + m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), uniform_data_size }
+            });
+        });
+
+    GetRenderContext().GetParallelExecutor().run(program_bindings_task_flow).get();
+    frame.uniforms_constants = uniforms_constants;
+}
+
+void ParallelRenderingApp::RenderCubes(const rhi::RenderCommandList& render_cmd_list,
+                                       const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
+                                       const gfx::FrustumCulling::VisibleIndices& cube_indices) const
 {
     META_FUNCTION_TASK();
     // Resource barriers are not set for vertex and index buffers, since it works with automatic state propagation from Common state
     render_cmd_list.SetVertexBuffers(m_cube_array_buffers_ptr->GetVertexBuffers(), false);
     render_cmd_list.SetIndexBuffer(m_cube_array_buffers_ptr->GetIndexBuffer(), false);
 
-    for (uint32_t instance_index = begin_instance_index; instance_index < end_instance_index; ++instance_index)
+    bool is_first_cube = true;
+    for (const Data::Index instance_index : cube_indices)
     {
         // Constant argument bindings are applied once per command list, mutables are applied always
         // Bound resources are retained by command list during its lifetime, but only for the first binding instance (since all binding instances use the same resource objects)
         rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior;
         bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::ConstantOnce);
-        if (instance_index == begin_instance_index)
+        if (is_first_cube)
             bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::RetainResources);
 
         render_cmd_list.SetProgramBindings(program_bindings_per_instance[instance_index], bindings_apply_behavior);
         render_cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle);
+        is_first_cube = false;
     }
 }
 
@@ -499,6 +548,8 @@ void ParallelRenderingApp::OnContextReleased(rhi::IContext& context)
 {
     META_FUNCTION_TASK();
     m_cube_array_buffers_ptr.reset();
+    m_visible_cube_indices.clear();
+    m_visible_cube_indices_per_thread.clear();
     m_texture_array = {};
     m_texture_sampler = {};
     m_render_state = {};
@@ -24,6 +24,7 @@ Tutorial demonstrating parallel rendering with Methane graphics API
 #pragma once
 
 #include <Methane/Kit.h>
+#include <Methane/Graphics/FrustumCulling.h>
 #include <Methane/UserInterface/App.hpp>
 
 #include <thread>
@@ -45,6 +46,7 @@ struct ParallelRenderingFrame final
     : Graphics::AppFrame
 {
     gfx::InstancedMeshBufferBindings cubes_array;
+    rhi::ContextDynamicConstants     uniforms_constants; // cube uniforms location bound to program bindings
     rhi::ParallelRenderCommandList   parallel_render_cmd_list;
     rhi::RenderCommandList           serial_render_cmd_list;
     rhi::CommandListSet              execute_cmd_list_set;
@@ -93,6 +95,7 @@ private:
     struct CubeParameters
     {
         hlslpp::float4x4 model_matrix;
+        float            bounding_radius  = 0.f;
         double           rotation_speed_y = 0.25f;
         double           rotation_speed_z = 0.5f;
         uint32_t         thread_index = 0;
@@ -103,9 +106,10 @@ private:
 
     CubeArrayParameters InitializeCubeArrayParameters() const;
     bool Animate(double elapsed_seconds, double delta_seconds);
-    void RenderCubesRange(const rhi::RenderCommandList& remder_cmd_list,
-                          const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
-                          uint32_t begin_instance_index, const uint32_t end_instance_index) const;
+    void BindCubesUniforms(ParallelRenderingFrame& frame, const rhi::RenderContext::DynamicConstants& uniforms_constants) const;
+    void RenderCubes(const rhi::RenderCommandList& render_cmd_list,
+                     const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
+                     const gfx::FrustumCulling::VisibleIndices& cube_indices) const;
 
     Settings            m_settings;
     gfx::Camera         m_camera;
@@ -114,6 +118,9 @@ private:
     rhi::Sampler        m_texture_sampler;
     Ptr<MeshBuffers>    m_cube_array_buffers_ptr;
     CubeArrayParameters m_cube_array_parameters;
+    gfx::BoundingSpheres                m_cube_bounding_spheres;
+    gfx::FrustumCulling::VisibleIndices m_visible_cube_indices;
+    std::vector<gfx::FrustumCulling::VisibleIndices> m_visible_cube_indices_per_thread;
 };
 
 } // namespace Methane::Tutorials
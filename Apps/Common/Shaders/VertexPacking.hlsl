@@ -0,0 +1,48 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: MethaneKit/Apps/Common/Shaders/VertexPacking.hlsl
+Decoding of packed vertex fields generated by Methane::Graphics::PackedMesh:
+
+  uint2 position : PACKED_POSITION; // half-float XYZW
+  uint  normal   : PACKED_NORMAL;   // octahedral snorm16 XY
+  uint  texcoord : PACKED_TEXCOORD; // unorm16 UV
+
+******************************************************************************/
+
+float3 UnpackPosition(uint2 packed_position)
+{
+    return float3(f16tof32(packed_position.x), f16tof32(packed_position.x >> 16), f16tof32(packed_position.y));
+}
+
+float3 UnpackNormal(uint packed_normal)
+{
+    // Sign extension of snorm16 components with arithmetic shift
+    const int2   snorm_components = int2(asint(packed_normal << 16), asint(packed_normal)) >> 16;
+    const float2 oct_normal = max(float2(snorm_components) / 32767.0, -1.0);
+    float3 normal = float3(oct_normal, 1.0 - abs(oct_normal.x) - abs(oct_normal.y));
+    const float fold = saturate(-normal.z);
+    normal.x += normal.x >= 0.0 ? -fold : fold;
+    normal.y += normal.y >= 0.0 ? -fold : fold;
+    return normalize(normal);
+}
+
+float2 UnpackTexCoord(uint packed_texcoord)
+{
+    return float2(packed_texcoord & 0xFFFF, packed_texcoord >> 16) / 65535.0;
+}
@@ -93,6 +93,9 @@ SET CMAKE_FLAGS= ^
     -DMETHANE_LOGGING_ENABLED:BOOL=OFF ^
     -DMETHANE_OPEN_IMAGE_IO_ENABLED:BOOL=OFF ^
     -DMETHANE_SCOPE_TIMERS_ENABLED:BOOL=OFF ^
+    -DMETHANE_TRACE_RECORDER_ENABLED:BOOL=OFF ^
+    -DMETHANE_ALLOCATION_STATS_ENABLED:BOOL=OFF ^
+    -DMETHANE_TSC_CLOCK_ENABLED:BOOL=OFF ^
     -DMETHANE_ITT_INSTRUMENTATION_ENABLED:BOOL=OFF ^
     -DMETHANE_ITT_METADATA_ENABLED:BOOL=OFF ^
     -DMETHANE_GPU_INSTRUMENTATION_ENABLED:BOOL=OFF ^
@@ -79,11 +79,14 @@ function(get_native_graphics_apis)
     set(METHANE_GFX_METAL 1 PARENT_SCOPE)   # MacOS default API
     set(METHANE_GFX_DIRECTX 2 PARENT_SCOPE) # Windows default API
     set(METHANE_GFX_VULKAN 3 PARENT_SCOPE)  # Linux default API
+    set(METHANE_GFX_NULL 4 PARENT_SCOPE)    # Headless API without GPU
 endfunction()
 
 function(get_default_graphics_api GRAPHICS_API)
     get_native_graphics_apis()
-    if(METHANE_GFX_VULKAN_ENABLED)
+    if(METHANE_GFX_NULL_ENABLED)
+        set(${GRAPHICS_API} ${METHANE_GFX_NULL} PARENT_SCOPE)
+    elseif(METHANE_GFX_VULKAN_ENABLED)
         set(${GRAPHICS_API} ${METHANE_GFX_VULKAN} PARENT_SCOPE)
     else()
         if(WIN32)
@@ -105,6 +108,8 @@ function(get_graphics_dir GRAPHICS_DIR)
         set(${GRAPHICS_DIR} Metal PARENT_SCOPE)
     elseif(METHANE_GFX_API EQUAL METHANE_GFX_VULKAN)
         set(${GRAPHICS_DIR} Vulkan PARENT_SCOPE)
+    elseif(METHANE_GFX_API EQUAL METHANE_GFX_NULL)
+        set(${GRAPHICS_DIR} Null PARENT_SCOPE)
     endif()
 endfunction()
 
@@ -322,6 +322,10 @@ function(add_methane_shaders_source)
         set_property(TARGET ${SHADERS_TARGET} APPEND PROPERTY METAL_LIBRARIES ${METAL_LIBRARY})
         set_property(TARGET ${SHADERS_TARGET} APPEND PROPERTY GENERATE_METAL_TARGETS ${GENERATE_METAL_TARGETS})
 
+    elseif(METHANE_GFX_API EQUAL METHANE_GFX_NULL)
+
+        # Shaders are not compiled for Null graphics API, since it does not execute shader code
+
     endif()
 
 endfunction()
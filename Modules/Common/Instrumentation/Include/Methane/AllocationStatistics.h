@@ -0,0 +1,140 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/AllocationStatistics.h
+Heap allocation statistics collected by tags of code scopes with thread-local counters,
+which are updated from overloaded "new" and "delete" operators.
+
+******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace Methane
+{
+
+// NOTE: Allocation statistics functions are called from the "new" and "delete" operators,
+//       so they must not allocate memory and must not be instrumented with META_FUNCTION_TASK
+class AllocationStatistics
+{
+public:
+    using TagId = uint8_t;
+
+    static constexpr size_t      max_tags_count     = 16U;
+    static constexpr size_t      max_threads_count  = 128U; // threads above this count share the same counters
+    static constexpr TagId       untagged_id        = 0U;
+    static constexpr const char* untagged_name      = "Untagged";
+
+    struct Counters
+    {
+        uint64_t allocations_count   = 0U;
+        uint64_t allocated_bytes     = 0U;
+        uint64_t deallocations_count = 0U;
+
+        [[nodiscard]] bool operator==(const Counters& other) const noexcept;
+        [[nodiscard]] bool operator!=(const Counters& other) const noexcept { return !operator==(other); }
+        Counters& operator+=(const Counters& other) noexcept;
+        Counters& operator-=(const Counters& other) noexcept;
+        [[nodiscard]] Counters operator+(const Counters& other) const noexcept { return Counters(*this) += other; }
+        [[nodiscard]] Counters operator-(const Counters& other) const noexcept { return Counters(*this) -= other; }
+    };
+
+    class TagCounters : public std::array<Counters, max_tags_count>
+    {
+    public:
+        [[nodiscard]] Counters GetSum() const noexcept;
+        TagCounters& operator+=(const TagCounters& other) noexcept;
+        TagCounters& operator-=(const TagCounters& other) noexcept;
+        [[nodiscard]] TagCounters operator-(const TagCounters& other) const noexcept { return TagCounters(*this) -= other; }
+    };
+
+    // Allocations made on the current thread within scope are counted under the given tag,
+    // nested scopes override the tag of the outer scopes
+    class TagScope
+    {
+    public:
+        explicit TagScope(TagId tag_id) noexcept : m_outer_tag_id(SetThreadTag(tag_id)) { }
+        ~TagScope() { SetThreadTag(m_outer_tag_id); }
+
+        TagScope(const TagScope&) = delete;
+        TagScope(TagScope&&) = delete;
+        TagScope& operator=(const TagScope&) = delete;
+        TagScope& operator=(TagScope&&) = delete;
+
+    private:
+        const TagId m_outer_tag_id;
+    };
+
+    // Counts allocations made on the current thread since construction,
+    // which is useful to check that hot code paths do not allocate memory
+    class ThreadScopeCounter
+    {
+    public:
+        ThreadScopeCounter() noexcept : m_begin_counters(GetThreadCounters()) { }
+
+        [[nodiscard]] TagCounters GetTagCounters() const noexcept { return GetThreadCounters() - m_begin_counters; }
+        [[nodiscard]] Counters    GetCounters() const noexcept    { return GetTagCounters().GetSum(); }
+
+    private:
+        const TagCounters m_begin_counters;
+    };
+
+    [[nodiscard]] static constexpr bool IsTrackingEnabled() noexcept
+    {
+#ifdef METHANE_ALLOCATION_STATS_ENABLED
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Tag name must be a static string, registering the same name again returns the same tag id,
+    // untagged id is returned when maximum tags count is reached
+    [[nodiscard]] static TagId       RegisterTag(const char* name) noexcept;
+    [[nodiscard]] static const char* GetTagName(TagId tag_id) noexcept;
+    [[nodiscard]] static size_t      GetTagsCount() noexcept;
+
+    [[nodiscard]] static TagId GetThreadTag() noexcept;
+    static TagId SetThreadTag(TagId tag_id) noexcept; // returns previous thread tag
+
+    static void AddAllocation(size_t size) noexcept;
+    static void AddDeallocation() noexcept;
+
+    [[nodiscard]] static TagCounters GetThreadCounters() noexcept;
+    [[nodiscard]] static TagCounters GetTotalCounters() noexcept;
+};
+
+} // namespace Methane
+
+#ifdef METHANE_ALLOCATION_STATS_ENABLED
+
+#define META_ALLOCATION_TAG_NAME_CONCAT(A, B) A##B
+#define META_ALLOCATION_TAG_NAME(PREFIX, LINE) META_ALLOCATION_TAG_NAME_CONCAT(PREFIX, LINE)
+
+#define META_ALLOCATION_TAG_SCOPE(/*const char* */name) \
+    static const Methane::AllocationStatistics::TagId META_ALLOCATION_TAG_NAME(allocation_tag_id_, __LINE__) = Methane::AllocationStatistics::RegisterTag(name); \
+    const Methane::AllocationStatistics::TagScope META_ALLOCATION_TAG_NAME(allocation_tag_scope_, __LINE__)(META_ALLOCATION_TAG_NAME(allocation_tag_id_, __LINE__))
+
+#else // ifdef METHANE_ALLOCATION_STATS_ENABLED
+
+#define META_ALLOCATION_TAG_SCOPE(/*const char* */name)
+
+#endif // ifdef METHANE_ALLOCATION_STATS_ENABLED
@@ -31,6 +31,8 @@ NOTE:
 
 #include "IttApiHelper.h"
 #include "ScopeTimer.h"
+#include "TraceRecorder.h"
+#include "AllocationStatistics.h"
 
 #if defined(__GNUC__) && !defined(__llvm__) && !defined(__INTEL_COMPILER)
 #define __GCC_COMPILER__
@@ -52,7 +54,7 @@ NOTE:
 
 #include <string_view>
 
-#if defined(ITT_INSTRUMENTATION_ENABLED) || defined(TRACY_ENABLE)
+#if defined(ITT_INSTRUMENTATION_ENABLED) || defined(TRACY_ENABLE) || defined(METHANE_TRACE_RECORDER_ENABLED)
 #define META_INSTRUMENTATION_ENABLED
 #endif
 
@@ -100,31 +102,40 @@ ITT_DOMAIN_EXTERN();
 
 #define META_CPU_FRAME_DELIMITER(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index) \
     FrameMark; \
+    META_TRACE_FRAME_DELIMITER(frame_buffer_index, frame_index); \
     ITT_PROCESS_MARKER("Methane-Frame-Delimiter"); \
     ITT_MARKER_ARG("Frame-Buffer-Index", static_cast<int64_t>(frame_buffer_index)); \
     ITT_MARKER_ARG("Frame-Index", static_cast<int64_t>(frame_index))
 
 #define META_CPU_FRAME_START(/*const char* */name) \
-    TracyCFrameMarkStart(name)
+    TracyCFrameMarkStart(name); \
+    META_TRACE_FRAME_START(name)
 
 #define META_CPU_FRAME_END(/*const char* */name) \
-    TracyCFrameMarkEnd(name)
+    TracyCFrameMarkEnd(name); \
+    META_TRACE_FRAME_END(name)
 
 #define META_SCOPE_TASK(/*const char* */name) \
     TRACY_ZONE_SCOPED_NAME(name); \
+    META_TRACE_SCOPE(name); \
     ITT_SCOPE_TASK(name)
 
 #define META_FUNCTION_TASK() \
     TRACY_ZONE_SCOPED(); \
+    META_TRACE_SCOPE(__FUNCTION__); \
     ITT_FUNCTION_TASK()
 
 #define META_GLOBAL_MARKER(/*const char* */name) \
+    META_TRACE_INSTANT(name); \
     ITT_GLOBAL_MARKER(name)
 #define META_PROCESS_MARKER(/*const char* */name) \
+    META_TRACE_INSTANT(name); \
     ITT_PROCESS_MARKER(name)
 #define META_THREAD_MARKER(/*const char* */name) \
+    META_TRACE_INSTANT(name); \
     ITT_THREAD_MARKER(name)
 #define META_TASK_MARKER(/*const char* */name) \
+    META_TRACE_INSTANT(name); \
     ITT_TASK_MARKER(name)
 
 #define META_FUNCTION_GLOBAL_MARKER() \
@@ -139,6 +150,7 @@ ITT_DOMAIN_EXTERN();
 #define META_THREAD_NAME(/*const char* */name) \
     TRACY_SET_THREAD_NAME(name); \
     ITT_THREAD_NAME(name); \
+    META_TRACE_THREAD_NAME(name); \
     Methane::SetThreadName(name)
 
 #else // ifdef META_INSTRUMENTATION_ENABLED
@@ -162,13 +174,14 @@ ITT_DOMAIN_EXTERN();
 
 #ifdef METHANE_LOGGING_ENABLED
 
-#include <Methane/Platform/Utils.h>
+#include <Methane/Platform/AsyncLogger.h>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+// Log message is formatted on the calling thread and written to debug output by the background thread
 #define META_LOG(/*std::string_view*/message, ...) \
-    Methane::Platform::PrintToDebugOutput(fmt::format(message, ## __VA_ARGS__))
+    Methane::Platform::AsyncLogger::Get().LogFormat(message, ## __VA_ARGS__)
 
 #else // ifdef METHANE_LOGGING_ENABLED
 
@@ -24,6 +24,7 @@ Code scope measurement timer with aggregating and averaging of timings.
 #pragma once
 
 #include "ILogger.h"
+#include "TraceRecorder.h"
 
 #include <Methane/IttApiHelper.h>
 #include <Methane/Timer.hpp>
@@ -112,7 +113,10 @@ private:
     using Timer::Reset;
     using Timer::ResetToSeconds;
 
-    const Registration m_registration;
+    const Registration               m_registration;
+#ifdef METHANE_TRACE_RECORDER_ENABLED
+    const TraceRecorder::Nanoseconds m_trace_begin_ns;
+#endif
 };
 
 } // namespace Methane
@@ -0,0 +1,200 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TraceRecorder.h
+In-process trace events recorder with per-thread ring buffers,
+which are written to file in Chrome trace JSON format (viewable in Perfetto UI).
+
+******************************************************************************/
+
+#pragma once
+
+#ifdef METHANE_TSC_CLOCK_ENABLED
+#include <Methane/TscClock.h>
+#endif
+
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <ostream>
+
+namespace Methane
+{
+
+// NOTE: Trace recorder functions must not be instrumented with META_FUNCTION_TASK,
+//       because this macro is itself implemented with trace recorder scopes
+class TraceRecorder // NOSONAR - custom destructor is required
+{
+public:
+#ifdef METHANE_TSC_CLOCK_ENABLED
+    using Clock       = TscClock;
+#else
+    using Clock       = std::chrono::steady_clock;
+#endif
+    using Nanoseconds = uint64_t;
+
+    static constexpr size_t      default_thread_events_capacity = 65536U;
+    static constexpr size_t      max_thread_buffers_count       = 64U; // buffers of exited threads are reused above this count
+    static constexpr const char* trace_file_env_variable        = "METHANE_TRACE_FILE";
+
+    enum class EventType : uint8_t
+    {
+        Complete,       // Scope with begin time and duration
+        Instant,        // Marker at some point in time
+        FrameDelimiter, // Global marker with frame buffer and frame indices
+        FrameStart,     // Named frame begin on the thread timeline
+        FrameEnd,       // Named frame end on the thread timeline
+    };
+
+    struct Event
+    {
+        const char* name               = nullptr;
+        Nanoseconds timestamp_ns       = 0U;
+        Nanoseconds duration_ns        = 0U;
+        EventType   type               = EventType::Complete;
+        uint32_t    frame_buffer_index = 0U;
+        uint32_t    frame_index        = 0U;
+    };
+
+    using Events = std::vector<Event>;
+
+    class Scope
+    {
+    public:
+        // Scope name must be a static string, since only pointer is stored in the event
+        explicit Scope(const char* name) noexcept
+            : m_name(TraceRecorder::Get().IsRecording() ? name : nullptr)
+            , m_begin_ns(m_name ? GetTimestamp() : 0U)
+        { }
+
+        ~Scope()
+        {
+            if (m_name)
+                TraceRecorder::Get().AddCompleteEvent(m_name, m_begin_ns, GetTimestamp());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        const char*       m_name;
+        const Nanoseconds m_begin_ns;
+    };
+
+    [[nodiscard]] static TraceRecorder& Get() noexcept;
+    [[nodiscard]] static Nanoseconds GetTimestamp() noexcept
+    {
+        return static_cast<Nanoseconds>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+    }
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder(TraceRecorder&&) = delete;
+    ~TraceRecorder();
+
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(TraceRecorder&&) = delete;
+
+    void SetRecording(bool is_recording) noexcept           { m_is_recording = is_recording; }
+    [[nodiscard]] bool IsRecording() const noexcept         { return m_is_recording; }
+
+    // Capacity is applied to the ring buffers of threads, which record their first event after this call
+    void SetThreadEventsCapacity(size_t events_capacity) noexcept { m_thread_events_capacity = events_capacity; }
+    [[nodiscard]] size_t GetThreadEventsCapacity() const noexcept { return m_thread_events_capacity; }
+
+    // Trace file is written on recorder destruction at exit, when path is not empty (initialized from environment variable)
+    void SetExitTraceFilePath(std::string_view file_path);
+    [[nodiscard]] std::string GetExitTraceFilePath() const;
+
+    void SetThreadName(std::string_view thread_name);
+    void AddCompleteEvent(const char* name, Nanoseconds begin_ns, Nanoseconds end_ns) noexcept;
+    void AddInstantEvent(const char* name) noexcept;
+    void AddFrameDelimiter(uint32_t frame_buffer_index, uint32_t frame_index) noexcept;
+    void AddFrameStart(std::string_view name) noexcept;
+    void AddFrameEnd(std::string_view name) noexcept;
+
+    // Returns recorded events of the calling thread from oldest to newest
+    [[nodiscard]] Events GetThreadEvents() const;
+    [[nodiscard]] size_t GetThreadsCount() const;
+
+    void WriteChromeTrace(std::ostream& os) const;
+    bool WriteChromeTraceFile(const std::string& file_path) const;
+    void Clear();
+
+private:
+    class ThreadBuffer;
+    class ThreadBufferLease;
+    using ThreadBuffers = std::vector<std::unique_ptr<ThreadBuffer>>;
+
+    TraceRecorder();
+
+    ThreadBuffer& GetThreadBuffer();
+    ThreadBuffer& AcquireThreadBuffer();
+    void ReleaseThreadBuffer(ThreadBuffer& thread_buffer);
+    void AddThreadEvent(const Event& event) noexcept;
+
+    const Nanoseconds         m_start_ns;
+    std::atomic<bool>         m_is_recording{ true };
+    std::atomic<size_t>       m_thread_events_capacity{ default_thread_events_capacity };
+    mutable std::mutex        m_mutex;
+    ThreadBuffers             m_thread_buffers;
+    std::deque<ThreadBuffer*> m_released_thread_buffers;
+    std::string               m_exit_trace_file_path;
+};
+
+} // namespace Methane
+
+#ifdef METHANE_TRACE_RECORDER_ENABLED
+
+#define META_TRACE_SCOPE_NAME_CONCAT(A, B) A##B
+#define META_TRACE_SCOPE_NAME(LINE) META_TRACE_SCOPE_NAME_CONCAT(trace_scope_, LINE)
+
+#define META_TRACE_SCOPE(/*const char* */name) \
+    const Methane::TraceRecorder::Scope META_TRACE_SCOPE_NAME(__LINE__)(name)
+
+#define META_TRACE_INSTANT(/*const char* */name) \
+    Methane::TraceRecorder::Get().AddInstantEvent(name)
+
+#define META_TRACE_FRAME_DELIMITER(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index) \
+    Methane::TraceRecorder::Get().AddFrameDelimiter(frame_buffer_index, frame_index)
+
+#define META_TRACE_FRAME_START(/*const char* */name) \
+    Methane::TraceRecorder::Get().AddFrameStart(name)
+
+#define META_TRACE_FRAME_END(/*const char* */name) \
+    Methane::TraceRecorder::Get().AddFrameEnd(name)
+
+#define META_TRACE_THREAD_NAME(/*const char* */name) \
+    Methane::TraceRecorder::Get().SetThreadName(name)
+
+#else // ifdef METHANE_TRACE_RECORDER_ENABLED
+
+#define META_TRACE_SCOPE(/*const char* */name)
+#define META_TRACE_INSTANT(/*const char* */name)
+#define META_TRACE_FRAME_DELIMITER(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index)
+#define META_TRACE_FRAME_START(/*const char* */name)
+#define META_TRACE_FRAME_END(/*const char* */name)
+#define META_TRACE_THREAD_NAME(/*const char* */name)
+
+#endif // ifdef METHANE_TRACE_RECORDER_ENABLED
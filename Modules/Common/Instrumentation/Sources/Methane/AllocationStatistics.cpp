@@ -0,0 +1,205 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/AllocationStatistics.cpp
+Heap allocation statistics collected by tags of code scopes with thread-local counters,
+which are updated from overloaded "new" and "delete" operators.
+
+******************************************************************************/
+
+#include <Methane/AllocationStatistics.h>
+
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cstring>
+
+namespace Methane
+{
+
+// All counters storage is statically allocated, because it is accessed from "new" and "delete" operators.
+// Counters are atomic only to be read from other threads, so relaxed memory order is enough.
+struct ThreadAllocationCounters
+{
+    struct TagCounters
+    {
+        std::atomic<uint64_t> allocations_count{ 0U };
+        std::atomic<uint64_t> allocated_bytes{ 0U };
+        std::atomic<uint64_t> deallocations_count{ 0U };
+    };
+
+    std::array<TagCounters, AllocationStatistics::max_tags_count> tags;
+};
+
+// Last counters block is shared by all threads above the maximum threads count
+static std::array<ThreadAllocationCounters, AllocationStatistics::max_threads_count + 1U> g_threads_counters;
+static std::atomic<size_t> g_threads_count{ 0U };
+
+static std::array<std::atomic<const char*>, AllocationStatistics::max_tags_count> g_tag_names{ AllocationStatistics::untagged_name };
+static std::atomic<size_t> g_tags_count{ 1U };
+static std::mutex          g_tags_mutex;
+
+static thread_local ThreadAllocationCounters* t_counters_ptr = nullptr;
+static thread_local AllocationStatistics::TagId t_tag_id = AllocationStatistics::untagged_id;
+
+[[nodiscard]]
+static ThreadAllocationCounters& GetThreadCountersRef() noexcept
+{
+    if (!t_counters_ptr)
+    {
+        const size_t thread_index = g_threads_count.fetch_add(1U, std::memory_order_relaxed);
+        t_counters_ptr = &g_threads_counters[std::min(thread_index, AllocationStatistics::max_threads_count)];
+    }
+    return *t_counters_ptr;
+}
+
+static void AddCounters(const ThreadAllocationCounters& thread_counters, AllocationStatistics::TagCounters& tag_counters) noexcept
+{
+    for(size_t tag_index = 0U; tag_index < AllocationStatistics::max_tags_count; ++tag_index)
+    {
+        const ThreadAllocationCounters::TagCounters& thread_tag_counters = thread_counters.tags[tag_index];
+        AllocationStatistics::Counters& counters = tag_counters[tag_index];
+        counters.allocations_count   += thread_tag_counters.allocations_count.load(std::memory_order_relaxed);
+        counters.allocated_bytes     += thread_tag_counters.allocated_bytes.load(std::memory_order_relaxed);
+        counters.deallocations_count += thread_tag_counters.deallocations_count.load(std::memory_order_relaxed);
+    }
+}
+
+bool AllocationStatistics::Counters::operator==(const Counters& other) const noexcept
+{
+    return allocations_count   == other.allocations_count &&
+           allocated_bytes     == other.allocated_bytes &&
+           deallocations_count == other.deallocations_count;
+}
+
+AllocationStatistics::Counters& AllocationStatistics::Counters::operator+=(const Counters& other) noexcept
+{
+    allocations_count   += other.allocations_count;
+    allocated_bytes     += other.allocated_bytes;
+    deallocations_count += other.deallocations_count;
+    return *this;
+}
+
+AllocationStatistics::Counters& AllocationStatistics::Counters::operator-=(const Counters& other) noexcept
+{
+    allocations_count   -= other.allocations_count;
+    allocated_bytes     -= other.allocated_bytes;
+    deallocations_count -= other.deallocations_count;
+    return *this;
+}
+
+AllocationStatistics::Counters AllocationStatistics::TagCounters::GetSum() const noexcept
+{
+    Counters sum_counters;
+    for(const Counters& counters : *this)
+    {
+        sum_counters += counters;
+    }
+    return sum_counters;
+}
+
+AllocationStatistics::TagCounters& AllocationStatistics::TagCounters::operator+=(const TagCounters& other) noexcept
+{
+    for(size_t tag_index = 0U; tag_index < max_tags_count; ++tag_index)
+    {
+        (*this)[tag_index] += other[tag_index];
+    }
+    return *this;
+}
+
+AllocationStatistics::TagCounters& AllocationStatistics::TagCounters::operator-=(const TagCounters& other) noexcept
+{
+    for(size_t tag_index = 0U; tag_index < max_tags_count; ++tag_index)
+    {
+        (*this)[tag_index] -= other[tag_index];
+    }
+    return *this;
+}
+
+AllocationStatistics::TagId AllocationStatistics::RegisterTag(const char* name) noexcept
+{
+    std::scoped_lock lock(g_tags_mutex);
+    const size_t tags_count = g_tags_count.load(std::memory_order_relaxed);
+    for(size_t tag_index = 0U; tag_index < tags_count; ++tag_index)
+    {
+        if (!std::strcmp(g_tag_names[tag_index].load(std::memory_order_relaxed), name))
+            return static_cast<TagId>(tag_index);
+    }
+
+    if (tags_count >= max_tags_count)
+        return untagged_id;
+
+    g_tag_names[tags_count].store(name, std::memory_order_relaxed);
+    g_tags_count.store(tags_count + 1U, std::memory_order_release);
+    return static_cast<TagId>(tags_count);
+}
+
+const char* AllocationStatistics::GetTagName(TagId tag_id) noexcept
+{
+    return tag_id < GetTagsCount() ? g_tag_names[tag_id].load(std::memory_order_relaxed) : nullptr;
+}
+
+size_t AllocationStatistics::GetTagsCount() noexcept
+{
+    return g_tags_count.load(std::memory_order_acquire);
+}
+
+AllocationStatistics::TagId AllocationStatistics::GetThreadTag() noexcept
+{
+    return t_tag_id;
+}
+
+AllocationStatistics::TagId AllocationStatistics::SetThreadTag(TagId tag_id) noexcept
+{
+    const TagId prev_tag_id = t_tag_id;
+    t_tag_id = tag_id;
+    return prev_tag_id;
+}
+
+void AllocationStatistics::AddAllocation(size_t size) noexcept
+{
+    ThreadAllocationCounters::TagCounters& tag_counters = GetThreadCountersRef().tags[t_tag_id];
+    tag_counters.allocations_count.fetch_add(1U, std::memory_order_relaxed);
+    tag_counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationStatistics::AddDeallocation() noexcept
+{
+    GetThreadCountersRef().tags[t_tag_id].deallocations_count.fetch_add(1U, std::memory_order_relaxed);
+}
+
+AllocationStatistics::TagCounters AllocationStatistics::GetThreadCounters() noexcept
+{
+    TagCounters tag_counters{};
+    if (t_counters_ptr)
+        AddCounters(*t_counters_ptr, tag_counters);
+    return tag_counters;
+}
+
+AllocationStatistics::TagCounters AllocationStatistics::GetTotalCounters() noexcept
+{
+    TagCounters tag_counters{};
+    const size_t threads_count = std::min(g_threads_count.load(std::memory_order_relaxed), max_threads_count + 1U);
+    for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        AddCounters(g_threads_counters[thread_index], tag_counters);
+    }
+    return tag_counters;
+}
+
+} // namespace Methane
@@ -19,14 +19,19 @@ limitations under the License.
 FILE: Methane/InstrumentMemoryAllocations.cpp
 Overloading "new" and "delete" operators with additional instrumentation:
  - Memory allocations tracking with Tracy
+ - Memory allocations statistics collection by tags
 
 ******************************************************************************/
 
-#include <tracy/Tracy.hpp>
+#include <Methane/AllocationStatistics.h>
 
 #include <cstdlib>
 #include <new>
 
+#ifdef TRACY_ENABLE
+
+#include <tracy/Tracy.hpp>
+
 #if defined(TRACY_MEMORY_CALL_STACK_DEPTH) && TRACY_MEMORY_CALL_STACK_DEPTH > 0
 
 #define TRACY_ALLOC(ptr, size) TracyAllocS(ptr, size, TRACY_MEMORY_CALL_STACK_DEPTH)
@@ -39,6 +44,25 @@ Overloading "new" and "delete" operators with additional instrumentation:
 
 #endif // TRACY_MEMORY_CALL_STACK_DEPTH
 
+#else // ifdef TRACY_ENABLE
+
+#define TRACY_ALLOC(ptr, size)
+#define TRACY_FREE(ptr)
+
+#endif // ifdef TRACY_ENABLE
+
+#ifdef METHANE_ALLOCATION_STATS_ENABLED
+
+#define STATISTICS_ALLOC(size) Methane::AllocationStatistics::AddAllocation(size)
+#define STATISTICS_FREE(ptr) if (ptr) Methane::AllocationStatistics::AddDeallocation()
+
+#else // ifdef METHANE_ALLOCATION_STATS_ENABLED
+
+#define STATISTICS_ALLOC(size)
+#define STATISTICS_FREE(ptr)
+
+#endif // ifdef METHANE_ALLOCATION_STATS_ENABLED
+
 void* operator new(std::size_t size)
 {
     void* ptr = std::malloc(size);
@@ -46,6 +70,7 @@ void* operator new(std::size_t size)
         throw std::bad_alloc();
 
     TRACY_ALLOC(ptr, size);
+    STATISTICS_ALLOC(size);
     return ptr;
 }
 
@@ -66,27 +91,31 @@ void* operator new(std::size_t size, std::align_val_t align)
         throw std::bad_alloc{};
 
     TRACY_ALLOC(ptr, size);
+    STATISTICS_ALLOC(size);
     return ptr;
 }
 
 void operator delete(void* ptr) noexcept
 {
     TRACY_FREE(ptr);
+    STATISTICS_FREE(ptr);
     std::free(ptr);
 }
 
 void operator delete(void* ptr, size_t) noexcept
 {
     TRACY_FREE(ptr);
+    STATISTICS_FREE(ptr);
     std::free(ptr);
 }
 
 void operator delete(void* ptr, std::align_val_t) noexcept
 {
     TRACY_FREE(ptr);
+    STATISTICS_FREE(ptr);
 #if defined(_WIN32)
     _aligned_free(ptr);
 #else
     free(ptr);
 #endif
-}
\ No newline at end of file
+}
@@ -123,12 +123,18 @@ void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registrati
 ScopeTimer::ScopeTimer(const char* scope_name)
     : Timer()
     , m_registration(Aggregator::Get().RegisterScope(scope_name))
+#ifdef METHANE_TRACE_RECORDER_ENABLED
+    , m_trace_begin_ns(TraceRecorder::GetTimestamp())
+#endif
 { }
 
 ScopeTimer::~ScopeTimer()
 {
     META_FUNCTION_TASK();
     Aggregator::Get().AddScopeTiming(m_registration, GetElapsedDuration());
+#ifdef METHANE_TRACE_RECORDER_ENABLED
+    TraceRecorder::Get().AddCompleteEvent(m_registration.name, m_trace_begin_ns, TraceRecorder::GetTimestamp());
+#endif
 }
 
 } // namespace Methane
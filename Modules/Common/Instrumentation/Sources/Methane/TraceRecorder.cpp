@@ -0,0 +1,408 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TraceRecorder.cpp
+In-process trace events recorder with per-thread ring buffers,
+which are written to file in Chrome trace JSON format (viewable in Perfetto UI).
+
+******************************************************************************/
+
+#include <Methane/TraceRecorder.h>
+
+#include <nowide/cstdlib.hpp>
+#include <nowide/fstream.hpp>
+
+#include <set>
+#include <algorithm>
+#include <iomanip>
+#include <cassert>
+
+namespace Methane
+{
+
+// Ring buffer of the thread events is written by its owner thread only,
+// so the mutex is contended only when events are read for trace writing
+class TraceRecorder::ThreadBuffer
+{
+public:
+    ThreadBuffer(uint32_t thread_id, size_t events_capacity)
+        : m_thread_id(thread_id)
+        , m_events(std::max(events_capacity, size_t(1U)))
+    { }
+
+    [[nodiscard]] uint32_t GetThreadId() const noexcept { return m_thread_id; }
+
+    [[nodiscard]] std::string GetThreadName() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_thread_name;
+    }
+
+    void SetThreadName(std::string_view thread_name)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_thread_name = thread_name;
+    }
+
+    void AddEvent(const Event& event) noexcept
+    {
+        std::scoped_lock lock(m_mutex);
+        m_events[m_next_event_index] = event;
+        m_next_event_index = (m_next_event_index + 1) % m_events.size();
+        m_events_count = std::min(m_events_count + 1, m_events.size());
+    }
+
+    [[nodiscard]] Events GetEvents() const
+    {
+        std::scoped_lock lock(m_mutex);
+        Events events;
+        events.reserve(m_events_count);
+        const size_t first_event_index = (m_next_event_index + m_events.size() - m_events_count) % m_events.size();
+        for(size_t event_offset = 0U; event_offset < m_events_count; ++event_offset)
+        {
+            events.push_back(m_events[(first_event_index + event_offset) % m_events.size()]);
+        }
+        return events;
+    }
+
+    void Clear() noexcept
+    {
+        std::scoped_lock lock(m_mutex);
+        m_next_event_index = 0U;
+        m_events_count     = 0U;
+    }
+
+    // Buffer of the exited thread is reset before reuse by the new thread
+    void Reset(size_t events_capacity)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_thread_name.clear();
+        m_events.assign(std::max(events_capacity, size_t(1U)), Event{});
+        m_next_event_index = 0U;
+        m_events_count     = 0U;
+    }
+
+    // Dynamic names are stored for the whole buffer lifetime, since events keep pointers to them,
+    // name string is allocated only once on the first use and then found without allocation
+    [[nodiscard]] const char* InternName(std::string_view name)
+    {
+        if (const auto name_it = m_interned_names.find(name); name_it != m_interned_names.end())
+            return name_it->c_str();
+
+        return m_interned_names.emplace(name).first->c_str();
+    }
+
+private:
+    const uint32_t                  m_thread_id;
+    mutable std::mutex              m_mutex;
+    std::string                     m_thread_name;
+    Events                          m_events;
+    size_t                          m_next_event_index = 0U;
+    size_t                          m_events_count     = 0U;
+    std::set<std::string, std::less<>> m_interned_names;
+};
+
+// Thread local lease returns thread buffer to the recorder on thread exit
+class TraceRecorder::ThreadBufferLease
+{
+public:
+    ThreadBufferLease() = default;
+    ThreadBufferLease(const ThreadBufferLease&) = delete;
+    ThreadBufferLease(ThreadBufferLease&&) = delete;
+
+    ~ThreadBufferLease()
+    {
+        if (!m_thread_buffer_ptr)
+            return;
+
+        try
+        {
+            TraceRecorder::Get().ReleaseThreadBuffer(*m_thread_buffer_ptr);
+        }
+        catch(const std::exception&)
+        {
+            // Thread buffer is not returned for reuse and stays owned by recorder
+            assert(false);
+        }
+    }
+
+    ThreadBufferLease& operator=(const ThreadBufferLease&) = delete;
+    ThreadBufferLease& operator=(ThreadBufferLease&&) = delete;
+
+    [[nodiscard]] ThreadBuffer* GetThreadBufferPtr() const noexcept { return m_thread_buffer_ptr; }
+    void SetThreadBuffer(ThreadBuffer& thread_buffer) noexcept      { m_thread_buffer_ptr = &thread_buffer; }
+
+private:
+    ThreadBuffer* m_thread_buffer_ptr = nullptr;
+};
+
+static void WriteJsonString(std::ostream& os, std::string_view str)
+{
+    os << '"';
+    for(const char c : str)
+    {
+        switch(c)
+        {
+        case '"':  os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n";  break;
+        case '\r': os << "\\r";  break;
+        case '\t': os << "\\t";  break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+            else
+                os << c;
+        }
+    }
+    os << '"';
+}
+
+static void WriteMicroseconds(std::ostream& os, TraceRecorder::Nanoseconds nanoseconds)
+{
+    os << nanoseconds / 1000U << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000U << std::setfill(' ');
+}
+
+TraceRecorder& TraceRecorder::Get() noexcept
+{
+    static TraceRecorder s_trace_recorder;
+    return s_trace_recorder;
+}
+
+TraceRecorder::TraceRecorder()
+    : m_start_ns(GetTimestamp())
+{
+    if (const char* trace_file_path = nowide::getenv(trace_file_env_variable); trace_file_path)
+    {
+        m_exit_trace_file_path = trace_file_path;
+    }
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    m_is_recording = false;
+    if (!m_exit_trace_file_path.empty())
+    {
+        WriteChromeTraceFile(m_exit_trace_file_path);
+    }
+}
+
+void TraceRecorder::SetExitTraceFilePath(std::string_view file_path)
+{
+    std::scoped_lock lock(m_mutex);
+    m_exit_trace_file_path = file_path;
+}
+
+std::string TraceRecorder::GetExitTraceFilePath() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_exit_trace_file_path;
+}
+
+void TraceRecorder::SetThreadName(std::string_view thread_name)
+{
+    GetThreadBuffer().SetThreadName(thread_name);
+}
+
+void TraceRecorder::AddCompleteEvent(const char* name, Nanoseconds begin_ns, Nanoseconds end_ns) noexcept
+{
+    AddThreadEvent(Event{ name, begin_ns, end_ns > begin_ns ? end_ns - begin_ns : 0U, EventType::Complete });
+}
+
+void TraceRecorder::AddInstantEvent(const char* name) noexcept
+{
+    AddThreadEvent(Event{ name, GetTimestamp(), 0U, EventType::Instant });
+}
+
+void TraceRecorder::AddFrameDelimiter(uint32_t frame_buffer_index, uint32_t frame_index) noexcept
+{
+    AddThreadEvent(Event{ "Frame", GetTimestamp(), 0U, EventType::FrameDelimiter, frame_buffer_index, frame_index });
+}
+
+void TraceRecorder::AddFrameStart(std::string_view name) noexcept
+{
+    if (!m_is_recording)
+        return;
+
+    try
+    {
+        ThreadBuffer& thread_buffer = GetThreadBuffer();
+        thread_buffer.AddEvent(Event{ thread_buffer.InternName(name), GetTimestamp(), 0U, EventType::FrameStart });
+    }
+    catch(const std::exception&)
+    {
+        assert(false);
+    }
+}
+
+void TraceRecorder::AddFrameEnd(std::string_view name) noexcept
+{
+    if (!m_is_recording)
+        return;
+
+    try
+    {
+        ThreadBuffer& thread_buffer = GetThreadBuffer();
+        thread_buffer.AddEvent(Event{ thread_buffer.InternName(name), GetTimestamp(), 0U, EventType::FrameEnd });
+    }
+    catch(const std::exception&)
+    {
+        assert(false);
+    }
+}
+
+TraceRecorder::Events TraceRecorder::GetThreadEvents() const
+{
+    return const_cast<TraceRecorder*>(this)->GetThreadBuffer().GetEvents(); // NOSONAR
+}
+
+size_t TraceRecorder::GetThreadsCount() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_thread_buffers.size();
+}
+
+void TraceRecorder::WriteChromeTrace(std::ostream& os) const
+{
+    std::scoped_lock lock(m_mutex);
+    constexpr uint32_t process_id = 1U;
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl;
+    os << R"({"name":"process_name","ph":"M","pid":)" << process_id << R"(,"args":{"name":"Methane Kit"}})";
+
+    for(const std::unique_ptr<ThreadBuffer>& thread_buffer_ptr : m_thread_buffers)
+    {
+        const uint32_t thread_id = thread_buffer_ptr->GetThreadId();
+        if (const std::string thread_name = thread_buffer_ptr->GetThreadName(); !thread_name.empty())
+        {
+            os << "," << std::endl << R"({"name":"thread_name","ph":"M","pid":)" << process_id
+               << R"(,"tid":)" << thread_id << R"(,"args":{"name":)";
+            WriteJsonString(os, thread_name);
+            os << "}}";
+        }
+
+        for(const Event& event : thread_buffer_ptr->GetEvents())
+        {
+            if (event.timestamp_ns < m_start_ns)
+                continue;
+
+            os << "," << std::endl << R"({"name":)";
+            WriteJsonString(os, event.name ? event.name : "");
+            os << R"(,"pid":)" << process_id << R"(,"tid":)" << thread_id << R"(,"ts":)";
+            WriteMicroseconds(os, event.timestamp_ns - m_start_ns);
+
+            switch(event.type)
+            {
+            case EventType::Complete:
+                os << R"(,"cat":"Methane","ph":"X","dur":)";
+                WriteMicroseconds(os, event.duration_ns);
+                break;
+            case EventType::Instant:
+                os << R"(,"cat":"Methane","ph":"i","s":"t")";
+                break;
+            case EventType::FrameDelimiter:
+                os << R"(,"cat":"Frame","ph":"i","s":"g","args":{"frame_buffer_index":)" << event.frame_buffer_index
+                   << R"(,"frame_index":)" << event.frame_index << "}";
+                break;
+            case EventType::FrameStart:
+                os << R"(,"cat":"Frame","ph":"b","id":)" << thread_id;
+                break;
+            case EventType::FrameEnd:
+                os << R"(,"cat":"Frame","ph":"e","id":)" << thread_id;
+                break;
+            default:
+                assert(false);
+            }
+            os << "}";
+        }
+    }
+
+    os << std::endl << "]}" << std::endl;
+}
+
+bool TraceRecorder::WriteChromeTraceFile(const std::string& file_path) const
+{
+    nowide::ofstream file_stream(file_path, std::ios::out | std::ios::trunc);
+    if (!file_stream.is_open())
+        return false;
+
+    WriteChromeTrace(file_stream);
+    return file_stream.good();
+}
+
+void TraceRecorder::Clear()
+{
+    std::scoped_lock lock(m_mutex);
+    for(const std::unique_ptr<ThreadBuffer>& thread_buffer_ptr : m_thread_buffers)
+    {
+        thread_buffer_ptr->Clear();
+    }
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::GetThreadBuffer()
+{
+    thread_local ThreadBufferLease tl_thread_buffer_lease;
+    if (ThreadBuffer* thread_buffer_ptr = tl_thread_buffer_lease.GetThreadBufferPtr(); thread_buffer_ptr)
+        return *thread_buffer_ptr;
+
+    ThreadBuffer& thread_buffer = AcquireThreadBuffer();
+    tl_thread_buffer_lease.SetThreadBuffer(thread_buffer);
+    return thread_buffer;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::AcquireThreadBuffer()
+{
+    std::scoped_lock lock(m_mutex);
+
+    // Thread buffers are owned by recorder and outlive their threads to keep events until trace is written,
+    // but when buffers count reaches the limit, the buffer of the earliest exited thread is reused
+    if (m_thread_buffers.size() >= max_thread_buffers_count && !m_released_thread_buffers.empty())
+    {
+        ThreadBuffer& thread_buffer = *m_released_thread_buffers.front();
+        m_released_thread_buffers.pop_front();
+        thread_buffer.Reset(m_thread_events_capacity);
+        return thread_buffer;
+    }
+
+    const auto thread_id = static_cast<uint32_t>(m_thread_buffers.size() + 1U);
+    return *m_thread_buffers.emplace_back(std::make_unique<ThreadBuffer>(thread_id, m_thread_events_capacity));
+}
+
+void TraceRecorder::ReleaseThreadBuffer(ThreadBuffer& thread_buffer)
+{
+    std::scoped_lock lock(m_mutex);
+    m_released_thread_buffers.push_back(&thread_buffer);
+}
+
+void TraceRecorder::AddThreadEvent(const Event& event) noexcept
+{
+    if (!m_is_recording)
+        return;
+
+    try
+    {
+        GetThreadBuffer().AddEvent(event);
+    }
+    catch(const std::exception&)
+    {
+        // Thread buffer allocation has failed, so event is dropped
+        assert(false);
+    }
+}
+
+} // namespace Methane
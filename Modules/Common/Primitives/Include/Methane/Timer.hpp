@@ -23,22 +23,64 @@ Basic animation timer for measuring elapsed time since start.
 
 #pragma once
 
+#ifdef METHANE_TSC_CLOCK_ENABLED
+#include "TscClock.h"
+#endif
+
 #include <chrono>
+#include <atomic>
 
 namespace Methane
 {
 
+enum class TimerTimeSource
+{
+    Clock,   // real time of the clock is used for measuring durations
+    Virtual  // virtual time is used while it is enabled, otherwise clock time is used
+};
+
 class Timer
 {
 public:
+#ifdef METHANE_TSC_CLOCK_ENABLED
+    using Clock        = TscClock; // lower overhead of time measurement in densely instrumented code
+#else
     using Clock        = std::chrono::high_resolution_clock;
+#endif
     using TimePoint    = Clock::time_point;
     using TimeDuration = Clock::duration;
+    using TimeSource   = TimerTimeSource;
 
-    Timer() = default;
+    // Virtual time is used only by timers which opt-in for it, like animations,
+    // while scope timers, FPS counters and other timers measuring durations always use clock time
+    explicit Timer(TimeSource time_source = TimeSource::Clock) noexcept
+        : m_time_source(time_source)
+    { }
+
+    // Virtual time replaces clock time in timers with virtual time source while it is enabled
+    // and is advanced explicitly with fixed time steps for deterministic animations
+    static void EnableVirtualTime() noexcept
+    {
+        s_virtual_time_ticks = Clock::now().time_since_epoch().count();
+        s_is_virtual_time_enabled = true;
+    }
 
+    static void DisableVirtualTime() noexcept                       { s_is_virtual_time_enabled = false; }
+    static void AdvanceVirtualTime(TimeDuration time_step) noexcept { s_virtual_time_ticks += time_step.count(); }
+
+    [[nodiscard]] static bool IsVirtualTimeEnabled() noexcept { return s_is_virtual_time_enabled; }
+
+    [[nodiscard]] static TimePoint GetNow(TimeSource time_source) noexcept
+    {
+        return time_source == TimeSource::Virtual && s_is_virtual_time_enabled
+             ? TimePoint(TimeDuration(s_virtual_time_ticks.load()))
+             : Clock::now();
+    }
+
+    [[nodiscard]] TimeSource   GetTimeSource() const noexcept      { return m_time_source; }
+    [[nodiscard]] TimePoint    GetNow() const noexcept             { return GetNow(m_time_source); }
     [[nodiscard]] TimePoint    GetStartTime() const noexcept       { return m_start_time; }
-    [[nodiscard]] TimeDuration GetElapsedDuration() const noexcept { return Clock::now() - m_start_time; }
+    [[nodiscard]] TimeDuration GetElapsedDuration() const noexcept { return GetNow() - m_start_time; }
     [[nodiscard]] uint32_t     GetElapsedSecondsU() const noexcept { return GetElapsedSeconds<uint32_t>(); }
     [[nodiscard]] double       GetElapsedSecondsD() const noexcept { return GetElapsedSeconds<double>(); }
     [[nodiscard]] float        GetElapsedSecondsF() const noexcept { return GetElapsedSeconds<float>(); }
@@ -51,12 +93,12 @@ public:
 
     void Reset() noexcept
     {
-        Reset(Clock::now());
+        Reset(GetNow());
     }
 
     void Reset(TimeDuration duration) noexcept
     {
-        Reset(Clock::now() - duration);
+        Reset(GetNow() - duration);
     }
 
     template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
@@ -72,7 +114,11 @@ protected:
     }
 
 private:
-    TimePoint m_start_time = Clock::now();
+    inline static std::atomic<bool>              s_is_virtual_time_enabled{ false };
+    inline static std::atomic<TimeDuration::rep> s_virtual_time_ticks{ 0 };
+
+    TimeSource m_time_source;
+    TimePoint  m_start_time = GetNow();
 };
 
 } // namespace Methane::Data
@@ -0,0 +1,104 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TscClock.h
+Low-overhead clock reading CPU time stamp counter (invariant TSC on x86 or virtual counter on ARM64)
+calibrated against steady clock, with fallback to steady clock when counter is not available.
+
+******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64))
+#include <intrin.h>
+#define METHANE_TSC_COUNTER_SUPPORTED
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define METHANE_TSC_COUNTER_SUPPORTED
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define METHANE_TSC_COUNTER_SUPPORTED
+#endif
+
+namespace Methane
+{
+
+// Clock satisfies std::chrono clock requirements and is compatible with steady clock time points:
+// time since epoch is counted from the steady clock epoch, so both clocks can be used together
+class TscClock
+{
+public:
+    using rep        = std::chrono::nanoseconds::rep;
+    using period     = std::chrono::nanoseconds::period;
+    using duration   = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<TscClock>;
+
+    static constexpr bool is_steady = true;
+
+    [[nodiscard]] static time_point now() noexcept
+    {
+        const Calibration& calibration = GetCalibration();
+        if (!calibration.is_counter_available)
+            return time_point(std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()));
+
+        const auto elapsed_ticks = static_cast<double>(ReadCounter() - calibration.base_ticks);
+        return time_point(duration(calibration.base_ns + static_cast<rep>(elapsed_ticks * calibration.ns_per_tick)));
+    }
+
+    // Counter is not serializing (rdtsc instead of rdtscp on x86) to keep the lowest overhead,
+    // so measured code may be reordered across the clock call by CPU in a range of few instructions
+    [[nodiscard]] static uint64_t ReadCounter() noexcept
+    {
+#if defined(_MSC_VER) && defined(_M_ARM64)
+        return static_cast<uint64_t>(_ReadStatusReg(ARM64_CNTVCT));
+#elif defined(__aarch64__)
+        uint64_t counter_value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(counter_value));
+        return counter_value;
+#elif defined(METHANE_TSC_COUNTER_SUPPORTED)
+        return static_cast<uint64_t>(__rdtsc());
+#else
+        return 0U;
+#endif
+    }
+
+    // Counter is available when it is supported by CPU and runs with constant rate independent of CPU frequency changes
+    [[nodiscard]] static bool   IsCounterAvailable() noexcept { return GetCalibration().is_counter_available; }
+    [[nodiscard]] static double GetCounterFrequency() noexcept; // ticks per second, or zero when counter is not available
+
+private:
+    struct Calibration
+    {
+        bool     is_counter_available = false;
+        uint64_t base_ticks           = 0U;
+        rep      base_ns              = 0;
+        double   ns_per_tick          = 0.0;
+    };
+
+    [[nodiscard]] static const Calibration& GetCalibration() noexcept
+    {
+        static const Calibration s_calibration = Calibrate();
+        return s_calibration;
+    }
+
+    [[nodiscard]] static Calibration Calibrate() noexcept;
+};
+
+} // namespace Methane
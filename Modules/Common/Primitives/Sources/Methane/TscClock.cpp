@@ -0,0 +1,107 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TscClock.cpp
+Low-overhead clock reading CPU time stamp counter (invariant TSC on x86 or virtual counter on ARM64)
+calibrated against steady clock, with fallback to steady clock when counter is not available.
+
+******************************************************************************/
+
+#include <Methane/TscClock.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+namespace Methane
+{
+
+// Calibration duration is a trade-off between application startup delay and counter frequency precision
+static constexpr std::chrono::milliseconds g_calibration_duration(5);
+
+[[nodiscard]]
+static bool IsInvariantCounterSupported() noexcept
+{
+#if (defined(_MSC_VER) && defined(_M_ARM64)) || defined(__aarch64__)
+    // ARM generic timer virtual counter always runs with constant frequency
+    return true;
+#elif defined(METHANE_TSC_COUNTER_SUPPORTED)
+    // Invariant TSC flag is reported in EDX bit 8 of the advanced power management CPUID leaf
+    constexpr uint32_t power_management_leaf = 0x80000007U;
+    constexpr uint32_t invariant_tsc_bit     = 1U << 8U;
+#if defined(_MSC_VER)
+    int cpu_info[4]{ };
+    __cpuid(cpu_info, static_cast<int>(0x80000000U));
+    if (static_cast<uint32_t>(cpu_info[0]) < power_management_leaf)
+        return false;
+
+    __cpuid(cpu_info, static_cast<int>(power_management_leaf));
+    return static_cast<uint32_t>(cpu_info[3]) & invariant_tsc_bit;
+#else
+    uint32_t eax = 0U;
+    uint32_t ebx = 0U;
+    uint32_t ecx = 0U;
+    uint32_t edx = 0U;
+    return __get_cpuid(power_management_leaf, &eax, &ebx, &ecx, &edx) && (edx & invariant_tsc_bit);
+#endif
+#else
+    return false;
+#endif
+}
+
+double TscClock::GetCounterFrequency() noexcept
+{
+    const Calibration& calibration = GetCalibration();
+    return calibration.is_counter_available ? 1E9 / calibration.ns_per_tick : 0.0;
+}
+
+TscClock::Calibration TscClock::Calibrate() noexcept
+{
+    Calibration calibration;
+    if (!IsInvariantCounterSupported())
+        return calibration;
+
+    using SteadyClock = std::chrono::steady_clock;
+    const SteadyClock::time_point begin_time  = SteadyClock::now();
+    const uint64_t                begin_ticks = ReadCounter();
+
+#if defined(__aarch64__)
+    // Virtual counter frequency is reported by the system register, so calibration wait is not required
+    uint64_t counter_frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(counter_frequency));
+    calibration.ns_per_tick = counter_frequency ? 1E9 / static_cast<double>(counter_frequency) : 0.0;
+#else
+    SteadyClock::time_point end_time = begin_time;
+    uint64_t                end_ticks = begin_ticks;
+    while (end_time - begin_time < g_calibration_duration)
+    {
+        end_time  = SteadyClock::now();
+        end_ticks = ReadCounter();
+    }
+
+    const auto elapsed_ns = std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(end_time - begin_time).count();
+    calibration.ns_per_tick = end_ticks > begin_ticks ? elapsed_ns / static_cast<double>(end_ticks - begin_ticks) : 0.0;
+#endif
+
+    calibration.is_counter_available = calibration.ns_per_tick > 0.0;
+    calibration.base_ticks           = begin_ticks;
+    calibration.base_ns              = std::chrono::duration_cast<duration>(begin_time.time_since_epoch()).count();
+    return calibration;
+}
+
+} // namespace Methane
@@ -31,7 +31,7 @@ namespace Methane::Data
 {
 
 Animation::Animation(double duration_sec) noexcept
-    : Timer()
+    : Timer(TimeSource::Virtual)
     , m_duration_sec(duration_sec)
 { }
 
@@ -69,7 +69,7 @@ void Animation::Resume()
     META_CHECK_ARG_EQUAL_DESCR(m_state, State::Paused, "only paused animation can be resumed");
 
     m_state = State::Running;
-    Reset(Clock::now() - m_paused_duration);
+    Reset(GetNow() - m_paused_duration);
 }
 
 } // namespace Methane::Data
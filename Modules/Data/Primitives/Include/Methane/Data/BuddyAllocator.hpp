@@ -0,0 +1,237 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/BuddyAllocator.hpp
+Buddy allocator of offset ranges in a memory block of power-of-two size,
+which is used for sub-allocation of resources in GPU memory heaps.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <cstdint>
+
+namespace Methane::Data
+{
+
+class BuddyAllocator
+{
+public:
+    using Offset = uint64_t;
+    using Size   = uint64_t;
+
+    struct Allocation
+    {
+        Offset offset = 0U;
+        Size   size   = 0U; // size of the allocated block rounded up to power of two
+
+        [[nodiscard]] friend bool operator==(const Allocation& left, const Allocation& right) noexcept
+        {
+            return left.offset == right.offset && left.size == right.size;
+        }
+    };
+
+    struct Statistics
+    {
+        Size     total_size              = 0U;
+        Size     used_size               = 0U;
+        Size     largest_free_block_size = 0U;
+        uint32_t allocations_count       = 0U;
+        Size     fragmented_free_size    = 0U; // free space out of the largest free block, summed over allocators
+
+        [[nodiscard]] Size   GetFreeSize() const noexcept    { return total_size - used_size; }
+        [[nodiscard]] double GetUtilization() const noexcept { return total_size ? static_cast<double>(used_size) / static_cast<double>(total_size) : 0.0; }
+
+        // Fragmentation is the share of free space which can not be allocated in one block of its allocator:
+        // 0 when all free space is contiguous and close to 1 when it is split in many small blocks
+        [[nodiscard]] double GetFragmentation() const noexcept
+        {
+            const Size free_size = GetFreeSize();
+            return free_size ? static_cast<double>(fragmented_free_size) / static_cast<double>(free_size) : 0.0;
+        }
+
+        // Merges statistics of several allocators, so that fragmentation is weighted by free size of each allocator
+        Statistics& operator+=(const Statistics& other) noexcept
+        {
+            total_size              += other.total_size;
+            used_size               += other.used_size;
+            largest_free_block_size  = std::max(largest_free_block_size, other.largest_free_block_size);
+            allocations_count       += other.allocations_count;
+            fragmented_free_size    += other.fragmented_free_size;
+            return *this;
+        }
+    };
+
+    [[nodiscard]] static constexpr bool IsPowerOfTwo(Size value) noexcept
+    {
+        return value && !(value & (value - 1U));
+    }
+
+    [[nodiscard]] static constexpr Size GetNextPowerOfTwo(Size value) noexcept
+    {
+        Size power_of_two = 1U;
+        while (power_of_two < value)
+            power_of_two <<= 1U;
+        return power_of_two;
+    }
+
+    BuddyAllocator(Size total_size, Size min_block_size)
+        : m_total_size(total_size)
+        , m_min_block_size(min_block_size)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_TRUE_DESCR(IsPowerOfTwo(total_size), "buddy allocator total size {} must be a power of two", total_size);
+        META_CHECK_ARG_TRUE_DESCR(IsPowerOfTwo(min_block_size), "buddy allocator minimum block size {} must be a power of two", min_block_size);
+        META_CHECK_ARG_LESS_OR_EQUAL(min_block_size, total_size);
+
+        uint32_t levels_count = 1U;
+        for(Size block_size = total_size; block_size > min_block_size; block_size >>= 1U)
+            levels_count++;
+
+        m_free_offsets_by_level.resize(levels_count);
+        m_free_offsets_by_level[0].insert(0U);
+    }
+
+    [[nodiscard]] Size GetTotalSize() const noexcept    { return m_total_size; }
+    [[nodiscard]] Size GetMinBlockSize() const noexcept { return m_min_block_size; }
+    [[nodiscard]] Size GetUsedSize() const noexcept     { return m_used_size; }
+    [[nodiscard]] bool IsEmpty() const noexcept         { return m_allocated_size_by_offset.empty(); }
+
+    // Returns the size of block which will be allocated for the given size and alignment:
+    // blocks are naturally aligned by their power-of-two size, so alignment is satisfied by rounding up block size
+    [[nodiscard]] Size GetBlockSize(Size size, Size alignment = 1U) const noexcept
+    {
+        return std::max(GetNextPowerOfTwo(std::max(size, alignment)), m_min_block_size);
+    }
+
+    [[nodiscard]] Opt<Allocation> Allocate(Size size, Size alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_TRUE_DESCR(IsPowerOfTwo(alignment), "allocation alignment {} must be a power of two", alignment);
+        if (!size)
+            return std::nullopt;
+
+        const Size block_size = GetBlockSize(size, alignment);
+        if (block_size > m_total_size)
+            return std::nullopt;
+
+        // Find the smallest free block which fits the requested block size
+        const uint32_t block_level = GetLevel(block_size);
+        uint32_t free_level = block_level + 1U;
+        while (free_level > 0U && m_free_offsets_by_level[free_level - 1U].empty())
+            free_level--;
+
+        if (!free_level)
+            return std::nullopt;
+
+        // Split the found free block in halves down to the requested block size
+        free_level--;
+        std::set<Offset>& free_offsets = m_free_offsets_by_level[free_level];
+        const Offset block_offset = *free_offsets.begin();
+        free_offsets.erase(free_offsets.begin());
+        for(uint32_t level = free_level + 1U; level <= block_level; ++level)
+        {
+            m_free_offsets_by_level[level].insert(block_offset + GetLevelBlockSize(level));
+        }
+
+        m_allocated_size_by_offset.emplace(block_offset, block_size);
+        m_used_size += block_size;
+        return Allocation{ block_offset, block_size };
+    }
+
+    void Free(Offset offset)
+    {
+        META_FUNCTION_TASK();
+        const auto allocated_it = m_allocated_size_by_offset.find(offset);
+        META_CHECK_ARG_TRUE_DESCR(allocated_it != m_allocated_size_by_offset.end(), "no block was allocated at offset {}", offset);
+
+        Size     block_size  = allocated_it->second;
+        uint32_t block_level = GetLevel(block_size);
+        m_allocated_size_by_offset.erase(allocated_it);
+        m_used_size -= block_size;
+
+        // Merge released block with its free buddy blocks up the levels hierarchy
+        while (block_level > 0U)
+        {
+            std::set<Offset>& free_offsets = m_free_offsets_by_level[block_level];
+            const auto buddy_it = free_offsets.find(offset ^ block_size);
+            if (buddy_it == free_offsets.end())
+                break;
+
+            free_offsets.erase(buddy_it);
+            offset = std::min(offset, offset ^ block_size);
+            block_size <<= 1U;
+            block_level--;
+        }
+        m_free_offsets_by_level[block_level].insert(offset);
+    }
+
+    void Free(const Allocation& allocation) { Free(allocation.offset); }
+
+    [[nodiscard]] Size GetLargestFreeBlockSize() const noexcept
+    {
+        for(uint32_t level = 0U; level < m_free_offsets_by_level.size(); ++level)
+        {
+            if (!m_free_offsets_by_level[level].empty())
+                return GetLevelBlockSize(level);
+        }
+        return 0U;
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const noexcept
+    {
+        const Size largest_free_block_size = GetLargestFreeBlockSize();
+        return Statistics{
+            m_total_size,
+            m_used_size,
+            largest_free_block_size,
+            static_cast<uint32_t>(m_allocated_size_by_offset.size()),
+            m_total_size - m_used_size - largest_free_block_size
+        };
+    }
+
+private:
+    [[nodiscard]] Size GetLevelBlockSize(uint32_t level) const noexcept { return m_total_size >> level; }
+
+    [[nodiscard]] uint32_t GetLevel(Size block_size) const noexcept
+    {
+        uint32_t level = 0U;
+        for(Size level_block_size = m_total_size; level_block_size > block_size; level_block_size >>= 1U)
+            level++;
+        return level;
+    }
+
+    using FreeOffsetsByLevel = std::vector<std::set<Offset>>;
+    using SizeByOffset       = std::map<Offset, Size>;
+
+    const Size         m_total_size;
+    const Size         m_min_block_size;
+    Size               m_used_size = 0U;
+    FreeOffsetsByLevel m_free_offsets_by_level;
+    SizeByOffset       m_allocated_size_by_offset;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,141 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FencedRingBuffer.hpp
+Ring buffer of offset ranges fenced by executions: ranges and payloads allocated
+before execution begin are reclaimed only when that execution is completed.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
+
+namespace Methane::Data
+{
+
+template<typename PayloadType>
+class FencedRingBuffer
+{
+public:
+    using Offset      = uint64_t;
+    using Size        = uint64_t;
+    using ExecutionId = const void*;
+
+    FencedRingBuffer(Size size, Size alignment)
+        : m_size(size)
+        , m_alignment(alignment)
+    {
+        META_CHECK_ARG_NOT_ZERO_DESCR(size, "fenced ring buffer size can not be zero");
+        META_CHECK_ARG_NOT_ZERO_DESCR(alignment, "fenced ring buffer alignment can not be zero");
+    }
+
+    [[nodiscard]] Size   GetSize() const noexcept             { return m_size; }
+    [[nodiscard]] Size   GetUsedSize() const noexcept         { return m_head - m_tail; }
+    [[nodiscard]] size_t GetExecutionsCount() const noexcept  { return m_executions.size(); }
+    [[nodiscard]] size_t GetPayloadsCount() const noexcept
+    {
+        size_t payloads_count = m_pending_payloads.size();
+        for(const Execution& execution : m_executions)
+            payloads_count += execution.payloads.size();
+        return payloads_count;
+    }
+
+    // Returns offset of the aligned range in ring or empty optional when there is no free space left,
+    // range can not wrap around the ring end, so the rest of the ring is skipped in this case
+    [[nodiscard]] Opt<Offset> Allocate(Size size)
+    {
+        META_FUNCTION_TASK();
+        const Size aligned_size = (size + m_alignment - 1U) / m_alignment * m_alignment;
+        if (!aligned_size || aligned_size > m_size)
+            return std::nullopt;
+
+        Offset offset = m_head;
+        if (const Offset ring_offset = offset % m_size;
+            ring_offset + aligned_size > m_size)
+        {
+            offset += m_size - ring_offset;
+        }
+
+        if (offset + aligned_size - m_tail > m_size)
+            return std::nullopt;
+
+        m_head = offset + aligned_size;
+        return offset % m_size;
+    }
+
+    // Payload is released along with ring ranges on completion of the next begun execution
+    PayloadType& AddPayload(PayloadType&& payload)
+    {
+        META_FUNCTION_TASK();
+        return m_pending_payloads.emplace_back(std::move(payload));
+    }
+
+    // All ranges and payloads allocated before execution begin are used by this execution
+    void BeginExecution(ExecutionId execution_id)
+    {
+        META_FUNCTION_TASK();
+        Execution& execution = m_executions.emplace_back(Execution{ execution_id, m_head, {}, false });
+        std::swap(execution.payloads, m_pending_payloads);
+    }
+
+    // Executions may be completed in any order, but ring space is reclaimed in order of executions begin,
+    // so the completed execution is released only when all executions begun before it are completed too
+    void CompleteExecution(ExecutionId execution_id)
+    {
+        META_FUNCTION_TASK();
+        const auto execution_it = std::find_if(m_executions.begin(), m_executions.end(),
+            [execution_id](const Execution& execution)
+            { return execution.id == execution_id && !execution.is_completed; });
+        if (execution_it == m_executions.end())
+            return;
+
+        execution_it->is_completed = true;
+        while (!m_executions.empty() && m_executions.front().is_completed)
+        {
+            m_tail = m_executions.front().head;
+            m_executions.pop_front();
+        }
+    }
+
+private:
+    struct Execution
+    {
+        ExecutionId              id;
+        Offset                   head;
+        std::vector<PayloadType> payloads;
+        bool                     is_completed;
+    };
+
+    const Size               m_size;
+    const Size               m_alignment;
+    Offset                   m_head = 0U; // monotonic offsets, ring offset is the remainder of division by ring size
+    Offset                   m_tail = 0U;
+    std::vector<PayloadType> m_pending_payloads;
+    std::deque<Execution>    m_executions;
+};
+
+} // namespace Methane::Data
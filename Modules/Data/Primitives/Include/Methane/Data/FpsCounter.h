@@ -24,10 +24,11 @@ FPS counter interface.
 #pragma once
 
 #include <Methane/Data/IFpsCounter.h>
+#include <Methane/Data/LogHistogram.hpp>
 
 #include <Methane/Timer.hpp>
 
-#include <queue>
+#include <vector>
 
 namespace Methane::Data
 {
@@ -36,26 +37,39 @@ class FpsCounter
     : public IFpsCounter
 {
 public:
-    FpsCounter() = default;
-    explicit FpsCounter(uint32_t averaged_timings_count) noexcept;
+    FpsCounter();
+    explicit FpsCounter(uint32_t averaged_timings_count);
 
-    void Reset(uint32_t averaged_timings_count) noexcept override;
+    void Reset(uint32_t averaged_timings_count) override;
     [[nodiscard]] uint32_t GetAveragedTimingsCount() const noexcept override;
     [[nodiscard]] Timing   GetAverageFrameTiming() const noexcept override;
+    [[nodiscard]] Timing   GetLastFrameTiming() const noexcept override;
     [[nodiscard]] uint32_t GetFramesPerSecond() const noexcept override;
+    [[nodiscard]] FrameStatistics GetFrameStatistics(double frame_budget_msec) const noexcept override;
 
     void OnGpuFramePresentWait() noexcept;
     void OnCpuFrameReadyToPresent() noexcept;
     void OnGpuFramePresented() noexcept;
     void OnCpuFramePresented() noexcept;
 
+    // Adds frame timing to the averaging window directly, bypassing frame timers
+    void AddFrameTiming(const Timing& frame_timing) noexcept;
+
 private:
-    Timer              m_frame_timer;
-    Timer              m_present_timer;
-    double             m_present_on_gpu_wait_time_sec = 0.0;
-    uint32_t           m_averaged_timings_count = 100;
-    Timing             m_frame_timings_sum;
-    std::queue<Timing> m_frame_timings;
+    using Timings = std::vector<Timing>;
+
+    void AddTimingToHistograms(const Timing& frame_timing) noexcept;
+    void RemoveTimingFromHistograms(const Timing& frame_timing) noexcept;
+
+    Timer        m_frame_timer;
+    Timer        m_present_timer;
+    double       m_present_on_gpu_wait_time_sec = 0.0;
+    Timing       m_frame_timings_sum;
+    Timings      m_frame_timings;  // ring buffer with capacity of averaged timings count allocated on reset only
+    uint32_t     m_frame_timings_begin = 0U;
+    uint32_t     m_frame_timings_count = 0U;
+    LogHistogram m_frame_time_histogram; // frame times in microseconds
+    LogHistogram m_cpu_time_histogram;   // CPU times in microseconds
 };
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -59,15 +59,34 @@ private:
     double m_gpu_wait_time_sec { 0.0 };
 };
 
+struct FrameTimePercentiles
+{
+    double p50_msec = 0.0;
+    double p95_msec = 0.0;
+    double p99_msec = 0.0;
+    double max_msec = 0.0;
+};
+
+struct FrameStatistics
+{
+    uint32_t             frames_count = 0U;
+    FrameTimePercentiles frame_time;
+    FrameTimePercentiles cpu_time;
+    uint32_t             over_budget_frames_count = 0U;
+    double               one_percent_low_fps = 0.0; // FPS of the average frame time of 1% slowest frames
+};
+
 class IFpsCounter
 {
 public:
     using Timing = FrameTiming;
 
-    virtual void Reset(uint32_t averaged_timings_count) noexcept = 0;
+    virtual void Reset(uint32_t averaged_timings_count) = 0;
     [[nodiscard]] virtual uint32_t GetAveragedTimingsCount() const noexcept = 0;
     [[nodiscard]] virtual Timing   GetAverageFrameTiming() const noexcept = 0;
+    [[nodiscard]] virtual Timing   GetLastFrameTiming() const noexcept = 0;
     [[nodiscard]] virtual uint32_t GetFramesPerSecond() const noexcept = 0;
+    [[nodiscard]] virtual FrameStatistics GetFrameStatistics(double frame_budget_msec) const noexcept = 0;
 
     virtual ~IFpsCounter() = default;
 };
@@ -0,0 +1,149 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/LogHistogram.hpp
+Fixed-size histogram with logarithmic buckets of integer values subdivided linearly
+in the style of HDR histogram, which supports values removal for sliding windows.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+namespace Methane::Data
+{
+
+class LogHistogram
+{
+public:
+    static constexpr uint32_t sub_bucket_bits      = 4U;  // 16 linear sub-buckets per power of 2 give 1/16 relative precision
+    static constexpr uint32_t value_bits           = 28U;
+    static constexpr uint32_t sub_buckets_count    = 1U << sub_bucket_bits;
+    static constexpr uint32_t buckets_count        = sub_buckets_count * (value_bits - sub_bucket_bits + 1U);
+    static constexpr uint32_t max_value            = (1U << value_bits) - 1U;
+
+    [[nodiscard]] static constexpr uint32_t GetBucketIndex(uint32_t value) noexcept
+    {
+        value = std::min(value, max_value);
+        if (value < sub_buckets_count)
+            return value;
+
+        uint32_t exponent = sub_bucket_bits;
+        while ((value >> (exponent + 1U)) != 0U)
+            exponent++;
+
+        const uint32_t shift = exponent - sub_bucket_bits;
+        return sub_buckets_count * (shift + 1U) + ((value >> shift) & (sub_buckets_count - 1U));
+    }
+
+    [[nodiscard]] static constexpr uint32_t GetBucketLowValue(uint32_t bucket_index) noexcept
+    {
+        if (bucket_index < sub_buckets_count)
+            return bucket_index;
+
+        const uint32_t shift = bucket_index / sub_buckets_count - 1U;
+        return (sub_buckets_count + bucket_index % sub_buckets_count) << shift;
+    }
+
+    [[nodiscard]] static constexpr uint32_t GetBucketWidth(uint32_t bucket_index) noexcept
+    {
+        return bucket_index < sub_buckets_count ? 1U : 1U << (bucket_index / sub_buckets_count - 1U);
+    }
+
+    // Bucket middle value is used as the representative of all values in a bucket
+    [[nodiscard]] static constexpr uint32_t GetBucketMiddleValue(uint32_t bucket_index) noexcept
+    {
+        return GetBucketLowValue(bucket_index) + GetBucketWidth(bucket_index) / 2U;
+    }
+
+    [[nodiscard]] uint32_t GetCount() const noexcept { return m_count; }
+    [[nodiscard]] uint32_t GetBucketCount(uint32_t bucket_index) const noexcept { return m_bucket_counts[bucket_index]; }
+
+    void Add(uint32_t value) noexcept
+    {
+        m_bucket_counts[GetBucketIndex(value)]++;
+        m_count++;
+    }
+
+    // Value must have been added to histogram before
+    void Remove(uint32_t value) noexcept
+    {
+        uint32_t& bucket_count = m_bucket_counts[GetBucketIndex(value)];
+        if (!bucket_count)
+            return;
+
+        bucket_count--;
+        m_count--;
+    }
+
+    void Clear() noexcept
+    {
+        m_bucket_counts.fill(0U);
+        m_count = 0U;
+    }
+
+    // Returns value with nearest rank percentile in range [0, 100]
+    [[nodiscard]] uint32_t GetValueAtPercentile(double percentile) const noexcept
+    {
+        META_FUNCTION_TASK();
+        if (!m_count)
+            return 0U;
+
+        const double   clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+        const uint32_t rank = std::max(1U, static_cast<uint32_t>(std::ceil(clamped_percentile * m_count / 100.0)));
+        uint32_t accumulated_count = 0U;
+        for(uint32_t bucket_index = 0U; bucket_index < buckets_count; ++bucket_index)
+        {
+            accumulated_count += m_bucket_counts[bucket_index];
+            if (accumulated_count >= rank)
+                return GetBucketMiddleValue(bucket_index);
+        }
+        return max_value;
+    }
+
+    // Returns mean of the given count of highest values, used for "1% lows" metrics
+    [[nodiscard]] double GetHighestValuesMean(uint32_t values_count) const noexcept
+    {
+        META_FUNCTION_TASK();
+        values_count = std::min(values_count, m_count);
+        if (!values_count)
+            return 0.0;
+
+        uint32_t remaining_count = values_count;
+        double   values_sum = 0.0;
+        for(uint32_t bucket_index = buckets_count; bucket_index > 0U && remaining_count; --bucket_index)
+        {
+            const uint32_t bucket_values_count = std::min(m_bucket_counts[bucket_index - 1U], remaining_count);
+            values_sum      += static_cast<double>(bucket_values_count) * GetBucketMiddleValue(bucket_index - 1U);
+            remaining_count -= bucket_values_count;
+        }
+        return values_sum / values_count;
+    }
+
+private:
+    std::array<uint32_t, buckets_count> m_bucket_counts{ };
+    uint32_t                            m_count = 0U;
+};
+
+} // namespace Methane::Data
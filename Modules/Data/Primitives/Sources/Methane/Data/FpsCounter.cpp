@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/FpsCounter.cpp
-FPS counter calculates frame time duration with moving average window algorithm.
+FPS counter calculates frame time duration with moving average window algorithm
+and frame time percentile statistics over the same window using log histograms.
 
 ******************************************************************************/
 
@@ -25,24 +26,58 @@ FPS counter calculates frame time duration with moving average window algorithm.
 
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace Methane::Data
 {
 
-FpsCounter::FpsCounter(uint32_t averaged_timings_count) noexcept
-    : m_averaged_timings_count(averaged_timings_count)
+static constexpr uint32_t g_default_averaged_timings_count = 100U;
+
+[[nodiscard]]
+static uint32_t ConvertToMicroseconds(double time_sec) noexcept
+{
+    const double time_usec = std::round(std::max(0.0, time_sec) * 1000000.0);
+    return time_usec < static_cast<double>(LogHistogram::max_value)
+         ? static_cast<uint32_t>(time_usec)
+         : LogHistogram::max_value;
+}
+
+[[nodiscard]]
+static FrameTimePercentiles GetPercentiles(const LogHistogram& histogram, double max_time_sec) noexcept
+{
+    // Histogram bucket values are clamped to the exact maximum to keep percentiles ordered
+    const double max_msec = max_time_sec * 1000.0;
+    const auto get_percentile_msec = [&histogram, max_msec](double percentile)
+    {
+        return std::min(static_cast<double>(histogram.GetValueAtPercentile(percentile)) / 1000.0, max_msec);
+    };
+    return FrameTimePercentiles{
+        get_percentile_msec(50.0),
+        get_percentile_msec(95.0),
+        get_percentile_msec(99.0),
+        max_msec
+    };
+}
+
+FpsCounter::FpsCounter()
+    : FpsCounter(g_default_averaged_timings_count)
 { }
 
-void FpsCounter::Reset(uint32_t averaged_timings_count) noexcept
+FpsCounter::FpsCounter(uint32_t averaged_timings_count)
+    : m_frame_timings(std::max(averaged_timings_count, 1U))
+{ }
+
+void FpsCounter::Reset(uint32_t averaged_timings_count)
 {
     META_FUNCTION_TASK();
-    m_averaged_timings_count = averaged_timings_count;
-    while (!m_frame_timings.empty())
-    {
-        m_frame_timings.pop();
-    }
+    // Ring buffer is reallocated only when its capacity is changed
+    m_frame_timings.assign(std::max(averaged_timings_count, 1U), Timing());
+    m_frame_timings_begin = 0U;
+    m_frame_timings_count = 0U;
     m_frame_timings_sum = Timing();
+    m_frame_time_histogram.Clear();
+    m_cpu_time_histogram.Clear();
     m_present_on_gpu_wait_time_sec = 0.0;
     m_frame_timer.Reset();
     m_present_timer.Reset();
@@ -69,7 +104,7 @@ void FpsCounter::OnGpuFramePresented() noexcept
 uint32_t FpsCounter::GetAveragedTimingsCount() const noexcept
 {
     META_FUNCTION_TASK();
-    return static_cast<uint32_t>(m_frame_timings.size());
+    return m_frame_timings_count;
 }
 
 FpsCounter::Timing FpsCounter::GetAverageFrameTiming() const noexcept
@@ -79,6 +114,16 @@ FpsCounter::Timing FpsCounter::GetAverageFrameTiming() const noexcept
     return averaged_timings_count ? m_frame_timings_sum / averaged_timings_count : Timing();
 }
 
+FpsCounter::Timing FpsCounter::GetLastFrameTiming() const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_timings_count)
+        return Timing();
+
+    const auto frame_timings_capacity = static_cast<uint32_t>(m_frame_timings.size());
+    return m_frame_timings[(m_frame_timings_begin + m_frame_timings_count - 1U) % frame_timings_capacity];
+}
+
 uint32_t FpsCounter::GetFramesPerSecond() const noexcept
 {
     META_FUNCTION_TASK();
@@ -86,22 +131,81 @@ uint32_t FpsCounter::GetFramesPerSecond() const noexcept
     return average_frame_time_sec > 0.0 ? static_cast<uint32_t>(std::round(1.0 / average_frame_time_sec)) : 0U;
 }
 
-void FpsCounter::OnCpuFramePresented() noexcept
+FrameStatistics FpsCounter::GetFrameStatistics(double frame_budget_msec) const noexcept
 {
     META_FUNCTION_TASK();
-    if (m_frame_timings.size() >= m_averaged_timings_count)
+    FrameStatistics statistics;
+    statistics.frames_count = m_frame_timings_count;
+    if (!m_frame_timings_count)
+        return statistics;
+
+    // Maximums and over budget frames are counted exactly from the timings window
+    const auto frame_timings_capacity = static_cast<uint32_t>(m_frame_timings.size());
+    double max_frame_time_sec = 0.0;
+    double max_cpu_time_sec   = 0.0;
+    for(uint32_t timing_index = 0U; timing_index < m_frame_timings_count; ++timing_index)
     {
-        m_frame_timings_sum -= m_frame_timings.front();
-        m_frame_timings.pop();
+        const Timing& frame_timing = m_frame_timings[(m_frame_timings_begin + timing_index) % frame_timings_capacity];
+        max_frame_time_sec = std::max(max_frame_time_sec, frame_timing.GetTotalTimeSec());
+        max_cpu_time_sec   = std::max(max_cpu_time_sec, frame_timing.GetCpuTimeSec());
+        if (frame_timing.GetTotalTimeMSec() > frame_budget_msec)
+            statistics.over_budget_frames_count++;
     }
 
-    const Timing frame_timing(m_frame_timer.GetElapsedSecondsD(),
-                              m_present_timer.GetElapsedSecondsD(),
-                              m_present_on_gpu_wait_time_sec);
+    statistics.frame_time = GetPercentiles(m_frame_time_histogram, max_frame_time_sec);
+    statistics.cpu_time   = GetPercentiles(m_cpu_time_histogram, max_cpu_time_sec);
 
-    m_frame_timings_sum += frame_timing;
-    m_frame_timings.push(frame_timing);
+    const uint32_t lowest_frames_count = (m_frame_timings_count + 99U) / 100U;
+    const double   lowest_frames_mean_time_usec = m_frame_time_histogram.GetHighestValuesMean(lowest_frames_count);
+    statistics.one_percent_low_fps = lowest_frames_mean_time_usec > 0.0 ? 1000000.0 / lowest_frames_mean_time_usec : 0.0;
+    return statistics;
+}
+
+void FpsCounter::OnCpuFramePresented() noexcept
+{
+    META_FUNCTION_TASK();
+    AddFrameTiming(Timing(m_frame_timer.GetElapsedSecondsD(),
+                          m_present_timer.GetElapsedSecondsD(),
+                          m_present_on_gpu_wait_time_sec));
     m_frame_timer.Reset();
 }
 
+void FpsCounter::AddFrameTiming(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    const auto frame_timings_capacity = static_cast<uint32_t>(m_frame_timings.size());
+    Timing* frame_timing_ptr = nullptr;
+    if (m_frame_timings_count >= frame_timings_capacity)
+    {
+        // Oldest timing is overwritten by the new timing in the ring buffer
+        frame_timing_ptr = &m_frame_timings[m_frame_timings_begin];
+        m_frame_timings_sum -= *frame_timing_ptr;
+        RemoveTimingFromHistograms(*frame_timing_ptr);
+        m_frame_timings_begin = (m_frame_timings_begin + 1U) % frame_timings_capacity;
+    }
+    else
+    {
+        frame_timing_ptr = &m_frame_timings[(m_frame_timings_begin + m_frame_timings_count) % frame_timings_capacity];
+        m_frame_timings_count++;
+    }
+
+    *frame_timing_ptr = frame_timing;
+    m_frame_timings_sum += frame_timing;
+    AddTimingToHistograms(frame_timing);
+}
+
+void FpsCounter::AddTimingToHistograms(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_time_histogram.Add(ConvertToMicroseconds(frame_timing.GetTotalTimeSec()));
+    m_cpu_time_histogram.Add(ConvertToMicroseconds(frame_timing.GetCpuTimeSec()));
+}
+
+void FpsCounter::RemoveTimingFromHistograms(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_time_histogram.Remove(ConvertToMicroseconds(frame_timing.GetTotalTimeSec()));
+    m_cpu_time_histogram.Remove(ConvertToMicroseconds(frame_timing.GetCpuTimeSec()));
+}
+
 } // namespace Methane::Graphics::Base
@@ -25,6 +25,7 @@ Base implementation of the Methane graphics application.
 
 #include "IApp.h"
 #include "CombinedAppSettings.h"
+#include "AppBenchmark.h"
 
 #include <Methane/Data/IProvider.h>
 #include <Methane/Data/AnimationsPool.h>
@@ -36,8 +37,11 @@ Base implementation of the Methane graphics application.
 #include <Methane/Graphics/RHI/RenderPattern.h>
 #include <Methane/Graphics/RHI/ViewState.h>
 #include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Memory.hpp>
 #include <Methane/Checks.hpp>
 
+#include <string>
+
 namespace Methane::Graphics
 {
 
@@ -92,6 +96,7 @@ protected:
 
     void UpdateWindowTitle();
     void CompleteInitialization() const;
+    bool IsBenchmarkCompleted() const noexcept { return m_benchmark_ptr && m_benchmark_ptr->IsCompleted(); }
     void WaitForRenderComplete() const;
 
     // Platform::AppBase interface
@@ -113,6 +118,9 @@ protected:
     Data::AnimationsPool&             GetAnimations() noexcept                    { return m_animations; }
 
 private:
+    bool UpdateBenchmark();
+    std::string GetGpuDebugGroupTimingsReport() const;
+
     Graphics::IApp::Settings   m_settings;
     Rhi::RenderContextSettings m_initial_context_settings;
     Rhi::RenderPatternSettings m_screen_pass_pattern_settings;
@@ -124,6 +132,10 @@ private:
     Rhi::RenderPattern         m_screen_render_pattern;
     Rhi::ViewState             m_view_state;
     bool                       m_restore_animations_enabled = true;
+    uint32_t                   m_benchmark_frames_count = 0U;
+    double                     m_benchmark_fps = 60.0;
+    std::string                m_benchmark_report_path = "benchmark_report.json";
+    UniquePtr<AppBenchmark>    m_benchmark_ptr;
 };
 
 } // namespace Methane::Graphics
\ No newline at end of file
@@ -0,0 +1,130 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/AppBenchmark.h
+Benchmark of the graphics application frames rendered with fixed time step,
+which measures per-frame CPU timings and heap allocations and writes them to JSON report.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Timer.hpp>
+#include <Methane/AllocationStatistics.h>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+class AppBenchmark
+{
+public:
+    struct FrameTiming
+    {
+        double update_msec       = 0.0;
+        double present_wait_msec = 0.0;
+        double render_msec       = 0.0;
+
+        // Heap allocations of all threads during frame are counted only when allocation statistics are enabled
+        uint64_t allocations_count = 0U;
+        uint64_t allocated_bytes   = 0U;
+
+        [[nodiscard]] double GetTotalMSec() const noexcept { return update_msec + present_wait_msec + render_msec; }
+    };
+
+    using FrameTimings = std::vector<FrameTiming>;
+
+    struct TimingStatistics
+    {
+        double mean_msec = 0.0;
+        double min_msec  = 0.0;
+        double max_msec  = 0.0;
+        double p50_msec  = 0.0;
+        double p90_msec  = 0.0;
+        double p95_msec  = 0.0;
+        double p99_msec  = 0.0;
+    };
+
+    struct ReportInfo
+    {
+        std::string_view app_name;
+        std::string_view graphics_api_name;
+        std::string_view adapter_name;
+        double           time_to_first_frame_msec = 0.0; // written to report only when measured in headless mode
+        std::string_view gpu_debug_group_timings;        // written to report only when GPU debug group timings are enabled
+    };
+
+    // Virtual time of animations is enabled while benchmark exists, other timers keep measuring clock time
+    AppBenchmark(uint32_t frames_count, double time_step_sec);
+    ~AppBenchmark();
+
+    AppBenchmark(const AppBenchmark&) = delete;
+    AppBenchmark(AppBenchmark&&) = delete;
+
+    AppBenchmark& operator=(const AppBenchmark&) = delete;
+    AppBenchmark& operator=(AppBenchmark&&) = delete;
+
+    // Frame is measured in three consecutive intervals: update from frame begin till present wait,
+    // wait for previous frame present and render commands encoding with present till the next frame begin.
+    // Virtual time is advanced by fixed time step on every frame begin.
+    void BeginFrame();
+    void BeginPresentWait();
+    void EndPresentWait();
+
+    [[nodiscard]] bool                IsCompleted() const noexcept      { return m_frame_timings.size() >= m_frames_count; }
+    [[nodiscard]] uint32_t            GetFramesCount() const noexcept   { return m_frames_count; }
+    [[nodiscard]] double              GetTimeStepSec() const noexcept   { return m_time_step_sec; }
+    [[nodiscard]] const FrameTimings& GetFrameTimings() const noexcept  { return m_frame_timings; }
+    [[nodiscard]] const AllocationStatistics::TagCounters& GetTagAllocations() const noexcept { return m_tag_allocations; }
+
+    // Percentiles are calculated with nearest-rank method, statistics of empty timings are zero
+    [[nodiscard]] static TimingStatistics GetTimingStatistics(std::vector<double> timings_msec);
+
+    [[nodiscard]] std::string GetReport(const ReportInfo& info) const;
+    void WriteReport(const std::string& file_path, const ReportInfo& info) const;
+
+private:
+    using Clock     = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
+    enum class FrameStage
+    {
+        None,
+        Update,
+        PresentWait,
+        Render
+    };
+
+    double GetStageElapsedMSec(TimePoint stage_end_time) const noexcept;
+
+    const uint32_t                    m_frames_count;
+    const double                      m_time_step_sec;
+    const Timer::TimeDuration         m_time_step;
+    FrameTimings                      m_frame_timings;
+    FrameTiming                       m_current_frame_timing;
+    FrameStage                        m_frame_stage = FrameStage::None;
+    TimePoint                         m_stage_start_time;
+    AllocationStatistics::TagCounters m_frame_begin_allocations{};
+    AllocationStatistics::TagCounters m_tag_allocations{};
+};
+
+} // namespace Methane::Graphics
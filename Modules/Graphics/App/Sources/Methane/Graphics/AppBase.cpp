@@ -26,6 +26,8 @@ Base implementation of the Methane graphics application.
 #include <Methane/Graphics/AppContextController.h>
 #include <Methane/Graphics/RHI/System.h>
 #include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Data/IProvider.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -56,6 +58,9 @@ AppBase::AppBase(const CombinedAppSettings& settings, Data::IProvider& textures_
     add_option("-d,--device", m_settings.default_device_index, "Render at adapter index, use -1 for software adapter");
     add_option("-v,--vsync", m_initial_context_settings.vsync_enabled, "Vertical synchronization");
     add_option("-b,--frame-buffers", m_initial_context_settings.frame_buffers_count, "Frame buffers count in swap-chain");
+    add_option("--benchmark", m_benchmark_frames_count, "Render given number of frames with fixed time step, write frame timings report and exit");
+    add_option("--benchmark-fps", m_benchmark_fps, "Frames per second of the fixed time step used for animations in benchmark mode");
+    add_option("--benchmark-report", m_benchmark_report_path, "Benchmark report JSON file path");
 
 #ifdef _WIN32
     add_flag("-e,--emulated-render-pass",
@@ -97,6 +102,17 @@ void AppBase::InitContext(const Platform::AppEnvironment& env, const FrameSize&
     META_FUNCTION_TASK();
     META_LOG("\n====================== CONTEXT INITIALIZATION ======================");
 
+    if (m_benchmark_frames_count)
+    {
+        // Virtual time is enabled before application initialization, so that all animations are started in virtual time
+        META_CHECK_ARG_GREATER_DESCR(m_benchmark_fps, 0.0, "benchmark FPS should be positive");
+        m_benchmark_ptr = std::make_unique<AppBenchmark>(m_benchmark_frames_count, 1.0 / m_benchmark_fps);
+
+        // One more frame is required in headless mode to complete render timing of the last benchmark frame
+        if (IsHeadless())
+            SetHeadlessFramesCount(m_benchmark_frames_count + 1U);
+    }
+
     // Get default device for rendering
     Rhi::System::Get().UpdateGpuDevices(env, m_settings.device_capabilities);
     const Rhi::Device device = GetDefaultDevice();
@@ -216,6 +232,9 @@ bool AppBase::Update()
     if (Platform::App::IsMinimized())
         return false;
 
+    if (m_benchmark_ptr && !UpdateBenchmark())
+        return false;
+
     META_LOG("\n========================== FRAME {} UPDATING =========================",
              m_context.IsInitialized() ? m_context.GetFrameIndex() : 0U);
 
@@ -229,13 +248,19 @@ bool AppBase::Update()
         m_title_update_timer.Reset();
     }
 
-    GetAnimations().Update();
+    {
+        META_ALLOCATION_TAG_SCOPE("Data");
+        GetAnimations().Update();
+    }
     return true;
 }
 
 bool AppBase::Render()
 {
     META_FUNCTION_TASK();
+    if (IsBenchmarkCompleted())
+        return false;
+
     if (Platform::App::IsMinimized())
     {
         // No need to render frames while window is minimized.
@@ -251,7 +276,14 @@ bool AppBase::Render()
     META_LOG("\n========================= FRAME {} RENDERING =========================", m_context.GetFrameIndex());
 
     // Wait for previous frame rendering is completed and switch to next frame
+    if (m_benchmark_ptr)
+        m_benchmark_ptr->BeginPresentWait();
+
     m_context.WaitForGpu(Rhi::IContext::WaitFor::FramePresented);
+
+    if (m_benchmark_ptr)
+        m_benchmark_ptr->EndPresentWait();
+
     return true;
 }
 
@@ -388,6 +420,66 @@ void AppBase::WaitForRenderComplete() const
     }
 }
 
+bool AppBase::UpdateBenchmark()
+{
+    META_FUNCTION_TASK();
+    if (m_benchmark_ptr->IsCompleted())
+        return false;
+
+    m_benchmark_ptr->BeginFrame();
+    if (!m_benchmark_ptr->IsCompleted())
+        return true;
+
+    const std::string adapter_name(m_context.GetDevice().GetAdapterName());
+    const std::string gpu_debug_group_timings = GetGpuDebugGroupTimingsReport();
+    m_benchmark_ptr->WriteReport(m_benchmark_report_path, AppBenchmark::ReportInfo{
+        GetPlatformAppSettings().name,
+        magic_enum::enum_name(Rhi::ISystem::GetNativeApi()),
+        adapter_name,
+        GetTimeToFirstFrameMSec(),
+        gpu_debug_group_timings
+    });
+
+    // Message box is not shown in window mode to let benchmark run unattended
+    if (IsHeadless())
+    {
+        Alert({
+            Message::Type::Information,
+            "Benchmark Completed",
+            fmt::format("Timings of {} frames were written to report file '{}'", m_benchmark_frames_count, m_benchmark_report_path)
+        }, true);
+    }
+
+    Close();
+    return false;
+}
+
+// Debug group timings of the render queue are aggregated per frame buffer,
+// so the report contains timings of the last frame rendered to each frame buffer
+std::string AppBase::GetGpuDebugGroupTimingsReport() const
+{
+    META_FUNCTION_TASK();
+    if (!m_context.GetOptions().HasBit(Rhi::ContextOption::GpuDebugGroupTimings))
+        return {};
+
+    m_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+    const Rhi::CommandQueue render_cmd_queue = m_context.GetRenderCommandKit().GetQueue();
+    std::string timings_report;
+    for(uint32_t frame_buffer_index = 0U; frame_buffer_index < m_context.GetSettings().frame_buffers_count; ++frame_buffer_index)
+    {
+        timings_report += fmt::format("\nFrame buffer {}:", frame_buffer_index);
+        timings_report += static_cast<std::string>(render_cmd_queue.GetDebugGroupTiming(frame_buffer_index));
+    }
+
+    // GPU timings are logged along with aggregated CPU timings of the scope timers
+    if (const Ptr<ILogger>& scope_timers_logger_ptr = ScopeTimer::Aggregator::Get().GetLogger();
+        scope_timers_logger_ptr)
+    {
+        scope_timers_logger_ptr->Log(timings_report);
+    }
+    return timings_report;
+}
+
 void AppBase::OnContextReleased(Rhi::IContext&)
 {
     META_FUNCTION_TASK();
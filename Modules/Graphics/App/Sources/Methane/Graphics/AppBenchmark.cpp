@@ -0,0 +1,269 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/AppBenchmark.cpp
+Benchmark of the graphics application frames rendered with fixed time step,
+which measures per-frame CPU timings and heap allocations and writes them to JSON report.
+
+******************************************************************************/
+
+#include <Methane/Graphics/AppBenchmark.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <iterator>
+#include <fstream>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+using FrameTimingGetter = double(*)(const AppBenchmark::FrameTiming&);
+
+static std::string EscapeJsonString(std::string_view str)
+{
+    std::string escaped_str;
+    escaped_str.reserve(str.size());
+    for(const char c : str)
+    {
+        if (c == '\n')
+        {
+            escaped_str += "\\n";
+            continue;
+        }
+        if (c == '"' || c == '\\')
+            escaped_str += '\\';
+        escaped_str += c;
+    }
+    return escaped_str;
+}
+
+// Nearest-rank percentile of sorted values
+static double GetPercentile(const std::vector<double>& sorted_values, double percentile)
+{
+    META_FUNCTION_TASK();
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted_values.size())));
+    return sorted_values[std::clamp<size_t>(rank, 1U, sorted_values.size()) - 1U];
+}
+
+static std::string GetTimingStatisticsJson(const AppBenchmark::FrameTimings& frame_timings, FrameTimingGetter get_timing)
+{
+    META_FUNCTION_TASK();
+    if (frame_timings.empty())
+        return "{}";
+
+    std::vector<double> timings_msec;
+    timings_msec.reserve(frame_timings.size());
+    std::transform(frame_timings.begin(), frame_timings.end(), std::back_inserter(timings_msec), get_timing);
+
+    const AppBenchmark::TimingStatistics statistics = AppBenchmark::GetTimingStatistics(std::move(timings_msec));
+    return fmt::format(R"({{ "mean": {:.4f}, "min": {:.4f}, "max": {:.4f}, "p50": {:.4f}, "p90": {:.4f}, "p95": {:.4f}, "p99": {:.4f} }})",
+                       statistics.mean_msec, statistics.min_msec, statistics.max_msec,
+                       statistics.p50_msec, statistics.p90_msec, statistics.p95_msec, statistics.p99_msec);
+}
+
+static std::string GetAllocationStatisticsJson(const AllocationStatistics::TagCounters& tag_allocations, size_t frames_count)
+{
+    META_FUNCTION_TASK();
+    std::string json = "{";
+    const auto frames_count_d = static_cast<double>(std::max<size_t>(frames_count, 1U));
+    for(size_t tag_index = 0U; tag_index < AllocationStatistics::GetTagsCount(); ++tag_index)
+    {
+        const AllocationStatistics::Counters& counters = tag_allocations[tag_index];
+        json += fmt::format(R"({} "{}": {{ "count": {:.2f}, "bytes": {:.2f} }})",
+                            tag_index ? "," : "", AllocationStatistics::GetTagName(static_cast<AllocationStatistics::TagId>(tag_index)),
+                            static_cast<double>(counters.allocations_count) / frames_count_d,
+                            static_cast<double>(counters.allocated_bytes) / frames_count_d);
+    }
+    json += " }";
+    return json;
+}
+
+AppBenchmark::AppBenchmark(uint32_t frames_count, double time_step_sec)
+    : m_frames_count(frames_count)
+    , m_time_step_sec(time_step_sec)
+    , m_time_step(std::chrono::duration_cast<Timer::TimeDuration>(std::chrono::duration<double>(time_step_sec)))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(frames_count, "benchmark frames count should be positive");
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(time_step_sec, 0.0, "benchmark time step can not be negative");
+    m_frame_timings.reserve(frames_count);
+    Timer::EnableVirtualTime();
+}
+
+AppBenchmark::~AppBenchmark()
+{
+    META_FUNCTION_TASK();
+    Timer::DisableVirtualTime();
+}
+
+void AppBenchmark::BeginFrame()
+{
+    META_FUNCTION_TASK();
+    const TimePoint frame_begin_time = Clock::now();
+
+    // Frames which were not rendered, are not measured
+    if (m_frame_stage == FrameStage::Render)
+    {
+        m_current_frame_timing.render_msec = GetStageElapsedMSec(frame_begin_time);
+        if constexpr (AllocationStatistics::IsTrackingEnabled())
+        {
+            const AllocationStatistics::TagCounters frame_allocations = AllocationStatistics::GetTotalCounters() - m_frame_begin_allocations;
+            const AllocationStatistics::Counters frame_allocations_sum = frame_allocations.GetSum();
+            m_current_frame_timing.allocations_count = frame_allocations_sum.allocations_count;
+            m_current_frame_timing.allocated_bytes   = frame_allocations_sum.allocated_bytes;
+            m_tag_allocations += frame_allocations;
+        }
+        m_frame_timings.push_back(m_current_frame_timing);
+    }
+
+    m_current_frame_timing = FrameTiming{};
+    if (IsCompleted())
+    {
+        m_frame_stage = FrameStage::None;
+        return;
+    }
+
+    Timer::AdvanceVirtualTime(m_time_step);
+    m_frame_stage      = FrameStage::Update;
+    m_stage_start_time = frame_begin_time;
+
+    if constexpr (AllocationStatistics::IsTrackingEnabled())
+    {
+        m_frame_begin_allocations = AllocationStatistics::GetTotalCounters();
+    }
+}
+
+void AppBenchmark::BeginPresentWait()
+{
+    META_FUNCTION_TASK();
+    if (m_frame_stage != FrameStage::Update)
+        return;
+
+    const TimePoint present_wait_begin_time = Clock::now();
+    m_current_frame_timing.update_msec = GetStageElapsedMSec(present_wait_begin_time);
+    m_frame_stage      = FrameStage::PresentWait;
+    m_stage_start_time = present_wait_begin_time;
+}
+
+void AppBenchmark::EndPresentWait()
+{
+    META_FUNCTION_TASK();
+    if (m_frame_stage != FrameStage::PresentWait)
+        return;
+
+    const TimePoint present_wait_end_time = Clock::now();
+    m_current_frame_timing.present_wait_msec = GetStageElapsedMSec(present_wait_end_time);
+    m_frame_stage      = FrameStage::Render;
+    m_stage_start_time = present_wait_end_time;
+}
+
+AppBenchmark::TimingStatistics AppBenchmark::GetTimingStatistics(std::vector<double> timings_msec)
+{
+    META_FUNCTION_TASK();
+    if (timings_msec.empty())
+        return TimingStatistics{};
+
+    std::sort(timings_msec.begin(), timings_msec.end());
+
+    double timings_sum = 0.0;
+    for(const double timing_msec : timings_msec)
+        timings_sum += timing_msec;
+
+    return TimingStatistics{
+        timings_sum / static_cast<double>(timings_msec.size()),
+        timings_msec.front(),
+        timings_msec.back(),
+        GetPercentile(timings_msec, 50.0),
+        GetPercentile(timings_msec, 90.0),
+        GetPercentile(timings_msec, 95.0),
+        GetPercentile(timings_msec, 99.0)
+    };
+}
+
+std::string AppBenchmark::GetReport(const ReportInfo& info) const
+{
+    META_FUNCTION_TASK();
+    std::string report = fmt::format(
+        "{{\n"
+        "  \"application\": \"{}\",\n"
+        "  \"graphics_api\": \"{}\",\n"
+        "  \"adapter\": \"{}\",\n"
+        "  \"frames_count\": {},\n"
+        "  \"time_step_sec\": {:.6f},\n"
+        "  \"summary\": {{\n"
+        "    \"update_msec\": {},\n"
+        "    \"present_wait_msec\": {},\n"
+        "    \"render_msec\": {},\n"
+        "    \"total_msec\": {}\n"
+        "  }},\n",
+        EscapeJsonString(info.app_name), EscapeJsonString(info.graphics_api_name), EscapeJsonString(info.adapter_name),
+        m_frame_timings.size(), m_time_step_sec,
+        GetTimingStatisticsJson(m_frame_timings, [](const FrameTiming& timing) { return timing.update_msec; }),
+        GetTimingStatisticsJson(m_frame_timings, [](const FrameTiming& timing) { return timing.present_wait_msec; }),
+        GetTimingStatisticsJson(m_frame_timings, [](const FrameTiming& timing) { return timing.render_msec; }),
+        GetTimingStatisticsJson(m_frame_timings, [](const FrameTiming& timing) { return timing.GetTotalMSec(); }));
+
+    if (info.time_to_first_frame_msec > 0.0)
+    {
+        report += fmt::format("  \"time_to_first_frame_msec\": {:.4f},\n", info.time_to_first_frame_msec);
+    }
+
+    if (!info.gpu_debug_group_timings.empty())
+    {
+        report += fmt::format("  \"gpu_debug_group_timings\": \"{}\",\n", EscapeJsonString(info.gpu_debug_group_timings));
+    }
+
+    if constexpr (AllocationStatistics::IsTrackingEnabled())
+    {
+        report += fmt::format("  \"allocations_per_frame\": {},\n", GetAllocationStatisticsJson(m_tag_allocations, m_frame_timings.size()));
+    }
+
+    report += "  \"frames\": [";
+    for(size_t frame_index = 0U; frame_index < m_frame_timings.size(); ++frame_index)
+    {
+        const FrameTiming& timing = m_frame_timings[frame_index];
+        report += fmt::format(R"({}    {{ "update_msec": {:.4f}, "present_wait_msec": {:.4f}, "render_msec": {:.4f})",
+                              frame_index ? ",\n" : "\n", timing.update_msec, timing.present_wait_msec, timing.render_msec);
+        if constexpr (AllocationStatistics::IsTrackingEnabled())
+        {
+            report += fmt::format(R"(, "allocations": {}, "allocated_bytes": {})", timing.allocations_count, timing.allocated_bytes);
+        }
+        report += " }";
+    }
+
+    report += "\n  ]\n}\n";
+    return report;
+}
+
+void AppBenchmark::WriteReport(const std::string& file_path, const ReportInfo& info) const
+{
+    META_FUNCTION_TASK();
+    std::ofstream fs(file_path, std::ios::trunc);
+    META_CHECK_ARG_DESCR(file_path, fs.good(), "failed to open benchmark report file for writing");
+    fs << GetReport(info);
+}
+
+double AppBenchmark::GetStageElapsedMSec(TimePoint stage_end_time) const noexcept
+{
+    return std::chrono::duration<double, std::milli>(stage_end_time - m_stage_start_time).count();
+}
+
+} // namespace Methane::Graphics
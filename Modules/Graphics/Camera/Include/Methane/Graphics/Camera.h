@@ -24,6 +24,7 @@ Camera helper implementation allowing to generate view and projection matrices.
 #pragma once
 
 #include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/Frustum.hpp>
 
 #include <hlsl++_vector_float.h>
 #include <hlsl++_matrix_float.h>
@@ -78,6 +79,7 @@ public:
     const hlslpp::float4x4& GetViewMatrix() const noexcept;
     const hlslpp::float4x4& GetProjMatrix() const;
     const hlslpp::float4x4& GetViewProjMatrix() const noexcept;
+    Frustum GetFrustum() const noexcept { return Frustum(GetViewProjMatrix()); }
 
     hlslpp::float2 TransformScreenToProj(const Data::Point2I& screen_pos) const noexcept;
     hlslpp::float3 TransformScreenToView(const Data::Point2I& screen_pos) const noexcept;
@@ -87,6 +89,9 @@ public:
     hlslpp::float4 TransformWorldToView(const hlslpp::float4& world_pos) const noexcept { return TransformWorldToView(world_pos, m_current_orientation); }
     hlslpp::float4 TransformViewToWorld(const hlslpp::float4& view_pos)  const noexcept { return TransformViewToWorld(view_pos,  m_current_orientation); }
 
+    // Returns height in pixels of the bounding sphere projected to screen, used for level of detail selection
+    float GetProjectedScreenSize(const hlslpp::float3& world_center, float world_radius) const noexcept;
+
     std::string GetOrientationString() const;
 
 protected:
@@ -26,6 +26,8 @@ Camera helper implementation allowing to generate view and projection matrices.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <cmath>
+
 namespace Methane::Graphics
 {
 
@@ -187,6 +189,20 @@ float Camera::GetFovAngleY() const noexcept
     return fov_angle_y;
 }
 
+float Camera::GetProjectedScreenSize(const hlslpp::float3& world_center, float world_radius) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_projection == Projection::Orthogonal)
+        return 2.F * world_radius; // orthogonal projection frustum has the screen size, so one world unit is one pixel
+
+    const hlslpp::float3 look_direction = hlslpp::normalize(GetLookDirection());
+    const auto           view_depth     = static_cast<float>(hlslpp::dot(world_center - m_current_orientation.eye, look_direction));
+    if (view_depth <= world_radius)
+        return m_screen_size.GetHeight(); // camera is inside or in front of the bounding sphere
+
+    return world_radius / (view_depth * std::tan(GetFovAngleY() / 2.F)) * m_screen_size.GetHeight();
+}
+
 std::string Camera::GetOrientationString() const
 {
     return fmt::format("Camera orientation:\n  - eye: {}\n  - aim: {}\n  - up:  {}",
@@ -24,9 +24,14 @@ Base mesh implementation with customizable vertex types
 #pragma once
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Graphics/EdgeHashMap.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 namespace Methane::Graphics
 {
 
@@ -49,9 +54,60 @@ public:
     [[nodiscard]] Data::Size        GetVertexDataSize() const noexcept final { return static_cast<Data::Size>(m_vertices.size() * GetVertexSize()); }
     [[nodiscard]] Data::ConstRawPtr GetVertexData() const noexcept final     { return reinterpret_cast<Data::ConstRawPtr>(m_vertices.data()); } // NOSONAR
 
+    // Reorders indices for post-transform vertex cache and overdraw, then reorders vertices for fetch locality
+    MeshOptimizer::Statistics Optimize(const MeshOptimizer::Settings& settings = {})
+    {
+        META_FUNCTION_TASK();
+        return OptimizeRange(settings, 0U, Mesh::GetIndexCount(), 0U, GetVertexCount(), 0U);
+    }
+
 protected:
+    // Optimizes indices range referencing vertices range with indices values shifted by the index base
+    MeshOptimizer::Statistics OptimizeRange(const MeshOptimizer::Settings& settings,
+                                            Data::Index index_offset, Data::Size index_count,
+                                            Data::Index vertex_offset, Data::Size vertex_count,
+                                            Mesh::Index index_base)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_LESS_OR_EQUAL(index_offset + index_count, Mesh::GetIndexCount());
+        META_CHECK_ARG_LESS_OR_EQUAL(vertex_offset + vertex_count, GetVertexCount());
+
+        const Mesh::Indices& mesh_indices = Mesh::GetIndices();
+        Mesh::Indices indices;
+        indices.reserve(index_count);
+        std::transform(mesh_indices.begin() + index_offset, mesh_indices.begin() + index_offset + index_count,
+                       std::back_inserter(indices), [index_base](Mesh::Index index) { return index - index_base; });
+
+        MeshOptimizer::Statistics statistics;
+        statistics.before = MeshOptimizer::AnalyzeVertexCache(indices, vertex_count, settings.cache_size);
+
+        indices = MeshOptimizer::OptimizeVertexCache(indices, vertex_count);
+        if (settings.optimize_overdraw)
+        {
+            indices = MeshOptimizer::OptimizeOverdraw(indices, *this, vertex_offset, vertex_count);
+        }
+
+        if (settings.optimize_fetch)
+        {
+            const MeshOptimizer::VertexRemap vertex_remap = MeshOptimizer::OptimizeVertexFetch(indices, vertex_count);
+            const Vertices original_vertices(m_vertices.begin() + vertex_offset, m_vertices.begin() + vertex_offset + vertex_count);
+            for(Data::Index vertex_index = 0U; vertex_index < vertex_count; ++vertex_index)
+            {
+                m_vertices[vertex_offset + vertex_remap[vertex_index]] = original_vertices[vertex_index];
+            }
+        }
+
+        statistics.after = MeshOptimizer::AnalyzeVertexCache(indices, vertex_count, settings.cache_size);
+
+        for(Data::Index index = 0U; index < index_count; ++index)
+        {
+            Mesh::SetIndex(index_offset + index, indices[index] + index_base);
+        }
+        return statistics;
+    }
+
     template<typename FType>
-    [[nodiscard]] FType& GetVertexField(VType& vertex, VertexField field) noexcept
+    [[nodiscard]] FType& GetVertexField(VType& vertex, VertexField field) const noexcept
     {
         META_FUNCTION_TASK();
         const int32_t field_offset = GetVertexFieldOffset(field);
@@ -59,24 +115,36 @@ protected:
     }
 
     template<typename FType>
-    [[nodiscard]] const FType& GetVertexField(const VType& vertex, VertexField field) noexcept
+    [[nodiscard]] const FType& GetVertexField(const VType& vertex, VertexField field) const noexcept
     {
         META_FUNCTION_TASK();
         const int32_t field_offset = GetVertexFieldOffset(field);
         return *reinterpret_cast<const FType*>(reinterpret_cast<const std::byte*>(&vertex) + field_offset); // NOSONAR
     }
 
-    using EdgeMidpoints = std::map<Mesh::Edge, Mesh::Index>;
-    Index AddEdgeMidpoint(const Edge& edge, EdgeMidpoints& edge_midpoints)
+    // Runs function for each index in range [0, count) in parallel with executor, when it is provided, or serially otherwise
+    template<typename FuncType>
+    static void ForEachIndex(tf::Executor* parallel_executor_ptr, Data::Size count, const FuncType& func)
     {
         META_FUNCTION_TASK();
-        if (const auto edge_midpoint_it = edge_midpoints.find(edge);
-            edge_midpoint_it != edge_midpoints.end())
-            return edge_midpoint_it->second;
+        const auto for_each_index_in_range = [&func](Data::Index begin_index, Data::Index end_index)
+        {
+            for(Data::Index index = begin_index; index < end_index; ++index)
+            {
+                func(index);
+            }
+        };
+
+        if (parallel_executor_ptr)
+            ForEachIndexRangeParallel(*parallel_executor_ptr, count, for_each_index_in_range);
+        else
+            for_each_index_in_range(0U, count);
+    }
 
-        const VType& v1 = m_vertices[edge.first_index];
-        const VType& v2 = m_vertices[edge.second_index];
-        VType  v_mid{ };
+    [[nodiscard]] VType GetEdgeMidpointVertex(const VType& v1, const VType& v2) const
+    {
+        META_FUNCTION_TASK();
+        VType v_mid{ };
 
         const HlslPosition v1_position = GetVertexField<Mesh::Position>(v1, Mesh::VertexField::Position).AsHlsl();
         const HlslPosition v2_position = GetVertexField<Mesh::Position>(v2, Mesh::VertexField::Position).AsHlsl();
@@ -107,12 +175,11 @@ protected:
             v_mid_texcoord = Mesh::TexCoord((v1_texcoord + v2_texcoord) / 2.F);
         }
 
-        const auto v_mid_index = static_cast<Mesh::Index>(m_vertices.size());
-        edge_midpoints.try_emplace(edge, v_mid_index);
-        m_vertices.push_back(v_mid);
-        return v_mid_index;
+        return v_mid;
     }
 
+    using EdgeMidpoints = EdgeHashMap;
+
     void ComputeAverageNormals()
     {
         META_FUNCTION_TASK();
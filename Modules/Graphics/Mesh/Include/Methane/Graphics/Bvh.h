@@ -0,0 +1,176 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Bvh.h
+Bounding volume hierarchy built with surface area heuristic over primitive
+bounding boxes, used for ray picking and frustum culling of triangles and instances.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/BoundingBox.hpp>
+#include <Methane/Graphics/Frustum.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <array>
+#include <optional>
+#include <limits>
+
+namespace tf
+{
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+struct Ray
+{
+    hlslpp::float3 origin;
+    hlslpp::float3 direction;
+    float          max_distance = std::numeric_limits<float>::max(); // in units of direction vector length
+};
+
+class Bvh
+{
+public:
+    struct Settings
+    {
+        Data::Size max_leaf_size       = 4U;    // nodes with more primitives are always split
+        Data::Size bins_count          = 16U;   // bins per axis used for surface area heuristic evaluation
+        Data::Size parallel_build_size = 4096U; // nodes with less primitives are built serially in one task
+    };
+
+    struct Node
+    {
+        std::array<float, 3> bounds_min;
+        uint32_t             offset; // first child node index for inner node or first primitive offset for leaf node
+        std::array<float, 3> bounds_max;
+        uint32_t             count;  // primitives count for leaf node and zero for inner node
+
+        [[nodiscard]] bool IsLeaf() const noexcept { return count > 0U; }
+        [[nodiscard]] BoundingBox GetBounds() const noexcept
+        {
+            return BoundingBox(hlslpp::float3(bounds_min[0], bounds_min[1], bounds_min[2]),
+                               hlslpp::float3(bounds_max[0], bounds_max[1], bounds_max[2]));
+        }
+        void SetBounds(const BoundingBox& bounds) noexcept;
+    };
+
+    struct Hit
+    {
+        Data::Index primitive_index;
+        float       distance; // in units of ray direction vector length
+    };
+
+    using Nodes            = std::vector<Node>;
+    using PrimitiveBoxes   = std::vector<BoundingBox>;
+    using PrimitiveIndices = std::vector<Data::Index>;
+
+    static constexpr Data::Size max_depth = 64U;
+
+    Bvh() = default;
+    explicit Bvh(PrimitiveBoxes primitive_boxes, const Settings& settings = {}, tf::Executor* parallel_executor_ptr = nullptr);
+
+    // Updates node bounds for moved primitives keeping tree topology, which is faster than rebuild for animated instances
+    void Refit(PrimitiveBoxes primitive_boxes);
+
+    [[nodiscard]] bool                    IsEmpty() const noexcept             { return m_nodes.empty(); }
+    [[nodiscard]] const Nodes&            GetNodes() const noexcept            { return m_nodes; }
+    [[nodiscard]] const PrimitiveIndices& GetPrimitiveIndices() const noexcept { return m_primitive_indices; }
+    [[nodiscard]] const PrimitiveBoxes&   GetPrimitiveBoxes() const noexcept   { return m_primitive_boxes; }
+    [[nodiscard]] Data::Size              GetPrimitiveCount() const noexcept   { return static_cast<Data::Size>(m_primitive_boxes.size()); }
+    [[nodiscard]] BoundingBox             GetBounds() const noexcept           { return m_nodes.empty() ? BoundingBox() : m_nodes.front().GetBounds(); }
+    [[nodiscard]] Data::Size              GetDepth() const;
+
+    // Returns the closest primitive with bounding box hit by the ray
+    [[nodiscard]] std::optional<Hit> Intersect(const Ray& ray) const;
+
+    // Returns the closest primitive hit by the ray with primitive intersector function:
+    // std::optional<float> intersector(Data::Index primitive_index, const Ray& ray, float max_distance)
+    template<typename PrimitiveIntersectorType>
+    [[nodiscard]] std::optional<Hit> Intersect(const Ray& ray, const PrimitiveIntersectorType& intersect_primitive) const
+    {
+        META_FUNCTION_TASK();
+        if (m_nodes.empty())
+            return std::nullopt;
+
+        const hlslpp::float3 inverse_direction = hlslpp::float3(1.F) / ray.direction;
+        float max_distance = ray.max_distance;
+        if (!IntersectBox(m_nodes.front().GetBounds(), ray.origin, inverse_direction, max_distance))
+            return std::nullopt;
+
+        std::optional<Hit> closest_hit;
+        std::array<uint32_t, max_depth * 2> nodes_stack{ 0U };
+        size_t stack_size = 1U;
+        while (stack_size)
+        {
+            const Node& node = m_nodes[nodes_stack[--stack_size]];
+            if (node.IsLeaf())
+            {
+                for(uint32_t offset = node.offset; offset < node.offset + node.count; ++offset)
+                {
+                    const Data::Index primitive_index = m_primitive_indices[offset];
+                    const std::optional<float> distance = intersect_primitive(primitive_index, ray, max_distance);
+                    if (distance && *distance < max_distance)
+                    {
+                        max_distance = *distance;
+                        closest_hit  = Hit{ primitive_index, *distance };
+                    }
+                }
+                continue;
+            }
+
+            const std::optional<float> left_distance  = IntersectBox(m_nodes[node.offset].GetBounds(),     ray.origin, inverse_direction, max_distance);
+            const std::optional<float> right_distance = IntersectBox(m_nodes[node.offset + 1].GetBounds(), ray.origin, inverse_direction, max_distance);
+
+            // Closer child is pushed last to be traversed first, so that farther nodes can be rejected by the found hit distance
+            if (left_distance && right_distance && *left_distance < *right_distance)
+            {
+                nodes_stack[stack_size++] = node.offset + 1;
+                nodes_stack[stack_size++] = node.offset;
+            }
+            else
+            {
+                if (left_distance)
+                    nodes_stack[stack_size++] = node.offset;
+                if (right_distance)
+                    nodes_stack[stack_size++] = node.offset + 1;
+            }
+        }
+        return closest_hit;
+    }
+
+    // Appends indices of primitives with bounding boxes visible in frustum
+    void Query(const Frustum& frustum, PrimitiveIndices& visible_primitive_indices) const;
+    [[nodiscard]] PrimitiveIndices Query(const Frustum& frustum) const;
+
+    // Slab test of ray with precomputed inverse direction, returns entry distance clamped to zero
+    [[nodiscard]] static std::optional<float> IntersectBox(const BoundingBox& box, const hlslpp::float3& ray_origin,
+                                                           const hlslpp::float3& ray_inverse_direction, float max_distance) noexcept;
+
+private:
+    Nodes            m_nodes;
+    PrimitiveIndices m_primitive_indices;
+    PrimitiveBoxes   m_primitive_boxes;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,167 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/EdgeHashMap.hpp
+Open-addressing hash map from undirected mesh edge to vertex index,
+used for edge midpoints deduplication in mesh subdivision.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <optional>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+class EdgeHashMap
+{
+public:
+    using Key = uint64_t;
+
+    explicit EdgeHashMap(size_t expected_size = 0U)
+    {
+        META_FUNCTION_TASK();
+        Reserve(expected_size);
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept     { return m_size; }
+    [[nodiscard]] size_t GetCapacity() const noexcept { return m_entries.size(); }
+
+    void Reserve(size_t expected_size)
+    {
+        META_FUNCTION_TASK();
+        // Load factor is kept below 1/2 to make linear probing sequences short
+        size_t capacity = s_min_capacity;
+        while (capacity < expected_size * 2)
+            capacity *= 2;
+
+        if (capacity > m_entries.size())
+            Rehash(capacity);
+    }
+
+    // Returns value stored for the edge or inserts new value, second result is true when value was inserted
+    std::pair<Mesh::Index, bool> TryEmplace(Mesh::Index v1_index, Mesh::Index v2_index, Mesh::Index value)
+    {
+        META_FUNCTION_TASK();
+        if ((m_size + 1) * 2 > m_entries.size())
+            Rehash(std::max(m_entries.size() * 2, s_min_capacity));
+
+        const Key key = GetKey(v1_index, v2_index);
+        Entry& entry = FindEntry(m_entries, key);
+        if (entry.key == key)
+            return { entry.value, false };
+
+        entry.key   = key;
+        entry.value = value;
+        m_size++;
+        return { value, true };
+    }
+
+    [[nodiscard]] std::optional<Mesh::Index> Find(Mesh::Index v1_index, Mesh::Index v2_index) const
+    {
+        META_FUNCTION_TASK();
+        if (m_entries.empty())
+            return std::nullopt;
+
+        const Key key = GetKey(v1_index, v2_index);
+        const size_t mask = m_entries.size() - 1;
+        for(size_t entry_index = GetHash(key) & mask; ; entry_index = (entry_index + 1) & mask)
+        {
+            const Entry& entry = m_entries[entry_index];
+            if (entry.key == key)
+                return entry.value;
+            if (entry.key == s_empty_key)
+                return std::nullopt;
+        }
+    }
+
+    void Clear() noexcept
+    {
+        META_FUNCTION_TASK();
+        std::fill(m_entries.begin(), m_entries.end(), Entry{});
+        m_size = 0U;
+    }
+
+    // Edge key does not depend on the order of vertices
+    [[nodiscard]] static Key GetKey(Mesh::Index v1_index, Mesh::Index v2_index) noexcept
+    {
+        return v1_index < v2_index
+             ? (static_cast<Key>(v1_index) << 32U) | static_cast<Key>(v2_index)
+             : (static_cast<Key>(v2_index) << 32U) | static_cast<Key>(v1_index);
+    }
+
+private:
+    static constexpr Key    s_empty_key    = std::numeric_limits<Key>::max();
+    static constexpr size_t s_min_capacity = 64U;
+
+    struct Entry
+    {
+        Key         key   = s_empty_key;
+        Mesh::Index value = 0U;
+    };
+
+    using Entries = std::vector<Entry>;
+
+    // MurmurHash3 finalizer mixes both vertex indices into the lower bits used for bucket selection
+    [[nodiscard]] static size_t GetHash(Key key) noexcept
+    {
+        key ^= key >> 33U;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33U;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33U;
+        return static_cast<size_t>(key);
+    }
+
+    [[nodiscard]] static Entry& FindEntry(Entries& entries, Key key) noexcept
+    {
+        const size_t mask = entries.size() - 1;
+        size_t entry_index = GetHash(key) & mask;
+        while (entries[entry_index].key != key && entries[entry_index].key != s_empty_key)
+        {
+            entry_index = (entry_index + 1) & mask;
+        }
+        return entries[entry_index];
+    }
+
+    void Rehash(size_t capacity)
+    {
+        META_FUNCTION_TASK();
+        Entries entries(capacity);
+        for(const Entry& entry : m_entries)
+        {
+            if (entry.key != s_empty_key)
+                FindEntry(entries, entry.key) = entry;
+        }
+        m_entries.swap(entries);
+    }
+
+    Entries m_entries;
+    size_t  m_size = 0U;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,109 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrustumCulling.h
+Batch frustum culling of instance bounding spheres and boxes stored in
+structure of arrays layout, vectorized with 4-wide HLSL++ SIMD vectors.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Frustum.hpp>
+#include <Methane/Data/Types.h>
+
+#include <vector>
+
+namespace tf
+{
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+// Bounding spheres in structure of arrays layout, padded to the multiple of SIMD width
+class BoundingSpheres
+{
+public:
+    BoundingSpheres() = default;
+    explicit BoundingSpheres(Data::Size count) { Resize(count); }
+
+    void Resize(Data::Size count);
+    void Set(Data::Index index, const hlslpp::float3& center, float radius);
+
+    [[nodiscard]] Data::Size   GetCount() const noexcept   { return m_count; }
+    [[nodiscard]] const float* GetCentersX() const noexcept { return m_centers_x.data(); }
+    [[nodiscard]] const float* GetCentersY() const noexcept { return m_centers_y.data(); }
+    [[nodiscard]] const float* GetCentersZ() const noexcept { return m_centers_z.data(); }
+    [[nodiscard]] const float* GetRadiuses() const noexcept { return m_radiuses.data(); }
+
+private:
+    Data::Size         m_count = 0U;
+    std::vector<float> m_centers_x;
+    std::vector<float> m_centers_y;
+    std::vector<float> m_centers_z;
+    std::vector<float> m_radiuses;
+};
+
+// Axis-aligned bounding boxes in structure of arrays layout with centers and extents, padded to the multiple of SIMD width
+class BoundingBoxes
+{
+public:
+    BoundingBoxes() = default;
+    explicit BoundingBoxes(Data::Size count) { Resize(count); }
+
+    void Resize(Data::Size count);
+    void Set(Data::Index index, const BoundingBox& box);
+
+    [[nodiscard]] Data::Size   GetCount() const noexcept    { return m_count; }
+    [[nodiscard]] const float* GetCentersX() const noexcept { return m_centers_x.data(); }
+    [[nodiscard]] const float* GetCentersY() const noexcept { return m_centers_y.data(); }
+    [[nodiscard]] const float* GetCentersZ() const noexcept { return m_centers_z.data(); }
+    [[nodiscard]] const float* GetExtentsX() const noexcept { return m_extents_x.data(); }
+    [[nodiscard]] const float* GetExtentsY() const noexcept { return m_extents_y.data(); }
+    [[nodiscard]] const float* GetExtentsZ() const noexcept { return m_extents_z.data(); }
+
+private:
+    Data::Size         m_count = 0U;
+    std::vector<float> m_centers_x;
+    std::vector<float> m_centers_y;
+    std::vector<float> m_centers_z;
+    std::vector<float> m_extents_x;
+    std::vector<float> m_extents_y;
+    std::vector<float> m_extents_z;
+};
+
+namespace FrustumCulling
+{
+
+using VisibleIndices = std::vector<Data::Index>;
+
+constexpr Data::Size simd_width         = 4U;
+constexpr Data::Size default_chunk_size = 4096U; // volumes count culled in one parallel task
+
+// Replaces content of visible indices with the ascending indices of volumes intersecting the frustum,
+// volumes are culled by chunks in parallel when executor is provided
+void Cull(const Frustum& frustum, const BoundingSpheres& spheres, VisibleIndices& visible_indices,
+          tf::Executor* parallel_executor_ptr = nullptr, Data::Size chunk_size = default_chunk_size);
+void Cull(const Frustum& frustum, const BoundingBoxes& boxes, VisibleIndices& visible_indices,
+          tf::Executor* parallel_executor_ptr = nullptr, Data::Size chunk_size = default_chunk_size);
+
+} // namespace FrustumCulling
+
+} // namespace Methane::Graphics
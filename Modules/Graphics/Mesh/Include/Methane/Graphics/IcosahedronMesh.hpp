@@ -34,7 +34,8 @@ class IcosahedronMesh : public BaseMesh<VType>
 public:
     using BaseMeshT = BaseMesh<VType>;
 
-    explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false)
+    explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false,
+                             tf::Executor* parallel_executor_ptr = nullptr)
         : BaseMeshT(Mesh::Type::Icosahedron, vertex_layout)
         , m_radius(radius)
     {
@@ -115,70 +116,100 @@ public:
 
         for(uint32_t subdivision = 0; subdivision < subdivisions_count; ++subdivision)
         {
-            Subdivide();
+            Subdivide(parallel_executor_ptr);
         }
 
         if (spherify)
         {
-            Spherify();
+            Spherify(parallel_executor_ptr);
         }
     }
 
     float GetRadius() const noexcept  { return m_radius; }
 
-    void Subdivide()
+    void Subdivide(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
         META_CHECK_ARG_DESCR(Mesh::GetIndexCount(), Mesh::GetIndexCount() % 3 == 0,
                              "icosahedron indices count should be a multiple of three representing triangles list");
 
-        Mesh::Indices new_indices;
-        new_indices.reserve(Mesh::GetIndexCount() * 4);
-        BaseMeshT::ReserveVertices(BaseMeshT::GetVertexCount() * 2);
+        const Data::Size triangles_count = Mesh::GetIndexCount() / 3;
+        const Data::Size vertices_count  = BaseMeshT::GetVertexCount();
 
-        typename BaseMeshT::EdgeMidpoints edge_midpoints;
+        // Edge midpoints are enumerated serially in faces order, so that midpoint vertex indices are deterministic
+        // and do not depend on parallel execution order of the vertex interpolation and faces split below
+        using EdgeVertices = std::pair<Mesh::Index, Mesh::Index>;
+        typename BaseMeshT::EdgeMidpoints edge_midpoints(triangles_count * 3 / 2);
+        std::vector<EdgeVertices> midpoint_edges;
+        midpoint_edges.reserve(triangles_count * 3 / 2);
 
-        const Data::Size triangles_count = Mesh::GetIndexCount() / 3;
+        Mesh::Indices face_midpoint_indices(triangles_count * 3);
         for (Data::Index triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
         {
-            const Mesh::Index vi1 = Mesh::GetIndex(triangle_index * 3);
-            const Mesh::Index vi2 = Mesh::GetIndex(triangle_index * 3 + 1);
-            const Mesh::Index vi3 = Mesh::GetIndex(triangle_index * 3 + 2);
-
-            const Mesh::Index vm1 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi1, vi2), edge_midpoints);
-            const Mesh::Index vm2 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi2, vi3), edge_midpoints);
-            const Mesh::Index vm3 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi3, vi1), edge_midpoints);
-
-            std::array<Mesh::Index, 3 * 4> indices{
-                vi1, vm1, vm3,
-                vm1, vi2, vm2,
-                vm1, vm2, vm3,
-                vm3, vm2, vi3,
-            };
-            new_indices.insert(new_indices.end(), indices.begin(), indices.end());
+            for (Data::Index edge_index = 0; edge_index < 3; ++edge_index)
+            {
+                const Mesh::Index vi1 = Mesh::GetIndex(triangle_index * 3 + edge_index);
+                const Mesh::Index vi2 = Mesh::GetIndex(triangle_index * 3 + (edge_index + 1) % 3);
+                const auto [vm_index, is_new_midpoint] = edge_midpoints.TryEmplace(vi1, vi2, static_cast<Mesh::Index>(vertices_count + midpoint_edges.size()));
+                if (is_new_midpoint)
+                    midpoint_edges.emplace_back(vi1, vi2);
+
+                face_midpoint_indices[triangle_index * 3 + edge_index] = vm_index;
+            }
         }
 
+        BaseMeshT::ResizeVertices(vertices_count + midpoint_edges.size());
+        BaseMeshT::ForEachIndex(parallel_executor_ptr, static_cast<Data::Size>(midpoint_edges.size()),
+            [this, vertices_count, &midpoint_edges](Data::Index midpoint_index)
+            {
+                const auto [vi1, vi2] = midpoint_edges[midpoint_index];
+                const typename BaseMeshT::Vertices& vertices = BaseMeshT::GetVertices();
+                BaseMeshT::GetMutableVertex(vertices_count + midpoint_index) = BaseMeshT::GetEdgeMidpointVertex(vertices[vi1], vertices[vi2]);
+            });
+
+        Mesh::Indices new_indices(static_cast<size_t>(triangles_count) * 12);
+        BaseMeshT::ForEachIndex(parallel_executor_ptr, triangles_count,
+            [this, &new_indices, &face_midpoint_indices](Data::Index triangle_index)
+            {
+                const Mesh::Index vi1 = Mesh::GetIndex(triangle_index * 3);
+                const Mesh::Index vi2 = Mesh::GetIndex(triangle_index * 3 + 1);
+                const Mesh::Index vi3 = Mesh::GetIndex(triangle_index * 3 + 2);
+
+                const Mesh::Index vm1 = face_midpoint_indices[triangle_index * 3];
+                const Mesh::Index vm2 = face_midpoint_indices[triangle_index * 3 + 1];
+                const Mesh::Index vm3 = face_midpoint_indices[triangle_index * 3 + 2];
+
+                const std::array<Mesh::Index, 3 * 4> indices{
+                    vi1, vm1, vm3,
+                    vm1, vi2, vm2,
+                    vm1, vm2, vm3,
+                    vm3, vm2, vi3,
+                };
+                std::copy(indices.begin(), indices.end(), new_indices.begin() + static_cast<size_t>(triangle_index) * indices.size());
+            });
+
         BaseMeshT::SwapIndices(new_indices);
     }
 
-    void Spherify()
+    void Spherify(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
         const bool has_normals = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
 
-        for(size_t vertex_index = 0; vertex_index < BaseMeshT::GetVertexCount(); ++vertex_index)
-        {
-            VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
-            Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
-            const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
-            vertex_position = Mesh::Position(vertex_position_norm * m_radius);
-
-            if (has_normals)
+        BaseMeshT::ForEachIndex(parallel_executor_ptr, BaseMeshT::GetVertexCount(),
+            [this, has_normals](Data::Index vertex_index)
             {
-                Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-                vertex_normal = Mesh::Normal(vertex_position_norm);
-            }
-        }
+                VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
+                Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+                const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
+                vertex_position = Mesh::Position(vertex_position_norm * m_radius);
+
+                if (has_normals)
+                {
+                    Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+                    vertex_normal = Mesh::Normal(vertex_position_norm);
+                }
+            });
     }
 
 private:
@@ -0,0 +1,109 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/LodMesh.hpp
+Uber-mesh with chain of levels of detail generated by mesh simplification,
+stored as subsets sharing vertices of the original mesh.
+
+******************************************************************************/
+
+#pragma once
+
+#include "UberMesh.hpp"
+#include "MeshSimplifier.h"
+
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+template<typename VType>
+class LodMesh : public UberMesh<VType>
+{
+public:
+    using UberMeshT = UberMesh<VType>;
+
+    // Level of detail 0 is the original mesh, each next level is simplified from the previous one
+    // until levels count, triangles budget or accumulated error limit is reached
+    LodMesh(const BaseMesh<VType>& mesh, const MeshSimplifier::LodSettings& settings = {})
+        : UberMeshT(mesh.GetVertexLayout())
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO(settings.max_lods_count);
+        META_CHECK_ARG_RANGE(settings.triangles_ratio, 0.F, 1.F);
+
+        UberMeshT::AddSubMesh(mesh, true);
+        m_lod_errors.push_back(0.F);
+
+        Mesh::Indices lod_indices = mesh.GetIndices();
+        while (m_lod_errors.size() < settings.max_lods_count)
+        {
+            const float remaining_error = settings.max_error - m_lod_errors.back();
+            const auto  lod_triangles_count = static_cast<Data::Size>(static_cast<float>(lod_indices.size() / 3) * settings.triangles_ratio);
+            if (remaining_error <= 0.F || !lod_triangles_count)
+                break;
+
+            MeshSimplifier::Settings simplifier_settings;
+            simplifier_settings.target_index_count = lod_triangles_count * 3;
+            simplifier_settings.target_error       = remaining_error;
+            simplifier_settings.attribute_weight   = settings.attribute_weight;
+
+            MeshSimplifier::Result lod = MeshSimplifier::Simplify(*this, lod_indices, simplifier_settings);
+            if (lod.indices.size() >= lod_indices.size())
+                break;
+
+            UberMeshT::AddSubsetIndices(0U, lod.indices);
+            m_lod_errors.push_back(m_lod_errors.back() + lod.error);
+            lod_indices = std::move(lod.indices);
+        }
+    }
+
+    [[nodiscard]] Data::Size GetLodCount() const noexcept { return static_cast<Data::Size>(m_lod_errors.size()); }
+
+    // Returns accumulated simplification error relative to mesh bounding box diagonal
+    [[nodiscard]] float GetLodError(Data::Index lod_index) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_LESS(lod_index, m_lod_errors.size());
+        return m_lod_errors[lod_index];
+    }
+
+    [[nodiscard]] Data::Size GetLodTriangleCount(Data::Index lod_index) const
+    {
+        META_FUNCTION_TASK();
+        return static_cast<Data::Size>(UberMeshT::GetSubset(lod_index).indices.count / 3);
+    }
+
+    // Selects the coarsest level of detail with projected error not exceeding maximum screen error in pixels,
+    // where projected screen size is the size of mesh bounding sphere in pixels (see Camera::GetProjectedScreenSize)
+    [[nodiscard]] Data::Index SelectLod(float projected_screen_size, float max_screen_error = 1.F) const
+    {
+        META_FUNCTION_TASK();
+        Data::Index lod_index = 0U;
+        while (lod_index + 1 < m_lod_errors.size() && m_lod_errors[lod_index + 1] * projected_screen_size <= max_screen_error)
+        {
+            lod_index++;
+        }
+        return lod_index;
+    }
+
+private:
+    std::vector<float> m_lod_errors;
+};
+
+} // namespace Methane::Graphics
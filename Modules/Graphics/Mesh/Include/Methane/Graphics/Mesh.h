@@ -23,6 +23,7 @@ Abstract mesh class
 
 #pragma once
 
+#include <Methane/Graphics/Types.h>
 #include <Methane/Data/Types.h>
 #include <Methane/Data/Vector.hpp>
 
@@ -30,6 +31,12 @@ Abstract mesh class
 #include <array>
 #include <string_view>
 #include <map>
+#include <functional>
+
+namespace tf
+{
+class Executor;
+}
 
 namespace Methane::Graphics
 {
@@ -42,8 +49,15 @@ public:
     using Normal     = Data::RawVector3F;
     using Color      = Data::RawVector3F;
     using TexCoord   = Data::RawVector2F;
-    using Index      = uint16_t;
+
+    // Packed vertex field types decoded in shaders from 32-bit unsigned integer inputs
+    using PackedPosition = std::array<uint16_t, 4>; // half-float XYZ components with W set to 1
+    using PackedNormal   = std::array<int16_t, 2>;  // octahedral encoding of unit normal with snorm16 components
+    using PackedTexCoord = std::array<uint16_t, 2>; // unorm16 components of texture coordinates in range [0, 1]
+    using Index      = uint32_t;
     using Indices    = std::vector<Index>;
+    using Index16    = uint16_t;
+    using Indices16  = std::vector<Index16>;
 
     enum class Type
     {
@@ -83,6 +97,9 @@ public:
         Normal,
         TexCoord,
         Color,
+        PackedPosition,
+        PackedNormal,
+        PackedTexCoord,
 
         Count
     };
@@ -103,6 +120,7 @@ public:
 
         using std::vector<VertexField>::vector;
 
+        [[nodiscard]] bool HasField(VertexField field) const noexcept;
         [[nodiscard]] std::vector<std::string_view> GetSemantics() const;
 
         [[nodiscard]] static std::string_view GetSemanticByVertexField(VertexField vertex_field);
@@ -118,6 +136,13 @@ public:
     [[nodiscard]] Index               GetIndex(Data::Index i) const noexcept { return i < m_indices.size() ? m_indices[i] : 0; }
     [[nodiscard]] Data::Size          GetIndexCount() const noexcept         { return static_cast<Data::Size>(m_indices.size()); }
     [[nodiscard]] Data::Size          GetIndexDataSize() const noexcept      { return static_cast<Data::Size>(m_indices.size() * sizeof(Index)); }
+    [[nodiscard]] Data::Size          GetIndexDataSize(PixelFormat index_format) const;
+    [[nodiscard]] PixelFormat         GetIndexFormat() const noexcept;
+    [[nodiscard]] Indices16           GetIndices16() const;
+    [[nodiscard]] Position            GetVertexPosition(Data::Index vertex_index) const;
+    [[nodiscard]] Data::ConstRawPtr   GetVertexFieldData(Data::Index vertex_index, VertexField field) const;
+
+    [[nodiscard]] static Data::Size   GetVertexSize(const VertexLayout& vertex_layout) noexcept;
 
     // Mesh interface methods
     [[nodiscard]] virtual Data::Size        GetVertexCount() const noexcept = 0;
@@ -142,6 +167,7 @@ protected:
     };
     
     using VertexFieldOffsets = std::array<int32_t, static_cast<size_t>(VertexField::Count)>;
+    using IndexRangeFunc     = std::function<void(Data::Index begin_index, Data::Index end_index)>;
 
     void CheckLayoutHasVertexField(VertexField field) const;
     [[nodiscard]] bool HasVertexField(VertexField field) const noexcept;
@@ -155,7 +181,6 @@ protected:
     auto GetIndicesBackInserter()                        { return std::back_inserter(m_indices); }
 
     [[nodiscard]] static VertexFieldOffsets GetVertexFieldOffsets(const VertexLayout& vertex_layout);
-    [[nodiscard]] static Data::Size         GetVertexSize(const VertexLayout& vertex_layout) noexcept;
     [[nodiscard]] static Data::Size         GetVertexFieldSize(VertexField vertex_field)   { return GetVertexFieldSize(static_cast<size_t>(vertex_field)); }
     [[nodiscard]] static Data::Size         GetVertexFieldSize(size_t vertex_field_index);
     [[nodiscard]] static const Position2D&  GetFacePosition2D(size_t index);
@@ -166,6 +191,9 @@ protected:
     [[nodiscard]] static const Color&       GetColor(size_t index);
     [[nodiscard]] static Data::Size         GetColorsCount() noexcept;
 
+    // Splits index range [0, count) to chunks processed in parallel with executor
+    static void ForEachIndexRangeParallel(tf::Executor& parallel_executor, Data::Size count, const IndexRangeFunc& range_func);
+
 private:
     const Type               m_type;
     const VertexLayout       m_vertex_layout;
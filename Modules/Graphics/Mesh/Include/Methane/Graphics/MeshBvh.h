@@ -0,0 +1,71 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshBvh.h
+Bounding volume hierarchy over mesh triangles for ray picking and frustum queries.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+#include "Bvh.h"
+
+namespace Methane::Graphics
+{
+
+class MeshBvh
+{
+public:
+    struct Hit
+    {
+        Data::Index triangle_index;
+        float       distance;    // in units of ray direction vector length
+        float       barycentric_u;
+        float       barycentric_v;
+    };
+
+    explicit MeshBvh(const Mesh& mesh, const Bvh::Settings& settings = {}, tf::Executor* parallel_executor_ptr = nullptr);
+    MeshBvh(const Mesh& mesh, const Mesh::Indices& indices, const Bvh::Settings& settings = {}, tf::Executor* parallel_executor_ptr = nullptr);
+
+    [[nodiscard]] const Bvh& GetBvh() const noexcept           { return m_bvh; }
+    [[nodiscard]] Data::Size GetTriangleCount() const noexcept { return static_cast<Data::Size>(m_triangles.size()); }
+
+    // Returns the closest triangle hit by the ray, both triangle sides are hit
+    [[nodiscard]] std::optional<Hit> Intersect(const Ray& ray) const;
+
+    // Returns indices of triangles with bounding boxes visible in frustum
+    [[nodiscard]] Bvh::PrimitiveIndices Query(const Frustum& frustum) const { return m_bvh.Query(frustum); }
+
+private:
+    struct Triangle
+    {
+        hlslpp::float3 vertex;
+        hlslpp::float3 edge_1;
+        hlslpp::float3 edge_2;
+    };
+
+    // Möller-Trumbore ray-triangle intersection test
+    [[nodiscard]] static std::optional<Hit> IntersectTriangle(const Triangle& triangle, Data::Index triangle_index,
+                                                              const Ray& ray, float max_distance) noexcept;
+
+    std::vector<Triangle> m_triangles;
+    Bvh                   m_bvh;
+};
+
+} // namespace Methane::Graphics
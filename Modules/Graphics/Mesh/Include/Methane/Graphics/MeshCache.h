@@ -0,0 +1,97 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshCache.h
+Versioned binary mesh cache format with vertex layout, subsets, bounds
+and index width, readable in place from memory without copying mesh data.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <Methane/Data/Chunk.hpp>
+#include <Methane/Data/IProvider.h>
+
+#include <string>
+#include <stdexcept>
+
+namespace Methane::Graphics
+{
+
+class MeshCache
+{
+public:
+    static constexpr uint32_t format_version = 1U;
+
+    class FormatException : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    struct Bounds
+    {
+        Mesh::Position min;
+        Mesh::Position max;
+    };
+
+    // Serializes mesh vertices and indices narrowed to the mesh index format, subsets are optional
+    [[nodiscard]] static Data::Bytes Serialize(const Mesh& mesh, const Mesh::Subsets& subsets = {});
+    static void Save(const std::string& file_path, const Mesh& mesh, const Mesh::Subsets& subsets = {});
+
+    // Mesh cache references chunk memory directly, so non-owning chunk data must outlive the cache
+    explicit MeshCache(Data::Chunk&& data);
+    MeshCache(const Data::IProvider& data_provider, const std::string& path);
+
+    [[nodiscard]] Mesh::Type                GetType() const noexcept            { return m_type; }
+    [[nodiscard]] const Mesh::VertexLayout& GetVertexLayout() const noexcept    { return m_vertex_layout; }
+    [[nodiscard]] Data::Size                GetVertexSize() const noexcept      { return m_vertex_size; }
+    [[nodiscard]] Data::Size                GetVertexCount() const noexcept     { return m_vertex_count; }
+    [[nodiscard]] Data::Size                GetVertexDataSize() const noexcept  { return m_vertex_size * m_vertex_count; }
+    [[nodiscard]] Data::ConstRawPtr         GetVertexData() const noexcept      { return m_data.GetDataPtr() + m_vertex_data_offset; }
+    [[nodiscard]] PixelFormat               GetIndexFormat() const noexcept     { return m_index_format; }
+    [[nodiscard]] Data::Size                GetIndexCount() const noexcept      { return m_index_count; }
+    [[nodiscard]] Data::Size                GetIndexDataSize() const noexcept;
+    [[nodiscard]] Data::ConstRawPtr         GetIndexData() const noexcept       { return m_data.GetDataPtr() + m_index_data_offset; }
+    [[nodiscard]] Mesh::Index               GetIndex(Data::Index index) const;
+    [[nodiscard]] Mesh::Indices             GetIndices() const;
+    [[nodiscard]] const Mesh::Subsets&      GetSubsets() const noexcept         { return m_subsets; }
+    [[nodiscard]] const Bounds&             GetBounds() const noexcept          { return m_bounds; }
+
+private:
+    void Parse();
+    void ValidateIndices() const;
+
+    // Vertex and index data are addressed with offsets in chunk data, so that copied or moved cache
+    // references its own chunk storage instead of the storage of the source cache
+    Data::Chunk        m_data;
+    Mesh::Type         m_type = Mesh::Type::Unknown;
+    Mesh::VertexLayout m_vertex_layout;
+    Data::Size         m_vertex_size        = 0U;
+    Data::Size         m_vertex_count       = 0U;
+    Data::Size         m_vertex_data_offset = 0U;
+    PixelFormat        m_index_format       = PixelFormat::Unknown;
+    Data::Size         m_index_count        = 0U;
+    Data::Size         m_index_data_offset  = 0U;
+    Mesh::Subsets      m_subsets;
+    Bounds             m_bounds;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,72 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshOptimizer.h
+Mesh optimization algorithms: post-transform vertex cache optimization
+with Forsyth index reordering, overdraw-aware cluster sorting
+and vertex fetch remapping.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <vector>
+#include <string>
+
+namespace Methane::Graphics::MeshOptimizer
+{
+
+using VertexRemap = std::vector<Mesh::Index>;
+
+struct VertexCacheStatistics
+{
+    Data::Size triangles_count       = 0U;
+    Data::Size vertices_count        = 0U; // unique vertices referenced by indices
+    Data::Size vertices_transformed  = 0U; // vertex shader invocations with simulated FIFO cache
+    float      acmr                  = 0.F; // average cache miss ratio: transformed vertices per triangle
+    float      atvr                  = 0.F; // average transformed vertices ratio: transformed vertices per unique vertex
+
+    VertexCacheStatistics& operator+=(const VertexCacheStatistics& other) noexcept;
+    explicit operator std::string() const;
+};
+
+struct Statistics
+{
+    VertexCacheStatistics before;
+    VertexCacheStatistics after;
+
+    Statistics& operator+=(const Statistics& other) noexcept;
+    explicit operator std::string() const;
+};
+
+struct Settings
+{
+    Data::Size cache_size         = 32U;  // FIFO cache size used for ACMR/ATVR analysis
+    bool       optimize_overdraw  = true;
+    bool       optimize_fetch     = true;
+};
+
+// All functions below work with triangle list indices in local vertex index space [0, vertex_count)
+[[nodiscard]] VertexCacheStatistics AnalyzeVertexCache(const Mesh::Indices& indices, Data::Size vertex_count, Data::Size cache_size = 32U);
+[[nodiscard]] Mesh::Indices OptimizeVertexCache(const Mesh::Indices& indices, Data::Size vertex_count);
+[[nodiscard]] Mesh::Indices OptimizeOverdraw(const Mesh::Indices& indices, const Mesh& mesh, Data::Index vertex_base_index, Data::Size vertex_count);
+[[nodiscard]] VertexRemap   OptimizeVertexFetch(Mesh::Indices& indices, Data::Size vertex_count);
+
+} // namespace Methane::Graphics::MeshOptimizer
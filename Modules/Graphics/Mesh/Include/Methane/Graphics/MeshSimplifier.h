@@ -0,0 +1,58 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshSimplifier.h
+Mesh simplification with quadric error metrics and attribute-aware
+edge collapses used for levels of detail generation.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+namespace Methane::Graphics::MeshSimplifier
+{
+
+struct Settings
+{
+    Data::Size target_index_count = 0U;    // simplification stops when indices count is reduced to this value
+    float      target_error       = 0.01F; // maximum collapse error relative to mesh bounding box diagonal
+    float      attribute_weight   = 0.01F; // weight of normal and texture coordinates difference in collapse error
+};
+
+struct LodSettings
+{
+    Data::Size max_lods_count   = 4U;    // including the original mesh level of detail
+    float      triangles_ratio  = 0.5F;  // ratio of triangles count between subsequent levels of detail
+    float      max_error        = 0.05F; // maximum accumulated error relative to mesh bounding box diagonal
+    float      attribute_weight = 0.01F; // weight of normal and texture coordinates difference in collapse error
+};
+
+struct Result
+{
+    Mesh::Indices indices;
+    float         error = 0.F; // maximum collapse error relative to mesh bounding box diagonal
+};
+
+// Simplifies triangle list indices referencing mesh vertices by collapsing edges to existing vertices,
+// so simplified indices can be used with the original vertex buffer. Vertices on open borders
+// and attribute seams, where several vertices share the same position, are never collapsed.
+[[nodiscard]] Result Simplify(const Mesh& mesh, const Mesh::Indices& indices, const Settings& settings);
+
+} // namespace Methane::Graphics::MeshSimplifier
@@ -0,0 +1,85 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Meshlets.h
+Meshlets builder splitting mesh triangles into bounded clusters
+with bounding spheres and normal cones used for cluster culling.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+struct Meshlet
+{
+    Data::Index    vertex_offset   = 0U; // offset of the first meshlet vertex in Meshlets::GetVertexIndices()
+    Data::Size     vertex_count    = 0U;
+    Data::Index    triangle_offset = 0U; // offset of the first meshlet triangle in Meshlets::GetTriangles()
+    Data::Size     triangle_count  = 0U;
+    Mesh::Position bounding_center;
+    float          bounding_radius = 0.F;
+    Mesh::Normal   cone_axis;
+    float          cone_cutoff     = 1.F; // sine of the normal cone half-angle, 1 means cone is degenerate and can not be culled
+
+    [[nodiscard]] bool IsBackFacing(const Mesh::Position& camera_position) const noexcept;
+};
+
+class Meshlets
+{
+public:
+    using LocalIndex = uint8_t;
+    using Triangle   = std::array<LocalIndex, 3>;
+    using Triangles  = std::vector<Triangle>;
+    using List       = std::vector<Meshlet>;
+
+    struct Settings
+    {
+        Data::Size max_vertices  = 64U;
+        Data::Size max_triangles = 124U;
+    };
+
+    explicit Meshlets(const Mesh& mesh);
+    Meshlets(const Mesh& mesh, const Settings& settings);
+
+    [[nodiscard]] const Settings&      GetSettings() const noexcept      { return m_settings; }
+    [[nodiscard]] const List&          GetList() const noexcept          { return m_meshlets; }
+    [[nodiscard]] Data::Size           GetCount() const noexcept         { return static_cast<Data::Size>(m_meshlets.size()); }
+    [[nodiscard]] const Meshlet&       Get(Data::Index meshlet_index) const;
+    [[nodiscard]] const Mesh::Indices& GetVertexIndices() const noexcept { return m_vertex_indices; }
+    [[nodiscard]] const Triangles&     GetTriangles() const noexcept     { return m_triangles; }
+
+    // Returns global mesh vertex index of the meshlet local vertex
+    [[nodiscard]] Mesh::Index GetMeshVertexIndex(const Meshlet& meshlet, LocalIndex local_index) const;
+
+private:
+    void Build(const Mesh& mesh);
+    void ComputeBounds(const Mesh& mesh, Meshlet& meshlet) const;
+
+    const Settings m_settings;
+    List           m_meshlets;
+    Mesh::Indices  m_vertex_indices;
+    Triangles      m_triangles;
+};
+
+} // namespace Methane::Graphics
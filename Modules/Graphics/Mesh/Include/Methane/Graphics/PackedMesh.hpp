@@ -0,0 +1,59 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/PackedMesh.hpp
+Mesh with packed vertex fields converted from full-precision mesh data.
+
+******************************************************************************/
+
+#pragma once
+
+#include "BaseMesh.hpp"
+#include "VertexPacking.h"
+
+namespace Methane::Graphics
+{
+
+template<typename VType>
+class PackedMesh : public BaseMesh<VType>
+{
+public:
+    using BaseMeshT = BaseMesh<VType>;
+
+    // Packed vertex layout fields are converted from the matching fields of the source mesh layout,
+    // so packed mesh can be used with source mesh subsets as is
+    PackedMesh(const Mesh::VertexLayout& packed_vertex_layout, const Mesh& source_mesh)
+        : BaseMeshT(source_mesh.GetType(), packed_vertex_layout)
+    {
+        META_FUNCTION_TASK();
+        const Data::Size vertex_count = source_mesh.GetVertexCount();
+        BaseMeshT::ResizeVertices(vertex_count);
+        for(Data::Index vertex_index = 0U; vertex_index < vertex_count; ++vertex_index)
+        {
+            auto vertex_ptr = reinterpret_cast<Data::RawPtr>(&BaseMeshT::GetMutableVertex(vertex_index)); // NOSONAR
+            for(Mesh::VertexField vertex_field : packed_vertex_layout)
+            {
+                VertexPacking::ConvertVertexField(source_mesh, vertex_index, vertex_field,
+                                                  vertex_ptr + Mesh::GetVertexFieldOffset(vertex_field));
+            }
+        }
+        Mesh::SetIndices(Mesh::Indices(source_mesh.GetIndices()));
+    }
+};
+
+} // namespace Methane::Graphics
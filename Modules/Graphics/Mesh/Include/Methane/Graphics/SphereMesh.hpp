@@ -36,7 +36,8 @@ class SphereMesh : public BaseMesh<VType>
 public:
     using BaseMeshT = BaseMesh<VType>;
 
-    explicit SphereMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, Mesh::Index lat_lines_count = 10, Mesh::Index long_lines_count = 16)
+    explicit SphereMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, Mesh::Index lat_lines_count = 10, Mesh::Index long_lines_count = 16,
+                        tf::Executor* parallel_executor_ptr = nullptr)
         : BaseMeshT(Mesh::Type::Sphere, vertex_layout)
         , m_radius(radius)
         , m_lat_lines_count(lat_lines_count)
@@ -47,7 +48,7 @@ public:
         META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_lat_lines_count,  3, "latitude lines count should not be less than 3");
         META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_long_lines_count, 3, "longitude lines count should not be less than 3");
 
-        GenerateSphereVertices();
+        GenerateSphereVertices(parallel_executor_ptr);
         GenerateSphereIndices();
     }
 
@@ -69,7 +70,7 @@ private:
              : m_lat_lines_count - 2) * m_long_lines_count * 2;
     }
 
-    void GenerateSphereVertices()
+    void GenerateSphereVertices(tf::Executor* parallel_executor_ptr)
     {
         META_FUNCTION_TASK();
 
@@ -109,38 +110,41 @@ private:
         const uint32_t first_lat_line_index   = has_texcoord ? 0 : 1;
         const uint32_t first_vertex_index     = has_texcoord ? 0 : 1;
 
-        for (uint32_t lat_line_index = first_lat_line_index; lat_line_index < actual_lat_lines_count; ++lat_line_index)
-        {
-            const float lat_ratio = static_cast<float>(lat_line_index) / static_cast<float>(actual_lat_lines_count - 1);
-
-            for(uint32_t long_line_index = 0; long_line_index < actual_long_lines_count; ++long_line_index)
+        // Latitude lines of vertices are generated in parallel
+        BaseMeshT::ForEachIndex(parallel_executor_ptr, actual_lat_lines_count - first_lat_line_index,
+            [&, this](Data::Index lat_line_offset)
             {
-                const uint32_t vertex_index = (lat_line_index - first_lat_line_index) * actual_long_lines_count + long_line_index + first_vertex_index;
-                const float    long_ratio   = static_cast<float>(long_line_index) / static_cast<float>(actual_long_lines_count - 1);
-
-                VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
-
-                Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
-                vertex_position.SetX(std::sin(ConstFloat::Pi * lat_ratio) * std::cos(ConstFloat::TwoPi * long_ratio));
-                vertex_position.SetZ(std::sin(ConstFloat::Pi * lat_ratio) * std::sin(ConstFloat::TwoPi * long_ratio));
-                vertex_position.SetY(std::cos(ConstFloat::Pi * lat_ratio));
-
-                if (has_normals)
-                {
-                    Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-                    vertex_normal = vertex_position;
-                }
-
-                vertex_position *= m_radius;
+                const uint32_t lat_line_index = first_lat_line_index + lat_line_offset;
+                const float    lat_ratio      = static_cast<float>(lat_line_index) / static_cast<float>(actual_lat_lines_count - 1);
 
-                if (has_texcoord)
+                for(uint32_t long_line_index = 0; long_line_index < actual_long_lines_count; ++long_line_index)
                 {
-                    Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::TexCoord>(vertex, Mesh::VertexField::TexCoord);
-                    vertex_texcoord.SetX(texcoord_long_spacing * static_cast<float>(long_line_index));
-                    vertex_texcoord.SetY(texcoord_lat_spacing  * static_cast<float>(lat_line_index));
+                    const uint32_t vertex_index = lat_line_offset * actual_long_lines_count + long_line_index + first_vertex_index;
+                    const float    long_ratio   = static_cast<float>(long_line_index) / static_cast<float>(actual_long_lines_count - 1);
+
+                    VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
+
+                    Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+                    vertex_position.SetX(std::sin(ConstFloat::Pi * lat_ratio) * std::cos(ConstFloat::TwoPi * long_ratio));
+                    vertex_position.SetZ(std::sin(ConstFloat::Pi * lat_ratio) * std::sin(ConstFloat::TwoPi * long_ratio));
+                    vertex_position.SetY(std::cos(ConstFloat::Pi * lat_ratio));
+
+                    if (has_normals)
+                    {
+                        Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+                        vertex_normal = vertex_position;
+                    }
+
+                    vertex_position *= m_radius;
+
+                    if (has_texcoord)
+                    {
+                        Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::TexCoord>(vertex, Mesh::VertexField::TexCoord);
+                        vertex_texcoord.SetX(texcoord_long_spacing * static_cast<float>(long_line_index));
+                        vertex_texcoord.SetY(texcoord_lat_spacing  * static_cast<float>(lat_line_index));
+                    }
                 }
-            }
-        }
+            });
     }
 
     void GenerateSphereIndices()
@@ -70,6 +70,36 @@ public:
         BaseMeshT::AppendVertices(sub_vertices);
     }
 
+    // Adds subset of indices referencing vertices slice of another subset, indices should be in the same space
+    // as the indices of that subset, which allows to share vertices between levels of detail
+    void AddSubsetIndices(size_t vertices_subset_index, const Mesh::Indices& indices)
+    {
+        META_FUNCTION_TASK();
+        const Mesh::Subset vertices_subset = GetSubset(vertices_subset_index);
+        m_subsets.emplace_back(vertices_subset.mesh_type, vertices_subset.vertices,
+                               Mesh::Subset::Slice(Mesh::GetIndexCount(), static_cast<Data::Size>(indices.size())),
+                               vertices_subset.indices_adjusted);
+        BaseMeshT::AppendIndices(indices);
+    }
+
+    // Optimizes each subset separately to keep subset slices of indices and vertices unchanged,
+    // vertices shared by several subsets are not reordered for fetch to keep all subsets indices valid
+    MeshOptimizer::Statistics Optimize(const MeshOptimizer::Settings& settings = {})
+    {
+        META_FUNCTION_TASK();
+        MeshOptimizer::Statistics statistics;
+        for(const Mesh::Subset& subset : m_subsets)
+        {
+            MeshOptimizer::Settings subset_settings = settings;
+            subset_settings.optimize_fetch = settings.optimize_fetch && !IsSubsetVerticesShared(subset);
+            statistics += BaseMeshT::OptimizeRange(subset_settings,
+                                                   subset.indices.offset, subset.indices.count,
+                                                   subset.vertices.offset, subset.vertices.count,
+                                                   subset.indices_adjusted ? subset.vertices.offset : 0U);
+        }
+        return statistics;
+    }
+
     const Mesh::Subsets& GetSubsets() const                     { return m_subsets; }
     size_t               GetSubsetCount() const noexcept        { return m_subsets.size(); }
     const Mesh::Subset&  GetSubset(size_t subset_index) const
@@ -94,6 +124,13 @@ public:
     }
 
 private:
+    bool IsSubsetVerticesShared(const Mesh::Subset& subset) const
+    {
+        return std::count_if(m_subsets.begin(), m_subsets.end(),
+                             [&subset](const Mesh::Subset& other_subset)
+                             { return other_subset.vertices.offset == subset.vertices.offset; }) > 1;
+    }
+
     Mesh::Subsets m_subsets;
 };
 
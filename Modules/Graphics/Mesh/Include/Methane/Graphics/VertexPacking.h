@@ -0,0 +1,49 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/VertexPacking.h
+Vertex fields quantization to packed formats: half-float positions,
+octahedral snorm16 normals and unorm16 texture coordinates.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+namespace Methane::Graphics::VertexPacking
+{
+
+[[nodiscard]] uint16_t FloatToHalf(float value) noexcept;
+[[nodiscard]] float    HalfToFloat(uint16_t value) noexcept;
+
+[[nodiscard]] Mesh::PackedPosition PackPosition(const Mesh::Position& position) noexcept;
+[[nodiscard]] Mesh::Position       UnpackPosition(const Mesh::PackedPosition& packed_position) noexcept;
+
+// Normal is expected to be of unit length
+[[nodiscard]] Mesh::PackedNormal PackNormal(const Mesh::Normal& normal) noexcept;
+[[nodiscard]] Mesh::Normal       UnpackNormal(const Mesh::PackedNormal& packed_normal) noexcept;
+
+// Texture coordinates are clamped to range [0, 1]
+[[nodiscard]] Mesh::PackedTexCoord PackTexCoord(const Mesh::TexCoord& texcoord) noexcept;
+[[nodiscard]] Mesh::TexCoord       UnpackTexCoord(const Mesh::PackedTexCoord& packed_texcoord) noexcept;
+
+// Writes vertex field of the target layout converted from the matching full-precision or packed field of the source mesh vertex
+void ConvertVertexField(const Mesh& source_mesh, Data::Index vertex_index, Mesh::VertexField target_field, Data::RawPtr target_field_ptr);
+
+} // namespace Methane::Graphics::VertexPacking
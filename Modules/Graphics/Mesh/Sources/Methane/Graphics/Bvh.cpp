@@ -0,0 +1,379 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Bvh.cpp
+Bounding volume hierarchy built with surface area heuristic over primitive
+bounding boxes, used for ray picking and frustum culling of triangles and instances.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Bvh.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <utility>
+
+namespace Methane::Graphics
+{
+
+static constexpr float g_traversal_cost = 1.F; // cost of inner node traversal relative to primitive intersection
+
+using Centroid  = std::array<float, 3>;
+using Centroids = std::vector<Centroid>;
+
+[[nodiscard]] static Centroid GetCentroid(const BoundingBox& box) noexcept
+{
+    const hlslpp::float3 center = box.GetCenter();
+    return { static_cast<float>(center.x), static_cast<float>(center.y), static_cast<float>(center.z) };
+}
+
+class BvhBuilder
+{
+public:
+    BvhBuilder(const Bvh::Settings& settings, const Bvh::PrimitiveBoxes& primitive_boxes,
+               Bvh::PrimitiveIndices& primitive_indices, Bvh::Nodes& nodes)
+        : m_settings(settings)
+        , m_primitive_boxes(primitive_boxes)
+        , m_primitive_indices(primitive_indices)
+        , m_nodes(nodes)
+        , m_centroids(primitive_boxes.size())
+    {
+        META_FUNCTION_TASK();
+        std::transform(primitive_boxes.begin(), primitive_boxes.end(), m_centroids.begin(), GetCentroid);
+    }
+
+    [[nodiscard]] Data::Size GetNodesCount() const noexcept { return m_nodes_count; }
+
+    // Node children are allocated after parent node, which is relied upon by refit,
+    // while primitive ranges of sibling nodes do not overlap, so subtrees can be built in parallel
+    void BuildNode(uint32_t node_index, Data::Index begin, Data::Index end, Data::Size depth, tf::Subflow* subflow_ptr)
+    {
+        Bvh::Node& node = m_nodes[node_index];
+        BoundingBox bounds;
+        BoundingBox centroid_bounds;
+        for(Data::Index offset = begin; offset < end; ++offset)
+        {
+            const Data::Index primitive_index = m_primitive_indices[offset];
+            const Centroid& centroid = m_centroids[primitive_index];
+            bounds.Add(m_primitive_boxes[primitive_index]);
+            centroid_bounds.Add(hlslpp::float3(centroid[0], centroid[1], centroid[2]));
+        }
+        node.SetBounds(bounds);
+        node.offset = begin;
+        node.count  = end - begin;
+
+        const Data::Size count = end - begin;
+        if (count <= 1U || depth + 1 >= Bvh::max_depth)
+            return;
+
+        Split split = FindSplit(begin, end, centroid_bounds);
+        const float leaf_cost  = static_cast<float>(count) * bounds.GetSurfaceArea();
+        const float split_cost = g_traversal_cost * bounds.GetSurfaceArea() + split.cost;
+        if (count <= m_settings.max_leaf_size && (split.axis >= 3U || split_cost >= leaf_cost))
+            return;
+
+        Data::Index middle = begin;
+        if (split.axis < 3U)
+        {
+            const float centroid_min = GetComponent(centroid_bounds.min, split.axis);
+            const float bins_scale   = static_cast<float>(m_settings.bins_count) / (GetComponent(centroid_bounds.max, split.axis) - centroid_min);
+            middle = static_cast<Data::Index>(std::distance(m_primitive_indices.begin(),
+                std::partition(m_primitive_indices.begin() + begin, m_primitive_indices.begin() + end,
+                               [this, &split, centroid_min, bins_scale](Data::Index primitive_index)
+                               { return GetBinIndex(m_centroids[primitive_index][split.axis], centroid_min, bins_scale) < split.bin; })));
+        }
+        if (middle == begin || middle == end)
+        {
+            // Centroids are not separable by bins, so primitives are split in halves by the longest centroids axis
+            const hlslpp::float3 centroid_size = centroid_bounds.max - centroid_bounds.min;
+            split.axis = static_cast<float>(centroid_size.x) >= static_cast<float>(centroid_size.y)
+                       ? (static_cast<float>(centroid_size.x) >= static_cast<float>(centroid_size.z) ? 0U : 2U)
+                       : (static_cast<float>(centroid_size.y) >= static_cast<float>(centroid_size.z) ? 1U : 2U);
+            middle = begin + count / 2;
+            std::nth_element(m_primitive_indices.begin() + begin, m_primitive_indices.begin() + middle, m_primitive_indices.begin() + end,
+                             [this, &split](Data::Index left, Data::Index right)
+                             { return m_centroids[left][split.axis] < m_centroids[right][split.axis]; });
+        }
+
+        const uint32_t left_index = m_nodes_count.fetch_add(2U);
+        node.offset = left_index;
+        node.count  = 0U;
+
+        if (subflow_ptr && count >= m_settings.parallel_build_size)
+        {
+            subflow_ptr->emplace([this, left_index, begin, middle, depth](tf::Subflow& subflow)
+                                 { BuildNode(left_index, begin, middle, depth + 1, &subflow); });
+            subflow_ptr->emplace([this, left_index, middle, end, depth](tf::Subflow& subflow)
+                                 { BuildNode(left_index + 1, middle, end, depth + 1, &subflow); });
+        }
+        else
+        {
+            BuildNode(left_index, begin, middle, depth + 1, nullptr);
+            BuildNode(left_index + 1, middle, end, depth + 1, nullptr);
+        }
+    }
+
+private:
+    struct Split
+    {
+        uint32_t   axis = 3U; // no split by default
+        Data::Size bin  = 0U;
+        float      cost = std::numeric_limits<float>::max();
+    };
+
+    struct Bin
+    {
+        BoundingBox bounds;
+        Data::Size  count = 0U;
+    };
+
+    [[nodiscard]] static float GetComponent(const hlslpp::float3& vector, uint32_t axis) noexcept
+    {
+        switch (axis)
+        {
+        case 0U:  return static_cast<float>(vector.x);
+        case 1U:  return static_cast<float>(vector.y);
+        default:  return static_cast<float>(vector.z);
+        }
+    }
+
+    [[nodiscard]] Data::Size GetBinIndex(float centroid, float centroid_min, float bins_scale) const noexcept
+    {
+        const auto bin_index = static_cast<Data::Size>((centroid - centroid_min) * bins_scale);
+        return std::min(bin_index, m_settings.bins_count - 1);
+    }
+
+    // Binned surface area heuristic evaluates splits between bins of centroids on each axis
+    [[nodiscard]] Split FindSplit(Data::Index begin, Data::Index end, const BoundingBox& centroid_bounds) const
+    {
+        Split best_split;
+        std::vector<Bin>   bins(m_settings.bins_count);
+        std::vector<float> right_costs(m_settings.bins_count);
+        for(uint32_t axis = 0U; axis < 3U; ++axis)
+        {
+            const float centroid_min = GetComponent(centroid_bounds.min, axis);
+            const float centroid_max = GetComponent(centroid_bounds.max, axis);
+            if (centroid_max <= centroid_min)
+                continue;
+
+            std::fill(bins.begin(), bins.end(), Bin{});
+            const float bins_scale = static_cast<float>(m_settings.bins_count) / (centroid_max - centroid_min);
+            for(Data::Index offset = begin; offset < end; ++offset)
+            {
+                const Data::Index primitive_index = m_primitive_indices[offset];
+                Bin& bin = bins[GetBinIndex(m_centroids[primitive_index][axis], centroid_min, bins_scale)];
+                bin.bounds.Add(m_primitive_boxes[primitive_index]);
+                bin.count++;
+            }
+
+            BoundingBox right_bounds;
+            Data::Size  right_count = 0U;
+            for(Data::Size bin_index = m_settings.bins_count - 1; bin_index > 0U; --bin_index)
+            {
+                right_bounds.Add(bins[bin_index].bounds);
+                right_count += bins[bin_index].count;
+                right_costs[bin_index] = static_cast<float>(right_count) * right_bounds.GetSurfaceArea();
+            }
+
+            BoundingBox left_bounds;
+            Data::Size  left_count = 0U;
+            for(Data::Size bin_index = 1U; bin_index < m_settings.bins_count; ++bin_index)
+            {
+                left_bounds.Add(bins[bin_index - 1].bounds);
+                left_count += bins[bin_index - 1].count;
+                const float cost = static_cast<float>(left_count) * left_bounds.GetSurfaceArea() + right_costs[bin_index];
+                if (left_count && left_count < end - begin && cost < best_split.cost)
+                {
+                    best_split = Split{ axis, bin_index, cost };
+                }
+            }
+        }
+        return best_split;
+    }
+
+    const Bvh::Settings&     m_settings;
+    const Bvh::PrimitiveBoxes& m_primitive_boxes;
+    Bvh::PrimitiveIndices&   m_primitive_indices;
+    Bvh::Nodes&              m_nodes;
+    Centroids                m_centroids;
+    std::atomic<uint32_t>    m_nodes_count{ 1U };
+};
+
+void Bvh::Node::SetBounds(const BoundingBox& bounds) noexcept
+{
+    bounds_min = { static_cast<float>(bounds.min.x), static_cast<float>(bounds.min.y), static_cast<float>(bounds.min.z) };
+    bounds_max = { static_cast<float>(bounds.max.x), static_cast<float>(bounds.max.y), static_cast<float>(bounds.max.z) };
+}
+
+Bvh::Bvh(PrimitiveBoxes primitive_boxes, const Settings& settings, tf::Executor* parallel_executor_ptr)
+    : m_primitive_boxes(std::move(primitive_boxes))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(settings.max_leaf_size);
+    META_CHECK_ARG_GREATER_OR_EQUAL(settings.bins_count, 2U);
+    META_CHECK_ARG_LESS(m_primitive_boxes.size(), std::numeric_limits<uint32_t>::max() / 2);
+    if (m_primitive_boxes.empty())
+        return;
+
+    m_primitive_indices.resize(m_primitive_boxes.size());
+    std::iota(m_primitive_indices.begin(), m_primitive_indices.end(), 0U);
+    m_nodes.resize(m_primitive_boxes.size() * 2 - 1);
+
+    BvhBuilder builder(settings, m_primitive_boxes, m_primitive_indices, m_nodes);
+    const auto primitive_count = static_cast<Data::Size>(m_primitive_boxes.size());
+    if (parallel_executor_ptr && primitive_count >= settings.parallel_build_size)
+    {
+        tf::Taskflow task_flow;
+        task_flow.emplace([&builder, primitive_count](tf::Subflow& subflow)
+                          { builder.BuildNode(0U, 0U, primitive_count, 0U, &subflow); });
+        parallel_executor_ptr->run(task_flow).get();
+    }
+    else
+    {
+        builder.BuildNode(0U, 0U, primitive_count, 0U, nullptr);
+    }
+    m_nodes.resize(builder.GetNodesCount());
+}
+
+void Bvh::Refit(PrimitiveBoxes primitive_boxes)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(primitive_boxes.size(), m_primitive_boxes.size(), "refit requires the same primitives count as BVH was built with");
+    m_primitive_boxes = std::move(primitive_boxes);
+
+    // Children nodes are always placed after their parent, so reverse order updates children before parents
+    for(auto node_it = m_nodes.rbegin(); node_it != m_nodes.rend(); ++node_it)
+    {
+        Node& node = *node_it;
+        BoundingBox bounds;
+        if (node.IsLeaf())
+        {
+            for(uint32_t offset = node.offset; offset < node.offset + node.count; ++offset)
+            {
+                bounds.Add(m_primitive_boxes[m_primitive_indices[offset]]);
+            }
+        }
+        else
+        {
+            bounds = m_nodes[node.offset].GetBounds();
+            bounds.Add(m_nodes[node.offset + 1].GetBounds());
+        }
+        node.SetBounds(bounds);
+    }
+}
+
+Data::Size Bvh::GetDepth() const
+{
+    META_FUNCTION_TASK();
+    if (m_nodes.empty())
+        return 0U;
+
+    Data::Size tree_depth = 0U;
+    std::vector<std::pair<uint32_t, Data::Size>> nodes_stack{ { 0U, 1U } };
+    while (!nodes_stack.empty())
+    {
+        const auto [node_index, depth] = nodes_stack.back();
+        nodes_stack.pop_back();
+        tree_depth = std::max(tree_depth, depth);
+
+        const Node& node = m_nodes[node_index];
+        if (node.IsLeaf())
+            continue;
+
+        nodes_stack.emplace_back(node.offset, depth + 1);
+        nodes_stack.emplace_back(node.offset + 1, depth + 1);
+    }
+    return tree_depth;
+}
+
+std::optional<Bvh::Hit> Bvh::Intersect(const Ray& ray) const
+{
+    META_FUNCTION_TASK();
+    const hlslpp::float3 inverse_direction = hlslpp::float3(1.F) / ray.direction;
+    return Intersect(ray,
+        [this, &inverse_direction](Data::Index primitive_index, const Ray& primitive_ray, float max_distance)
+        { return IntersectBox(m_primitive_boxes[primitive_index], primitive_ray.origin, inverse_direction, max_distance); });
+}
+
+void Bvh::Query(const Frustum& frustum, PrimitiveIndices& visible_primitive_indices) const
+{
+    META_FUNCTION_TASK();
+    if (m_nodes.empty())
+        return;
+
+    // Subtrees of nodes fully inside frustum are collected without further visibility tests
+    std::array<std::pair<uint32_t, bool>, max_depth * 2> nodes_stack{ std::make_pair(0U, false) };
+    size_t stack_size = 1U;
+    while (stack_size)
+    {
+        auto [node_index, is_inside] = nodes_stack[--stack_size];
+        const Node& node = m_nodes[node_index];
+        if (!is_inside)
+        {
+            const Frustum::Intersection intersection = frustum.TestBox(node.GetBounds());
+            if (intersection == Frustum::Intersection::Outside)
+                continue;
+
+            is_inside = intersection == Frustum::Intersection::Inside;
+        }
+
+        if (!node.IsLeaf())
+        {
+            nodes_stack[stack_size++] = { node.offset + 1, is_inside };
+            nodes_stack[stack_size++] = { node.offset, is_inside };
+            continue;
+        }
+
+        for(uint32_t offset = node.offset; offset < node.offset + node.count; ++offset)
+        {
+            const Data::Index primitive_index = m_primitive_indices[offset];
+            if (is_inside || frustum.IsBoxVisible(m_primitive_boxes[primitive_index]))
+                visible_primitive_indices.push_back(primitive_index);
+        }
+    }
+}
+
+Bvh::PrimitiveIndices Bvh::Query(const Frustum& frustum) const
+{
+    META_FUNCTION_TASK();
+    PrimitiveIndices visible_primitive_indices;
+    Query(frustum, visible_primitive_indices);
+    return visible_primitive_indices;
+}
+
+std::optional<float> Bvh::IntersectBox(const BoundingBox& box, const hlslpp::float3& ray_origin,
+                                       const hlslpp::float3& ray_inverse_direction, float max_distance) noexcept
+{
+    const hlslpp::float3 min_distances = (box.min - ray_origin) * ray_inverse_direction;
+    const hlslpp::float3 max_distances = (box.max - ray_origin) * ray_inverse_direction;
+    const hlslpp::float3 near_distances = hlslpp::min(min_distances, max_distances);
+    const hlslpp::float3 far_distances  = hlslpp::max(min_distances, max_distances);
+    const float near_distance = std::max(std::max(static_cast<float>(near_distances.x), static_cast<float>(near_distances.y)),
+                                         std::max(static_cast<float>(near_distances.z), 0.F));
+    const float far_distance  = std::min(std::min(static_cast<float>(far_distances.x), static_cast<float>(far_distances.y)),
+                                         std::min(static_cast<float>(far_distances.z), max_distance));
+    if (near_distance > far_distance)
+        return std::nullopt;
+
+    return near_distance;
+}
+
+} // namespace Methane::Graphics
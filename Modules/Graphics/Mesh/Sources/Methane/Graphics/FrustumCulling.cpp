@@ -0,0 +1,250 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrustumCulling.cpp
+Batch frustum culling of instance bounding spheres and boxes stored in
+structure of arrays layout, vectorized with 4-wide HLSL++ SIMD vectors.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCulling.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+[[nodiscard]] static Data::Size GetPaddedCount(Data::Size count) noexcept
+{
+    return Data::DivCeil(count, FrustumCulling::simd_width) * FrustumCulling::simd_width;
+}
+
+void BoundingSpheres::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    // Padding spheres have zero radius at the origin and are never reported, since their indices are out of range
+    const Data::Size padded_count = GetPaddedCount(count);
+    m_count = count;
+    m_centers_x.resize(padded_count, 0.F);
+    m_centers_y.resize(padded_count, 0.F);
+    m_centers_z.resize(padded_count, 0.F);
+    m_radiuses.resize(padded_count, 0.F);
+}
+
+void BoundingSpheres::Set(Data::Index index, const hlslpp::float3& center, float radius)
+{
+    META_CHECK_ARG_LESS(index, m_count);
+    META_CHECK_ARG_GREATER_OR_EQUAL(radius, 0.F);
+    m_centers_x[index] = static_cast<float>(center.x);
+    m_centers_y[index] = static_cast<float>(center.y);
+    m_centers_z[index] = static_cast<float>(center.z);
+    m_radiuses[index]  = radius;
+}
+
+void BoundingBoxes::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    const Data::Size padded_count = GetPaddedCount(count);
+    m_count = count;
+    m_centers_x.resize(padded_count, 0.F);
+    m_centers_y.resize(padded_count, 0.F);
+    m_centers_z.resize(padded_count, 0.F);
+    m_extents_x.resize(padded_count, 0.F);
+    m_extents_y.resize(padded_count, 0.F);
+    m_extents_z.resize(padded_count, 0.F);
+}
+
+void BoundingBoxes::Set(Data::Index index, const BoundingBox& box)
+{
+    META_CHECK_ARG_LESS(index, m_count);
+    const hlslpp::float3 center = box.GetCenter();
+    const hlslpp::float3 extent = box.GetExtent();
+    m_centers_x[index] = static_cast<float>(center.x);
+    m_centers_y[index] = static_cast<float>(center.y);
+    m_centers_z[index] = static_cast<float>(center.z);
+    m_extents_x[index] = static_cast<float>(extent.x);
+    m_extents_y[index] = static_cast<float>(extent.y);
+    m_extents_z[index] = static_cast<float>(extent.z);
+}
+
+namespace FrustumCulling
+{
+
+// Frustum plane components broadcast to all SIMD lanes, so that each lane tests its own volume
+struct BroadcastPlanes
+{
+    std::array<hlslpp::float4, Frustum::planes_count> x;
+    std::array<hlslpp::float4, Frustum::planes_count> y;
+    std::array<hlslpp::float4, Frustum::planes_count> z;
+    std::array<hlslpp::float4, Frustum::planes_count> w;
+    std::array<hlslpp::float4, Frustum::planes_count> abs_x;
+    std::array<hlslpp::float4, Frustum::planes_count> abs_y;
+    std::array<hlslpp::float4, Frustum::planes_count> abs_z;
+
+    explicit BroadcastPlanes(const Frustum& frustum)
+    {
+        for(size_t plane_index = 0; plane_index < Frustum::planes_count; ++plane_index)
+        {
+            const hlslpp::float4& plane = frustum.GetPlane(static_cast<Frustum::Plane>(plane_index));
+            x[plane_index]     = hlslpp::float4(static_cast<float>(plane.x));
+            y[plane_index]     = hlslpp::float4(static_cast<float>(plane.y));
+            z[plane_index]     = hlslpp::float4(static_cast<float>(plane.z));
+            w[plane_index]     = hlslpp::float4(static_cast<float>(plane.w));
+            abs_x[plane_index] = hlslpp::abs(x[plane_index]);
+            abs_y[plane_index] = hlslpp::abs(y[plane_index]);
+            abs_z[plane_index] = hlslpp::abs(z[plane_index]);
+        }
+    }
+};
+
+[[nodiscard]] static hlslpp::float4 LoadLanes(const float* values_ptr) noexcept
+{
+    return hlslpp::float4(values_ptr[0], values_ptr[1], values_ptr[2], values_ptr[3]);
+}
+
+// Lanes with non-negative minimum distance from volume to frustum planes are visible
+static void AppendVisibleLanes(const hlslpp::float4& min_distances, Data::Index first_index, Data::Index end_index,
+                               VisibleIndices& visible_indices)
+{
+    const std::array<float, simd_width> lane_distances{
+        static_cast<float>(min_distances.x), static_cast<float>(min_distances.y),
+        static_cast<float>(min_distances.z), static_cast<float>(min_distances.w)
+    };
+    const Data::Size lanes_count = std::min(simd_width, end_index - first_index);
+    for(Data::Index lane_index = 0U; lane_index < lanes_count; ++lane_index)
+    {
+        if (lane_distances[lane_index] >= 0.F)
+            visible_indices.push_back(first_index + lane_index);
+    }
+}
+
+static void CullRange(const BroadcastPlanes& planes, const BoundingSpheres& spheres,
+                      Data::Index begin_index, Data::Index end_index, VisibleIndices& visible_indices)
+{
+    for(Data::Index index = begin_index; index < end_index; index += simd_width)
+    {
+        const hlslpp::float4 centers_x = LoadLanes(spheres.GetCentersX() + index);
+        const hlslpp::float4 centers_y = LoadLanes(spheres.GetCentersY() + index);
+        const hlslpp::float4 centers_z = LoadLanes(spheres.GetCentersZ() + index);
+        const hlslpp::float4 radiuses  = LoadLanes(spheres.GetRadiuses() + index);
+
+        hlslpp::float4 min_distances(std::numeric_limits<float>::max());
+        for(size_t plane_index = 0; plane_index < Frustum::planes_count; ++plane_index)
+        {
+            const hlslpp::float4 distances = planes.x[plane_index] * centers_x + planes.y[plane_index] * centers_y +
+                                             planes.z[plane_index] * centers_z + planes.w[plane_index] + radiuses;
+            min_distances = hlslpp::min(min_distances, distances);
+        }
+        AppendVisibleLanes(min_distances, index, end_index, visible_indices);
+    }
+}
+
+static void CullRange(const BroadcastPlanes& planes, const BoundingBoxes& boxes,
+                      Data::Index begin_index, Data::Index end_index, VisibleIndices& visible_indices)
+{
+    for(Data::Index index = begin_index; index < end_index; index += simd_width)
+    {
+        const hlslpp::float4 centers_x = LoadLanes(boxes.GetCentersX() + index);
+        const hlslpp::float4 centers_y = LoadLanes(boxes.GetCentersY() + index);
+        const hlslpp::float4 centers_z = LoadLanes(boxes.GetCentersZ() + index);
+        const hlslpp::float4 extents_x = LoadLanes(boxes.GetExtentsX() + index);
+        const hlslpp::float4 extents_y = LoadLanes(boxes.GetExtentsY() + index);
+        const hlslpp::float4 extents_z = LoadLanes(boxes.GetExtentsZ() + index);
+
+        // Box extent projected to plane normal is used as radius of the box relative to plane
+        hlslpp::float4 min_distances(std::numeric_limits<float>::max());
+        for(size_t plane_index = 0; plane_index < Frustum::planes_count; ++plane_index)
+        {
+            const hlslpp::float4 distances = planes.x[plane_index] * centers_x + planes.y[plane_index] * centers_y +
+                                             planes.z[plane_index] * centers_z + planes.w[plane_index] +
+                                             planes.abs_x[plane_index] * extents_x + planes.abs_y[plane_index] * extents_y +
+                                             planes.abs_z[plane_index] * extents_z;
+            min_distances = hlslpp::min(min_distances, distances);
+        }
+        AppendVisibleLanes(min_distances, index, end_index, visible_indices);
+    }
+}
+
+template<typename VolumesType>
+static void CullVolumes(const Frustum& frustum, const VolumesType& volumes, VisibleIndices& visible_indices,
+                        tf::Executor* parallel_executor_ptr, Data::Size chunk_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(chunk_size);
+    visible_indices.clear();
+
+    const BroadcastPlanes planes(frustum);
+    const Data::Size volumes_count = volumes.GetCount();
+    const Data::Size simd_chunk_size = GetPaddedCount(chunk_size);
+    const Data::Size chunks_count = Data::DivCeil(volumes_count, simd_chunk_size);
+    if (!parallel_executor_ptr || chunks_count <= 1U)
+    {
+        CullRange(planes, volumes, 0U, volumes_count, visible_indices);
+        return;
+    }
+
+    // Chunks are culled to separate lists in parallel and compacted in chunks order to keep visible indices ascending
+    std::vector<VisibleIndices> chunk_visible_indices(chunks_count);
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, chunks_count, 1U,
+        [&planes, &volumes, &chunk_visible_indices, simd_chunk_size, volumes_count](const Data::Index chunk_index)
+        {
+            const Data::Index begin_index = chunk_index * simd_chunk_size;
+            const Data::Index end_index   = std::min(begin_index + simd_chunk_size, volumes_count);
+            VisibleIndices& chunk_indices = chunk_visible_indices[chunk_index];
+            chunk_indices.reserve(end_index - begin_index);
+            CullRange(planes, volumes, begin_index, end_index, chunk_indices);
+        });
+    parallel_executor_ptr->run(task_flow).get();
+
+    size_t visible_count = 0U;
+    for(const VisibleIndices& chunk_indices : chunk_visible_indices)
+    {
+        visible_count += chunk_indices.size();
+    }
+    visible_indices.reserve(visible_count);
+    for(const VisibleIndices& chunk_indices : chunk_visible_indices)
+    {
+        visible_indices.insert(visible_indices.end(), chunk_indices.begin(), chunk_indices.end());
+    }
+}
+
+void Cull(const Frustum& frustum, const BoundingSpheres& spheres, VisibleIndices& visible_indices,
+          tf::Executor* parallel_executor_ptr, Data::Size chunk_size)
+{
+    META_FUNCTION_TASK();
+    CullVolumes(frustum, spheres, visible_indices, parallel_executor_ptr, chunk_size);
+}
+
+void Cull(const Frustum& frustum, const BoundingBoxes& boxes, VisibleIndices& visible_indices,
+          tf::Executor* parallel_executor_ptr, Data::Size chunk_size)
+{
+    META_FUNCTION_TASK();
+    CullVolumes(frustum, boxes, visible_indices, parallel_executor_ptr, chunk_size);
+}
+
+} // namespace FrustumCulling
+
+} // namespace Methane::Graphics
@@ -22,11 +22,19 @@ Abstract mesh class
 ******************************************************************************/
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/VertexPacking.h>
+#include <Methane/Data/Math.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <magic_enum.hpp>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <array>
+#include <cstring>
 
 namespace Methane::Graphics
 {
@@ -42,6 +50,9 @@ Data::Size Mesh::GetVertexFieldSize(size_t vertex_field_index)
         sizeof(Normal),
         sizeof(TexCoord),
         sizeof(Color),
+        sizeof(PackedPosition),
+        sizeof(PackedNormal),
+        sizeof(PackedTexCoord),
     }};
     return s_vertex_field_sizes[vertex_field_index];
 }
@@ -113,11 +124,14 @@ std::string_view Mesh::VertexLayout::GetSemanticByVertexField(VertexField vertex
 
     switch(vertex_field)
     {
-    case VertexField::Position: return "POSITION";
-    case VertexField::Normal:   return "NORMAL";
-    case VertexField::TexCoord: return "TEXCOORD";
-    case VertexField::Color:    return "COLOR";
-    default:                    META_UNEXPECTED_ARG_RETURN(vertex_field, "");
+    case VertexField::Position:       return "POSITION";
+    case VertexField::Normal:         return "NORMAL";
+    case VertexField::TexCoord:       return "TEXCOORD";
+    case VertexField::Color:          return "COLOR";
+    case VertexField::PackedPosition: return "PACKED_POSITION";
+    case VertexField::PackedNormal:   return "PACKED_NORMAL";
+    case VertexField::PackedTexCoord: return "PACKED_TEXCOORD";
+    default:                          META_UNEXPECTED_ARG_RETURN(vertex_field, "");
     }
 }
 
@@ -126,6 +140,12 @@ Mesh::VertexLayout::IncompatibleException::IncompatibleException(VertexField mis
     , m_missing_field(missing_field)
 { }
 
+bool Mesh::VertexLayout::HasField(VertexField field) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::find(begin(), end(), field) != end();
+}
+
 std::vector<std::string_view> Mesh::VertexLayout::GetSemantics() const
 {
     META_FUNCTION_TASK();
@@ -160,7 +180,10 @@ Mesh::VertexFieldOffsets Mesh::GetVertexFieldOffsets(const VertexLayout& vertex_
         current_offset += GetVertexFieldSize(vertex_field_index);
     }
 
-    META_CHECK_ARG_NAME_DESCR("vertex_layout", field_offsets[static_cast<size_t>(VertexField::Position)] >= 0, "position field must be specified in vertex layout");
+    META_CHECK_ARG_NAME_DESCR("vertex_layout",
+                              field_offsets[static_cast<size_t>(VertexField::Position)] >= 0 ||
+                              field_offsets[static_cast<size_t>(VertexField::PackedPosition)] >= 0,
+                              "position field must be specified in vertex layout");
     return field_offsets;
 }
 
@@ -182,7 +205,63 @@ Mesh::Mesh(Type type, const VertexLayout& vertex_layout)
     , m_vertex_size(GetVertexSize(m_vertex_layout))
 {
     META_FUNCTION_TASK();
-    CheckLayoutHasVertexField(VertexField::Position);
+    if (!HasVertexField(VertexField::PackedPosition))
+        CheckLayoutHasVertexField(VertexField::Position);
+}
+
+PixelFormat Mesh::GetIndexFormat() const noexcept
+{
+    META_FUNCTION_TASK();
+    // 16-bit indices are used whenever all vertices are addressable with them to save memory bandwidth
+    return GetVertexCount() <= static_cast<Data::Size>(std::numeric_limits<Index16>::max()) + 1U
+         ? PixelFormat::R16Uint
+         : PixelFormat::R32Uint;
+}
+
+Data::Size Mesh::GetIndexDataSize(PixelFormat index_format) const
+{
+    META_FUNCTION_TASK();
+    switch(index_format)
+    {
+    case PixelFormat::R16Uint: return GetIndexCount() * static_cast<Data::Size>(sizeof(Index16));
+    case PixelFormat::R32Uint: return GetIndexCount() * static_cast<Data::Size>(sizeof(Index));
+    default:                   META_UNEXPECTED_ARG_RETURN(index_format, 0U);
+    }
+}
+
+Mesh::Indices16 Mesh::GetIndices16() const
+{
+    META_FUNCTION_TASK();
+    Indices16 indices_16;
+    indices_16.reserve(m_indices.size());
+    std::transform(m_indices.begin(), m_indices.end(), std::back_inserter(indices_16),
+                   [](Index index)
+                   {
+                       META_CHECK_ARG_LESS_OR_EQUAL_DESCR(index, std::numeric_limits<Index16>::max(),
+                                                          "mesh index value does not fit into 16-bit index format");
+                       return static_cast<Index16>(index);
+                   });
+    return indices_16;
+}
+
+Mesh::Position Mesh::GetVertexPosition(Data::Index vertex_index) const
+{
+    META_FUNCTION_TASK();
+    if (HasVertexField(VertexField::PackedPosition))
+    {
+        PackedPosition packed_position{};
+        std::memcpy(&packed_position, GetVertexFieldData(vertex_index, VertexField::PackedPosition), sizeof(PackedPosition));
+        return VertexPacking::UnpackPosition(packed_position);
+    }
+    return *reinterpret_cast<const Position*>(GetVertexFieldData(vertex_index, VertexField::Position)); // NOSONAR
+}
+
+Data::ConstRawPtr Mesh::GetVertexFieldData(Data::Index vertex_index, VertexField field) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(vertex_index, GetVertexCount());
+    CheckLayoutHasVertexField(field);
+    return GetVertexData() + static_cast<size_t>(vertex_index) * m_vertex_size + GetVertexFieldOffset(field);
 }
 
 bool Mesh::HasVertexField(VertexField field) const noexcept
@@ -198,6 +277,27 @@ void Mesh::CheckLayoutHasVertexField(VertexField field) const
         throw VertexLayout::IncompatibleException(field);
 }
 
+void Mesh::ForEachIndexRangeParallel(tf::Executor& parallel_executor, Data::Size count, const IndexRangeFunc& range_func)
+{
+    META_FUNCTION_TASK();
+    if (!count)
+        return;
+
+    // Several chunks per worker are used to balance the load of workers with uneven chunk processing times
+    const auto       chunks_count = static_cast<Data::Size>(std::min<size_t>(parallel_executor.num_workers() * 4U, count));
+    const Data::Size chunk_size   = Data::DivCeil(count, chunks_count);
+
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, chunks_count, 1U,
+        [&range_func, chunk_size, count](const Data::Index chunk_index)
+        {
+            const Data::Index begin_index = chunk_index * chunk_size;
+            if (begin_index < count)
+                range_func(begin_index, std::min(begin_index + chunk_size, count));
+        });
+    parallel_executor.run(task_flow).get();
+}
+
 
 Mesh::Edge::Edge(Mesh::Index v1_index, Mesh::Index v2_index)
     : first_index( v1_index < v2_index ? v1_index : v2_index)
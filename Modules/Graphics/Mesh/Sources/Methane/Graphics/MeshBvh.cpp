@@ -0,0 +1,107 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshBvh.cpp
+Bounding volume hierarchy over mesh triangles for ray picking and frustum queries.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshBvh.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+static constexpr float g_parallel_ray_epsilon = 1E-12F; // ray is considered parallel to triangle plane below this determinant
+
+MeshBvh::MeshBvh(const Mesh& mesh, const Bvh::Settings& settings, tf::Executor* parallel_executor_ptr)
+    : MeshBvh(mesh, mesh.GetIndices(), settings, parallel_executor_ptr)
+{ }
+
+MeshBvh::MeshBvh(const Mesh& mesh, const Mesh::Indices& indices, const Bvh::Settings& settings, tf::Executor* parallel_executor_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(indices.size(), indices.size() % 3 == 0,
+                         "mesh indices count should be a multiple of three representing triangles list");
+
+    const size_t triangles_count = indices.size() / 3;
+    Bvh::PrimitiveBoxes triangle_boxes(triangles_count);
+    m_triangles.resize(triangles_count);
+    for(size_t triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
+    {
+        const hlslpp::float3 v1 = mesh.GetVertexPosition(indices[triangle_index * 3]).AsHlsl();
+        const hlslpp::float3 v2 = mesh.GetVertexPosition(indices[triangle_index * 3 + 1]).AsHlsl();
+        const hlslpp::float3 v3 = mesh.GetVertexPosition(indices[triangle_index * 3 + 2]).AsHlsl();
+        m_triangles[triangle_index] = Triangle{ v1, v2 - v1, v3 - v1 };
+
+        BoundingBox& triangle_box = triangle_boxes[triangle_index];
+        triangle_box.Add(v1);
+        triangle_box.Add(v2);
+        triangle_box.Add(v3);
+    }
+
+    m_bvh = Bvh(std::move(triangle_boxes), settings, parallel_executor_ptr);
+}
+
+std::optional<MeshBvh::Hit> MeshBvh::Intersect(const Ray& ray) const
+{
+    META_FUNCTION_TASK();
+    std::optional<Hit> closest_hit;
+    const std::optional<Bvh::Hit> bvh_hit = m_bvh.Intersect(ray,
+        [this, &closest_hit](Data::Index triangle_index, const Ray& triangle_ray, float max_distance) -> std::optional<float>
+        {
+            const std::optional<Hit> hit = IntersectTriangle(m_triangles[triangle_index], triangle_index, triangle_ray, max_distance);
+            if (!hit)
+                return std::nullopt;
+
+            closest_hit = hit;
+            return hit->distance;
+        });
+    return bvh_hit ? closest_hit : std::nullopt;
+}
+
+std::optional<MeshBvh::Hit> MeshBvh::IntersectTriangle(const Triangle& triangle, Data::Index triangle_index,
+                                                       const Ray& ray, float max_distance) noexcept
+{
+    const hlslpp::float3 p = hlslpp::cross(ray.direction, triangle.edge_2);
+    const auto determinant = static_cast<float>(hlslpp::dot(triangle.edge_1, p));
+    if (std::abs(determinant) < g_parallel_ray_epsilon)
+        return std::nullopt;
+
+    const float          inverse_determinant = 1.F / determinant;
+    const hlslpp::float3 t = ray.origin - triangle.vertex;
+    const float          u = static_cast<float>(hlslpp::dot(t, p)) * inverse_determinant;
+    if (u < 0.F || u > 1.F)
+        return std::nullopt;
+
+    const hlslpp::float3 q = hlslpp::cross(t, triangle.edge_1);
+    const float          v = static_cast<float>(hlslpp::dot(ray.direction, q)) * inverse_determinant;
+    if (v < 0.F || u + v > 1.F)
+        return std::nullopt;
+
+    const float distance = static_cast<float>(hlslpp::dot(triangle.edge_2, q)) * inverse_determinant;
+    if (distance < 0.F || distance >= max_distance)
+        return std::nullopt;
+
+    return Hit{ triangle_index, distance, u, v };
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,351 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshCache.cpp
+Versioned binary mesh cache format with vertex layout, subsets, bounds
+and index width, readable in place from memory without copying mesh data.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshCache.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <limits>
+#include <array>
+
+namespace Methane::Graphics
+{
+
+static constexpr std::array<char, 4> g_mesh_cache_magic{ 'M', 'M', 'S', 'H' };
+static constexpr uint32_t            g_max_vertex_fields = 16U;
+static constexpr Data::Size          g_section_alignment = 16U; // sections are aligned for direct SIMD reads of mapped data
+
+// All fields are 4-byte wide, so the structure layout is the same on all supported platforms
+struct MeshCacheHeader
+{
+    std::array<char, 4>                       magic;
+    uint32_t                                  version;
+    uint32_t                                  mesh_type;
+    uint32_t                                  vertex_fields_count;
+    std::array<uint32_t, g_max_vertex_fields> vertex_fields;
+    uint32_t                                  vertex_size;
+    uint32_t                                  vertex_count;
+    uint32_t                                  index_size;
+    uint32_t                                  index_count;
+    uint32_t                                  subsets_count;
+    std::array<float, 3>                      bounds_min;
+    std::array<float, 3>                      bounds_max;
+    uint32_t                                  subsets_offset;
+    uint32_t                                  vertices_offset;
+    uint32_t                                  indices_offset;
+    uint32_t                                  data_size;
+};
+
+struct MeshCacheSubset
+{
+    uint32_t mesh_type;
+    uint32_t vertex_offset;
+    uint32_t vertex_count;
+    uint32_t index_offset;
+    uint32_t index_count;
+    uint32_t indices_adjusted;
+};
+
+static_assert(sizeof(MeshCacheHeader) == 140U, "mesh cache header layout has changed, increment format version");
+static_assert(sizeof(MeshCacheSubset) == 24U,  "mesh cache subset layout has changed, increment format version");
+
+[[nodiscard]] static bool IsValidMeshType(uint32_t mesh_type) noexcept
+{
+    return mesh_type < static_cast<uint32_t>(magic_enum::enum_count<Mesh::Type>());
+}
+
+[[nodiscard]] static Data::Size AlignSectionOffset(Data::Size offset) noexcept
+{
+    return (offset + g_section_alignment - 1U) / g_section_alignment * g_section_alignment;
+}
+
+[[nodiscard]] static uint32_t GetIndexSize(PixelFormat index_format)
+{
+    META_FUNCTION_TASK();
+    switch(index_format)
+    {
+    case PixelFormat::R16Uint: return static_cast<uint32_t>(sizeof(Mesh::Index16));
+    case PixelFormat::R32Uint: return static_cast<uint32_t>(sizeof(Mesh::Index));
+    default:                   META_UNEXPECTED_ARG_RETURN(index_format, 0U);
+    }
+}
+
+[[nodiscard]] static MeshCache::Bounds ComputeBounds(const Mesh& mesh)
+{
+    META_FUNCTION_TASK();
+    if (!mesh.GetVertexCount())
+        return MeshCache::Bounds{ Mesh::Position(0.F, 0.F, 0.F), Mesh::Position(0.F, 0.F, 0.F) };
+
+    hlslpp::float3 min_position(std::numeric_limits<float>::max());
+    hlslpp::float3 max_position(std::numeric_limits<float>::lowest());
+    for(Data::Index vertex_index = 0U; vertex_index < mesh.GetVertexCount(); ++vertex_index)
+    {
+        const hlslpp::float3 position = mesh.GetVertexPosition(vertex_index).AsHlsl();
+        min_position = hlslpp::min(min_position, position);
+        max_position = hlslpp::max(max_position, position);
+    }
+    return MeshCache::Bounds{ Mesh::Position(min_position), Mesh::Position(max_position) };
+}
+
+template<typename T>
+static void WriteSection(Data::Bytes& data, Data::Size offset, const T* items_ptr, size_t items_count)
+{
+    if (items_count)
+        std::memcpy(data.data() + offset, items_ptr, items_count * sizeof(T));
+}
+
+Data::Bytes MeshCache::Serialize(const Mesh& mesh, const Mesh::Subsets& subsets)
+{
+    META_FUNCTION_TASK();
+    const Mesh::VertexLayout& vertex_layout = mesh.GetVertexLayout();
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(vertex_layout.size(), g_max_vertex_fields, "mesh vertex layout has too many fields for mesh cache");
+
+    const PixelFormat index_format = mesh.GetIndexFormat();
+    const Bounds      bounds       = ComputeBounds(mesh);
+
+    MeshCacheHeader header{};
+    header.magic               = g_mesh_cache_magic;
+    header.version             = format_version;
+    header.mesh_type           = static_cast<uint32_t>(mesh.GetType());
+    header.vertex_fields_count = static_cast<uint32_t>(vertex_layout.size());
+    std::transform(vertex_layout.begin(), vertex_layout.end(), header.vertex_fields.begin(),
+                   [](Mesh::VertexField vertex_field) { return static_cast<uint32_t>(vertex_field); });
+    header.vertex_size         = mesh.GetVertexSize();
+    header.vertex_count        = mesh.GetVertexCount();
+    header.index_size          = GetIndexSize(index_format);
+    header.index_count         = mesh.GetIndexCount();
+    header.subsets_count       = static_cast<uint32_t>(subsets.size());
+    header.bounds_min          = { bounds.min.GetX(), bounds.min.GetY(), bounds.min.GetZ() };
+    header.bounds_max          = { bounds.max.GetX(), bounds.max.GetY(), bounds.max.GetZ() };
+    header.subsets_offset      = AlignSectionOffset(static_cast<Data::Size>(sizeof(MeshCacheHeader)));
+    header.vertices_offset     = AlignSectionOffset(header.subsets_offset + header.subsets_count * static_cast<Data::Size>(sizeof(MeshCacheSubset)));
+    header.indices_offset      = AlignSectionOffset(header.vertices_offset + mesh.GetVertexDataSize());
+    header.data_size           = header.indices_offset + mesh.GetIndexDataSize(index_format);
+
+    std::vector<MeshCacheSubset> cache_subsets;
+    cache_subsets.reserve(subsets.size());
+    std::transform(subsets.begin(), subsets.end(), std::back_inserter(cache_subsets),
+                   [](const Mesh::Subset& subset)
+                   {
+                       return MeshCacheSubset{
+                           static_cast<uint32_t>(subset.mesh_type),
+                           subset.vertices.offset, subset.vertices.count,
+                           subset.indices.offset,  subset.indices.count,
+                           subset.indices_adjusted ? 1U : 0U
+                       };
+                   });
+
+    Data::Bytes data(header.data_size, Data::Byte{});
+    WriteSection(data, 0U, &header, 1U);
+    WriteSection(data, header.subsets_offset, cache_subsets.data(), cache_subsets.size());
+    WriteSection(data, header.vertices_offset, mesh.GetVertexData(), mesh.GetVertexDataSize());
+    if (index_format == PixelFormat::R16Uint)
+    {
+        const Mesh::Indices16 indices_16 = mesh.GetIndices16();
+        WriteSection(data, header.indices_offset, indices_16.data(), indices_16.size());
+    }
+    else
+    {
+        WriteSection(data, header.indices_offset, mesh.GetIndices().data(), mesh.GetIndices().size());
+    }
+    return data;
+}
+
+void MeshCache::Save(const std::string& file_path, const Mesh& mesh, const Mesh::Subsets& subsets)
+{
+    META_FUNCTION_TASK();
+    const Data::Bytes data = Serialize(mesh, subsets);
+    std::ofstream fs(file_path, std::ios::binary | std::ios::trunc);
+    META_CHECK_ARG_DESCR(file_path, fs.good(), "failed to open mesh cache file for writing");
+    fs.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())); // NOSONAR
+}
+
+MeshCache::MeshCache(Data::Chunk&& data)
+    : m_data(std::move(data))
+{
+    META_FUNCTION_TASK();
+    Parse();
+}
+
+MeshCache::MeshCache(const Data::IProvider& data_provider, const std::string& path)
+    : MeshCache(data_provider.GetData(path))
+{ }
+
+Data::Size MeshCache::GetIndexDataSize() const noexcept
+{
+    return m_index_count * (m_index_format == PixelFormat::R16Uint
+                            ? static_cast<Data::Size>(sizeof(Mesh::Index16))
+                            : static_cast<Data::Size>(sizeof(Mesh::Index)));
+}
+
+Mesh::Index MeshCache::GetIndex(Data::Index index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(index, m_index_count);
+    if (m_index_format == PixelFormat::R16Uint)
+    {
+        Mesh::Index16 index_16 = 0U;
+        std::memcpy(&index_16, GetIndexData() + index * sizeof(Mesh::Index16), sizeof(Mesh::Index16));
+        return index_16;
+    }
+
+    Mesh::Index index_32 = 0U;
+    std::memcpy(&index_32, GetIndexData() + index * sizeof(Mesh::Index), sizeof(Mesh::Index));
+    return index_32;
+}
+
+Mesh::Indices MeshCache::GetIndices() const
+{
+    META_FUNCTION_TASK();
+    Mesh::Indices indices(m_index_count, 0U);
+    if (m_index_format == PixelFormat::R16Uint)
+    {
+        Mesh::Indices16 indices_16(m_index_count, 0U);
+        std::memcpy(indices_16.data(), GetIndexData(), GetIndexDataSize());
+        std::copy(indices_16.begin(), indices_16.end(), indices.begin());
+    }
+    else
+    {
+        std::memcpy(indices.data(), GetIndexData(), GetIndexDataSize());
+    }
+    return indices;
+}
+
+template<typename IndexType>
+[[nodiscard]] static Mesh::Index GetMaxIndex(Data::ConstRawPtr index_data_ptr, Data::Size index_count) noexcept
+{
+    Mesh::Index max_index = 0U;
+    for(Data::Index index = 0U; index < index_count; ++index)
+    {
+        IndexType index_value = 0U;
+        std::memcpy(&index_value, index_data_ptr + index * sizeof(IndexType), sizeof(IndexType));
+        max_index = std::max(max_index, static_cast<Mesh::Index>(index_value));
+    }
+    return max_index;
+}
+
+void MeshCache::ValidateIndices() const
+{
+    META_FUNCTION_TASK();
+    if (!m_index_count)
+        return;
+
+    const Mesh::Index max_index = m_index_format == PixelFormat::R16Uint
+                                ? GetMaxIndex<Mesh::Index16>(GetIndexData(), m_index_count)
+                                : GetMaxIndex<Mesh::Index>(GetIndexData(), m_index_count);
+    if (max_index >= m_vertex_count)
+        throw FormatException(fmt::format("Mesh cache index {} is out of vertices range {}.", max_index, m_vertex_count));
+}
+
+// Cache data layout is validated with exceptions regardless of checks configuration, since it comes from external source
+void MeshCache::Parse()
+{
+    META_FUNCTION_TASK();
+    const Data::Size data_size = m_data.GetDataSize();
+    if (m_data.IsEmptyOrNull() || data_size < sizeof(MeshCacheHeader))
+        throw FormatException(fmt::format("Mesh cache data size {} is too small to hold the header.", data_size));
+
+    MeshCacheHeader header{};
+    std::memcpy(&header, m_data.GetDataPtr(), sizeof(MeshCacheHeader));
+
+    if (header.magic != g_mesh_cache_magic)
+        throw FormatException("Mesh cache data has invalid signature.");
+
+    if (header.version != format_version)
+        throw FormatException(fmt::format("Mesh cache version {} is not supported, expected version {}.", header.version, format_version));
+
+    if (header.data_size != data_size)
+        throw FormatException(fmt::format("Mesh cache data size {} differs from size {} stored in header.", data_size, header.data_size));
+
+    if (header.vertex_fields_count > g_max_vertex_fields)
+        throw FormatException(fmt::format("Mesh cache vertex layout fields count {} is too large.", header.vertex_fields_count));
+
+    m_vertex_layout.reserve(header.vertex_fields_count);
+    for(uint32_t field_index = 0U; field_index < header.vertex_fields_count; ++field_index)
+    {
+        if (header.vertex_fields[field_index] >= static_cast<uint32_t>(Mesh::VertexField::Count))
+            throw FormatException(fmt::format("Mesh cache vertex layout has unknown field {}.", header.vertex_fields[field_index]));
+        m_vertex_layout.push_back(static_cast<Mesh::VertexField>(header.vertex_fields[field_index]));
+    }
+
+    if (header.vertex_size != Mesh::GetVertexSize(m_vertex_layout))
+        throw FormatException(fmt::format("Mesh cache vertex size {} does not match vertex layout.", header.vertex_size));
+
+    switch(header.index_size)
+    {
+    case sizeof(Mesh::Index16): m_index_format = PixelFormat::R16Uint; break;
+    case sizeof(Mesh::Index):   m_index_format = PixelFormat::R32Uint; break;
+    default: throw FormatException(fmt::format("Mesh cache index size {} is not supported.", header.index_size));
+    }
+
+    // Section bounds are checked in 64-bit arithmetic to exclude overflow with corrupted header values
+    const auto is_section_valid = [data_size](uint32_t offset, uint64_t size)
+    {
+        return offset % g_section_alignment == 0U && static_cast<uint64_t>(offset) + size <= data_size;
+    };
+    if (!is_section_valid(header.subsets_offset,  static_cast<uint64_t>(header.subsets_count) * sizeof(MeshCacheSubset)) ||
+        !is_section_valid(header.vertices_offset, static_cast<uint64_t>(header.vertex_count) * header.vertex_size) ||
+        !is_section_valid(header.indices_offset,  static_cast<uint64_t>(header.index_count) * header.index_size))
+        throw FormatException("Mesh cache data sections are out of data bounds.");
+
+    if (!IsValidMeshType(header.mesh_type))
+        throw FormatException(fmt::format("Mesh cache has unknown mesh type {}.", header.mesh_type));
+
+    m_type               = static_cast<Mesh::Type>(header.mesh_type);
+    m_vertex_size        = header.vertex_size;
+    m_vertex_count       = header.vertex_count;
+    m_vertex_data_offset = header.vertices_offset;
+    m_index_count        = header.index_count;
+    m_index_data_offset  = header.indices_offset;
+    m_bounds             = Bounds{
+        Mesh::Position(header.bounds_min[0], header.bounds_min[1], header.bounds_min[2]),
+        Mesh::Position(header.bounds_max[0], header.bounds_max[1], header.bounds_max[2])
+    };
+
+    m_subsets.reserve(header.subsets_count);
+    for(uint32_t subset_index = 0U; subset_index < header.subsets_count; ++subset_index)
+    {
+        MeshCacheSubset subset{};
+        std::memcpy(&subset, m_data.GetDataPtr() + header.subsets_offset + subset_index * sizeof(MeshCacheSubset), sizeof(MeshCacheSubset));
+        if (static_cast<uint64_t>(subset.vertex_offset) + subset.vertex_count > m_vertex_count ||
+            static_cast<uint64_t>(subset.index_offset) + subset.index_count > m_index_count)
+            throw FormatException(fmt::format("Mesh cache subset {} is out of mesh bounds.", subset_index));
+        if (!IsValidMeshType(subset.mesh_type))
+            throw FormatException(fmt::format("Mesh cache subset {} has unknown mesh type {}.", subset_index, subset.mesh_type));
+
+        m_subsets.emplace_back(static_cast<Mesh::Type>(subset.mesh_type),
+                               Mesh::Subset::Slice(subset.vertex_offset, subset.vertex_count),
+                               Mesh::Subset::Slice(subset.index_offset,  subset.index_count),
+                               subset.indices_adjusted != 0U);
+    }
+
+    ValidateIndices();
+}
+
+} // namespace Methane::Graphics
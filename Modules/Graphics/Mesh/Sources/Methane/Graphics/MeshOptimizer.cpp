@@ -0,0 +1,406 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshOptimizer.cpp
+Mesh optimization algorithms: post-transform vertex cache optimization
+with Forsyth index reordering, overdraw-aware cluster sorting
+and vertex fetch remapping.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cmath>
+
+namespace Methane::Graphics::MeshOptimizer
+{
+
+static constexpr Mesh::Index g_invalid_index               = std::numeric_limits<Mesh::Index>::max();
+static constexpr Data::Size  g_invalid_triangle            = std::numeric_limits<Data::Size>::max();
+static constexpr Data::Size  g_forsyth_cache_size          = 32U;
+static constexpr float       g_forsyth_cache_decay_power   = 1.5F;
+static constexpr float       g_forsyth_last_triangle_score = 0.75F;
+static constexpr float       g_forsyth_valence_boost_scale = 2.F;
+static constexpr float       g_forsyth_valence_boost_power = 0.5F;
+
+static void CheckTriangleListIndices(const Mesh::Indices& indices, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(indices.size(), indices.size() % 3 == 0,
+                         "mesh indices count should be a multiple of three representing triangles list");
+    for(const Mesh::Index index : indices)
+    {
+        META_CHECK_ARG_LESS_DESCR(index, vertex_count, "mesh index is out of vertex range");
+    }
+}
+
+static float GetForsythVertexScore(int32_t cache_position, Data::Size remaining_valence) noexcept
+{
+    if (!remaining_valence)
+        return -1.F; // vertex is not used by any remaining triangle
+
+    float score = 0.F;
+    if (cache_position >= 0)
+    {
+        if (cache_position < 3)
+        {
+            // Vertices of the last emitted triangle get fixed score to discourage using them again immediately
+            score = g_forsyth_last_triangle_score;
+        }
+        else
+        {
+            const float cache_position_scale = 1.F / static_cast<float>(g_forsyth_cache_size - 3);
+            score = std::pow(1.F - static_cast<float>(cache_position - 3) * cache_position_scale, g_forsyth_cache_decay_power);
+        }
+    }
+
+    // Boost score of vertices with few remaining triangles to get rid of lone vertices quickly
+    score += g_forsyth_valence_boost_scale * std::pow(static_cast<float>(remaining_valence), -g_forsyth_valence_boost_power);
+    return score;
+}
+
+VertexCacheStatistics& VertexCacheStatistics::operator+=(const VertexCacheStatistics& other) noexcept
+{
+    META_FUNCTION_TASK();
+    triangles_count      += other.triangles_count;
+    vertices_count       += other.vertices_count;
+    vertices_transformed += other.vertices_transformed;
+    acmr = triangles_count ? static_cast<float>(vertices_transformed) / static_cast<float>(triangles_count) : 0.F;
+    atvr = vertices_count  ? static_cast<float>(vertices_transformed) / static_cast<float>(vertices_count)  : 0.F;
+    return *this;
+}
+
+VertexCacheStatistics::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    return fmt::format("ACMR {:.3f}, ATVR {:.3f} ({} transformed vertices for {} triangles and {} unique vertices)",
+                       acmr, atvr, vertices_transformed, triangles_count, vertices_count);
+}
+
+Statistics& Statistics::operator+=(const Statistics& other) noexcept
+{
+    META_FUNCTION_TASK();
+    before += other.before;
+    after  += other.after;
+    return *this;
+}
+
+Statistics::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    return fmt::format("before: {}; after: {}", static_cast<std::string>(before), static_cast<std::string>(after));
+}
+
+VertexCacheStatistics AnalyzeVertexCache(const Mesh::Indices& indices, Data::Size vertex_count, Data::Size cache_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER_OR_EQUAL(cache_size, 3U);
+    CheckTriangleListIndices(indices, vertex_count);
+
+    // FIFO cache is simulated with vertex timestamps: vertex is in cache when it was added less than cache_size misses ago
+    std::vector<Data::Size> vertex_timestamps(vertex_count, 0U);
+    std::vector<bool>       vertex_referenced(vertex_count, false);
+    Data::Size              cache_timestamp = cache_size + 1U;
+
+    VertexCacheStatistics statistics;
+    for(const Mesh::Index index : indices)
+    {
+        if (cache_timestamp - vertex_timestamps[index] > cache_size)
+        {
+            vertex_timestamps[index] = cache_timestamp++;
+            statistics.vertices_transformed++;
+        }
+        if (!vertex_referenced[index])
+        {
+            vertex_referenced[index] = true;
+            statistics.vertices_count++;
+        }
+    }
+
+    statistics.triangles_count = static_cast<Data::Size>(indices.size() / 3);
+    statistics.acmr = statistics.triangles_count ? static_cast<float>(statistics.vertices_transformed) / static_cast<float>(statistics.triangles_count) : 0.F;
+    statistics.atvr = statistics.vertices_count  ? static_cast<float>(statistics.vertices_transformed) / static_cast<float>(statistics.vertices_count)  : 0.F;
+    return statistics;
+}
+
+Mesh::Indices OptimizeVertexCache(const Mesh::Indices& indices, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    CheckTriangleListIndices(indices, vertex_count);
+
+    const auto triangles_count = static_cast<Data::Size>(indices.size() / 3);
+    if (!triangles_count)
+        return indices;
+
+    // Build vertex to triangles adjacency in compressed rows: live triangles are kept in front of each vertex row
+    std::vector<Data::Size> vertex_valence(vertex_count, 0U);
+    for(const Mesh::Index index : indices)
+    {
+        vertex_valence[index]++;
+    }
+
+    std::vector<Data::Size> adjacency_offsets(vertex_count + 1, 0U);
+    std::partial_sum(vertex_valence.begin(), vertex_valence.end(), adjacency_offsets.begin() + 1);
+
+    std::vector<Data::Size> adjacent_triangles(indices.size());
+    std::vector<Data::Size> adjacency_fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+    for(Data::Size triangle_index = 0U; triangle_index < triangles_count; ++triangle_index)
+    {
+        for(Data::Size corner = 0U; corner < 3U; ++corner)
+        {
+            adjacent_triangles[adjacency_fill[indices[triangle_index * 3 + corner]]++] = triangle_index;
+        }
+    }
+
+    std::vector<float> vertex_scores(vertex_count);
+    for(Data::Size vertex_index = 0U; vertex_index < vertex_count; ++vertex_index)
+    {
+        vertex_scores[vertex_index] = GetForsythVertexScore(-1, vertex_valence[vertex_index]);
+    }
+
+    std::vector<float> triangle_scores(triangles_count);
+    std::vector<bool>  triangle_emitted(triangles_count, false);
+    for(Data::Size triangle_index = 0U; triangle_index < triangles_count; ++triangle_index)
+    {
+        triangle_scores[triangle_index] = vertex_scores[indices[triangle_index * 3]]
+                                        + vertex_scores[indices[triangle_index * 3 + 1]]
+                                        + vertex_scores[indices[triangle_index * 3 + 2]];
+    }
+
+    Mesh::Indices optimized_indices;
+    optimized_indices.reserve(indices.size());
+
+    // LRU cache is 3 entries larger than simulated cache to hold vertices pushed out by the last triangle
+    std::vector<Mesh::Index> cache;
+    std::vector<Mesh::Index> new_cache;
+    cache.reserve(g_forsyth_cache_size + 3);
+    new_cache.reserve(g_forsyth_cache_size + 3);
+
+    Data::Size best_triangle = static_cast<Data::Size>(std::distance(triangle_scores.begin(), std::max_element(triangle_scores.begin(), triangle_scores.end())));
+    Data::Size input_cursor  = 0U;
+    for(Data::Size emitted_count = 0U; emitted_count < triangles_count; ++emitted_count)
+    {
+        if (best_triangle == g_invalid_triangle)
+        {
+            // Dead end: continue with the next not emitted triangle in input order
+            while (triangle_emitted[input_cursor])
+                input_cursor++;
+            best_triangle = input_cursor;
+        }
+
+        const std::array<Mesh::Index, 3> triangle_vertices{
+            indices[best_triangle * 3],
+            indices[best_triangle * 3 + 1],
+            indices[best_triangle * 3 + 2]
+        };
+        optimized_indices.insert(optimized_indices.end(), triangle_vertices.begin(), triangle_vertices.end());
+        triangle_emitted[best_triangle] = true;
+
+        // Remove emitted triangle from live adjacency rows of its vertices
+        for(const Mesh::Index vertex_index : triangle_vertices)
+        {
+            const auto row_begin = adjacent_triangles.begin() + adjacency_offsets[vertex_index];
+            const auto row_end   = row_begin + vertex_valence[vertex_index];
+            const auto row_it    = std::find(row_begin, row_end, best_triangle);
+            if (row_it == row_end)
+                continue;
+
+            std::iter_swap(row_it, row_end - 1);
+            vertex_valence[vertex_index]--;
+        }
+
+        // Move triangle vertices to the front of LRU cache
+        new_cache.clear();
+        for(const Mesh::Index vertex_index : triangle_vertices)
+        {
+            if (std::find(new_cache.begin(), new_cache.end(), vertex_index) == new_cache.end())
+                new_cache.push_back(vertex_index);
+        }
+        for(const Mesh::Index cached_vertex_index : cache)
+        {
+            if (std::find(triangle_vertices.begin(), triangle_vertices.end(), cached_vertex_index) == triangle_vertices.end())
+                new_cache.push_back(cached_vertex_index);
+        }
+        if (new_cache.size() > g_forsyth_cache_size + 3)
+            new_cache.resize(g_forsyth_cache_size + 3);
+        cache.swap(new_cache);
+
+        // Update scores of cached vertices and their live triangles
+        for(size_t cache_index = 0; cache_index < cache.size(); ++cache_index)
+        {
+            const Mesh::Index vertex_index   = cache[cache_index];
+            const int32_t     cache_position = cache_index < g_forsyth_cache_size ? static_cast<int32_t>(cache_index) : -1;
+            const float       vertex_score   = GetForsythVertexScore(cache_position, vertex_valence[vertex_index]);
+            const float       score_delta    = vertex_score - vertex_scores[vertex_index];
+            vertex_scores[vertex_index] = vertex_score;
+
+            for(Data::Size adjacent_index = 0U; adjacent_index < vertex_valence[vertex_index]; ++adjacent_index)
+            {
+                triangle_scores[adjacent_triangles[adjacency_offsets[vertex_index] + adjacent_index]] += score_delta;
+            }
+        }
+
+        // Next triangle is the best scored among live triangles adjacent to cached vertices
+        best_triangle = g_invalid_triangle;
+        float best_triangle_score = -1.F;
+        for(const Mesh::Index vertex_index : cache)
+        {
+            for(Data::Size adjacent_index = 0U; adjacent_index < vertex_valence[vertex_index]; ++adjacent_index)
+            {
+                const Data::Size triangle_index = adjacent_triangles[adjacency_offsets[vertex_index] + adjacent_index];
+                if (triangle_scores[triangle_index] > best_triangle_score)
+                {
+                    best_triangle_score = triangle_scores[triangle_index];
+                    best_triangle       = triangle_index;
+                }
+            }
+        }
+    }
+
+    return optimized_indices;
+}
+
+Mesh::Indices OptimizeOverdraw(const Mesh::Indices& indices, const Mesh& mesh, Data::Index vertex_base_index, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    CheckTriangleListIndices(indices, vertex_count);
+    META_CHECK_ARG_LESS_OR_EQUAL(vertex_base_index + vertex_count, mesh.GetVertexCount());
+
+    struct Cluster
+    {
+        Data::Size     first_triangle = 0U;
+        Data::Size     triangles_count = 0U;
+        hlslpp::float3 centroid{ 0.F };
+        hlslpp::float3 normal{ 0.F };
+        float          area = 0.F;
+        float          sort_key = 0.F;
+    };
+
+    // Split cache-optimized triangles into clusters on hard cache boundaries, where all triangle vertices miss in cache,
+    // so that reordering of clusters does not degrade vertex cache efficiency
+    const auto       triangles_count = static_cast<Data::Size>(indices.size() / 3);
+    const Data::Size cache_size      = g_forsyth_cache_size;
+    std::vector<Data::Size> vertex_timestamps(vertex_count, 0U);
+    Data::Size              cache_timestamp = cache_size + 1U;
+    std::vector<Cluster>    clusters;
+
+    for(Data::Size triangle_index = 0U; triangle_index < triangles_count; ++triangle_index)
+    {
+        Data::Size cache_misses = 0U;
+        for(Data::Size corner = 0U; corner < 3U; ++corner)
+        {
+            const Mesh::Index vertex_index = indices[triangle_index * 3 + corner];
+            if (cache_timestamp - vertex_timestamps[vertex_index] > cache_size)
+            {
+                vertex_timestamps[vertex_index] = cache_timestamp++;
+                cache_misses++;
+            }
+        }
+
+        if (clusters.empty() || cache_misses == 3U)
+        {
+            Cluster cluster;
+            cluster.first_triangle = triangle_index;
+            clusters.push_back(cluster);
+        }
+        clusters.back().triangles_count++;
+    }
+
+    // Compute area weighted centroids and normals of clusters and of the whole mesh
+    hlslpp::float3 mesh_centroid(0.F);
+    float          mesh_area = 0.F;
+    for(Cluster& cluster : clusters)
+    {
+        for(Data::Size triangle_index = cluster.first_triangle; triangle_index < cluster.first_triangle + cluster.triangles_count; ++triangle_index)
+        {
+            const hlslpp::float3 p1 = mesh.GetVertexPosition(vertex_base_index + indices[triangle_index * 3]).AsHlsl();
+            const hlslpp::float3 p2 = mesh.GetVertexPosition(vertex_base_index + indices[triangle_index * 3 + 1]).AsHlsl();
+            const hlslpp::float3 p3 = mesh.GetVertexPosition(vertex_base_index + indices[triangle_index * 3 + 2]).AsHlsl();
+            const hlslpp::float3 normal = hlslpp::cross(p2 - p1, p3 - p1);
+            const float          area   = hlslpp::length(normal);
+
+            cluster.centroid += (p1 + p2 + p3) * (area / 3.F);
+            cluster.normal   += normal;
+            cluster.area     += area;
+        }
+
+        mesh_centroid += cluster.centroid;
+        mesh_area     += cluster.area;
+
+        if (cluster.area > std::numeric_limits<float>::epsilon())
+            cluster.centroid /= cluster.area;
+    }
+
+    if (mesh_area > std::numeric_limits<float>::epsilon())
+        mesh_centroid /= mesh_area;
+
+    // Clusters facing outwards from the mesh centroid are more likely to occlude others, so they are drawn first
+    for(Cluster& cluster : clusters)
+    {
+        const float normal_length = hlslpp::length(cluster.normal);
+        cluster.sort_key = normal_length > std::numeric_limits<float>::epsilon()
+                         ? static_cast<float>(hlslpp::dot(cluster.centroid - mesh_centroid, cluster.normal / normal_length))
+                         : 0.F;
+    }
+
+    std::stable_sort(clusters.begin(), clusters.end(),
+                     [](const Cluster& left, const Cluster& right) { return left.sort_key > right.sort_key; });
+
+    Mesh::Indices optimized_indices;
+    optimized_indices.reserve(indices.size());
+    for(const Cluster& cluster : clusters)
+    {
+        optimized_indices.insert(optimized_indices.end(),
+                                 indices.begin() + cluster.first_triangle * 3,
+                                 indices.begin() + (cluster.first_triangle + cluster.triangles_count) * 3);
+    }
+    return optimized_indices;
+}
+
+VertexRemap OptimizeVertexFetch(Mesh::Indices& indices, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    CheckTriangleListIndices(indices, vertex_count);
+
+    // Vertices are renumbered in order of their first reference, unreferenced vertices are moved to the end
+    VertexRemap vertex_remap(vertex_count, g_invalid_index);
+    Mesh::Index next_vertex_index = 0U;
+    for(Mesh::Index& index : indices)
+    {
+        Mesh::Index& remapped_index = vertex_remap[index];
+        if (remapped_index == g_invalid_index)
+            remapped_index = next_vertex_index++;
+        index = remapped_index;
+    }
+
+    for(Mesh::Index& remapped_index : vertex_remap)
+    {
+        if (remapped_index == g_invalid_index)
+            remapped_index = next_vertex_index++;
+    }
+
+    return vertex_remap;
+}
+
+} // namespace Methane::Graphics::MeshOptimizer
@@ -0,0 +1,500 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshSimplifier.cpp
+Mesh simplification with quadric error metrics and attribute-aware
+edge collapses used for levels of detail generation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshSimplifier.h>
+#include <Methane/Graphics/VertexPacking.h>
+#include <Methane/Graphics/EdgeHashMap.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
+#include <cstring>
+#include <queue>
+#include <limits>
+#include <cmath>
+
+namespace Methane::Graphics::MeshSimplifier
+{
+
+static constexpr float g_min_collapsed_normal_dot = 0.2F; // collapse is rejected when it flips or folds any triangle stronger
+
+using Triangle = std::array<Mesh::Index, 3>;
+
+class Quadric
+{
+public:
+    Quadric() = default;
+
+    // Quadric of squared distance to the plane with unit normal, weighted by triangle area
+    Quadric(const hlslpp::float3& normal, float distance, double weight) noexcept
+    {
+        const double a = static_cast<float>(normal.x);
+        const double b = static_cast<float>(normal.y);
+        const double c = static_cast<float>(normal.z);
+        const double d = distance;
+        m_a2 = weight * a * a; m_ab = weight * a * b; m_ac = weight * a * c; m_ad = weight * a * d;
+        m_b2 = weight * b * b; m_bc = weight * b * c; m_bd = weight * b * d;
+        m_c2 = weight * c * c; m_cd = weight * c * d;
+        m_d2 = weight * d * d;
+        m_weight = weight;
+    }
+
+    Quadric& operator+=(const Quadric& other) noexcept
+    {
+        m_a2 += other.m_a2; m_ab += other.m_ab; m_ac += other.m_ac; m_ad += other.m_ad;
+        m_b2 += other.m_b2; m_bc += other.m_bc; m_bd += other.m_bd;
+        m_c2 += other.m_c2; m_cd += other.m_cd;
+        m_d2 += other.m_d2;
+        m_weight += other.m_weight;
+        return *this;
+    }
+
+    // Returns mean squared distance from position to the accumulated planes
+    [[nodiscard]] double Evaluate(const hlslpp::float3& position) const noexcept
+    {
+        if (m_weight <= 0.0)
+            return 0.0;
+
+        const double x = static_cast<float>(position.x);
+        const double y = static_cast<float>(position.y);
+        const double z = static_cast<float>(position.z);
+        const double distance_sq = m_a2 * x * x + 2.0 * m_ab * x * y + 2.0 * m_ac * x * z + 2.0 * m_ad * x
+                                 + m_b2 * y * y + 2.0 * m_bc * y * z + 2.0 * m_bd * y
+                                 + m_c2 * z * z + 2.0 * m_cd * z
+                                 + m_d2;
+        return std::max(distance_sq, 0.0) / m_weight;
+    }
+
+private:
+    double m_a2 = 0.0;
+    double m_ab = 0.0;
+    double m_ac = 0.0;
+    double m_ad = 0.0;
+    double m_b2 = 0.0;
+    double m_bc = 0.0;
+    double m_bd = 0.0;
+    double m_c2 = 0.0;
+    double m_cd = 0.0;
+    double m_d2 = 0.0;
+    double m_weight = 0.0;
+};
+
+struct VertexAttributes
+{
+    hlslpp::float3 normal{ 0.F };
+    hlslpp::float2 texcoord{ 0.F };
+};
+
+struct Collapse
+{
+    double      cost;
+    Mesh::Index source;
+    Mesh::Index target;
+    uint32_t    source_version;
+    uint32_t    target_version;
+
+    [[nodiscard]] bool operator>(const Collapse& other) const noexcept { return cost > other.cost; }
+};
+
+struct PositionKeyHash
+{
+    [[nodiscard]] size_t operator()(const std::array<uint32_t, 3>& key) const noexcept
+    {
+        return static_cast<size_t>(key[0]) * 73856093U ^ static_cast<size_t>(key[1]) * 19349663U ^ static_cast<size_t>(key[2]) * 83492791U;
+    }
+};
+
+[[nodiscard]] static VertexAttributes GetVertexAttributes(const Mesh& mesh, Mesh::Index vertex_index)
+{
+    VertexAttributes attributes;
+    if (mesh.GetVertexLayout().HasField(Mesh::VertexField::Normal))
+    {
+        attributes.normal = reinterpret_cast<const Mesh::Normal*>(mesh.GetVertexFieldData(vertex_index, Mesh::VertexField::Normal))->AsHlsl(); // NOSONAR
+    }
+    else if (mesh.GetVertexLayout().HasField(Mesh::VertexField::PackedNormal))
+    {
+        Mesh::PackedNormal packed_normal{};
+        std::memcpy(&packed_normal, mesh.GetVertexFieldData(vertex_index, Mesh::VertexField::PackedNormal), sizeof(packed_normal));
+        attributes.normal = VertexPacking::UnpackNormal(packed_normal).AsHlsl();
+    }
+
+    if (mesh.GetVertexLayout().HasField(Mesh::VertexField::TexCoord))
+    {
+        attributes.texcoord = reinterpret_cast<const Mesh::TexCoord*>(mesh.GetVertexFieldData(vertex_index, Mesh::VertexField::TexCoord))->AsHlsl(); // NOSONAR
+    }
+    else if (mesh.GetVertexLayout().HasField(Mesh::VertexField::PackedTexCoord))
+    {
+        Mesh::PackedTexCoord packed_texcoord{};
+        std::memcpy(&packed_texcoord, mesh.GetVertexFieldData(vertex_index, Mesh::VertexField::PackedTexCoord), sizeof(packed_texcoord));
+        attributes.texcoord = VertexPacking::UnpackTexCoord(packed_texcoord).AsHlsl();
+    }
+    return attributes;
+}
+
+[[nodiscard]] static bool HasVertex(const Triangle& triangle, Mesh::Index vertex_index) noexcept
+{
+    return std::find(triangle.begin(), triangle.end(), vertex_index) != triangle.end();
+}
+
+class Simplifier
+{
+public:
+    Simplifier(const Mesh& mesh, const Mesh::Indices& indices, const Settings& settings)
+        : m_settings(settings)
+        , m_positions(mesh.GetVertexCount())
+        , m_attributes(mesh.GetVertexCount())
+        , m_quadrics(mesh.GetVertexCount())
+        , m_vertex_triangles(mesh.GetVertexCount())
+        , m_vertex_versions(mesh.GetVertexCount(), 0U)
+        , m_is_vertex_locked(mesh.GetVertexCount(), false)
+        , m_is_vertex_removed(mesh.GetVertexCount(), false)
+    {
+        META_FUNCTION_TASK();
+        InitializeVertices(mesh, indices);
+        InitializeTriangles(indices);
+        LockSeamVertices();
+        LockBorderVertices();
+    }
+
+    Result Simplify()
+    {
+        META_FUNCTION_TASK();
+        Result result;
+        if (m_extent_sq <= 0.0)
+        {
+            result.indices = GetIndices();
+            return result;
+        }
+
+        for(const Triangle& triangle : m_triangles)
+        {
+            for(size_t corner = 0; corner < triangle.size(); ++corner)
+            {
+                const Mesh::Index v1_index = triangle[corner];
+                const Mesh::Index v2_index = triangle[(corner + 1) % 3];
+                if (v1_index >= v2_index)
+                    continue; // every manifold edge is visited once in the triangle where it goes in ascending order
+
+                AddCollapse(v1_index, v2_index);
+                AddCollapse(v2_index, v1_index);
+            }
+        }
+
+        const double target_error_sq = static_cast<double>(m_settings.target_error) * static_cast<double>(m_settings.target_error);
+        double max_error_sq = 0.0;
+        while (!m_collapses.empty() && m_live_triangles_count * 3 > m_settings.target_index_count)
+        {
+            const Collapse collapse = m_collapses.top();
+            m_collapses.pop();
+            if (collapse.cost > target_error_sq)
+                break;
+
+            if (m_is_vertex_removed[collapse.source] || m_is_vertex_removed[collapse.target] ||
+                m_vertex_versions[collapse.source] != collapse.source_version ||
+                m_vertex_versions[collapse.target] != collapse.target_version ||
+                !IsCollapseValid(collapse.source, collapse.target))
+                continue;
+
+            ApplyCollapse(collapse.source, collapse.target);
+            max_error_sq = std::max(max_error_sq, collapse.cost);
+        }
+
+        result.indices = GetIndices();
+        result.error   = static_cast<float>(std::sqrt(max_error_sq));
+        return result;
+    }
+
+private:
+    void InitializeVertices(const Mesh& mesh, const Mesh::Indices& indices)
+    {
+        META_FUNCTION_TASK();
+        hlslpp::float3 min_position(std::numeric_limits<float>::max());
+        hlslpp::float3 max_position(std::numeric_limits<float>::lowest());
+        for(Mesh::Index vertex_index = 0U; vertex_index < mesh.GetVertexCount(); ++vertex_index)
+        {
+            m_positions[vertex_index]  = mesh.GetVertexPosition(vertex_index).AsHlsl();
+            m_attributes[vertex_index] = GetVertexAttributes(mesh, vertex_index);
+        }
+        for(const Mesh::Index vertex_index : indices)
+        {
+            min_position = hlslpp::min(min_position, m_positions[vertex_index]);
+            max_position = hlslpp::max(max_position, m_positions[vertex_index]);
+        }
+        if (!indices.empty())
+        {
+            const auto extent = static_cast<double>(static_cast<float>(hlslpp::length(max_position - min_position)));
+            m_extent_sq = extent * extent;
+        }
+    }
+
+    void InitializeTriangles(const Mesh::Indices& indices)
+    {
+        META_FUNCTION_TASK();
+        const size_t triangles_count = indices.size() / 3;
+        m_triangles.reserve(triangles_count);
+        m_is_triangle_removed.reserve(triangles_count);
+        for(size_t triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
+        {
+            const Triangle triangle{ indices[triangle_index * 3], indices[triangle_index * 3 + 1], indices[triangle_index * 3 + 2] };
+            const bool is_degenerate = triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2];
+            m_triangles.push_back(triangle);
+            m_is_triangle_removed.push_back(is_degenerate);
+            if (is_degenerate)
+                continue;
+
+            m_live_triangles_count++;
+            const hlslpp::float3& p1 = m_positions[triangle[0]];
+            const hlslpp::float3 normal = hlslpp::cross(m_positions[triangle[1]] - p1, m_positions[triangle[2]] - p1);
+            const auto normal_length = static_cast<float>(hlslpp::length(normal));
+            const Quadric quadric = normal_length > 0.F
+                                  ? Quadric(normal / normal_length, -static_cast<float>(hlslpp::dot(normal, p1)) / normal_length, normal_length / 2.0)
+                                  : Quadric();
+            for(const Mesh::Index vertex_index : triangle)
+            {
+                m_quadrics[vertex_index] += quadric;
+                m_vertex_triangles[vertex_index].push_back(static_cast<Data::Index>(triangle_index));
+            }
+        }
+    }
+
+    void LockSeamVertices()
+    {
+        META_FUNCTION_TASK();
+        // Vertices sharing the same position with different attributes form seams, which are preserved
+        std::unordered_map<std::array<uint32_t, 3>, Mesh::Index, PositionKeyHash> vertex_by_position;
+        for(Mesh::Index vertex_index = 0U; vertex_index < m_vertex_triangles.size(); ++vertex_index)
+        {
+            if (m_vertex_triangles[vertex_index].empty())
+                continue;
+
+            std::array<uint32_t, 3> position_key{};
+            const hlslpp::float3& vertex_position = m_positions[vertex_index];
+            const std::array<float, 3> position{ static_cast<float>(vertex_position.x), static_cast<float>(vertex_position.y), static_cast<float>(vertex_position.z) };
+            std::memcpy(position_key.data(), position.data(), sizeof(position_key));
+            const auto [vertex_it, is_added] = vertex_by_position.try_emplace(position_key, vertex_index);
+            if (is_added)
+                continue;
+
+            m_is_vertex_locked[vertex_index]      = true;
+            m_is_vertex_locked[vertex_it->second] = true;
+        }
+    }
+
+    void LockBorderVertices()
+    {
+        META_FUNCTION_TASK();
+        // Vertices of open border and non-manifold edges are preserved
+        std::unordered_map<EdgeHashMap::Key, uint32_t> edge_triangles_count;
+        for(size_t triangle_index = 0; triangle_index < m_triangles.size(); ++triangle_index)
+        {
+            if (m_is_triangle_removed[triangle_index])
+                continue;
+
+            const Triangle& triangle = m_triangles[triangle_index];
+            for(size_t corner = 0; corner < triangle.size(); ++corner)
+            {
+                edge_triangles_count[EdgeHashMap::GetKey(triangle[corner], triangle[(corner + 1) % 3])]++;
+            }
+        }
+        for(const auto& [edge_key, triangles_count] : edge_triangles_count)
+        {
+            if (triangles_count == 2U)
+                continue;
+
+            m_is_vertex_locked[static_cast<Mesh::Index>(edge_key >> 32U)]         = true;
+            m_is_vertex_locked[static_cast<Mesh::Index>(edge_key & 0xFFFFFFFFU)] = true;
+        }
+    }
+
+    [[nodiscard]] double GetCollapseCost(Mesh::Index source_index, Mesh::Index target_index) const noexcept
+    {
+        Quadric quadric = m_quadrics[source_index];
+        quadric += m_quadrics[target_index];
+        const double position_error = quadric.Evaluate(m_positions[target_index]) / m_extent_sq;
+
+        const VertexAttributes& source_attributes = m_attributes[source_index];
+        const VertexAttributes& target_attributes = m_attributes[target_index];
+        const double attributes_error = static_cast<double>(m_settings.attribute_weight) * static_cast<double>(
+                                            static_cast<float>(hlslpp::length(source_attributes.normal - target_attributes.normal)) +
+                                            static_cast<float>(hlslpp::length(source_attributes.texcoord - target_attributes.texcoord)));
+        return position_error + attributes_error * attributes_error;
+    }
+
+    void AddCollapse(Mesh::Index source_index, Mesh::Index target_index)
+    {
+        if (m_is_vertex_locked[source_index])
+            return;
+
+        m_collapses.push(Collapse{
+            GetCollapseCost(source_index, target_index), source_index, target_index,
+            m_vertex_versions[source_index], m_vertex_versions[target_index]
+        });
+    }
+
+    [[nodiscard]] std::vector<Mesh::Index> GetVertexNeighbours(Mesh::Index vertex_index) const
+    {
+        std::vector<Mesh::Index> neighbours;
+        for(const Data::Index triangle_index : m_vertex_triangles[vertex_index])
+        {
+            if (m_is_triangle_removed[triangle_index])
+                continue;
+
+            for(const Mesh::Index neighbour_index : m_triangles[triangle_index])
+            {
+                if (neighbour_index != vertex_index)
+                    neighbours.push_back(neighbour_index);
+            }
+        }
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        return neighbours;
+    }
+
+    [[nodiscard]] bool IsCollapseValid(Mesh::Index source_index, Mesh::Index target_index) const
+    {
+        // Link condition: vertices adjacent to both edge vertices must be opposite to the edge in its triangles,
+        // otherwise collapse produces non-manifold topology
+        Data::Size edge_triangles_count = 0U;
+        for(const Data::Index triangle_index : m_vertex_triangles[source_index])
+        {
+            if (!m_is_triangle_removed[triangle_index] && HasVertex(m_triangles[triangle_index], target_index))
+                edge_triangles_count++;
+        }
+        if (!edge_triangles_count)
+            return false;
+
+        const std::vector<Mesh::Index> source_neighbours = GetVertexNeighbours(source_index);
+        const std::vector<Mesh::Index> target_neighbours = GetVertexNeighbours(target_index);
+        std::vector<Mesh::Index> common_neighbours;
+        std::set_intersection(source_neighbours.begin(), source_neighbours.end(),
+                              target_neighbours.begin(), target_neighbours.end(),
+                              std::back_inserter(common_neighbours));
+        if (common_neighbours.size() != edge_triangles_count)
+            return false;
+
+        // Triangles moved with the source vertex should not flip or fold
+        for(const Data::Index triangle_index : m_vertex_triangles[source_index])
+        {
+            const Triangle& triangle = m_triangles[triangle_index];
+            if (m_is_triangle_removed[triangle_index] || HasVertex(triangle, target_index))
+                continue;
+
+            std::array<hlslpp::float3, 3> positions{ m_positions[triangle[0]], m_positions[triangle[1]], m_positions[triangle[2]] };
+            const hlslpp::float3 original_normal = hlslpp::cross(positions[1] - positions[0], positions[2] - positions[0]);
+            for(size_t corner = 0; corner < triangle.size(); ++corner)
+            {
+                if (triangle[corner] == source_index)
+                    positions[corner] = m_positions[target_index];
+            }
+            const hlslpp::float3 collapsed_normal = hlslpp::cross(positions[1] - positions[0], positions[2] - positions[0]);
+            const float normals_length = static_cast<float>(hlslpp::length(original_normal)) * static_cast<float>(hlslpp::length(collapsed_normal));
+            if (normals_length <= std::numeric_limits<float>::min() ||
+                static_cast<float>(hlslpp::dot(original_normal, collapsed_normal)) < g_min_collapsed_normal_dot * normals_length)
+                return false;
+        }
+        return true;
+    }
+
+    void ApplyCollapse(Mesh::Index source_index, Mesh::Index target_index)
+    {
+        for(const Data::Index triangle_index : m_vertex_triangles[source_index])
+        {
+            if (m_is_triangle_removed[triangle_index])
+                continue;
+
+            Triangle& triangle = m_triangles[triangle_index];
+            if (HasVertex(triangle, target_index))
+            {
+                m_is_triangle_removed[triangle_index] = true;
+                m_live_triangles_count--;
+                continue;
+            }
+
+            std::replace(triangle.begin(), triangle.end(), source_index, target_index);
+            m_vertex_triangles[target_index].push_back(triangle_index);
+        }
+
+        m_vertex_triangles[source_index].clear();
+        m_is_vertex_removed[source_index] = true;
+        m_quadrics[target_index] += m_quadrics[source_index];
+        m_vertex_versions[target_index]++;
+
+        std::vector<Data::Index>& target_triangles = m_vertex_triangles[target_index];
+        target_triangles.erase(std::remove_if(target_triangles.begin(), target_triangles.end(),
+                                              [this](Data::Index triangle_index) { return m_is_triangle_removed[triangle_index]; }),
+                               target_triangles.end());
+
+        for(const Mesh::Index neighbour_index : GetVertexNeighbours(target_index))
+        {
+            AddCollapse(target_index, neighbour_index);
+            AddCollapse(neighbour_index, target_index);
+        }
+    }
+
+    [[nodiscard]] Mesh::Indices GetIndices() const
+    {
+        Mesh::Indices indices;
+        indices.reserve(static_cast<size_t>(m_live_triangles_count) * 3);
+        for(size_t triangle_index = 0; triangle_index < m_triangles.size(); ++triangle_index)
+        {
+            if (!m_is_triangle_removed[triangle_index])
+                indices.insert(indices.end(), m_triangles[triangle_index].begin(), m_triangles[triangle_index].end());
+        }
+        return indices;
+    }
+
+    using Collapses = std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>>;
+
+    const Settings                          m_settings;
+    std::vector<hlslpp::float3>             m_positions;
+    std::vector<VertexAttributes>           m_attributes;
+    std::vector<Quadric>                    m_quadrics;
+    std::vector<std::vector<Data::Index>>   m_vertex_triangles;
+    std::vector<uint32_t>                   m_vertex_versions;
+    std::vector<bool>                       m_is_vertex_locked;
+    std::vector<bool>                       m_is_vertex_removed;
+    std::vector<Triangle>                   m_triangles;
+    std::vector<bool>                       m_is_triangle_removed;
+    Data::Size                              m_live_triangles_count = 0U;
+    double                                  m_extent_sq = 0.0;
+    Collapses                               m_collapses;
+};
+
+Result Simplify(const Mesh& mesh, const Mesh::Indices& indices, const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(indices.size(), indices.size() % 3 == 0,
+                         "mesh indices count should be a multiple of three representing triangles list");
+    META_CHECK_ARG_GREATER_OR_EQUAL(settings.target_error, 0.F);
+    for(const Mesh::Index index : indices)
+    {
+        META_CHECK_ARG_LESS_DESCR(index, mesh.GetVertexCount(), "mesh index is out of vertex range");
+    }
+
+    return Simplifier(mesh, indices, settings).Simplify();
+}
+
+} // namespace Methane::Graphics::MeshSimplifier
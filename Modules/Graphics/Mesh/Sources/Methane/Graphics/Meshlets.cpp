@@ -0,0 +1,214 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Meshlets.cpp
+Meshlets builder splitting mesh triangles into bounded clusters
+with bounding spheres and normal cones used for cluster culling.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+static constexpr Mesh::Index g_invalid_local_index = std::numeric_limits<Mesh::Index>::max();
+static constexpr float       g_min_cone_cosine     = 0.1F;
+
+bool Meshlet::IsBackFacing(const Mesh::Position& camera_position) const noexcept
+{
+    META_FUNCTION_TASK();
+    const hlslpp::float3 camera_to_center = bounding_center.AsHlsl() - camera_position.AsHlsl();
+    const float camera_distance = hlslpp::length(camera_to_center);
+    const float axis_projection = hlslpp::dot(camera_to_center, cone_axis.AsHlsl());
+    return axis_projection >= cone_cutoff * camera_distance + bounding_radius;
+}
+
+Meshlets::Meshlets(const Mesh& mesh)
+    : Meshlets(mesh, Settings{})
+{ }
+
+Meshlets::Meshlets(const Mesh& mesh, const Settings& settings)
+    : m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_RANGE_INC_DESCR(m_settings.max_vertices, 3U, std::numeric_limits<LocalIndex>::max() + 1U,
+                                   "meshlet vertices count should be addressable with 8-bit local indices");
+    META_CHECK_ARG_GREATER_OR_EQUAL(m_settings.max_triangles, 1U);
+    META_CHECK_ARG_DESCR(mesh.GetIndexCount(), mesh.GetIndexCount() % 3 == 0,
+                         "mesh indices count should be a multiple of three representing triangles list");
+    Build(mesh);
+}
+
+const Meshlet& Meshlets::Get(Data::Index meshlet_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(meshlet_index, m_meshlets.size());
+    return m_meshlets[meshlet_index];
+}
+
+Mesh::Index Meshlets::GetMeshVertexIndex(const Meshlet& meshlet, LocalIndex local_index) const
+{
+    META_FUNCTION_TASK();
+    const Data::Index local_vertex_index = local_index;
+    META_CHECK_ARG_LESS(local_vertex_index, meshlet.vertex_count);
+    return m_vertex_indices[meshlet.vertex_offset + local_vertex_index];
+}
+
+void Meshlets::Build(const Mesh& mesh)
+{
+    META_FUNCTION_TASK();
+    const Data::Size triangles_count = mesh.GetIndexCount() / 3;
+    m_triangles.reserve(triangles_count);
+    m_vertex_indices.reserve(mesh.GetVertexCount());
+    m_meshlets.reserve(triangles_count / m_settings.max_triangles + 1);
+
+    // Mesh vertex index to meshlet local index map, reset for the meshlet vertices only on meshlet completion
+    std::vector<Mesh::Index> local_index_by_vertex(mesh.GetVertexCount(), g_invalid_local_index);
+
+    Meshlet meshlet;
+    const auto complete_meshlet = [this, &mesh, &meshlet, &local_index_by_vertex]()
+    {
+        if (!meshlet.triangle_count)
+            return;
+
+        for(Data::Index vertex_index = 0U; vertex_index < meshlet.vertex_count; ++vertex_index)
+        {
+            local_index_by_vertex[m_vertex_indices[meshlet.vertex_offset + vertex_index]] = g_invalid_local_index;
+        }
+
+        ComputeBounds(mesh, meshlet);
+        m_meshlets.push_back(meshlet);
+
+        meshlet = Meshlet();
+        meshlet.vertex_offset   = static_cast<Data::Index>(m_vertex_indices.size());
+        meshlet.triangle_offset = static_cast<Data::Index>(m_triangles.size());
+    };
+
+    for(Data::Index triangle_index = 0U; triangle_index < triangles_count; ++triangle_index)
+    {
+        const std::array<Mesh::Index, 3> triangle_vertices{
+            mesh.GetIndex(triangle_index * 3),
+            mesh.GetIndex(triangle_index * 3 + 1),
+            mesh.GetIndex(triangle_index * 3 + 2)
+        };
+
+        const auto new_vertices_count = static_cast<Data::Size>(
+            std::count_if(triangle_vertices.begin(), triangle_vertices.end(),
+                          [&local_index_by_vertex](Mesh::Index vertex_index)
+                          { return local_index_by_vertex[vertex_index] == g_invalid_local_index; }));
+
+        if (meshlet.vertex_count + new_vertices_count > m_settings.max_vertices ||
+            meshlet.triangle_count + 1 > m_settings.max_triangles)
+        {
+            complete_meshlet();
+        }
+
+        Triangle local_triangle{};
+        for(size_t corner = 0; corner < triangle_vertices.size(); ++corner)
+        {
+            const Mesh::Index vertex_index = triangle_vertices[corner];
+            Mesh::Index& local_index = local_index_by_vertex[vertex_index];
+            if (local_index == g_invalid_local_index)
+            {
+                local_index = meshlet.vertex_count++;
+                m_vertex_indices.push_back(vertex_index);
+            }
+            local_triangle[corner] = static_cast<LocalIndex>(local_index);
+        }
+
+        m_triangles.push_back(local_triangle);
+        meshlet.triangle_count++;
+    }
+
+    complete_meshlet();
+}
+
+void Meshlets::ComputeBounds(const Mesh& mesh, Meshlet& meshlet) const
+{
+    META_FUNCTION_TASK();
+
+    // Bounding sphere is centered in the axis-aligned bounding box of meshlet vertices
+    hlslpp::float3 min_position(std::numeric_limits<float>::max());
+    hlslpp::float3 max_position(std::numeric_limits<float>::lowest());
+    for(Data::Index vertex_index = 0U; vertex_index < meshlet.vertex_count; ++vertex_index)
+    {
+        const hlslpp::float3 position = mesh.GetVertexPosition(m_vertex_indices[meshlet.vertex_offset + vertex_index]).AsHlsl();
+        min_position = hlslpp::min(min_position, position);
+        max_position = hlslpp::max(max_position, position);
+    }
+
+    const hlslpp::float3 center = (min_position + max_position) / 2.F;
+    float radius = 0.F;
+    for(Data::Index vertex_index = 0U; vertex_index < meshlet.vertex_count; ++vertex_index)
+    {
+        const hlslpp::float3 position = mesh.GetVertexPosition(m_vertex_indices[meshlet.vertex_offset + vertex_index]).AsHlsl();
+        radius = std::max(radius, static_cast<float>(hlslpp::length(position - center)));
+    }
+
+    meshlet.bounding_center = Mesh::Position(center);
+    meshlet.bounding_radius = radius;
+
+    // Normal cone axis is an average of unit triangle normals and cutoff is derived from the widest normal deviation
+    std::vector<hlslpp::float3> triangle_normals;
+    triangle_normals.reserve(meshlet.triangle_count);
+    hlslpp::float3 normals_sum(0.F);
+    for(Data::Index triangle_index = 0U; triangle_index < meshlet.triangle_count; ++triangle_index)
+    {
+        const Triangle& triangle = m_triangles[meshlet.triangle_offset + triangle_index];
+        const hlslpp::float3 p1 = mesh.GetVertexPosition(m_vertex_indices[meshlet.vertex_offset + triangle[0]]).AsHlsl();
+        const hlslpp::float3 p2 = mesh.GetVertexPosition(m_vertex_indices[meshlet.vertex_offset + triangle[1]]).AsHlsl();
+        const hlslpp::float3 p3 = mesh.GetVertexPosition(m_vertex_indices[meshlet.vertex_offset + triangle[2]]).AsHlsl();
+        const hlslpp::float3 normal = hlslpp::cross(p2 - p1, p3 - p1);
+        const float normal_length = hlslpp::length(normal);
+        if (normal_length <= std::numeric_limits<float>::epsilon())
+            continue; // skip degenerate triangles
+
+        const hlslpp::float3 unit_normal = normal / normal_length;
+        triangle_normals.push_back(unit_normal);
+        normals_sum += unit_normal;
+    }
+
+    const float normals_sum_length = hlslpp::length(normals_sum);
+    if (triangle_normals.empty() || normals_sum_length <= std::numeric_limits<float>::epsilon())
+    {
+        meshlet.cone_axis   = Mesh::Normal(0.F, 0.F, 0.F);
+        meshlet.cone_cutoff = 1.F;
+        return;
+    }
+
+    const hlslpp::float3 cone_axis = normals_sum / normals_sum_length;
+    float min_cone_cosine = 1.F;
+    for(const hlslpp::float3& unit_normal : triangle_normals)
+    {
+        min_cone_cosine = std::min(min_cone_cosine, static_cast<float>(hlslpp::dot(unit_normal, cone_axis)));
+    }
+
+    meshlet.cone_axis   = Mesh::Normal(cone_axis);
+    meshlet.cone_cutoff = min_cone_cosine <= g_min_cone_cosine
+                        ? 1.F
+                        : std::sqrt(1.F - min_cone_cosine * min_cone_cosine);
+}
+
+} // namespace Methane::Graphics
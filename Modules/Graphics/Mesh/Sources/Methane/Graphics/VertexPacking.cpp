@@ -0,0 +1,241 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/VertexPacking.cpp
+Vertex fields quantization to packed formats: half-float positions,
+octahedral snorm16 normals and unorm16 texture coordinates.
+
+******************************************************************************/
+
+#include <Methane/Graphics/VertexPacking.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+namespace Methane::Graphics::VertexPacking
+{
+
+static constexpr float g_snorm16_max = 32767.F;
+static constexpr float g_unorm16_max = 65535.F;
+
+[[nodiscard]] static int16_t FloatToSnorm16(float value) noexcept
+{
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.F, 1.F) * g_snorm16_max));
+}
+
+[[nodiscard]] static float Snorm16ToFloat(int16_t value) noexcept
+{
+    return std::max(static_cast<float>(value) / g_snorm16_max, -1.F);
+}
+
+[[nodiscard]] static float GetNonZeroSign(float value) noexcept
+{
+    return value >= 0.F ? 1.F : -1.F;
+}
+
+template<typename FieldType, typename PackedFieldType, typename UnpackFunc>
+[[nodiscard]] static FieldType ReadVertexField(const Mesh& mesh, Data::Index vertex_index,
+                                               Mesh::VertexField field, Mesh::VertexField packed_field,
+                                               const UnpackFunc& unpack)
+{
+    if (!mesh.GetVertexLayout().HasField(packed_field))
+        return *reinterpret_cast<const FieldType*>(mesh.GetVertexFieldData(vertex_index, field)); // NOSONAR
+
+    PackedFieldType packed_value{};
+    std::memcpy(&packed_value, mesh.GetVertexFieldData(vertex_index, packed_field), sizeof(PackedFieldType));
+    return unpack(packed_value);
+}
+
+template<typename FieldType>
+static void WriteVertexField(Data::RawPtr target_field_ptr, const FieldType& value) noexcept
+{
+    std::memcpy(target_field_ptr, &value, sizeof(FieldType));
+}
+
+// Conversion with rounding to nearest even, overflow to infinity and half-float subnormals support
+uint16_t FloatToHalf(float value) noexcept
+{
+    uint32_t bits = 0U;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const auto     sign      = static_cast<uint16_t>((bits >> 16U) & 0x8000U);
+    const uint32_t abs_bits  = bits & 0x7FFFFFFFU;
+
+    if (abs_bits >= 0x7F800000U) // infinity or NaN
+        return static_cast<uint16_t>(sign | 0x7C00U | (abs_bits > 0x7F800000U ? 0x200U : 0U));
+
+    if (abs_bits >= 0x477FF000U) // values rounded above the maximum half-float 65504
+        return static_cast<uint16_t>(sign | 0x7C00U);
+
+    if (abs_bits < 0x33000000U) // values rounded to zero below half of the minimum half-float subnormal 2^-24
+        return sign;
+
+    uint32_t half_bits = 0U;
+    uint32_t remainder = 0U;
+    uint32_t halfway   = 0U;
+    if (abs_bits < 0x38800000U) // half-float subnormals below 2^-14
+    {
+        const uint32_t shift    = 126U - (abs_bits >> 23U);
+        const uint32_t mantissa = (abs_bits & 0x7FFFFFU) | 0x800000U;
+        half_bits = mantissa >> shift;
+        remainder = mantissa & ((1U << shift) - 1U);
+        halfway   = 1U << (shift - 1U);
+    }
+    else
+    {
+        half_bits = (abs_bits - 0x38000000U) >> 13U;
+        remainder = abs_bits & 0x1FFFU;
+        halfway   = 0x1000U;
+    }
+
+    if (remainder > halfway || (remainder == halfway && (half_bits & 1U)))
+        half_bits++;
+
+    return static_cast<uint16_t>(sign | half_bits);
+}
+
+float HalfToFloat(uint16_t value) noexcept
+{
+    const uint32_t sign     = static_cast<uint32_t>(value & 0x8000U) << 16U;
+    const uint32_t exponent = (value >> 10U) & 0x1FU;
+    const uint32_t mantissa = value & 0x3FFU;
+
+    if (!exponent)
+    {
+        const float subnormal = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -subnormal : subnormal;
+    }
+
+    const uint32_t bits = exponent == 0x1FU
+                        ? sign | 0x7F800000U | (mantissa << 13U)
+                        : sign | ((exponent + 112U) << 23U) | (mantissa << 13U);
+    float result = 0.F;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+Mesh::PackedPosition PackPosition(const Mesh::Position& position) noexcept
+{
+    return Mesh::PackedPosition{
+        FloatToHalf(position.GetX()),
+        FloatToHalf(position.GetY()),
+        FloatToHalf(position.GetZ()),
+        FloatToHalf(1.F)
+    };
+}
+
+Mesh::Position UnpackPosition(const Mesh::PackedPosition& packed_position) noexcept
+{
+    return Mesh::Position(HalfToFloat(packed_position[0]),
+                          HalfToFloat(packed_position[1]),
+                          HalfToFloat(packed_position[2]));
+}
+
+Mesh::PackedNormal PackNormal(const Mesh::Normal& normal) noexcept
+{
+    // Project normal on octahedron and unfold its lower half over the upper half diagonals
+    const float l1_norm = std::abs(normal.GetX()) + std::abs(normal.GetY()) + std::abs(normal.GetZ());
+    if (l1_norm <= std::numeric_limits<float>::epsilon())
+        return Mesh::PackedNormal{ 0, 0 };
+
+    float x = normal.GetX() / l1_norm;
+    float y = normal.GetY() / l1_norm;
+    if (normal.GetZ() < 0.F)
+    {
+        const float folded_x = (1.F - std::abs(y)) * GetNonZeroSign(x);
+        const float folded_y = (1.F - std::abs(x)) * GetNonZeroSign(y);
+        x = folded_x;
+        y = folded_y;
+    }
+    return Mesh::PackedNormal{ FloatToSnorm16(x), FloatToSnorm16(y) };
+}
+
+Mesh::Normal UnpackNormal(const Mesh::PackedNormal& packed_normal) noexcept
+{
+    const float x = Snorm16ToFloat(packed_normal[0]);
+    const float y = Snorm16ToFloat(packed_normal[1]);
+    const float z = 1.F - std::abs(x) - std::abs(y);
+    const float fold = std::max(-z, 0.F);
+    const hlslpp::float3 normal(x >= 0.F ? x - fold : x + fold,
+                                y >= 0.F ? y - fold : y + fold,
+                                z);
+    return Mesh::Normal(hlslpp::normalize(normal));
+}
+
+Mesh::PackedTexCoord PackTexCoord(const Mesh::TexCoord& texcoord) noexcept
+{
+    return Mesh::PackedTexCoord{
+        static_cast<uint16_t>(std::lround(std::clamp(texcoord.GetX(), 0.F, 1.F) * g_unorm16_max)),
+        static_cast<uint16_t>(std::lround(std::clamp(texcoord.GetY(), 0.F, 1.F) * g_unorm16_max))
+    };
+}
+
+Mesh::TexCoord UnpackTexCoord(const Mesh::PackedTexCoord& packed_texcoord) noexcept
+{
+    return Mesh::TexCoord(static_cast<float>(packed_texcoord[0]) / g_unorm16_max,
+                          static_cast<float>(packed_texcoord[1]) / g_unorm16_max);
+}
+
+void ConvertVertexField(const Mesh& source_mesh, Data::Index vertex_index, Mesh::VertexField target_field, Data::RawPtr target_field_ptr)
+{
+    META_FUNCTION_TASK();
+    using VertexField = Mesh::VertexField;
+    switch(target_field)
+    {
+    case VertexField::Position:
+        WriteVertexField(target_field_ptr, source_mesh.GetVertexPosition(vertex_index));
+        break;
+
+    case VertexField::PackedPosition:
+        WriteVertexField(target_field_ptr, PackPosition(source_mesh.GetVertexPosition(vertex_index)));
+        break;
+
+    case VertexField::Normal:
+        WriteVertexField(target_field_ptr, ReadVertexField<Mesh::Normal, Mesh::PackedNormal>(
+            source_mesh, vertex_index, VertexField::Normal, VertexField::PackedNormal, UnpackNormal));
+        break;
+
+    case VertexField::PackedNormal:
+        WriteVertexField(target_field_ptr, PackNormal(ReadVertexField<Mesh::Normal, Mesh::PackedNormal>(
+            source_mesh, vertex_index, VertexField::Normal, VertexField::PackedNormal, UnpackNormal)));
+        break;
+
+    case VertexField::TexCoord:
+        WriteVertexField(target_field_ptr, ReadVertexField<Mesh::TexCoord, Mesh::PackedTexCoord>(
+            source_mesh, vertex_index, VertexField::TexCoord, VertexField::PackedTexCoord, UnpackTexCoord));
+        break;
+
+    case VertexField::PackedTexCoord:
+        WriteVertexField(target_field_ptr, PackTexCoord(ReadVertexField<Mesh::TexCoord, Mesh::PackedTexCoord>(
+            source_mesh, vertex_index, VertexField::TexCoord, VertexField::PackedTexCoord, UnpackTexCoord)));
+        break;
+
+    case VertexField::Color:
+        std::memcpy(target_field_ptr, source_mesh.GetVertexFieldData(vertex_index, VertexField::Color), sizeof(Mesh::Color));
+        break;
+
+    default:
+        META_UNEXPECTED_ARG(target_field);
+    }
+}
+
+} // namespace Methane::Graphics::VertexPacking
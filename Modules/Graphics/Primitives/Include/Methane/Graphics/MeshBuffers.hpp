@@ -26,6 +26,7 @@ Mesh buffers with texture extension structure.
 #include "MeshBuffersBase.h"
 
 #include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/IContext.h>
 #include <Methane/Graphics/UberMesh.hpp>
 #include <Methane/Graphics/Types.h>
 #include <Methane/Data/AlignedAllocator.hpp>
@@ -34,6 +35,8 @@ Mesh buffers with texture extension structure.
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
@@ -63,6 +66,13 @@ public:
         : MeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets())
     { }
 
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, std::string_view mesh_name)
+        : MeshBuffersBase(render_cmd_queue, mesh_cache, mesh_name)
+    {
+        META_FUNCTION_TASK();
+        SetInstanceCount(GetSubsetsCount());
+    }
+
     [[nodiscard]] Data::Size GetInstanceCount() const noexcept
     {
         return static_cast<Data::Size>(m_final_pass_instance_uniforms.size());
@@ -88,6 +98,16 @@ public:
         m_final_pass_instance_uniforms[instance_index] = std::move(uniforms);
     }
 
+    // Copies uniforms of all instances to the dynamic constants allocated with GetUniformsBufferSize()
+    void WriteFinalPassUniforms(const Rhi::ContextDynamicConstants& dynamic_constants) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_NULL(dynamic_constants.data_ptr);
+        META_CHECK_ARG_GREATER_OR_EQUAL(dynamic_constants.size, GetUniformsBufferSize());
+        const auto uniforms_data_ptr = reinterpret_cast<Data::ConstRawPtr>(m_final_pass_instance_uniforms.data()); // NOSONAR
+        std::copy(uniforms_data_ptr, uniforms_data_ptr + GetUniformsBufferSize(), dynamic_constants.data_ptr);
+    }
+
     [[nodiscard]]
     static constexpr Data::Size GetUniformSize() noexcept
     {
@@ -154,6 +174,13 @@ public:
         m_subset_textures.resize(MeshBuffers<UniformsType>::GetSubsetsCount());
     }
 
+    TexturedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, const std::string& mesh_name)
+        : MeshBuffers<UniformsType>(render_cmd_queue, mesh_cache, mesh_name)
+    {
+        META_FUNCTION_TASK();
+        m_subset_textures.resize(MeshBuffers<UniformsType>::GetSubsetsCount());
+    }
+
     Rhi::ResourceBarriers CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr = nullptr)
     {
         META_FUNCTION_TASK();
@@ -29,6 +29,7 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/MeshCache.h>
 
 #include <vector>
 #include <string>
@@ -63,6 +64,9 @@ public:
     MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
                     std::string_view mesh_name, const Mesh::Subsets& mesh_subsets);
 
+    // Uploads vertex and index data referenced by mesh cache straight to GPU buffers without conversion
+    MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, std::string_view mesh_name);
+
     virtual ~MeshBuffersBase() = default;
 
     [[nodiscard]] const Rhi::IContext&  GetContext() const noexcept        { return m_context; }
@@ -91,11 +95,35 @@ public:
                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
                       bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    // Draws only instances with the given indices, like compacted list of visible instances produced by frustum culling
+    void Draw(const Rhi::RenderCommandList& cmd_list, const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+              const std::vector<Data::Index>& instance_indices,
+              Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+              bool retain_bindings_once = false, bool set_resource_barriers = true) const;
+
+    // Draws instances with indices from each bucket on the parallel command list with the same index
+    void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
+                      const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                      const std::vector<std::vector<Data::Index>>& instance_indices_per_command_list,
+                      Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                      bool retain_bindings_once = false, bool set_resource_barriers = true) const;
+
 protected:
     [[nodiscard]]
     virtual Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const { return instance_index; }
 
 private:
+    void DrawInstance(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                      Data::Index instance_index, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) const;
+    void DrawInstances(const Rhi::RenderCommandList& cmd_list, const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                       const Data::Index* instance_indices_begin, const Data::Index* instance_indices_end,
+                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                       bool retain_bindings_once, bool set_resource_barriers) const;
+
+    void InitializeBuffers(const Rhi::CommandQueue& render_cmd_queue,
+                           const Rhi::SubResource& vertex_data, Data::Size vertex_size,
+                           const Rhi::SubResource& index_data, PixelFormat index_format);
+
     const Rhi::IContext& m_context;
     const std::string    m_mesh_name;
     const Mesh::Subsets  m_mesh_subsets;
@@ -48,26 +48,62 @@ MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, cons
 {
     META_FUNCTION_TASK();
 
+    // Narrowest index format is selected automatically by the mesh vertex count
+    const PixelFormat index_format = mesh_data.GetIndexFormat();
+    const Data::Size  index_data_size = mesh_data.GetIndexDataSize(index_format);
+    const Rhi::SubResource vertex_data(mesh_data.GetVertexData(), mesh_data.GetVertexDataSize());
+
+    if (index_format == PixelFormat::R16Uint)
+    {
+        const Mesh::Indices16 indices_16 = mesh_data.GetIndices16();
+        InitializeBuffers(render_cmd_queue, vertex_data, mesh_data.GetVertexSize(), {
+            reinterpret_cast<Data::ConstRawPtr>(indices_16.data()), // NOSONAR
+            index_data_size
+        }, index_format);
+    }
+    else
+    {
+        InitializeBuffers(render_cmd_queue, vertex_data, mesh_data.GetVertexSize(), {
+            reinterpret_cast<Data::ConstRawPtr>(mesh_data.GetIndices().data()), // NOSONAR
+            index_data_size
+        }, index_format);
+    }
+}
+
+MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, std::string_view mesh_name)
+    : m_context(render_cmd_queue.GetContext())
+    , m_mesh_name(mesh_name)
+    , m_mesh_subsets(!mesh_cache.GetSubsets().empty()
+                    ? mesh_cache.GetSubsets()
+                    : Mesh::Subsets{
+                        Mesh::Subset(mesh_cache.GetType(),
+                                     { 0, mesh_cache.GetVertexCount() },
+                                     { 0, mesh_cache.GetIndexCount()  }, true )
+                      })
+{
+    META_FUNCTION_TASK();
+    InitializeBuffers(render_cmd_queue,
+                      { mesh_cache.GetVertexData(), mesh_cache.GetVertexDataSize() }, mesh_cache.GetVertexSize(),
+                      { mesh_cache.GetIndexData(), mesh_cache.GetIndexDataSize() }, mesh_cache.GetIndexFormat());
+}
+
+void MeshBuffersBase::InitializeBuffers(const Rhi::CommandQueue& render_cmd_queue,
+                                        const Rhi::SubResource& vertex_data, Data::Size vertex_size,
+                                        const Rhi::SubResource& index_data, PixelFormat index_format)
+{
+    META_FUNCTION_TASK();
     Rhi::Buffer vertex_buffer(m_context,
         Rhi::BufferSettings::ForVertexBuffer(
-            mesh_data.GetVertexDataSize(),
-            mesh_data.GetVertexSize()));
-    vertex_buffer.SetName(fmt::format("{} Vertex Buffer", mesh_name));
-    vertex_buffer.SetData(render_cmd_queue, {
-        mesh_data.GetVertexData(),
-        mesh_data.GetVertexDataSize()
-    });
+            vertex_data.GetDataSize(),
+            vertex_size));
+    vertex_buffer.SetName(fmt::format("{} Vertex Buffer", m_mesh_name));
+    vertex_buffer.SetData(render_cmd_queue, vertex_data);
     m_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
 
     m_index_buffer = Rhi::Buffer(m_context,
-        Rhi::BufferSettings::ForIndexBuffer(
-            mesh_data.GetIndexDataSize(),
-            GetIndexFormat(mesh_data.GetIndex(0))));
-    m_index_buffer.SetName(fmt::format("{} Index Buffer", mesh_name));
-    m_index_buffer.SetData(render_cmd_queue, {
-        reinterpret_cast<Data::ConstRawPtr>(mesh_data.GetIndices().data()), // NOSONAR
-        mesh_data.GetIndexDataSize()
-    });
+        Rhi::BufferSettings::ForIndexBuffer(index_data.GetDataSize(), index_format));
+    m_index_buffer.SetName(fmt::format("{} Index Buffer", m_mesh_name));
+    m_index_buffer.SetData(render_cmd_queue, index_data);
 }
 
 Rhi::ResourceBarriers MeshBuffersBase::CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr) const
@@ -140,24 +176,13 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
          instance_program_bindings_it != instance_program_bindings_end;
          ++instance_program_bindings_it)
     {
-        const Rhi::ProgramBindings& program_bindings = *instance_program_bindings_it;
-        META_CHECK_ARG_TRUE(program_bindings.IsInitialized());
-
         const uint32_t instance_index = first_instance_index + static_cast<uint32_t>(std::distance(instance_program_bindings_begin, instance_program_bindings_it));
-        const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
-
-        META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
-        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
 
         Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = bindings_apply_behavior;
         apply_behavior.SetBit(Rhi::ProgramBindingsApplyBehavior::RetainResources,
                               !retain_bindings_once || instance_program_bindings_it == instance_program_bindings_begin);
 
-        cmd_list.SetProgramBindings(program_bindings, apply_behavior);
-        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
-                             mesh_subset.indices.count, mesh_subset.indices.offset,
-                             mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
-                             1, 0);
+        DrawInstance(cmd_list, *instance_program_bindings_it, instance_index, apply_behavior);
     }
 }
 
@@ -190,4 +215,84 @@ void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& paralle
     m_context.GetParallelExecutor().run(render_task_flow).get();
 }
 
+void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
+                           const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                           const std::vector<Data::Index>& instance_indices,
+                           Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                           bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    DrawInstances(cmd_list, instance_program_bindings,
+                  instance_indices.data(), instance_indices.data() + instance_indices.size(),
+                  bindings_apply_behavior, retain_bindings_once, set_resource_barriers);
+}
+
+void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
+                                   const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                                   const std::vector<std::vector<Data::Index>>& instance_indices_per_command_list,
+                                   Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                                   bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    META_CHECK_ARG_EQUAL_DESCR(instance_indices_per_command_list.size(), render_cmd_lists.size(),
+                               "instance indices buckets count should be equal to parallel command lists count");
+
+    tf::Taskflow render_task_flow;
+    render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
+        [this, &render_cmd_lists, &instance_program_bindings, &instance_indices_per_command_list,
+         bindings_apply_behavior, retain_bindings_once, set_resource_barriers](const uint32_t cmd_list_index)
+        {
+            const std::vector<Data::Index>& instance_indices = instance_indices_per_command_list[cmd_list_index];
+            DrawInstances(render_cmd_lists[cmd_list_index], instance_program_bindings,
+                          instance_indices.data(), instance_indices.data() + instance_indices.size(),
+                          bindings_apply_behavior, retain_bindings_once, set_resource_barriers);
+        }
+    );
+    m_context.GetParallelExecutor().run(render_task_flow).get();
+}
+
+void MeshBuffersBase::DrawInstance(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                                   Data::Index instance_index, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE(program_bindings.IsInitialized());
+
+    const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
+    META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
+    const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
+
+    cmd_list.SetProgramBindings(program_bindings, apply_behavior);
+    cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
+                         mesh_subset.indices.count, mesh_subset.indices.offset,
+                         mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
+                         1, 0);
+}
+
+void MeshBuffersBase::DrawInstances(const Rhi::RenderCommandList& cmd_list,
+                                    const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                                    const Data::Index* instance_indices_begin, const Data::Index* instance_indices_end,
+                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                                    bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    if (instance_indices_begin == instance_indices_end)
+        return;
+
+    cmd_list.SetVertexBuffers(GetVertexBuffers(), set_resource_barriers);
+    cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
+
+    for (const Data::Index* instance_index_ptr = instance_indices_begin; instance_index_ptr != instance_indices_end; ++instance_index_ptr)
+    {
+        const Data::Index instance_index = *instance_index_ptr;
+        META_CHECK_ARG_LESS(instance_index, instance_program_bindings.size());
+
+        Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = bindings_apply_behavior;
+        apply_behavior.SetBit(Rhi::ProgramBindingsApplyBehavior::RetainResources,
+                              !retain_bindings_once || instance_index_ptr == instance_indices_begin);
+
+        DrawInstance(cmd_list, instance_program_bindings[instance_index], instance_index, apply_behavior);
+    }
+}
+
 } // namespace Methane::Graphics
@@ -227,14 +227,14 @@ public:
         }
         else
         {
-            m_index_buffer = render_context.CreateBuffer(
-                Rhi::BufferSettings::ForIndexBuffer(
-                    s_quad_mesh.GetIndexDataSize(),
-                    GetIndexFormat(s_quad_mesh.GetIndex(0))));
+            const PixelFormat     index_format    = s_quad_mesh.GetIndexFormat();
+            const Data::Size      index_data_size = s_quad_mesh.GetIndexDataSize(index_format);
+            const Mesh::Indices16 quad_indices    = s_quad_mesh.GetIndices16();
+            m_index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(index_data_size, index_format));
             m_index_buffer.SetName(s_index_buffer_name);
             m_index_buffer.SetData(m_render_cmd_queue, {
-                reinterpret_cast<Data::ConstRawPtr>(s_quad_mesh.GetIndices().data()), // NOSONAR
-                s_quad_mesh.GetIndexDataSize()
+                reinterpret_cast<Data::ConstRawPtr>(quad_indices.data()), // NOSONAR
+                index_data_size
             });
             render_context.GetObjectRegistry().AddGraphicsObject(m_index_buffer.GetInterface());
         }
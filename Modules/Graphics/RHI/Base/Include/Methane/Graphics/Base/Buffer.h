@@ -47,6 +47,10 @@ public:
     uint32_t        GetFormattedItemsCount() const noexcept final;
     void            SetData(Rhi::ICommandQueue&, const SubResource& sub_resource) override;
 
+    // Buffer interface
+    // Returns persistently mapped buffer memory or null, when buffer data can be changed with SetData only
+    [[nodiscard]] virtual Data::RawPtr GetMappedData() { return nullptr; }
+
 private:
     Settings m_settings;
 };
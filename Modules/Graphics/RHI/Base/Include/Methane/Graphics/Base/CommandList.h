@@ -28,16 +28,14 @@ Base implementation of the command list interface.
 #include <Methane/Graphics/RHI/IProgram.h>
 #include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Graphics/RHI/ICommandQueue.h>
+#include <Methane/Graphics/RHI/IQueryPool.h>
 #include <Methane/Data/Emitter.hpp>
 #include <Methane/Memory.hpp>
 #include <Methane/TracyGpu.hpp>
 #include <Methane/Checks.hpp>
 
-#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
-#include <Methane/Graphics/RHI/IQueryPool.h>
-#endif
-
 #include <stack>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 
@@ -47,6 +45,7 @@ namespace Methane::Graphics::Base
 class CommandQueue;
 class ProgramBindings;
 class CommandListDebugGroup;
+class CommandStream;
 
 class CommandList // NOSONAR - custom destructor is used for logging, class has more than 35 methods
     : public Object
@@ -95,6 +94,10 @@ public:
     const ProgramBindings* GetProgramBindingsPtr() const noexcept { return GetCommandState().program_bindings_ptr; }
     Ptr<CommandList>       GetCommandListPtr()                    { return GetPtr<CommandList>(); }
 
+    // Command stream records all calls of command list wrapper while it is set, null pointer stops recording
+    void           SetCommandStream(CommandStream* command_stream_ptr) noexcept { m_command_stream_ptr = command_stream_ptr; }
+    CommandStream* GetCommandStreamPtr() const noexcept                         { return m_command_stream_ptr; }
+
     inline void RetainResource(const Ptr<Object>& resource_ptr)   { if (resource_ptr) m_command_state.retained_resources.emplace_back(resource_ptr); }
     inline void RetainResource(Object& resource)                  { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
     inline void ReleaseRetainedResources()                        { m_command_state.retained_resources.clear(); }
@@ -124,19 +127,37 @@ protected:
     void BeginGpuZone();
     void EndGpuZone();
 
+    // Debug group timestamps can not be written by command lists encoding commands inside render pass in some APIs
+    virtual bool IsDebugGroupTimingSupported() const noexcept { return true; }
+
     void VerifyEncodingState() const;
 
 private:
     using DebugGroupStack  = std::stack<Ptr<DebugGroup>>;
 
+    struct DebugGroupTimestamps
+    {
+        std::string               name;
+        size_t                    depth = 0U;
+        Ptr<Rhi::ITimestampQuery> begin_query_ptr;
+        Ptr<Rhi::ITimestampQuery> end_query_ptr;
+    };
+
     void CompleteInternal();
+    Rhi::ITimestampQueryPool* GetDebugGroupTimestampQueryPoolPtr();
+    Ptr<Rhi::ITimestampQuery> CreateDebugGroupTimestampQuery();
+    void BeginDebugGroupTiming(const IDebugGroup& debug_group);
+    void EndDebugGroupTiming();
+    void AddDebugGroupTimings(Rhi::CommandQueueDebugGroupTiming& root_timing) const; // called by CommandQueue
 
     const Type        m_type;
     Ptr<CommandQueue> m_command_queue_ptr;
     CommandState      m_command_state;
     DebugGroupStack   m_open_debug_groups;
+    std::vector<DebugGroupTimestamps> m_debug_group_timestamps;
     CompletedCallback m_completed_callback;
     State             m_state = State::Pending;
+    CommandStream*    m_command_stream_ptr = nullptr;
 
     mutable TracyLockable(std::recursive_mutex, m_state_mutex);
     TracyLockable(std::mutex,   m_state_change_mutex);
@@ -28,9 +28,11 @@ Base implementation of the command queue interface.
 
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/TracyGpu.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <list>
 #include <set>
+#include <map>
 #include <mutex>
 
 namespace Methane::Graphics::Base
@@ -57,6 +59,10 @@ public:
     [[nodiscard]] const Rhi::IContext& GetContext() const noexcept final;
     Rhi::CommandListType GetCommandListType() const noexcept final { return m_command_lists_type; }
     void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
+    [[nodiscard]] DebugGroupTiming GetDebugGroupTiming(const Opt<Data::Index>& frame_index = {}) const override;
+
+    // Called for each command list of the set which execution was completed by GPU, but not yet marked as completed
+    void AddDebugGroupTimings(const Opt<Data::Index>& frame_index, const CommandList& command_list);
 
     const Context&     GetBaseContext() const noexcept     { return m_context; }
     Device&            GetBaseDevice() const noexcept      { return *m_device_ptr; }
@@ -68,10 +74,17 @@ protected:
     void InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings);
 
 private:
+    using DebugGroupTimingByFrame = std::map<Opt<Data::Index>, DebugGroupTiming>;
+
+    void BeginDebugGroupTimingsFrame(const Opt<Data::Index>& frame_index);
+
     const Context&               m_context;
     const Ptr<Device>            m_device_ptr;
     const Rhi::CommandListType   m_command_lists_type;
     UniquePtr<Tracy::GpuContext> m_tracy_gpu_context_ptr;
+    DebugGroupTimingByFrame      m_debug_group_timing_by_frame;
+    Opt<Data::Index>             m_debug_group_timings_frame_index;
+    mutable TracyLockable(std::mutex, m_debug_group_timings_mutex);
 };
 
 } // namespace Methane::Graphics::Base
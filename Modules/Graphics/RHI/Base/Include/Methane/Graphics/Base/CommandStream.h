@@ -0,0 +1,118 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/CommandStream.h
+Compact binary stream of command list calls with referenced objects table,
+recorded from command list wrappers and replayed to command list of any RHI backend.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Graphics/RHI/IRenderCommandList.h>
+#include <Methane/Graphics/RHI/IComputeCommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+
+#include <vector>
+#include <unordered_map>
+#include <limits>
+
+namespace Methane::Graphics::Base
+{
+
+class CommandStream
+{
+public:
+    enum class Command : uint8_t
+    {
+        Reset,
+        ResetOnce,
+        ResetWithRenderState,
+        ResetWithRenderStateOnce,
+        ResetWithComputeState,
+        ResetWithComputeStateOnce,
+        PushDebugGroup,
+        PopDebugGroup,
+        SetProgramBindings,
+        SetResourceBarriers,
+        SetRenderState,
+        SetViewState,
+        SetVertexBuffers,
+        SetIndexBuffer,
+        DrawIndexed,
+        Draw,
+        SetComputeState,
+        Dispatch,
+        Commit
+    };
+
+    using ObjectIndex = Data::Index;
+    static constexpr ObjectIndex null_object_index = std::numeric_limits<ObjectIndex>::max();
+
+    // Recording of command list calls, referenced objects are retained by the stream until it is cleared
+    void RecordReset(Rhi::ICommandList::IDebugGroup* debug_group_ptr, bool once);
+    void RecordResetWithState(Rhi::IRenderState& render_state, Rhi::ICommandList::IDebugGroup* debug_group_ptr, bool once);
+    void RecordResetWithState(Rhi::IComputeState& compute_state, Rhi::ICommandList::IDebugGroup* debug_group_ptr, bool once);
+    void RecordPushDebugGroup(Rhi::ICommandList::IDebugGroup& debug_group);
+    void RecordPopDebugGroup();
+    void RecordSetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
+    void RecordSetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers);
+    void RecordSetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups);
+    void RecordSetViewState(Rhi::IViewState& view_state);
+    void RecordSetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers);
+    void RecordSetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers);
+    void RecordDrawIndexed(Rhi::RenderPrimitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                           uint32_t instance_count, uint32_t start_instance);
+    void RecordDraw(Rhi::RenderPrimitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                    uint32_t instance_count, uint32_t start_instance);
+    void RecordSetComputeState(Rhi::IComputeState& compute_state);
+    void RecordDispatch(const Rhi::ThreadGroupsCount& thread_groups_count);
+    void RecordCommit();
+
+    // Replays all recorded commands to the given command list in the order of recording,
+    // command list type should support all recorded commands
+    void Replay(Rhi::ICommandList& command_list) const;
+
+    void Clear();
+
+    [[nodiscard]] const Data::Bytes&             GetData() const noexcept          { return m_data; }
+    [[nodiscard]] Data::Size                     GetCommandsCount() const noexcept { return m_commands_count; }
+    [[nodiscard]] const Ptrs<Rhi::IObject>&      GetObjects() const noexcept       { return m_objects; }
+    [[nodiscard]] bool                           IsEmpty() const noexcept          { return m_data.empty(); }
+
+private:
+    using ObjectIndexByPtr = std::unordered_map<const Rhi::IObject*, ObjectIndex>;
+
+    template<typename T>
+    void Write(const T& value);
+
+    void WriteCommand(Command command);
+    void WriteObject(Rhi::IObject* object_ptr);
+    void WriteBarriers(const Rhi::IResourceBarriers& resource_barriers);
+
+    Data::Bytes                   m_data;
+    Data::Size                    m_commands_count = 0U;
+    Ptrs<Rhi::IObject>            m_objects;
+    ObjectIndexByPtr              m_object_index_by_ptr;
+    Ptrs<Rhi::IResourceBarriers>  m_resource_barriers;
+};
+
+} // namespace Methane::Graphics::Base
@@ -24,6 +24,8 @@ Base implementation of the context interface.
 #pragma once
 
 #include "Object.h"
+#include "DynamicConstantsAllocator.h"
+#include "ShaderCache.h"
 
 #include <Methane/Graphics/RHI/IFence.h>
 #include <Methane/Graphics/RHI/IContext.h>
@@ -82,6 +84,8 @@ public:
     Rhi::ICommandKit&           GetDefaultCommandKit(Rhi::ICommandQueue& cmd_queue) const final;
     const Rhi::IDevice&         GetDevice() const final;
     bool                        UploadResources() const override;
+    DynamicConstants            AllocateDynamicConstants(Data::Size size) const final;
+    ShaderCacheStatistics       GetShaderCacheStatistics() const final                  { return m_shader_cache.GetStatistics(); }
 
     // Context interface
     virtual void Initialize(Device& device, bool is_callback_emitted = true);
@@ -95,10 +99,13 @@ public:
     Device&                  GetBaseDevice();
     const Device&            GetBaseDevice() const;
     Rhi::IDescriptorManager& GetDescriptorManager() const;
+    void                     FlushDynamicConstants(Rhi::ICommandQueue& target_cmd_queue) const;
+    ShaderCache&             GetShaderCache() const noexcept     { return m_shader_cache; }
 
 protected:
     void PerformRequestedAction();
     void SetDevice(Device& device);
+    void BeginDynamicConstantsFrame(uint32_t frame_index);
 
     // Context interface
     virtual void OnGpuWaitStart(WaitFor);
@@ -118,6 +125,8 @@ private:
     ObjectRegistry                     m_objects_cache;
     mutable CommandKitPtrByType        m_default_command_kit_ptrs;
     mutable CommandKitByQueue          m_default_command_kit_ptr_by_queue;
+    mutable DynamicConstantsAllocator  m_dynamic_constants_allocator;
+    mutable ShaderCache                m_shader_cache;
     mutable DeferredAction             m_requested_action = DeferredAction::None;
     mutable bool                       m_is_completing_initialization = false;
 };
@@ -0,0 +1,90 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/DynamicConstantsAllocator.h
+Linear allocator of per-frame dynamic constants in CPU-visible constant buffer pages.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <mutex>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct ICommandQueue;
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Base
+{
+
+class Context;
+
+class DynamicConstantsAllocator
+{
+public:
+    static constexpr Data::Size page_size       = 256U * 1024U;
+    static constexpr Data::Size data_alignment  = 256U; // satisfies constant buffer offset alignment of all graphics APIs
+
+    explicit DynamicConstantsAllocator(const Context& context);
+
+    // Allocated constants are valid until the same frame is begun again
+    [[nodiscard]] Rhi::ContextDynamicConstants Allocate(Data::Size size);
+
+    // Frame is begun when GPU has completed all commands using its constants
+    void BeginFrame(uint32_t frame_index);
+
+    // Constants of buffers which are not persistently mapped are written with IBuffer::SetData from the CPU copy
+    void Flush(Rhi::ICommandQueue& target_cmd_queue);
+    void Release();
+
+    [[nodiscard]] uint32_t   GetFrameIndex() const noexcept { return m_frame_index; }
+    [[nodiscard]] Data::Size GetFrameUsedSize() const;
+
+private:
+    struct Page
+    {
+        Ptr<Rhi::IBuffer> buffer_ptr;
+        Data::RawPtr      mapped_data_ptr = nullptr;
+        Data::Bytes       cpu_data; // used instead of mapped data, when buffer memory can not be persistently mapped
+        Data::Size        used_size       = 0U;
+        Data::Size        flushed_size    = 0U;
+    };
+
+    struct Frame
+    {
+        std::vector<Page> pages;
+        size_t            page_index = 0U;
+    };
+
+    Page& AddPage(Frame& frame, Data::Size min_size);
+
+    const Context&            m_context;
+    std::vector<Frame>        m_frames;
+    uint32_t                  m_frame_index = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
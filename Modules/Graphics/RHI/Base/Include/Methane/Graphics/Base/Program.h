@@ -39,6 +39,7 @@ namespace Methane::Graphics::Base
 
 class Context;
 class CommandList;
+class Shader;
 
 class Program
     : public Rhi::IProgram
@@ -65,6 +66,11 @@ protected:
     using FrameArgumentBindings = std::unordered_map<IProgram::Argument, Ptrs<ArgumentBinding>, IProgram::Argument::Hash>;
 
     void InitArgumentBindings(const ArgumentAccessors& argument_accessors);
+
+    // Shader objects may be shared between programs by the context shader cache,
+    // so program specific reflection of shader arguments is provided by overriding this method
+    virtual Ptrs<ArgumentBinding> GetShaderArgumentBindings(const Shader& shader, const ArgumentAccessors& argument_accessors) const;
+
     const ArgumentBindings&         GetArgumentBindings() const noexcept      { return m_binding_by_argument; }
     const FrameArgumentBindings&    GetFrameArgumentBindings() const noexcept { return m_frame_bindings_by_argument; }
     const Ptr<ArgumentBinding>&     GetFrameArgumentBinding(Data::Index frame_index, const Rhi::ProgramArgumentAccessor& argument_accessor) const;
@@ -28,6 +28,9 @@ GPU data query pool base implementation.
 #include <Methane/Data/Types.h>
 #include <Methane/Data/TimeRange.hpp>
 #include <Methane/Data/RangeSet.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <mutex>
 
 namespace Methane::Graphics::Base
 {
@@ -109,6 +112,7 @@ private:
     RangeSet                 m_free_data_ranges;
     CommandQueue&            m_command_queue;
     const Rhi::IContext&     m_context;
+    TracyLockable(std::mutex, m_free_ranges_mutex); // queries are created by command lists encoded in parallel
 };
 
 class TimestampQueryPool
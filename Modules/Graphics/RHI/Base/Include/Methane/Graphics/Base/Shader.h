@@ -27,9 +27,11 @@ Base implementation of the shader interface.
 #include "ProgramBindings.h"
 
 #include <Methane/Graphics/RHI/IShader.h>
+#include <Methane/Instrumentation.h>
 
 #include <set>
 #include <string_view>
+#include <mutex>
 
 namespace Methane::Graphics::Rhi
 {
@@ -75,6 +77,7 @@ private:
     const Context&      m_context;
     const Settings      m_settings;
     mutable ArgNamesSet m_cached_arg_names;
+    mutable TracyLockable(std::mutex, m_cached_arg_names_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -0,0 +1,82 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ShaderCache.h
+Context cache of shaders deduplicated by shader type, entry function and compile definitions,
+so that programs created with equal shader settings share shader objects and their reflection.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IShader.h>
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <unordered_map>
+#include <functional>
+#include <mutex>
+
+namespace Methane::Graphics::Base
+{
+
+class ShaderCache
+{
+public:
+    using Statistics = Rhi::ContextShaderCacheStatistics;
+
+    using CreateShaderFunc = std::function<Ptr<Rhi::IShader>()>;
+
+    // Shader is created with the given function only when no shader with equal type and settings is cached
+    [[nodiscard]] Ptr<Rhi::IShader> GetShader(Rhi::ShaderType shader_type, const Rhi::ShaderSettings& settings,
+                                              const CreateShaderFunc& create_shader);
+
+    [[nodiscard]] Statistics GetStatistics() const;
+    void Clear();
+
+private:
+    struct Key
+    {
+        struct Hash
+        {
+            [[nodiscard]] size_t operator()(const Key& key) const noexcept { return key.hash; }
+        };
+
+        Key(Rhi::ShaderType shader_type, const Rhi::ShaderSettings& settings);
+
+        [[nodiscard]] bool operator==(const Key& other) const noexcept;
+
+        Rhi::ShaderType             shader_type;
+        const Data::IProvider*      data_provider_ptr;
+        Rhi::ShaderEntryFunction    entry_function;
+        Rhi::ShaderMacroDefinitions sorted_definitions; // macro definitions order does not change compiled shader
+        std::string                 source_file_path;
+        std::string                 source_compile_target;
+        size_t                      hash;
+    };
+
+    using ShaderByKey = std::unordered_map<Key, Ptr<Rhi::IShader>, Key::Hash>;
+
+    ShaderByKey                       m_shader_by_key;
+    uint32_t                          m_hits_count   = 0U;
+    uint32_t                          m_misses_count = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
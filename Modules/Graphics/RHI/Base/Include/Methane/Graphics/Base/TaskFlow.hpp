@@ -0,0 +1,44 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/TaskFlow.hpp
+TaskFlow utilities shared by RHI base and implementation modules.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/taskflow.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+// Task flow is co-run by the worker thread when it is called from the same executor,
+// which prevents dead-lock of the nested task flow waiting for the busy worker threads
+inline void RunTaskFlow(tf::Executor& executor, tf::Taskflow& task_flow)
+{
+    META_FUNCTION_TASK();
+    if (executor.this_worker_id() >= 0)
+        executor.corun(task_flow);
+    else
+        executor.run(task_flow).get();
+}
+
+} // namespace Methane::Graphics::Base
@@ -25,6 +25,7 @@ Base implementation of the command list interface.
 #include <Methane/Graphics/Base/CommandListDebugGroup.h>
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
+#include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Resource.h>
 
@@ -32,6 +33,8 @@ Base implementation of the command list interface.
 #include <Methane/Checks.hpp>
 
 #include <magic_enum.hpp>
+#include <algorithm>
+#include <stdexcept>
 
 // Disable debug groups instrumentation with discontinuous CPU frames in Tracy,
 // because it is not working for parallel render command lists by some reason
@@ -40,12 +43,10 @@ Base implementation of the command list interface.
 namespace Methane::Graphics::Base
 {
 
-#ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
 static Data::TimeRange GetNormalTimeRange(Timestamp start, Timestamp end)
 {
     return Data::TimeRange(std::min(start, end), std::max(start, end));
 }
-#endif
 
 CommandList::CommandList(CommandQueue& command_queue, Type type)
     : m_type(type)
@@ -74,6 +75,7 @@ void CommandList::PushDebugGroup(IDebugGroup& debug_group)
 #endif
     META_LOG("{} Command list '{}' PUSH debug group '{}'", magic_enum::enum_name(m_type), GetName(), debug_group.GetName());
 
+    BeginDebugGroupTiming(debug_group);
     PushOpenDebugGroup(debug_group);
 }
 
@@ -90,6 +92,7 @@ void CommandList::PopDebugGroup()
     META_CPU_FRAME_END(GetTopOpenDebugGroup()->GetName().data());
 #endif
 
+    EndDebugGroupTiming();
     m_open_debug_groups.pop();
 }
 
@@ -111,6 +114,12 @@ void CommandList::Reset(IDebugGroup* debug_group_ptr)
         PopDebugGroup();
     }
 
+    // Timestamps of the debug groups are kept while the same debug group stays open between resets
+    if (m_open_debug_groups.empty())
+    {
+        m_debug_group_timestamps.clear();
+    }
+
     TRACY_GPU_SCOPE_TRY_BEGIN_NAMED(m_tracy_gpu_scope, GetName());
 
     if (debug_group_ptr && debug_group_changed)
@@ -350,6 +359,112 @@ Data::TimeRange CommandList::GetGpuTimeRange(bool in_cpu_nanoseconds) const
     return { 0U, 0U };
 }
 
+Rhi::ITimestampQueryPool* CommandList::GetDebugGroupTimestampQueryPoolPtr()
+{
+    META_FUNCTION_TASK();
+    if (!GetBaseCommandQueue().GetBaseContext().GetOptions().HasBit(Rhi::ContextOption::GpuDebugGroupTimings) ||
+        !IsDebugGroupTimingSupported())
+        return nullptr;
+
+    // Command queue may have no support of timestamp queries, like DirectX copy queue
+    return GetCommandQueue().GetTimestampQueryPoolPtr().get();
+}
+
+Ptr<Rhi::ITimestampQuery> CommandList::CreateDebugGroupTimestampQuery()
+{
+    META_FUNCTION_TASK();
+    Rhi::ITimestampQueryPool* query_pool_ptr = GetDebugGroupTimestampQueryPoolPtr();
+    if (!query_pool_ptr)
+        return nullptr;
+
+    try
+    {
+        return query_pool_ptr->CreateTimestampQuery(*this);
+    }
+    catch([[maybe_unused]] const std::invalid_argument& e)
+    {
+        // Debug group timing is skipped when queries of the frame are exhausted by GPU zones and other debug groups
+        META_LOG("WARNING: Debug group timing is skipped in command list '{}': {}", GetName(), e.what());
+        return nullptr;
+    }
+}
+
+void CommandList::BeginDebugGroupTiming(const IDebugGroup& debug_group)
+{
+    META_FUNCTION_TASK();
+    Ptr<Rhi::ITimestampQuery> begin_query_ptr = CreateDebugGroupTimestampQuery();
+    if (!begin_query_ptr)
+        return;
+
+    begin_query_ptr->InsertTimestamp();
+    m_debug_group_timestamps.push_back(DebugGroupTimestamps{
+        std::string(debug_group.GetName()), m_open_debug_groups.size(), std::move(begin_query_ptr), nullptr
+    });
+}
+
+void CommandList::EndDebugGroupTiming()
+{
+    META_FUNCTION_TASK();
+    if (m_debug_group_timestamps.empty())
+        return;
+
+    // Debug group may be opened without timestamp, when it was pushed to another command list
+    const size_t depth = m_open_debug_groups.size() - 1U;
+    const auto group_timestamps_it = std::find_if(m_debug_group_timestamps.rbegin(), m_debug_group_timestamps.rend(),
+        [depth](const DebugGroupTimestamps& group_timestamps)
+        { return group_timestamps.depth == depth && !group_timestamps.end_query_ptr; });
+    if (group_timestamps_it == m_debug_group_timestamps.rend())
+        return;
+
+    Ptr<Rhi::ITimestampQuery> end_query_ptr = CreateDebugGroupTimestampQuery();
+    if (!end_query_ptr)
+        return;
+
+    end_query_ptr->InsertTimestamp();
+    end_query_ptr->ResolveTimestamp();
+    group_timestamps_it->begin_query_ptr->ResolveTimestamp();
+    group_timestamps_it->end_query_ptr = std::move(end_query_ptr);
+}
+
+void CommandList::AddDebugGroupTimings(Rhi::CommandQueueDebugGroupTiming& root_timing) const
+{
+    META_FUNCTION_TASK();
+    if (m_debug_group_timestamps.empty())
+        return;
+
+    // Debug group timestamps are stored in the order of pushing, so parent timing is always added before its children
+    std::vector<Rhi::CommandQueueDebugGroupTiming*> parent_timing_ptrs{ &root_timing };
+    for(const DebugGroupTimestamps& group_timestamps : m_debug_group_timestamps)
+    {
+        if (group_timestamps.depth >= parent_timing_ptrs.size())
+            continue;
+
+        parent_timing_ptrs.resize(group_timestamps.depth + 1U);
+        if (!group_timestamps.end_query_ptr)
+            continue;
+
+        std::vector<Rhi::CommandQueueDebugGroupTiming>& sibling_timings = parent_timing_ptrs.back()->children;
+        auto timing_it = std::find_if(sibling_timings.begin(), sibling_timings.end(),
+                                      [&group_timestamps](const Rhi::CommandQueueDebugGroupTiming& timing)
+                                      { return timing.name == group_timestamps.name; });
+        if (timing_it == sibling_timings.end())
+        {
+            timing_it = sibling_timings.insert(sibling_timings.end(), Rhi::CommandQueueDebugGroupTiming{ group_timestamps.name });
+        }
+
+        const Timestamp duration_ns = GetNormalTimeRange(group_timestamps.begin_query_ptr->GetCpuNanoseconds(),
+                                                         group_timestamps.end_query_ptr->GetCpuNanoseconds()).GetLength();
+        timing_it->duration_ns += duration_ns;
+        timing_it->count++;
+        if (!group_timestamps.depth)
+        {
+            root_timing.duration_ns += duration_ns;
+        }
+        parent_timing_ptrs.push_back(&*timing_it);
+    }
+    root_timing.count++;
+}
+
 Rhi::ICommandQueue& CommandList::GetCommandQueue()
 {
     META_FUNCTION_TASK();
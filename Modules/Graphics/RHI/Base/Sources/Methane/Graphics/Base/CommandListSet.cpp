@@ -89,6 +89,8 @@ void CommandListSet::Complete() const
         if (command_list.GetState() != CommandList::State::Executing)
             continue;
 
+        // Debug group timestamps are read before completion, while command list can not be reset
+        command_list.GetBaseCommandQueue().AddDebugGroupTimings(m_frame_index_opt, command_list);
         command_list.Complete();
     }
 
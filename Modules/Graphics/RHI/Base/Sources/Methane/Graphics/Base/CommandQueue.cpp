@@ -75,7 +75,38 @@ void CommandQueue::Execute(Rhi::ICommandListSet& command_lists, const Rhi::IComm
 {
     META_FUNCTION_TASK();
     META_LOG("Command queue '{}' is executing", GetName());
-    static_cast<CommandListSet&>(command_lists).Execute(completed_callback);
+    m_context.FlushDynamicConstants(*this);
+
+    auto& command_list_set = static_cast<CommandListSet&>(command_lists);
+    if (m_context.GetOptions().HasBit(Rhi::ContextOption::GpuDebugGroupTimings))
+    {
+        BeginDebugGroupTimingsFrame(command_list_set.GetFrameIndex());
+    }
+    command_list_set.Execute(completed_callback);
+}
+
+Rhi::CommandQueueDebugGroupTiming CommandQueue::GetDebugGroupTiming(const Opt<Data::Index>& frame_index) const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_debug_group_timings_mutex);
+    if (const auto timing_it = m_debug_group_timing_by_frame.find(frame_index);
+        timing_it != m_debug_group_timing_by_frame.end())
+    {
+        return timing_it->second;
+    }
+    return DebugGroupTiming{ std::string(GetName()) };
+}
+
+void CommandQueue::AddDebugGroupTimings(const Opt<Data::Index>& frame_index, const CommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    if (!m_context.GetOptions().HasBit(Rhi::ContextOption::GpuDebugGroupTimings))
+        return;
+
+    std::lock_guard lock(m_debug_group_timings_mutex);
+    DebugGroupTiming& frame_timing = m_debug_group_timing_by_frame[frame_index];
+    frame_timing.name = GetName();
+    command_list.AddDebugGroupTimings(frame_timing);
 }
 
 Tracy::GpuContext& CommandQueue::GetTracyContext() const
@@ -85,6 +116,22 @@ Tracy::GpuContext& CommandQueue::GetTracyContext() const
     return *m_tracy_gpu_context_ptr;
 }
 
+void CommandQueue::BeginDebugGroupTimingsFrame(const Opt<Data::Index>& frame_index)
+{
+    META_FUNCTION_TASK();
+    // Timings of the frame are reset when its first command list set is executed after the command lists of another frame,
+    // while timings of command lists executed without frame index are accumulated
+    if (!frame_index)
+        return;
+
+    std::lock_guard lock(m_debug_group_timings_mutex);
+    if (frame_index == m_debug_group_timings_frame_index)
+        return;
+
+    m_debug_group_timings_frame_index = frame_index;
+    m_debug_group_timing_by_frame[frame_index] = DebugGroupTiming{ std::string(GetName()) };
+}
+
 void CommandQueue::InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings)
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,416 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/CommandStream.cpp
+Compact binary stream of command list calls with referenced objects table,
+recorded from command list wrappers and replayed to command list of any RHI backend.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/CommandStream.h>
+
+#include <Methane/Graphics/RHI/ICommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/IRenderState.h>
+#include <Methane/Graphics/RHI/IViewState.h>
+#include <Methane/Graphics/RHI/IComputeState.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Graphics/RHI/IBufferSet.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+#include <cstring>
+
+namespace Methane::Graphics::Base
+{
+
+class CommandStreamReader
+{
+public:
+    CommandStreamReader(const Data::Bytes& data, const Ptrs<Rhi::IObject>& objects, const Ptrs<Rhi::IResourceBarriers>& resource_barriers) noexcept
+        : m_data(data)
+        , m_objects(objects)
+        , m_resource_barriers(resource_barriers)
+    { }
+
+    [[nodiscard]] bool IsEnd() const noexcept { return m_offset >= m_data.size(); }
+
+    template<typename T>
+    [[nodiscard]] T Read()
+    {
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(m_offset + sizeof(T), m_data.size(), "command stream data is truncated");
+        T value;
+        std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return value;
+    }
+
+    template<typename T>
+    [[nodiscard]] T* ReadObjectPtr()
+    {
+        const auto object_index = Read<CommandStream::ObjectIndex>();
+        if (object_index == CommandStream::null_object_index)
+            return nullptr;
+
+        META_CHECK_ARG_LESS(object_index, m_objects.size());
+        return dynamic_cast<T*>(m_objects[object_index].get());
+    }
+
+    template<typename T>
+    [[nodiscard]] T& ReadObject()
+    {
+        T* object_ptr = ReadObjectPtr<T>();
+        META_CHECK_ARG_NOT_NULL_DESCR(object_ptr, "command stream object has unexpected type");
+        return *object_ptr;
+    }
+
+    [[nodiscard]] const Rhi::IResourceBarriers& ReadBarriers()
+    {
+        const auto barriers_index = Read<Data::Index>();
+        META_CHECK_ARG_LESS(barriers_index, m_resource_barriers.size());
+        return *m_resource_barriers[barriers_index];
+    }
+
+    template<typename MaskType>
+    [[nodiscard]] MaskType ReadMask()
+    {
+        return MaskType(Read<typename MaskType::MaskType>());
+    }
+
+private:
+    const Data::Bytes&                  m_data;
+    const Ptrs<Rhi::IObject>&           m_objects;
+    const Ptrs<Rhi::IResourceBarriers>& m_resource_barriers;
+    size_t                              m_offset = 0U;
+};
+
+template<typename T>
+void CommandStream::Write(const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be written to command stream");
+    const size_t offset = m_data.size();
+    m_data.resize(offset + sizeof(T));
+    std::memcpy(m_data.data() + offset, &value, sizeof(T));
+}
+
+void CommandStream::WriteCommand(Command command)
+{
+    Write(command);
+    m_commands_count++;
+}
+
+void CommandStream::WriteObject(Rhi::IObject* object_ptr)
+{
+    if (!object_ptr)
+    {
+        Write(null_object_index);
+        return;
+    }
+
+    // Objects are added to the table once and referenced by index in the stream data
+    const auto [object_index_it, object_added] = m_object_index_by_ptr.try_emplace(object_ptr, static_cast<ObjectIndex>(m_objects.size()));
+    if (object_added)
+    {
+        m_objects.emplace_back(object_ptr->GetPtr());
+    }
+    Write(object_index_it->second);
+}
+
+void CommandStream::WriteBarriers(const Rhi::IResourceBarriers& resource_barriers)
+{
+    // Resource barriers are mutable, so their snapshot is captured at the moment of recording
+    Write(static_cast<Data::Index>(m_resource_barriers.size()));
+    m_resource_barriers.emplace_back(Rhi::IResourceBarriers::Create(resource_barriers.GetSet()));
+}
+
+void CommandStream::RecordReset(Rhi::ICommandList::IDebugGroup* debug_group_ptr, bool once)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(once ? Command::ResetOnce : Command::Reset);
+    WriteObject(debug_group_ptr);
+}
+
+void CommandStream::RecordResetWithState(Rhi::IRenderState& render_state, Rhi::ICommandList::IDebugGroup* debug_group_ptr, bool once)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(once ? Command::ResetWithRenderStateOnce : Command::ResetWithRenderState);
+    WriteObject(&render_state);
+    WriteObject(debug_group_ptr);
+}
+
+void CommandStream::RecordResetWithState(Rhi::IComputeState& compute_state, Rhi::ICommandList::IDebugGroup* debug_group_ptr, bool once)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(once ? Command::ResetWithComputeStateOnce : Command::ResetWithComputeState);
+    WriteObject(&compute_state);
+    WriteObject(debug_group_ptr);
+}
+
+void CommandStream::RecordPushDebugGroup(Rhi::ICommandList::IDebugGroup& debug_group)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::PushDebugGroup);
+    WriteObject(&debug_group);
+}
+
+void CommandStream::RecordPopDebugGroup()
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::PopDebugGroup);
+}
+
+void CommandStream::RecordSetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetProgramBindings);
+    WriteObject(&program_bindings);
+    Write(apply_behavior.GetValue());
+}
+
+void CommandStream::RecordSetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetResourceBarriers);
+    WriteBarriers(resource_barriers);
+}
+
+void CommandStream::RecordSetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetRenderState);
+    WriteObject(&render_state);
+    Write(state_groups.GetValue());
+}
+
+void CommandStream::RecordSetViewState(Rhi::IViewState& view_state)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetViewState);
+    WriteObject(&view_state);
+}
+
+void CommandStream::RecordSetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetVertexBuffers);
+    WriteObject(&vertex_buffers);
+    Write(set_resource_barriers);
+}
+
+void CommandStream::RecordSetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetIndexBuffer);
+    WriteObject(&index_buffer);
+    Write(set_resource_barriers);
+}
+
+void CommandStream::RecordDrawIndexed(Rhi::RenderPrimitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                      uint32_t instance_count, uint32_t start_instance)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::DrawIndexed);
+    Write(static_cast<uint8_t>(primitive));
+    Write(index_count);
+    Write(start_index);
+    Write(start_vertex);
+    Write(instance_count);
+    Write(start_instance);
+}
+
+void CommandStream::RecordDraw(Rhi::RenderPrimitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                               uint32_t instance_count, uint32_t start_instance)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::Draw);
+    Write(static_cast<uint8_t>(primitive));
+    Write(vertex_count);
+    Write(start_vertex);
+    Write(instance_count);
+    Write(start_instance);
+}
+
+void CommandStream::RecordSetComputeState(Rhi::IComputeState& compute_state)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::SetComputeState);
+    WriteObject(&compute_state);
+}
+
+void CommandStream::RecordDispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::Dispatch);
+    Write(thread_groups_count.GetWidth());
+    Write(thread_groups_count.GetHeight());
+    Write(thread_groups_count.GetDepth());
+}
+
+void CommandStream::RecordCommit()
+{
+    META_FUNCTION_TASK();
+    WriteCommand(Command::Commit);
+}
+
+void CommandStream::Replay(Rhi::ICommandList& command_list) const
+{
+    META_FUNCTION_TASK();
+    auto* render_command_list_ptr  = dynamic_cast<Rhi::IRenderCommandList*>(&command_list);
+    auto* compute_command_list_ptr = dynamic_cast<Rhi::IComputeCommandList*>(&command_list);
+    const auto get_render_command_list = [render_command_list_ptr]() -> Rhi::IRenderCommandList&
+    {
+        META_CHECK_ARG_NOT_NULL_DESCR(render_command_list_ptr, "render command can not be replayed to non-render command list");
+        return *render_command_list_ptr;
+    };
+    const auto get_compute_command_list = [compute_command_list_ptr]() -> Rhi::IComputeCommandList&
+    {
+        META_CHECK_ARG_NOT_NULL_DESCR(compute_command_list_ptr, "compute command can not be replayed to non-compute command list");
+        return *compute_command_list_ptr;
+    };
+
+    CommandStreamReader reader(m_data, m_objects, m_resource_barriers);
+    while(!reader.IsEnd())
+    {
+        switch(const auto command = reader.Read<Command>(); command)
+        {
+        case Command::Reset:
+            command_list.Reset(reader.ReadObjectPtr<Rhi::ICommandList::IDebugGroup>());
+            break;
+
+        case Command::ResetOnce:
+            command_list.ResetOnce(reader.ReadObjectPtr<Rhi::ICommandList::IDebugGroup>());
+            break;
+
+        case Command::ResetWithRenderState:
+        {
+            auto& render_state = reader.ReadObject<Rhi::IRenderState>();
+            get_render_command_list().ResetWithState(render_state, reader.ReadObjectPtr<Rhi::ICommandList::IDebugGroup>());
+        } break;
+
+        case Command::ResetWithRenderStateOnce:
+        {
+            auto& render_state = reader.ReadObject<Rhi::IRenderState>();
+            get_render_command_list().ResetWithStateOnce(render_state, reader.ReadObjectPtr<Rhi::ICommandList::IDebugGroup>());
+        } break;
+
+        case Command::ResetWithComputeState:
+        {
+            auto& compute_state = reader.ReadObject<Rhi::IComputeState>();
+            get_compute_command_list().ResetWithState(compute_state, reader.ReadObjectPtr<Rhi::ICommandList::IDebugGroup>());
+        } break;
+
+        case Command::ResetWithComputeStateOnce:
+        {
+            auto& compute_state = reader.ReadObject<Rhi::IComputeState>();
+            get_compute_command_list().ResetWithStateOnce(compute_state, reader.ReadObjectPtr<Rhi::ICommandList::IDebugGroup>());
+        } break;
+
+        case Command::PushDebugGroup:
+            command_list.PushDebugGroup(reader.ReadObject<Rhi::ICommandList::IDebugGroup>());
+            break;
+
+        case Command::PopDebugGroup:
+            command_list.PopDebugGroup();
+            break;
+
+        case Command::SetProgramBindings:
+        {
+            auto& program_bindings = reader.ReadObject<Rhi::IProgramBindings>();
+            command_list.SetProgramBindings(program_bindings, reader.ReadMask<Rhi::ProgramBindingsApplyBehaviorMask>());
+        } break;
+
+        case Command::SetResourceBarriers:
+            command_list.SetResourceBarriers(reader.ReadBarriers());
+            break;
+
+        case Command::SetRenderState:
+        {
+            auto& render_state = reader.ReadObject<Rhi::IRenderState>();
+            get_render_command_list().SetRenderState(render_state, reader.ReadMask<Rhi::RenderStateGroupMask>());
+        } break;
+
+        case Command::SetViewState:
+            get_render_command_list().SetViewState(reader.ReadObject<Rhi::IViewState>());
+            break;
+
+        case Command::SetVertexBuffers:
+        {
+            auto& vertex_buffers = reader.ReadObject<Rhi::IBufferSet>();
+            get_render_command_list().SetVertexBuffers(vertex_buffers, reader.Read<bool>());
+        } break;
+
+        case Command::SetIndexBuffer:
+        {
+            auto& index_buffer = reader.ReadObject<Rhi::IBuffer>();
+            get_render_command_list().SetIndexBuffer(index_buffer, reader.Read<bool>());
+        } break;
+
+        case Command::DrawIndexed:
+        {
+            const auto primitive      = static_cast<Rhi::RenderPrimitive>(reader.Read<uint8_t>());
+            const auto index_count    = reader.Read<uint32_t>();
+            const auto start_index    = reader.Read<uint32_t>();
+            const auto start_vertex   = reader.Read<uint32_t>();
+            const auto instance_count = reader.Read<uint32_t>();
+            const auto start_instance = reader.Read<uint32_t>();
+            get_render_command_list().DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+        } break;
+
+        case Command::Draw:
+        {
+            const auto primitive      = static_cast<Rhi::RenderPrimitive>(reader.Read<uint8_t>());
+            const auto vertex_count   = reader.Read<uint32_t>();
+            const auto start_vertex   = reader.Read<uint32_t>();
+            const auto instance_count = reader.Read<uint32_t>();
+            const auto start_instance = reader.Read<uint32_t>();
+            get_render_command_list().Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+        } break;
+
+        case Command::SetComputeState:
+            get_compute_command_list().SetComputeState(reader.ReadObject<Rhi::IComputeState>());
+            break;
+
+        case Command::Dispatch:
+        {
+            const auto groups_x = reader.Read<uint32_t>();
+            const auto groups_y = reader.Read<uint32_t>();
+            const auto groups_z = reader.Read<uint32_t>();
+            get_compute_command_list().Dispatch(Rhi::ThreadGroupsCount(groups_x, groups_y, groups_z));
+        } break;
+
+        case Command::Commit:
+            command_list.Commit();
+            break;
+
+        default:
+            META_UNEXPECTED_ARG(command);
+        }
+    }
+}
+
+void CommandStream::Clear()
+{
+    META_FUNCTION_TASK();
+    m_data.clear();
+    m_commands_count = 0U;
+    m_objects.clear();
+    m_object_index_by_ptr.clear();
+    m_resource_barriers.clear();
+}
+
+} // namespace Methane::Graphics::Base
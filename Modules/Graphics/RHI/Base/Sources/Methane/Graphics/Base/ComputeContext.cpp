@@ -49,7 +49,9 @@ void ComputeContext::WaitForGpu(WaitFor wait_for)
     {
     case WaitFor::RenderComplete:
     case WaitFor::ComputeComplete:
-        WaitForGpuComputeComplete(); break;
+        WaitForGpuComputeComplete();
+        BeginDynamicConstantsFrame(0U);
+        break;
     case WaitFor::ResourcesUploaded: break; // Handled in Context::WaitForGpu
     default: META_UNEXPECTED_ARG(wait_for);
     }
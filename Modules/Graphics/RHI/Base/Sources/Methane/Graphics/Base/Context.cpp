@@ -57,6 +57,7 @@ Context::Context(Device& device, UniquePtr<Rhi::IDescriptorManager>&& descriptor
     , m_device_ptr(device.GetPtr<Device>())
     , m_descriptor_manager_ptr(std::move(descriptor_manager_ptr))
     , m_parallel_executor(parallel_executor)
+    , m_dynamic_constants_allocator(*this)
 { }
 
 Context::~Context() = default;
@@ -145,6 +146,8 @@ void Context::Release()
     META_FUNCTION_TASK();
     META_LOG("Context '{}' RELEASE", GetName());
 
+    m_shader_cache.Clear();
+    m_dynamic_constants_allocator.Release();
     m_device_ptr.reset();
 
     m_default_command_kit_ptr_by_queue.clear();
@@ -330,10 +333,28 @@ void Context::PerformRequestedAction()
     m_requested_action = DeferredAction::None;
 }
 
+Rhi::ContextDynamicConstants Context::AllocateDynamicConstants(Data::Size size) const
+{
+    META_FUNCTION_TASK();
+    return m_dynamic_constants_allocator.Allocate(size);
+}
+
+void Context::FlushDynamicConstants(Rhi::ICommandQueue& target_cmd_queue) const
+{
+    META_FUNCTION_TASK();
+    m_dynamic_constants_allocator.Flush(target_cmd_queue);
+}
+
 void Context::SetDevice(Device& device)
 {
     META_FUNCTION_TASK();
     m_device_ptr = device.GetPtr<Device>();
 }
 
+void Context::BeginDynamicConstantsFrame(uint32_t frame_index)
+{
+    META_FUNCTION_TASK();
+    m_dynamic_constants_allocator.BeginFrame(frame_index);
+}
+
 } // namespace Methane::Graphics::Base
@@ -0,0 +1,150 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/DynamicConstantsAllocator.cpp
+Linear allocator of per-frame dynamic constants in CPU-visible constant buffer pages.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/DynamicConstantsAllocator.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+namespace Methane::Graphics::Base
+{
+
+static constexpr Data::Size AlignUp(Data::Size size, Data::Size alignment) noexcept
+{
+    return (size + alignment - 1U) / alignment * alignment;
+}
+
+DynamicConstantsAllocator::DynamicConstantsAllocator(const Context& context)
+    : m_context(context)
+{ }
+
+Rhi::ContextDynamicConstants DynamicConstantsAllocator::Allocate(Data::Size size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(size, "can not allocate empty dynamic constants");
+    const Data::Size aligned_size = AlignUp(size, data_alignment);
+
+    std::lock_guard lock(m_mutex);
+    if (m_frames.size() <= m_frame_index)
+        m_frames.resize(m_frame_index + 1U);
+
+    // Pages of the frame are reused in the same order each frame,
+    // so that steady allocations get the same buffer offsets and program bindings stay unchanged
+    Frame& frame = m_frames[m_frame_index];
+    while (frame.page_index < frame.pages.size() &&
+           frame.pages[frame.page_index].used_size + aligned_size > frame.pages[frame.page_index].buffer_ptr->GetSettings().size)
+    {
+        frame.page_index++;
+    }
+
+    Page& page = frame.page_index < frame.pages.size()
+               ? frame.pages[frame.page_index]
+               : AddPage(frame, aligned_size);
+
+    const Data::Size offset = page.used_size;
+    page.used_size += aligned_size;
+
+    Data::RawPtr data_ptr = page.mapped_data_ptr ? page.mapped_data_ptr : page.cpu_data.data();
+    return Rhi::ContextDynamicConstants{ page.buffer_ptr.get(), offset, size, data_ptr + offset };
+}
+
+void DynamicConstantsAllocator::BeginFrame(uint32_t frame_index)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    m_frame_index = frame_index;
+    if (m_frames.size() <= m_frame_index)
+        return;
+
+    Frame& frame = m_frames[m_frame_index];
+    frame.page_index = 0U;
+    for(Page& page : frame.pages)
+    {
+        page.used_size    = 0U;
+        page.flushed_size = 0U;
+    }
+}
+
+void DynamicConstantsAllocator::Flush(Rhi::ICommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    if (m_frames.size() <= m_frame_index)
+        return;
+
+    for(Page& page : m_frames[m_frame_index].pages)
+    {
+        if (page.mapped_data_ptr || page.used_size == page.flushed_size)
+            continue;
+
+        // Buffer data is always written from the beginning, since not all APIs support writing at buffer offset
+        page.buffer_ptr->SetData(target_cmd_queue, Rhi::SubResource(page.cpu_data.data(), page.used_size,
+                                                                    Rhi::SubResource::Index(), Rhi::BytesRange(0U, page.used_size)));
+        page.flushed_size = page.used_size;
+    }
+}
+
+void DynamicConstantsAllocator::Release()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    m_frames.clear();
+    m_frame_index = 0U;
+}
+
+Data::Size DynamicConstantsAllocator::GetFrameUsedSize() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    if (m_frames.size() <= m_frame_index)
+        return 0U;
+
+    Data::Size used_size = 0U;
+    for(const Page& page : m_frames[m_frame_index].pages)
+    {
+        used_size += page.used_size;
+    }
+    return used_size;
+}
+
+DynamicConstantsAllocator::Page& DynamicConstantsAllocator::AddPage(Frame& frame, Data::Size min_size)
+{
+    META_FUNCTION_TASK();
+    const Data::Size buffer_size = std::max(page_size, min_size);
+
+    Page& page = frame.pages.emplace_back();
+    page.buffer_ptr = m_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(buffer_size, true, true));
+    page.buffer_ptr->SetName(fmt::format("Dynamic Constants Buffer {}.{}", m_frame_index, frame.pages.size() - 1U));
+    page.mapped_data_ptr = static_cast<Buffer&>(*page.buffer_ptr).GetMappedData();
+    if (!page.mapped_data_ptr)
+    {
+        page.cpu_data.resize(buffer_size);
+    }
+    return page;
+}
+
+} // namespace Methane::Graphics::Base
@@ -23,10 +23,12 @@ Base implementation of the program interface.
 
 #include <Methane/Graphics/Base/Program.h>
 #include <Methane/Graphics/Base/RenderContext.h>
+#include <Methane/Graphics/Base/TaskFlow.hpp>
 
 #include <Methane/Instrumentation.h>
 
 #include <magic_enum.hpp>
+#include <taskflow/algorithm/for_each.hpp>
 #include <algorithm>
 
 namespace Methane::Graphics::Base
@@ -74,15 +76,24 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
     Rhi::ShaderTypes all_shader_types;
     std::map<std::string_view, Rhi::ShaderTypes, std::less<>> shader_types_by_argument_name_map;
     
+    // Arguments of independent shader stages are reflected in parallel and merged in order of shaders
+    const Ptrs<Rhi::IShader>& shaders = m_settings.shaders;
+    std::vector<Ptrs<ProgramArgumentBinding>> argument_bindings_by_shader(shaders.size());
+    tf::Taskflow reflection_task_flow;
+    reflection_task_flow.for_each_index(size_t(0U), shaders.size(), size_t(1U),
+        [this, &shaders, &argument_accessors, &argument_bindings_by_shader](const size_t shader_index)
+        {
+            const Ptr<Rhi::IShader>& shader_ptr = shaders[shader_index];
+            META_CHECK_ARG_NOT_NULL_DESCR(shader_ptr, "empty shader pointer in program is not allowed");
+            argument_bindings_by_shader[shader_index] = GetShaderArgumentBindings(static_cast<const Shader&>(*shader_ptr), argument_accessors);
+        });
+    RunTaskFlow(m_context.GetParallelExecutor(), reflection_task_flow);
+
     m_binding_by_argument.clear();
-    for (const Ptr<Rhi::IShader>& shader_ptr : m_settings.shaders)
+    for (size_t shader_index = 0U; shader_index < shaders.size(); ++shader_index)
     {
-        META_CHECK_ARG_NOT_NULL_DESCR(shader_ptr, "empty shader pointer in program is not allowed");
-        const Rhi::ShaderType shader_type = shader_ptr->GetType();
-        all_shader_types.insert(shader_type);
-        
-        const Ptrs<ProgramArgumentBinding> argument_bindings = static_cast<const Shader&>(*shader_ptr).GetArgumentBindings(argument_accessors);
-        for (const Ptr<ProgramBindings::ArgumentBinding>& argument_binging_ptr : argument_bindings)
+        all_shader_types.insert(shaders[shader_index]->GetType());
+        for (const Ptr<ProgramBindings::ArgumentBinding>& argument_binging_ptr : argument_bindings_by_shader[shader_index])
         {
             META_CHECK_ARG_NOT_NULL_DESCR(argument_binging_ptr, "empty resource binding provided by shader");
             const Argument& shader_argument = argument_binging_ptr->GetSettings().argument;
@@ -149,6 +160,12 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
     }
 }
 
+Ptrs<ProgramBindings::ArgumentBinding> Program::GetShaderArgumentBindings(const Shader& shader, const ArgumentAccessors& argument_accessors) const
+{
+    META_FUNCTION_TASK();
+    return shader.GetArgumentBindings(argument_accessors);
+}
+
 const Ptr<ProgramBindings::ArgumentBinding>& Program::GetFrameArgumentBinding(Data::Index frame_index, const Rhi::ProgramArgumentAccessor& argument_accessor) const
 {
     META_FUNCTION_TASK();
@@ -109,9 +109,11 @@ bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resou
                                   "can not set resource view_id with non-zero offset to non-addressable resource binding");
     }
 
-    Data::Emitter<Rhi::IProgramBindings::IArgumentBindingCallback>::Emit(&Rhi::IProgramBindings::IArgumentBindingCallback::OnProgramArgumentBindingResourceViewsChanged, std::cref(*this), std::cref(m_resource_views), std::cref(resource_views));
-
+    // New resource views are set before callback emission, so that receivers can access them via argument binding
+    const Rhi::IResource::Views old_resource_views = std::move(m_resource_views);
     m_resource_views = resource_views;
+
+    Data::Emitter<Rhi::IProgramBindings::IArgumentBindingCallback>::Emit(&Rhi::IProgramBindings::IArgumentBindingCallback::OnProgramArgumentBindingResourceViewsChanged, std::cref(*this), std::cref(old_resource_views), std::cref(m_resource_views));
     return true;
 }
 
@@ -117,6 +117,7 @@ Rhi::ICommandQueue& QueryPool::GetCommandQueue() noexcept
 void QueryPool::ReleaseQuery(const Query& query)
 {
     META_FUNCTION_TASK();
+    std::lock_guard lock(m_free_ranges_mutex);
     m_free_indices.Add({ query.GetIndex(), query.GetIndex() + 1 });
     m_free_data_ranges.Add(query.GetDataRange());
 }
@@ -124,6 +125,7 @@ void QueryPool::ReleaseQuery(const Query& query)
 QueryPool::CreateQueryArgs QueryPool::GetCreateQueryArguments()
 {
     META_FUNCTION_TASK();
+    std::lock_guard lock(m_free_ranges_mutex);
     const Data::Range<Data::Index> index_range = Data::ReserveRange(m_free_indices, m_slots_count_per_query);
     META_CHECK_ARG_DESCR(index_range, !index_range.IsEmpty(), "maximum queries count is reached");
 
@@ -176,6 +176,7 @@ void RenderContext::OnGpuWaitComplete(WaitFor wait_for)
     if (wait_for == WaitFor::FramePresented)
     {
         m_fps_counter.OnGpuFramePresented();
+        BeginDynamicConstantsFrame(m_frame_buffer_index);
         PerformRequestedAction();
     }
     else
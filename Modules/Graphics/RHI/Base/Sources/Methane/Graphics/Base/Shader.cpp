@@ -47,6 +47,8 @@ uint32_t Shader::GetProgramInputBufferIndexByArgumentSemantic(const Program& pro
 std::string_view Shader::GetCachedArgName(std::string_view arg_name) const
 {
     META_FUNCTION_TASK();
+    // Shader arguments may be reflected by several programs in parallel, when shader is shared through the context shader cache
+    std::lock_guard lock(m_cached_arg_names_mutex);
     return *m_cached_arg_names.emplace(arg_name).first;
 }
 
@@ -0,0 +1,123 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ShaderCache.cpp
+Context cache of shaders deduplicated by shader type, entry function and compile definitions,
+so that programs created with equal shader settings share shader objects and their reflection.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/ShaderCache.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+#include <algorithm>
+#include <tuple>
+
+namespace Methane::Graphics::Base
+{
+
+static void CombineHash(size_t& hash, size_t value) noexcept
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+static Rhi::ShaderMacroDefinitions GetSortedMacroDefinitions(Rhi::ShaderMacroDefinitions macro_definitions)
+{
+    META_FUNCTION_TASK();
+    std::sort(macro_definitions.begin(), macro_definitions.end(),
+              [](const Rhi::ShaderMacroDefinition& left, const Rhi::ShaderMacroDefinition& right)
+              { return std::tie(left.name, left.value) < std::tie(right.name, right.value); });
+    return macro_definitions;
+}
+
+ShaderCache::Key::Key(Rhi::ShaderType shader_type, const Rhi::ShaderSettings& settings)
+    : shader_type(shader_type)
+    , data_provider_ptr(&settings.data_provider)
+    , entry_function(settings.entry_function)
+    , sorted_definitions(GetSortedMacroDefinitions(settings.compile_definitions))
+    , source_file_path(settings.source_file_path)
+    , source_compile_target(settings.source_compile_target)
+    , hash(magic_enum::enum_index(shader_type).value())
+{
+    META_FUNCTION_TASK();
+    const std::hash<std::string_view> string_hash;
+    CombineHash(hash, std::hash<const Data::IProvider*>()(data_provider_ptr));
+    CombineHash(hash, string_hash(entry_function.file_name));
+    CombineHash(hash, string_hash(entry_function.function_name));
+    for(const Rhi::ShaderMacroDefinition& macro_definition : sorted_definitions)
+    {
+        CombineHash(hash, string_hash(macro_definition.name));
+        CombineHash(hash, string_hash(macro_definition.value));
+    }
+}
+
+bool ShaderCache::Key::operator==(const Key& other) const noexcept
+{
+    return std::tie(hash, shader_type, data_provider_ptr, entry_function, sorted_definitions, source_file_path, source_compile_target) ==
+           std::tie(other.hash, other.shader_type, other.data_provider_ptr, other.entry_function, other.sorted_definitions,
+                    other.source_file_path, other.source_compile_target);
+}
+
+Ptr<Rhi::IShader> ShaderCache::GetShader(Rhi::ShaderType shader_type, const Rhi::ShaderSettings& settings,
+                                         const CreateShaderFunc& create_shader)
+{
+    META_FUNCTION_TASK();
+    Key shader_key(shader_type, settings);
+    {
+        std::lock_guard lock(m_mutex);
+        if (const auto shader_it = m_shader_by_key.find(shader_key);
+            shader_it != m_shader_by_key.end())
+        {
+            m_hits_count++;
+            return shader_it->second;
+        }
+    }
+
+    // Shader is created outside of lock to let programs be created in parallel,
+    // so the same shader may be created twice by concurrent threads and the first cached one is used
+    Ptr<Rhi::IShader> shader_ptr = create_shader();
+    META_CHECK_ARG_NOT_NULL_DESCR(shader_ptr, "shader creation function has returned empty shader pointer");
+
+    std::lock_guard lock(m_mutex);
+    const auto [shader_it, shader_added] = m_shader_by_key.try_emplace(std::move(shader_key), shader_ptr);
+    if (shader_added)
+        m_misses_count++;
+    else
+        m_hits_count++;
+
+    return shader_it->second;
+}
+
+ShaderCache::Statistics ShaderCache::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    return Statistics{ m_hits_count, m_misses_count, static_cast<uint32_t>(m_shader_by_key.size()) };
+}
+
+void ShaderCache::Clear()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    m_shader_by_key.clear();
+}
+
+} // namespace Methane::Graphics::Base
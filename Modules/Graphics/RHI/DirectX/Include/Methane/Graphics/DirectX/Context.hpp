@@ -109,7 +109,8 @@ public:
     [[nodiscard]] Ptr<Rhi::IShader> CreateShader(Rhi::ShaderType type, const Rhi::ShaderSettings& settings) const final
     {
         META_FUNCTION_TASK();
-        return std::make_shared<Shader>(type, *this, settings);
+        return ContextBaseT::GetShaderCache().GetShader(type, settings,
+            [this, type, &settings] { return std::make_shared<Shader>(type, *this, settings); });
     }
 
     [[nodiscard]] Ptr<Rhi::IProgram> CreateProgram(const Rhi::ProgramSettings& settings) const final
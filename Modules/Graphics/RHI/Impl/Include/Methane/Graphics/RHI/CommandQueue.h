@@ -49,6 +49,8 @@ class ComputeCommandList;
 class CommandQueue // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
 {
 public:
+    using DebugGroupTiming = CommandQueueDebugGroupTiming;
+
     META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(CommandQueue);
     META_PIMPL_METHODS_COMPARE_DECLARE(CommandQueue);
 
@@ -80,6 +82,7 @@ public:
     [[nodiscard]] META_PIMPL_API CommandListType                 GetCommandListType() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t                        GetFamilyIndex() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Ptr<ITimestampQueryPool>& GetTimestampQueryPoolPtr();
+    [[nodiscard]] META_PIMPL_API DebugGroupTiming                GetDebugGroupTiming(const Opt<Data::Index>& frame_index = {}) const;
     META_PIMPL_API void Execute(const CommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback = {}) const;
 
 private:
@@ -27,6 +27,8 @@ Methane ComputeContext PIMPL wrappers for direct calls to final implementation.
 
 #include <Methane/Graphics/RHI/IComputeContext.h>
 
+#include <future>
+
 namespace Methane::Graphics::META_GFX_NAME
 {
 class ComputeContext;
@@ -65,6 +67,8 @@ public:
     using Option                = ContextOption;
     using OptionMask            = ContextOptionMask;
     using IncompatibleException = ContextIncompatibleException;
+    using DynamicConstants      = ContextDynamicConstants;
+    using ShaderCacheStatistics = ContextShaderCacheStatistics;
 
     META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(ComputeContext);
     META_PIMPL_METHODS_COMPARE_DECLARE(ComputeContext);
@@ -97,6 +101,8 @@ public:
     [[nodiscard]] META_PIMPL_API OptionMask       GetOptions() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API tf::Executor&    GetParallelExecutor() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API IObjectRegistry& GetObjectRegistry() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API DynamicConstants AllocateDynamicConstants(Data::Size size) const;
+    [[nodiscard]] META_PIMPL_API ShaderCacheStatistics GetShaderCacheStatistics() const;
     META_PIMPL_API bool UploadResources() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void RequestDeferredAction(DeferredAction action) const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void CompleteInitialization() const;
@@ -110,6 +116,13 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetComputeCommandKit() const;
 
+    // Asynchronous creation on the parallel executor, objects are ready to use when future is resolved;
+    // compute state with program settings creates its program in the same task, replacing program in state settings
+    [[nodiscard]] META_PIMPL_API std::future<Program>      CreateProgramAsync(const ProgramSettingsImpl& settings) const;
+    [[nodiscard]] META_PIMPL_API std::future<ComputeState> CreateComputeStateAsync(const ComputeStateSettingsImpl& settings) const;
+    [[nodiscard]] META_PIMPL_API std::future<ComputeState> CreateComputeStateAsync(const ProgramSettingsImpl& program_settings,
+                                                                                   const ComputeStateSettingsImpl& settings) const;
+
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
     META_PIMPL_API void Disconnect(Data::Receiver<IContextCallback>& receiver) const;
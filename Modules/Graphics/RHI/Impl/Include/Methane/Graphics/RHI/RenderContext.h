@@ -27,6 +27,8 @@ Methane RenderContext PIMPL wrappers for direct calls to final implementation.
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 
+#include <future>
+
 namespace Methane::Graphics::META_GFX_NAME
 {
 class RenderContext;
@@ -69,6 +71,8 @@ public:
     using Option                = ContextOption;
     using OptionMask            = ContextOptionMask;
     using IncompatibleException = ContextIncompatibleException;
+    using DynamicConstants      = ContextDynamicConstants;
+    using ShaderCacheStatistics = ContextShaderCacheStatistics;
 
     META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(RenderContext);
     META_PIMPL_METHODS_COMPARE_DECLARE(RenderContext);
@@ -103,6 +107,8 @@ public:
     [[nodiscard]] META_PIMPL_API OptionMask       GetOptions() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API tf::Executor&    GetParallelExecutor() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API IObjectRegistry& GetObjectRegistry() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API DynamicConstants AllocateDynamicConstants(Data::Size size) const;
+    [[nodiscard]] META_PIMPL_API ShaderCacheStatistics GetShaderCacheStatistics() const;
     META_PIMPL_API bool UploadResources() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void RequestDeferredAction(DeferredAction action) const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void CompleteInitialization() const;
@@ -116,6 +122,13 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetRenderCommandKit() const;
 
+    // Asynchronous creation on the parallel executor, objects are ready to use when future is resolved;
+    // render state with program settings creates its program in the same task, replacing program in state settings
+    [[nodiscard]] META_PIMPL_API std::future<Program>     CreateProgramAsync(const ProgramSettingsImpl& settings) const;
+    [[nodiscard]] META_PIMPL_API std::future<RenderState> CreateRenderStateAsync(const RenderStateSettingsImpl& settings) const;
+    [[nodiscard]] META_PIMPL_API std::future<RenderState> CreateRenderStateAsync(const ProgramSettingsImpl& program_settings,
+                                                                                 const RenderStateSettingsImpl& settings) const;
+
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
     META_PIMPL_API void Disconnect(Data::Receiver<IContextCallback>& receiver) const;
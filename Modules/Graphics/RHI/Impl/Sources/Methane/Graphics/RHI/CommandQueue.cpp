@@ -34,6 +34,7 @@ Methane CommandQueue PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/ComputeCommandList.h>
 
 #include <Methane/Pimpl.hpp>
+#include <Methane/Instrumentation.h>
 
 #ifdef META_GFX_METAL
 #include <CommandQueue.hh>
@@ -152,8 +153,14 @@ ParallelRenderCommandList CommandQueue::CreateParallelRenderCommandList(const Re
     return GetImpl(m_impl_ptr).GetTimestampQueryPoolPtr();
 }
 
+[[nodiscard]] CommandQueueDebugGroupTiming CommandQueue::GetDebugGroupTiming(const Opt<Data::Index>& frame_index) const
+{
+    return GetImpl(m_impl_ptr).GetDebugGroupTiming(frame_index);
+}
+
 void CommandQueue::Execute(const CommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback) const
 {
+    META_ALLOCATION_TAG_SCOPE("RHI");
     return GetImpl(m_impl_ptr).Execute(command_lists.GetInterface(), completed_callback);
 }
 
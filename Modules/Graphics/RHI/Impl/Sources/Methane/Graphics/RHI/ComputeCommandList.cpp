@@ -27,6 +27,7 @@ Methane ComputeCommandList PIMPL wrappers for direct calls to final implementati
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 
+#include <Methane/Graphics/Base/CommandStream.h>
 #include <Methane/Pimpl.hpp>
 
 #ifdef META_GFX_METAL
@@ -93,37 +94,60 @@ void ComputeCommandList::Disconnect(Data::Receiver<IObjectCallback>& receiver) c
 
 void ComputeCommandList::PushDebugGroup(const DebugGroup& debug_group) const
 {
-    GetImpl(m_impl_ptr).PushDebugGroup(debug_group.GetInterface());
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordPushDebugGroup(debug_group.GetInterface());
+    impl.PushDebugGroup(debug_group.GetInterface());
 }
 
 void ComputeCommandList::PopDebugGroup() const
 {
-    GetImpl(m_impl_ptr).PopDebugGroup();
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordPopDebugGroup();
+    impl.PopDebugGroup();
 }
 
 void ComputeCommandList::Reset(const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).Reset(debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordReset(debug_group_interface_ptr, false);
+    impl.Reset(debug_group_interface_ptr);
 }
 
 void ComputeCommandList::ResetOnce(const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetOnce(debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordReset(debug_group_interface_ptr, true);
+    impl.ResetOnce(debug_group_interface_ptr);
 }
 
 void ComputeCommandList::SetProgramBindings(const ProgramBindings& program_bindings, ProgramBindingsApplyBehaviorMask apply_behavior) const
 {
-    GetImpl(m_impl_ptr).SetProgramBindings(program_bindings.GetInterface(), apply_behavior);
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetProgramBindings(program_bindings.GetInterface(), apply_behavior);
+    impl.SetProgramBindings(program_bindings.GetInterface(), apply_behavior);
 }
 
 void ComputeCommandList::SetResourceBarriers(const IResourceBarriers& resource_barriers) const
 {
-    GetImpl(m_impl_ptr).SetResourceBarriers(resource_barriers);
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetResourceBarriers(resource_barriers);
+    impl.SetResourceBarriers(resource_barriers);
 }
 
 void ComputeCommandList::Commit() const
 {
-    GetImpl(m_impl_ptr).Commit();
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordCommit();
+    impl.Commit();
 }
 
 void ComputeCommandList::WaitUntilCompleted(uint32_t timeout_ms) const
@@ -158,24 +182,36 @@ void ComputeCommandList::Disconnect(Data::Receiver<ICommandListCallback>& receiv
 
 void ComputeCommandList::ResetWithState(const ComputeState& compute_state, const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetWithState(compute_state.GetInterface(),
-                                       debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordResetWithState(compute_state.GetInterface(), debug_group_interface_ptr, false);
+    impl.ResetWithState(compute_state.GetInterface(), debug_group_interface_ptr);
 }
 
 void ComputeCommandList::ResetWithStateOnce(const ComputeState& compute_state, const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetWithStateOnce(compute_state.GetInterface(),
-                                           debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordResetWithState(compute_state.GetInterface(), debug_group_interface_ptr, true);
+    impl.ResetWithStateOnce(compute_state.GetInterface(), debug_group_interface_ptr);
 }
 
 void ComputeCommandList::SetComputeState(const ComputeState& compute_state) const
 {
-    GetImpl(m_impl_ptr).SetComputeState(compute_state.GetInterface());
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetComputeState(compute_state.GetInterface());
+    impl.SetComputeState(compute_state.GetInterface());
 }
 
 void ComputeCommandList::Dispatch(const ThreadGroupsCount& thread_groups_count) const
 {
-    GetImpl(m_impl_ptr).Dispatch(thread_groups_count);
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordDispatch(thread_groups_count);
+    impl.Dispatch(thread_groups_count);
 }
 
 } // namespace Methane::Graphics::Rhi
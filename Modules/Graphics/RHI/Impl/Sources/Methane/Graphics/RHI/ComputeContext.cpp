@@ -34,6 +34,9 @@ Methane ComputeContext PIMPL wrappers for direct calls to final implementation.
 
 #include <Methane/Pimpl.hpp>
 
+#include <taskflow/core/async.hpp>
+#include <taskflow/core/executor.hpp>
+
 #ifdef META_GFX_METAL
 #include <ComputeContext.hh>
 #else
@@ -121,6 +124,31 @@ ComputeState ComputeContext::CreateComputeState(const ComputeStateSettingsImpl&
     return ComputeState(GetImpl(m_impl_ptr).CreateComputeState(ComputeStateSettingsImpl::Convert(settings)));
 }
 
+std::future<Program> ComputeContext::CreateProgramAsync(const ProgramSettingsImpl& settings) const
+{
+    return GetParallelExecutor().async([context = *this, settings]()
+    {
+        return context.CreateProgram(settings);
+    });
+}
+
+std::future<ComputeState> ComputeContext::CreateComputeStateAsync(const ComputeStateSettingsImpl& settings) const
+{
+    return GetParallelExecutor().async([context = *this, settings]()
+    {
+        return context.CreateComputeState(settings);
+    });
+}
+
+std::future<ComputeState> ComputeContext::CreateComputeStateAsync(const ProgramSettingsImpl& program_settings, const ComputeStateSettingsImpl& settings) const
+{
+    return GetParallelExecutor().async([context = *this, program_settings, settings]() mutable
+    {
+        settings.program = context.CreateProgram(program_settings);
+        return context.CreateComputeState(settings);
+    });
+}
+
 Buffer ComputeContext::CreateBuffer(const BufferSettings& settings) const
 {
     return Buffer(GetImpl(m_impl_ptr).CreateBuffer(settings));
@@ -151,6 +179,16 @@ IObjectRegistry& ComputeContext::GetObjectRegistry() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetObjectRegistry();
 }
 
+ContextDynamicConstants ComputeContext::AllocateDynamicConstants(Data::Size size) const
+{
+    return GetImpl(m_impl_ptr).AllocateDynamicConstants(size);
+}
+
+ContextShaderCacheStatistics ComputeContext::GetShaderCacheStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetShaderCacheStatistics();
+}
+
 bool ComputeContext::UploadResources() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).UploadResources();
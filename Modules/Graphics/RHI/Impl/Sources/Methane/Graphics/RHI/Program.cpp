@@ -27,15 +27,18 @@ Methane Program PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/Shader.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 
+#include <Methane/Graphics/Base/TaskFlow.hpp>
 #include <Methane/Pimpl.hpp>
 
+#include <taskflow/algorithm/for_each.hpp>
+
 #ifdef META_GFX_METAL
 #include <Program.hh>
 #else
 #include <Program.h>
 #endif
 
-#include <algorithm>
+#include <iterator>
 
 namespace Methane::Graphics::Rhi
 {
@@ -44,10 +47,16 @@ ProgramSettings ProgramSettingsImpl::Convert(const IContext& context, const Prog
 {
     META_FUNCTION_TASK();
 
-    IProgram::Shaders shader_ptrs;
-    std::transform(settings.shader_set.begin(), settings.shader_set.end(), std::back_inserter(shader_ptrs),
-                   [&context](const std::pair<ShaderType, ShaderSettings>& shader_type_settings)
-                   { return IShader::Create(shader_type_settings.first, context, shader_type_settings.second); });
+    // Shaders of independent stages are loaded from data provider and created in parallel
+    IProgram::Shaders shader_ptrs(settings.shader_set.size());
+    tf::Taskflow shaders_task_flow;
+    shaders_task_flow.for_each_index(size_t(0U), shader_ptrs.size(), size_t(1U),
+        [&context, &settings, &shader_ptrs](const size_t shader_index)
+        {
+            const auto& [shader_type, shader_settings] = *std::next(settings.shader_set.begin(), static_cast<std::ptrdiff_t>(shader_index));
+            shader_ptrs[shader_index] = IShader::Create(shader_type, context, shader_settings);
+        });
+    Base::RunTaskFlow(context.GetParallelExecutor(), shaders_task_flow);
 
     return ProgramSettings
     {
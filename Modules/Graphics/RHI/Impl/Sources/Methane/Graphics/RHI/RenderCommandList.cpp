@@ -32,7 +32,9 @@ Methane RenderCommandList PIMPL wrappers for direct calls to final implementatio
 #include <Methane/Graphics/RHI/ViewState.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 
+#include <Methane/Graphics/Base/CommandStream.h>
 #include <Methane/Pimpl.hpp>
+#include <Methane/Instrumentation.h>
 
 #ifdef META_GFX_METAL
 #include <RenderCommandList.hh>
@@ -98,37 +100,65 @@ void RenderCommandList::Disconnect(Data::Receiver<IObjectCallback>& receiver) co
 
 void RenderCommandList::PushDebugGroup(const DebugGroup& debug_group) const
 {
-    GetImpl(m_impl_ptr).PushDebugGroup(debug_group.GetInterface());
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordPushDebugGroup(debug_group.GetInterface());
+    impl.PushDebugGroup(debug_group.GetInterface());
 }
 
 void RenderCommandList::PopDebugGroup() const
 {
-    GetImpl(m_impl_ptr).PopDebugGroup();
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordPopDebugGroup();
+    impl.PopDebugGroup();
 }
 
 void RenderCommandList::Reset(const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).Reset(debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordReset(debug_group_interface_ptr, false);
+    impl.Reset(debug_group_interface_ptr);
 }
 
 void RenderCommandList::ResetOnce(const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetOnce(debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordReset(debug_group_interface_ptr, true);
+    impl.ResetOnce(debug_group_interface_ptr);
 }
 
 void RenderCommandList::SetProgramBindings(const ProgramBindings& program_bindings, ProgramBindingsApplyBehaviorMask apply_behavior) const
 {
-    GetImpl(m_impl_ptr).SetProgramBindings(program_bindings.GetInterface(), apply_behavior);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetProgramBindings(program_bindings.GetInterface(), apply_behavior);
+    impl.SetProgramBindings(program_bindings.GetInterface(), apply_behavior);
 }
 
 void RenderCommandList::SetResourceBarriers(const ResourceBarriers& resource_barriers) const
 {
-    GetImpl(m_impl_ptr).SetResourceBarriers(resource_barriers.GetInterface());
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetResourceBarriers(resource_barriers.GetInterface());
+    impl.SetResourceBarriers(resource_barriers.GetInterface());
 }
 
 void RenderCommandList::Commit() const
 {
-    GetImpl(m_impl_ptr).Commit();
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordCommit();
+    impl.Commit();
 }
 
 void RenderCommandList::WaitUntilCompleted(uint32_t timeout_ms) const
@@ -178,46 +208,80 @@ RenderPass RenderCommandList::GetRenderPass() const
 
 void RenderCommandList::ResetWithState(const RenderState& render_state, const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetWithState(render_state.GetInterface(), debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordResetWithState(render_state.GetInterface(), debug_group_interface_ptr, false);
+    impl.ResetWithState(render_state.GetInterface(), debug_group_interface_ptr);
 }
 
 void RenderCommandList::ResetWithStateOnce(const RenderState& render_state, const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetWithStateOnce(render_state.GetInterface(), debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordResetWithState(render_state.GetInterface(), debug_group_interface_ptr, true);
+    impl.ResetWithStateOnce(render_state.GetInterface(), debug_group_interface_ptr);
 }
 
 void RenderCommandList::SetRenderState(const RenderState& render_state, RenderStateGroupMask state_groups) const
 {
-    GetImpl(m_impl_ptr).SetRenderState(render_state.GetInterface(), state_groups);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetRenderState(render_state.GetInterface(), state_groups);
+    impl.SetRenderState(render_state.GetInterface(), state_groups);
 }
 
 void RenderCommandList::SetViewState(const ViewState& view_state) const
 {
-    GetImpl(m_impl_ptr).SetViewState(view_state.GetInterface());
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetViewState(view_state.GetInterface());
+    impl.SetViewState(view_state.GetInterface());
 }
 
 bool RenderCommandList::SetVertexBuffers(const BufferSet& vertex_buffers, bool set_resource_barriers) const
 {
-    return GetImpl(m_impl_ptr).SetVertexBuffers(vertex_buffers.GetInterface(), set_resource_barriers);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetVertexBuffers(vertex_buffers.GetInterface(), set_resource_barriers);
+    return impl.SetVertexBuffers(vertex_buffers.GetInterface(), set_resource_barriers);
 }
 
 bool RenderCommandList::SetIndexBuffer(const Buffer& index_buffer, bool set_resource_barriers) const
 {
-    return GetImpl(m_impl_ptr).SetIndexBuffer(index_buffer.GetInterface(), set_resource_barriers);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetIndexBuffer(index_buffer.GetInterface(), set_resource_barriers);
+    return impl.SetIndexBuffer(index_buffer.GetInterface(), set_resource_barriers);
 }
 
 void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count,
                                     uint32_t start_index, uint32_t start_vertex,
                                     uint32_t instance_count, uint32_t start_instance) const
 {
-    GetImpl(m_impl_ptr).DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordDrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    impl.DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
 }
 
 void RenderCommandList::Draw(Primitive primitive,
                              uint32_t vertex_count, uint32_t start_vertex,
                              uint32_t instance_count, uint32_t start_instance) const
 {
-    GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    META_ALLOCATION_TAG_SCOPE("RHI");
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordDraw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    impl.Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 }
 
 } // namespace Methane::Graphics::Rhi
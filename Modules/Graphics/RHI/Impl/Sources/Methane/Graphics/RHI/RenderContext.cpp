@@ -35,6 +35,10 @@ Methane RenderContext PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/ComputeState.h>
 
 #include <Methane/Pimpl.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/core/async.hpp>
+#include <taskflow/core/executor.hpp>
 
 #ifdef META_GFX_METAL
 #include <RenderContext.hh>
@@ -138,6 +142,31 @@ RenderState RenderContext::CreateRenderState(const RenderStateSettingsImpl& sett
     return RenderState(GetImpl(m_impl_ptr).CreateRenderState(RenderStateSettingsImpl::Convert(settings)));
 }
 
+std::future<Program> RenderContext::CreateProgramAsync(const ProgramSettingsImpl& settings) const
+{
+    return GetParallelExecutor().async([context = *this, settings]()
+    {
+        return context.CreateProgram(settings);
+    });
+}
+
+std::future<RenderState> RenderContext::CreateRenderStateAsync(const RenderStateSettingsImpl& settings) const
+{
+    return GetParallelExecutor().async([context = *this, settings]()
+    {
+        return context.CreateRenderState(settings);
+    });
+}
+
+std::future<RenderState> RenderContext::CreateRenderStateAsync(const ProgramSettingsImpl& program_settings, const RenderStateSettingsImpl& settings) const
+{
+    return GetParallelExecutor().async([context = *this, program_settings, settings]() mutable
+    {
+        settings.program = context.CreateProgram(program_settings);
+        return context.CreateRenderState(settings);
+    });
+}
+
 ComputeState RenderContext::CreateComputeState(const ComputeStateSettingsImpl& settings) const
 {
     return ComputeState(GetImpl(m_impl_ptr).CreateComputeState(ComputeStateSettingsImpl::Convert(settings)));
@@ -163,6 +192,16 @@ IObjectRegistry& RenderContext::GetObjectRegistry() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetObjectRegistry();
 }
 
+ContextDynamicConstants RenderContext::AllocateDynamicConstants(Data::Size size) const
+{
+    return GetImpl(m_impl_ptr).AllocateDynamicConstants(size);
+}
+
+ContextShaderCacheStatistics RenderContext::GetShaderCacheStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetShaderCacheStatistics();
+}
+
 bool RenderContext::UploadResources() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).UploadResources();
@@ -185,6 +224,7 @@ bool RenderContext::IsCompletingInitialization() const META_PIMPL_NOEXCEPT
 
 void RenderContext::WaitForGpu(WaitFor wait_for) const
 {
+    META_ALLOCATION_TAG_SCOPE("RHI");
     GetImpl(m_impl_ptr).WaitForGpu(wait_for);
 }
 
@@ -245,6 +285,7 @@ void RenderContext::Resize(const FrameSize& frame_size) const
 
 void RenderContext::Present() const
 {
+    META_ALLOCATION_TAG_SCOPE("RHI");
     GetImpl(m_impl_ptr).Present();
 }
 
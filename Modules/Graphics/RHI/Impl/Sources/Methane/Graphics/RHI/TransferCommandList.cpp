@@ -25,6 +25,7 @@ Methane TransferCommandList PIMPL wrappers for direct calls to final implementat
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
 
+#include <Methane/Graphics/Base/CommandStream.h>
 #include <Methane/Pimpl.hpp>
 
 #ifdef META_GFX_METAL
@@ -91,32 +92,52 @@ void TransferCommandList::Disconnect(Data::Receiver<IObjectCallback>& receiver)
 
 void TransferCommandList::PushDebugGroup(const DebugGroup& debug_group) const
 {
-    GetImpl(m_impl_ptr).PushDebugGroup(debug_group.GetInterface());
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordPushDebugGroup(debug_group.GetInterface());
+    impl.PushDebugGroup(debug_group.GetInterface());
 }
 
 void TransferCommandList::PopDebugGroup() const
 {
-    GetImpl(m_impl_ptr).PopDebugGroup();
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordPopDebugGroup();
+    impl.PopDebugGroup();
 }
 
 void TransferCommandList::Reset(const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).Reset(debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordReset(debug_group_interface_ptr, false);
+    impl.Reset(debug_group_interface_ptr);
 }
 
 void TransferCommandList::ResetOnce(const DebugGroup* debug_group_ptr) const
 {
-    GetImpl(m_impl_ptr).ResetOnce(debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr);
+    ICommandListDebugGroup* debug_group_interface_ptr = debug_group_ptr ? debug_group_ptr->GetInterfacePtr().get() : nullptr;
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordReset(debug_group_interface_ptr, true);
+    impl.ResetOnce(debug_group_interface_ptr);
 }
 
 void TransferCommandList::SetResourceBarriers(const IResourceBarriers& resource_barriers) const
 {
-    GetImpl(m_impl_ptr).SetResourceBarriers(resource_barriers);
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordSetResourceBarriers(resource_barriers);
+    impl.SetResourceBarriers(resource_barriers);
 }
 
 void TransferCommandList::Commit() const
 {
-    GetImpl(m_impl_ptr).Commit();
+    Impl& impl = GetImpl(m_impl_ptr);
+    if (Base::CommandStream* command_stream_ptr = impl.GetCommandStreamPtr())
+        command_stream_ptr->RecordCommit();
+    impl.Commit();
 }
 
 void TransferCommandList::WaitUntilCompleted(uint32_t timeout_ms) const
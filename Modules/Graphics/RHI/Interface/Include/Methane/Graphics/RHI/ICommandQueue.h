@@ -28,6 +28,10 @@ Methane command queue interface: queues are used to execute command lists.
 
 #include <Methane/Memory.hpp>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace Methane::Graphics::Rhi
 {
 
@@ -42,9 +46,24 @@ struct IRenderCommandList;
 struct IParallelRenderCommandList;
 struct ITimestampQueryPool;
 
+// GPU execution time of command list debug groups with the same name and parent group,
+// aggregated from all command lists executed on the queue in one frame
+struct CommandQueueDebugGroupTiming
+{
+    std::string                               name;
+    Timestamp                                 duration_ns = 0U; // total duration of all invocations in nanoseconds
+    uint32_t                                  count       = 0U;
+    std::vector<CommandQueueDebugGroupTiming> children;
+
+    [[nodiscard]] const CommandQueueDebugGroupTiming* GetChild(std::string_view child_name) const noexcept;
+    [[nodiscard]] explicit operator std::string() const;
+};
+
 struct ICommandQueue
     : virtual IObject // NOSONAR
 {
+    using DebugGroupTiming = CommandQueueDebugGroupTiming;
+
     // Create ICommandQueue instance
     [[nodiscard]] static Ptr<ICommandQueue> Create(const IContext& context, CommandListType command_lists_type);
 
@@ -60,6 +79,7 @@ struct ICommandQueue
     [[nodiscard]] virtual CommandListType                 GetCommandListType() const noexcept = 0;
     [[nodiscard]] virtual uint32_t                        GetFamilyIndex() const noexcept = 0;
     [[nodiscard]] virtual const Ptr<ITimestampQueryPool>& GetTimestampQueryPoolPtr() = 0;
+    [[nodiscard]] virtual DebugGroupTiming                GetDebugGroupTiming(const Opt<Data::Index>& frame_index = {}) const = 0;
     virtual void Execute(ICommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback = {}) = 0;
 };
 
@@ -66,7 +66,9 @@ enum class ContextOption : uint32_t
 {
     DeferredProgramBindingsInitialization, // Defer program bindings initialization on GPU until Context::CompleteInitialization
     TransferWithD3D12DirectQueue,          // Transfer command lists and queues in DX API are created with DIRECT type instead of COPY type
-    EmulateD3D12RenderPass                 // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    EmulateD3D12RenderPass,                // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    RetainNullResourceData,                // Resources of Null API store their data in host memory, so it can be read back with GetData
+    GpuDebugGroupTimings                   // Command list debug groups are timed with GPU timestamp queries aggregated by command queue per frame
 };
 
 using ContextOptionMask = Data::EnumMask<ContextOption>;
@@ -109,6 +111,24 @@ struct SamplerSettings;
 enum class CommandListType;
 enum class ShaderType : uint32_t;
 
+// Constants data allocated for the current frame in CPU-visible buffer memory of the context,
+// which is bound to addressable program argument by buffer offset and valid until the same frame is waited on GPU again
+struct ContextDynamicConstants
+{
+    IBuffer*     buffer_ptr = nullptr;
+    Data::Size   offset     = 0U;
+    Data::Size   size       = 0U;
+    Data::RawPtr data_ptr   = nullptr;
+};
+
+// Statistics of shaders cache, which reuses shaders created with equal type and settings in the context
+struct ContextShaderCacheStatistics
+{
+    uint32_t hits_count    = 0U;
+    uint32_t misses_count  = 0U;
+    uint32_t shaders_count = 0U;
+};
+
 struct IContext
     : virtual IObject // NOSONAR
     , virtual Data::IEmitter<IContextCallback> // NOSONAR
@@ -119,6 +139,8 @@ struct IContext
     using Option                = ContextOption;
     using OptionMask            = ContextOptionMask;
     using IncompatibleException = ContextIncompatibleException;
+    using DynamicConstants      = ContextDynamicConstants;
+    using ShaderCacheStatistics = ContextShaderCacheStatistics;
 
     // IContext interface
     [[nodiscard]] virtual Ptr<ICommandQueue> CreateCommandQueue(CommandListType type) const = 0;
@@ -134,6 +156,8 @@ struct IContext
     [[nodiscard]] virtual tf::Executor&      GetParallelExecutor() const noexcept = 0;
     [[nodiscard]] virtual IObjectRegistry&   GetObjectRegistry() noexcept = 0;
     [[nodiscard]] virtual const IObjectRegistry& GetObjectRegistry() const noexcept = 0;
+    [[nodiscard]] virtual DynamicConstants   AllocateDynamicConstants(Data::Size size) const = 0;
+    [[nodiscard]] virtual ShaderCacheStatistics GetShaderCacheStatistics() const = 0;
     virtual bool UploadResources() const = 0;
     virtual void RequestDeferredAction(DeferredAction action) const noexcept = 0;
     virtual void CompleteInitialization() = 0;
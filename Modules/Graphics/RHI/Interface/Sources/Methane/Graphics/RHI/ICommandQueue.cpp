@@ -26,9 +26,43 @@ Methane command queue interface.
 
 #include <Methane/Instrumentation.h>
 
+#include <fmt/format.h>
+#include <algorithm>
+#include <iterator>
+
 namespace Methane::Graphics::Rhi
 {
 
+static void FormatDebugGroupTimings(const std::vector<CommandQueueDebugGroupTiming>& timings, size_t depth, fmt::memory_buffer& buffer)
+{
+    for(const CommandQueueDebugGroupTiming& timing : timings)
+    {
+        const double average_duration_ms = timing.count
+                                         ? static_cast<double>(timing.duration_ns) / static_cast<double>(timing.count) / 1000000.0
+                                         : 0.0;
+        fmt::format_to(std::back_inserter(buffer), "{:>{}}- {}: {:f} ms. with {} invocations count;\n",
+                       "", depth * 2U + 2U, timing.name, average_duration_ms, timing.count);
+        FormatDebugGroupTimings(timing.children, depth + 1U, buffer);
+    }
+}
+
+const CommandQueueDebugGroupTiming* CommandQueueDebugGroupTiming::GetChild(std::string_view child_name) const noexcept
+{
+    META_FUNCTION_TASK();
+    const auto child_it = std::find_if(children.begin(), children.end(),
+                                       [child_name](const CommandQueueDebugGroupTiming& child) { return child.name == child_name; });
+    return child_it == children.end() ? nullptr : &*child_it;
+}
+
+CommandQueueDebugGroupTiming::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "\nGPU timings of '{}' debug groups in {} command lists:\n", name, count);
+    FormatDebugGroupTimings(children, 0U, buffer);
+    return fmt::to_string(buffer);
+}
+
 Ptr<ICommandQueue> ICommandQueue::Create(const IContext& context, CommandListType command_lists_type)
 {
     META_FUNCTION_TASK();
@@ -27,6 +27,8 @@ Metal implementation of the program interface.
 
 #import <Metal/Metal.h>
 
+#include <map>
+
 namespace Methane::Graphics::Metal
 {
 
@@ -52,8 +54,14 @@ private:
     void ReflectRenderPipelineArguments();
     void ReflectComputePipelineArguments();
     void SetNativeShaderArguments(Rhi::ShaderType shader_type, NSArray<id<MTLBinding>>* mtl_arguments) noexcept;
+
+    // Base::Program overrides
+    Ptrs<ArgumentBinding> GetShaderArgumentBindings(const Base::Shader& shader, const ArgumentAccessors& argument_accessors) const override;
+
+    using NativeBindingsByShaderType = std::map<Rhi::ShaderType, NSArray<id<MTLBinding>>*>;
     
-    MTLVertexDescriptor* m_mtl_vertex_desc = nil;
+    MTLVertexDescriptor*       m_mtl_vertex_desc = nil;
+    NativeBindingsByShaderType m_mtl_bindings_by_shader_type;
 };
 
 } // namespace Methane::Graphics::Metal
@@ -41,16 +41,18 @@ public:
 
     // Base::Shader interface
     Ptrs<Base::ProgramArgumentBinding> GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const final;
+
+    // Shader bindings are provided by program pipeline reflection, since shader may be shared between programs
+    Ptrs<Base::ProgramArgumentBinding> GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors,
+                                                           NSArray<id<MTLBinding>>* mtl_bindings) const;
     
-    id<MTLFunction> GetNativeFunction() noexcept                           { return m_mtl_function; }
+    id<MTLFunction> GetNativeFunction() noexcept { return m_mtl_function; }
     MTLVertexDescriptor* GetNativeVertexDescriptor(const Program& program) const;
-    void SetNativeBindings(NSArray<id<MTLBinding>>* mtl_bindings) noexcept { m_mtl_bindings = mtl_bindings; }
 
 private:
     const IContext& GetMetalContext() const noexcept;
 
-    id<MTLFunction>          m_mtl_function;
-    NSArray<id<MTLBinding>>* m_mtl_bindings = nil;
+    id<MTLFunction> m_mtl_function;
 };
 
 } // namespace Methane::Graphics::Metal
@@ -148,8 +148,16 @@ void Program::SetNativeShaderArguments(Rhi::ShaderType shader_type, NSArray<id<M
     META_FUNCTION_TASK();
     if (HasShader(shader_type))
     {
-        GetMetalShader(shader_type).SetNativeBindings(mtl_arguments);
+        m_mtl_bindings_by_shader_type[shader_type] = mtl_arguments;
     }
 }
 
+Ptrs<Program::ArgumentBinding> Program::GetShaderArgumentBindings(const Base::Shader& shader, const ArgumentAccessors& argument_accessors) const
+{
+    META_FUNCTION_TASK();
+    const auto mtl_bindings_it = m_mtl_bindings_by_shader_type.find(shader.GetType());
+    return static_cast<const Shader&>(shader).GetArgumentBindings(argument_accessors,
+        mtl_bindings_it == m_mtl_bindings_by_shader_type.end() ? nil : mtl_bindings_it->second);
+}
+
 } // namespace Methane::Graphics::Metal
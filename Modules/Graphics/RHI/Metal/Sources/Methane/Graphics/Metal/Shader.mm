@@ -122,17 +122,24 @@ Shader::Shader(Rhi::ShaderType shader_type, const Base::Context& context, const
 }
 
 Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const
+{
+    META_FUNCTION_TASK();
+    return GetArgumentBindings(argument_accessors, nil);
+}
+
+Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors,
+                                                               NSArray<id<MTLBinding>>* mtl_bindings) const
 {
     META_FUNCTION_TASK();
     Ptrs<Base::ProgramArgumentBinding> argument_bindings;
-    if (m_mtl_bindings == nil)
+    if (mtl_bindings == nil)
         return argument_bindings;
     
 #ifndef NDEBUG
     NSLog(@"%s shader '%s' arguments:", magic_enum::enum_name(GetType()).data(), GetCompiledEntryFunctionName().c_str());
 #endif
 
-    for(id<MTLBinding> mtl_binding in m_mtl_bindings)
+    for(id<MTLBinding> mtl_binding in mtl_bindings)
     {
         if (!mtl_binding.argument || !mtl_binding.used)
             continue;
@@ -26,6 +26,7 @@ Null implementation of the buffer interface.
 #include "Resource.hpp"
 
 #include <Methane/Graphics/Base/Buffer.h>
+#include <Methane/Data/Types.h>
 
 namespace Methane::Graphics::Null
 {
@@ -36,7 +37,15 @@ class Buffer final // NOSONAR - inheritance hierarchy is greater than 5
 public:
     Buffer(const Base::Context& context, const Settings& settings);
 
-    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt&) override;
+    // IBuffer interface
+    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range) override;
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource) override;
+
+    // Base::Buffer interface
+    Data::RawPtr GetMappedData() override;
+
+private:
+    Data::Bytes m_data;
 };
 
 } // namespace Methane::Graphics::Null
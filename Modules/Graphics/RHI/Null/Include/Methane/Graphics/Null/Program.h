@@ -26,6 +26,7 @@ Null implementation of the program interface.
 #include "Shader.h"
 
 #include <Methane/Graphics/Base/Program.h>
+#include <Methane/Memory.hpp>
 
 namespace Methane::Graphics::Null
 {
@@ -40,6 +41,13 @@ public:
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateBindings(const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index) override;
 
     void SetArgumentBindings(const ResourceArgumentDescs& argument_descriptions);
+
+protected:
+    // Base::Program overrides
+    Ptrs<ArgumentBinding> GetShaderArgumentBindings(const Base::Shader& shader, const ArgumentAccessors& argument_accessors) const override;
+
+private:
+    Opt<ResourceArgumentDescs> m_argument_descriptions_opt;
 };
 
 } // namespace Methane::Graphics::Null
@@ -41,8 +41,17 @@ class ProgramArgumentBinding final
 public:
     using Base::ProgramArgumentBinding::ProgramArgumentBinding;
 
+    // Binding created without shader reflection deduces resource type from the first bound resource
+    ProgramArgumentBinding(const Base::Context& context, const Settings& settings, bool is_resource_type_deduced);
+
     // Base::ProgramArgumentBinding interface
     [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
+
+    // IArgumentBinding interface
+    bool SetResourceViews(const Rhi::ResourceViews& resource_views) override;
+
+private:
+    bool m_is_resource_type_deduced = false;
 };
 
 } // namespace Methane::Graphics::Null
@@ -24,6 +24,9 @@ Null GPU query pool implementation.
 #pragma once
 
 #include <Methane/Graphics/Base/QueryPool.h>
+#include <Methane/Data/Types.h>
+
+#include <atomic>
 
 namespace Methane::Graphics::Null
 {
@@ -44,6 +47,8 @@ public:
     Rhi::SubResource GetData() const override { return {}; }
 };
 
+// Timestamp queries are created only with retained resource data context option,
+// they record synthetic GPU time in nanoseconds which is advanced by fixed step on every timestamp insertion
 class TimestampQuery final
     : protected Query
     , public Rhi::ITimestampQuery
@@ -51,11 +56,17 @@ class TimestampQuery final
 public:
     TimestampQuery(Base::QueryPool& buffer, Base::CommandList& command_list, Index index, Range data_range);
 
+    // IQuery overrides
+    Rhi::SubResource GetData() const override;
+
     // TimestampQuery overrides
-    void InsertTimestamp() override                 { /* Null implementation */ }
-    void ResolveTimestamp() override                { /* Null implementation */ }
-    Timestamp GetGpuTimestamp() const override      { return 0U; }
-    Timestamp GetCpuNanoseconds() const override    { return 0U; }
+    void InsertTimestamp() override;
+    void ResolveTimestamp() override;
+    Timestamp GetGpuTimestamp() const override;
+    Timestamp GetCpuNanoseconds() const override;
+
+private:
+    TimestampQueryPool& GetNullTimestampQueryPool() const noexcept;
 };
 
 class TimestampQueryPool final
@@ -63,11 +74,23 @@ class TimestampQueryPool final
     , public Base::TimestampQueryPool
 {
 public:
+    static constexpr Timestamp synthetic_timestamp_step = 1000U; // nanoseconds
+
     TimestampQueryPool(CommandQueue& command_queue, uint32_t max_timestamps_per_frame);
 
     // ITimestampQueryPool interface
-    Ptr<Rhi::ITimestampQuery> CreateTimestampQuery(Rhi::ICommandList&) override { return nullptr; }
-    CalibratedTimestamps Calibrate() override { return {}; }
+    Ptr<Rhi::ITimestampQuery> CreateTimestampQuery(Rhi::ICommandList& command_list) override;
+    CalibratedTimestamps Calibrate() override;
+
+    [[nodiscard]] Data::Bytes&       GetQueriesData() noexcept       { return m_queries_data; }
+    [[nodiscard]] const Data::Bytes& GetQueriesData() const noexcept { return m_queries_data; }
+
+    // Deterministic timestamps make GPU timings aggregation testable, since commands are not executed by Null command lists
+    [[nodiscard]] Timestamp AdvanceSyntheticTimestamp() noexcept { return m_synthetic_timestamp += synthetic_timestamp_step; }
+
+private:
+    Data::Bytes            m_queries_data;
+    std::atomic<Timestamp> m_synthetic_timestamp;
 };
 
 } // namespace Methane::Graphics::Null
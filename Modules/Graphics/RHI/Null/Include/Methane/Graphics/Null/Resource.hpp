@@ -73,6 +73,13 @@ public:
 
     void RestoreDescriptorViews(const DescriptorByViewId&) final
     { /* Intentionally unimplemented */ }
+
+protected:
+    // Resource data is stored in host memory only when requested with context option, otherwise it is discarded
+    [[nodiscard]] bool IsDataRetained() const noexcept
+    {
+        return ResourceBaseType::GetBaseContext().GetOptions().HasBit(Rhi::ContextOption::RetainNullResourceData);
+    }
 };
 
 } // namespace Methane::Graphics::Null
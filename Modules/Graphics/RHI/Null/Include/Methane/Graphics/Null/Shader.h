@@ -47,10 +47,7 @@ public:
     // Base::Shader interface
     Ptrs<Base::ProgramArgumentBinding> GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const override;
 
-    void InitArgumentBindings(const ResourceArgumentDescs& argument_descriptions);
-
-private:
-    Ptrs<Base::ProgramArgumentBinding> m_argument_bindings;
+    Ptrs<Base::ProgramArgumentBinding> GetArgumentBindings(const ResourceArgumentDescs& argument_descriptions) const;
 };
 
 } // namespace Methane::Graphics::Null
@@ -26,6 +26,9 @@ Null implementation of the texture interface.
 #include "Resource.hpp"
 
 #include <Methane/Graphics/Base/Texture.h>
+#include <Methane/Data/Types.h>
+
+#include <vector>
 
 namespace Methane::Graphics::Null
 {
@@ -39,7 +42,13 @@ public:
     Texture(const Base::Context& context, const Settings& settings);
     Texture(const RenderContext& render_context, const Settings& settings, Data::Index frame_index);
 
-    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&) override;
+    // ITexture interface
+    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range) override;
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources) override;
+
+private:
+    // Sub-resources data is stored by raw sub-resource index
+    std::vector<Data::Bytes> m_sub_resources_data;
 };
 
 } // namespace Methane::Graphics::Null
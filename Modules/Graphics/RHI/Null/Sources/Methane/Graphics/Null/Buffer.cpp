@@ -23,7 +23,10 @@ Null implementation of the buffer interface.
 
 #include <Methane/Graphics/Null/Buffer.h>
 
-#include <iterator>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
 
 namespace Methane::Graphics::Null
 {
@@ -33,9 +36,53 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 {
 }
 
-Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt&)
+Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    if (!IsDataRetained())
+        return {};
+
+    META_CHECK_ARG_TRUE_DESCR(GetUsage().HasAnyBit(Rhi::ResourceUsage::ReadBack),
+                              "getting buffer data from GPU is allowed for buffers with CPU Read-back flag only");
+
+    const BytesRange buffer_data_range(data_range ? data_range->GetStart() : 0U,
+                                       data_range ? data_range->GetEnd()   : GetDataSize());
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(buffer_data_range.GetEnd(), GetDataSize(), "buffer data range is out of bounds");
+
+    // Buffer memory which was never written is read back as zeros
+    Data::Bytes data(buffer_data_range.GetLength(), std::byte{});
+    if (buffer_data_range.GetStart() < m_data.size())
+    {
+        const size_t data_end = std::min<size_t>(buffer_data_range.GetEnd(), m_data.size());
+        std::copy(m_data.data() + buffer_data_range.GetStart(), m_data.data() + data_end, data.data());
+    }
+    return Rhi::SubResource(std::move(data), Rhi::SubResourceIndex(), data_range);
+}
+
+void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource)
+{
+    META_FUNCTION_TASK();
+    Base::Buffer::SetData(target_cmd_queue, sub_resource);
+    if (!IsDataRetained())
+        return;
+
+    // Upload is executed on CPU immediately, so buffer data is available for read-back right after this call
+    m_data.resize(GetDataSize(Data::MemoryState::Reserved));
+    const Data::Index data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(data_offset + sub_resource.GetDataSize(), static_cast<Data::Size>(m_data.size()),
+                                       "sub-resource data range is out of buffer bounds");
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), m_data.data() + data_offset);
+}
+
+Data::RawPtr Buffer::GetMappedData()
 {
-    return {};
+    META_FUNCTION_TASK();
+    if (GetSettings().storage_mode != IBuffer::StorageMode::Managed)
+        return nullptr;
+
+    // Managed buffer memory is emulated with host memory, which stays mapped for the whole buffer lifetime
+    m_data.resize(GetDataSize(Data::MemoryState::Reserved));
+    return m_data.data();
 }
 
 } // namespace Methane::Graphics::Null
@@ -62,10 +62,13 @@ Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandLi
     return std::make_shared<ParallelRenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass));
 }
 
-Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t)
+Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t max_timestamps_per_frame)
 {
     META_FUNCTION_TASK();
-    return nullptr;
+    if (!GetBaseContext().GetOptions().HasBit(Rhi::ContextOption::RetainNullResourceData))
+        return nullptr;
+
+    return std::make_shared<TimestampQueryPool>(*this, max_timestamps_per_frame);
 }
 
 } // namespace Methane::Graphics::Null
@@ -40,11 +40,17 @@ Ptr<Rhi::IProgramBindings> Program::CreateBindings(const ResourceViewsByArgument
 
 void Program::SetArgumentBindings(const ResourceArgumentDescs& argument_descriptions)
 {
-    for(Rhi::ShaderType shader_type : GetShaderTypes())
-    {
-        dynamic_cast<Shader&>(GetShaderRef(shader_type)).InitArgumentBindings(argument_descriptions);
-    }
+    // Argument descriptions are kept in program, since shaders may be shared with other programs
+    m_argument_descriptions_opt = argument_descriptions;
     Base::Program::InitArgumentBindings(GetSettings().argument_accessors);
 }
 
+Ptrs<Program::ArgumentBinding> Program::GetShaderArgumentBindings(const Base::Shader& shader, const ArgumentAccessors& argument_accessors) const
+{
+    if (!m_argument_descriptions_opt)
+        return Base::Program::GetShaderArgumentBindings(shader, argument_accessors);
+
+    return dynamic_cast<const Shader&>(shader).GetArgumentBindings(*m_argument_descriptions_opt);
+}
+
 } // namespace Methane::Graphics::Null
@@ -26,6 +26,11 @@ Null implementation of the program argument binding interface.
 namespace Methane::Graphics::Null
 {
 
+ProgramArgumentBinding::ProgramArgumentBinding(const Base::Context& context, const Settings& settings, bool is_resource_type_deduced)
+    : Base::ProgramArgumentBinding(context, settings)
+    , m_is_resource_type_deduced(is_resource_type_deduced)
+{ }
+
 // Base::ProgramArgumentBinding interface
 Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
 {
@@ -33,4 +38,14 @@ Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
     return std::make_shared<ProgramArgumentBinding>(*this);
 }
 
+bool ProgramArgumentBinding::SetResourceViews(const Rhi::ResourceViews& resource_views)
+{
+    META_FUNCTION_TASK();
+    if (m_is_resource_type_deduced && GetResourceViews().empty() && !resource_views.empty())
+    {
+        SetResourceType(resource_views.front().GetResource().GetResourceType());
+    }
+    return Base::ProgramArgumentBinding::SetResourceViews(resource_views);
+}
+
 } // namespace Methane::Graphics::Null
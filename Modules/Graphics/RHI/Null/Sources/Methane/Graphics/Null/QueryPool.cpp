@@ -23,10 +23,25 @@ Null GPU query pool implementation.
 
 #include <Methane/Graphics/Null/QueryPool.h>
 #include <Methane/Graphics/Null/CommandQueue.h>
+#include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Data/TimeRange.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <chrono>
+#include <cstring>
 
 namespace Methane::Graphics::Null
 {
 
+[[nodiscard]]
+static Timestamp GetCpuTimestamp() noexcept
+{
+    return static_cast<Timestamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 Query::Query(Base::QueryPool& buffer, Base::CommandList& command_list, Index index, Range data_range)
     : Base::Query(buffer, command_list, index, data_range)
 { }
@@ -35,8 +50,82 @@ TimestampQuery::TimestampQuery(Base::QueryPool& buffer, Base::CommandList& comma
     : Query(buffer, command_list, index, data_range)
 { }
 
+Rhi::SubResource TimestampQuery::GetData() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(GetState(), State::Resolved, "can not get data of not resolved query");
+    const Data::Bytes& queries_data = GetNullTimestampQueryPool().GetQueriesData();
+    return Rhi::SubResource(queries_data.data() + GetDataRange().GetStart(), GetDataRange().GetLength());
+}
+
+void TimestampQuery::InsertTimestamp()
+{
+    META_FUNCTION_TASK();
+    Base::Query::End();
+
+    TimestampQueryPool& query_pool = GetNullTimestampQueryPool();
+    const Timestamp timestamp = query_pool.AdvanceSyntheticTimestamp();
+    Data::Bytes& queries_data = query_pool.GetQueriesData();
+    std::memcpy(queries_data.data() + GetDataRange().GetStart(), &timestamp, sizeof(Timestamp));
+}
+
+void TimestampQuery::ResolveTimestamp()
+{
+    META_FUNCTION_TASK();
+    Base::Query::ResolveData();
+}
+
+Timestamp TimestampQuery::GetGpuTimestamp() const
+{
+    META_FUNCTION_TASK();
+    const Rhi::SubResource query_data = GetData();
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(query_data.GetDataSize(), sizeof(Timestamp), "query data size is less than expected for timestamp");
+    Timestamp timestamp = 0U;
+    std::memcpy(&timestamp, query_data.GetDataPtr(), sizeof(Timestamp));
+    return timestamp;
+}
+
+Timestamp TimestampQuery::GetCpuNanoseconds() const
+{
+    META_FUNCTION_TASK();
+    // Null GPU timestamps are synthesized in CPU clock domain with nanoseconds frequency and zero offset
+    return GetGpuTimestamp();
+}
+
+TimestampQueryPool& TimestampQuery::GetNullTimestampQueryPool() const noexcept
+{
+    META_FUNCTION_TASK();
+    return static_cast<TimestampQueryPool&>(GetQueryPool());
+}
+
 TimestampQueryPool::TimestampQueryPool(CommandQueue& command_queue, uint32_t max_timestamps_per_frame)
     : Base::QueryPool(command_queue, Type::Timestamp, 1U << 15U, 1U, max_timestamps_per_frame * sizeof(Timestamp), sizeof(Timestamp))
-{ }
+    , m_synthetic_timestamp(GetCpuTimestamp())
+{
+    META_FUNCTION_TASK();
+    SetGpuFrequency(Data::g_one_sec_in_nanoseconds);
+    Calibrate();
+}
+
+Ptr<Rhi::ITimestampQuery> TimestampQueryPool::CreateTimestampQuery(Rhi::ICommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    if (!GetContext().GetOptions().HasBit(Rhi::ContextOption::RetainNullResourceData))
+        return nullptr;
+
+    if (m_queries_data.empty())
+        m_queries_data.resize(GetPoolSize());
+
+    return Base::QueryPool::CreateQuery<TimestampQuery>(dynamic_cast<Base::CommandList&>(command_list));
+}
+
+Rhi::ITimestampQueryPool::CalibratedTimestamps TimestampQueryPool::Calibrate()
+{
+    META_FUNCTION_TASK();
+    const Timestamp synthetic_timestamp = m_synthetic_timestamp;
+    const CalibratedTimestamps calibrated_timestamps{ synthetic_timestamp, synthetic_timestamp };
+    SetCalibratedTimestamps(calibrated_timestamps);
+    return calibrated_timestamps;
+}
 
 } // namespace Methane::Graphics::Null
@@ -31,15 +31,34 @@ Null implementation of the shader interface.
 namespace Methane::Graphics::Null
 {
 
-Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::ProgramArgumentAccessors&) const
+Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const
 {
-    return m_argument_bindings;
+    // Without shader reflection argument bindings are created for all program arguments accessible from this shader type,
+    // which allows to run applications with Null graphics API, where resource types are deduced from bound resources
+    Ptrs<Base::ProgramArgumentBinding> argument_bindings;
+    for(const Rhi::ProgramArgumentAccessor& argument_accessor : argument_accessors)
+    {
+        if (argument_accessor.GetShaderType() != GetType() && argument_accessor.GetShaderType() != Rhi::ShaderType::All)
+            continue;
+
+        const Rhi::ProgramArgumentAccessor shader_argument_accessor(GetType(), GetCachedArgName(argument_accessor.GetName()),
+                                                                    argument_accessor.GetAccessorType(), argument_accessor.IsAddressable());
+        auto argument_binding_ptr = std::make_shared<ProgramArgumentBinding>(GetContext(),
+            Rhi::ProgramArgumentBindingSettings
+            {
+                shader_argument_accessor,
+                Rhi::ResourceType::Buffer,
+                1U
+            }, true);
+
+        argument_bindings.push_back(std::static_pointer_cast<Base::ProgramArgumentBinding>(argument_binding_ptr));
+    }
+    return argument_bindings;
 }
 
-void Shader::InitArgumentBindings(const ResourceArgumentDescs& argument_descriptions)
+Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const ResourceArgumentDescs& argument_descriptions) const
 {
-    m_argument_bindings.clear();
-    m_argument_bindings.reserve(argument_descriptions.size());
+    Ptrs<Base::ProgramArgumentBinding> argument_bindings;
     for(const auto& [argument_accessor, argument_desc] : argument_descriptions)
     {
         if (argument_accessor.GetShaderType() != GetType())
@@ -53,8 +72,9 @@ void Shader::InitArgumentBindings(const ResourceArgumentDescs& argument_descript
                 argument_desc.resource_count
             });
 
-        m_argument_bindings.push_back(std::static_pointer_cast<Base::ProgramArgumentBinding>(argument_binding_ptr));
+        argument_bindings.push_back(std::static_pointer_cast<Base::ProgramArgumentBinding>(argument_binding_ptr));
     }
+    return argument_bindings;
 }
 
 } // namespace Methane::Graphics::Null
@@ -24,8 +24,11 @@ Null implementation of the texture interface.
 #include <Methane/Graphics/Null/Texture.h>
 #include <Methane/Graphics/Null/RenderContext.h>
 
+#include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Null
 {
 
@@ -41,9 +44,54 @@ Texture::Texture(const RenderContext& render_context, const Settings& settings,
     META_CHECK_ARG_EQUAL(frame_index, settings.frame_index_opt.value());
 }
 
-Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&)
+Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    if (!IsDataRetained())
+        return {};
+
+    META_CHECK_ARG_EQUAL_DESCR(GetSettings().type, Rhi::TextureType::Image, "only image textures support data read-back from CPU");
+    META_CHECK_ARG_TRUE_DESCR(GetUsage().HasAnyBit(Rhi::ResourceUsage::ReadBack),
+                              "getting texture data from GPU is allowed for textures with CPU Read-back flag only");
+    ValidateSubResource(sub_resource_index, data_range);
+
+    const Data::Size sub_resource_data_size = GetSubResourceDataSize(sub_resource_index);
+    const BytesRange sub_resource_data_range(data_range ? data_range->GetStart() : 0U,
+                                             data_range ? data_range->GetEnd()   : sub_resource_data_size);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(sub_resource_data_range.GetEnd(), sub_resource_data_size, "texture sub-resource data range is out of bounds");
+
+    // Texture memory which was never written is read back as zeros
+    Data::Bytes data(sub_resource_data_range.GetLength(), std::byte{});
+    const Data::Index sub_resource_raw_index = sub_resource_index.GetRawIndex(GetSubresourceCount());
+    if (sub_resource_raw_index < m_sub_resources_data.size())
+    {
+        const Data::Bytes& sub_resource_data = m_sub_resources_data[sub_resource_raw_index];
+        if (sub_resource_data_range.GetStart() < sub_resource_data.size())
+        {
+            const size_t data_end = std::min<size_t>(sub_resource_data_range.GetEnd(), sub_resource_data.size());
+            std::copy(sub_resource_data.data() + sub_resource_data_range.GetStart(), sub_resource_data.data() + data_end, data.data());
+        }
+    }
+    return Rhi::SubResource(std::move(data), sub_resource_index, data_range);
+}
+
+void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources)
 {
-    return {};
+    META_FUNCTION_TASK();
+    Base::Texture::SetData(target_cmd_queue, sub_resources);
+    if (!IsDataRetained())
+        return;
+
+    // Upload is executed on CPU immediately, so texture data is available for read-back right after this call
+    m_sub_resources_data.resize(GetSubresourceCount().GetRawCount());
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        ValidateSubResource(sub_resource);
+        Data::Bytes& sub_resource_data = m_sub_resources_data[sub_resource.GetIndex().GetRawIndex(GetSubresourceCount())];
+        sub_resource_data.resize(GetSubResourceDataSize(sub_resource.GetIndex()));
+        const Data::Index data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data.data() + data_offset);
+    }
 }
 
 } // namespace Methane::Graphics::Null
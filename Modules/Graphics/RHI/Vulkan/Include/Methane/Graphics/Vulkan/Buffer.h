@@ -43,8 +43,8 @@ public:
     void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource) override;
     SubResource GetData(Rhi::ICommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) override;
 
-    // IObject interface
-    bool SetName(std::string_view name) override;
+    // Base::Buffer interface
+    Data::RawPtr GetMappedData() override { return GetMemoryAllocation().GetMappedData(); }
 
 protected:
     // Resource override
@@ -54,9 +54,7 @@ private:
     Data::Bytes GetDataFromSharedBuffer(const BytesRange& data_range) const;
     Data::Bytes GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue);
 
-    vk::UniqueBuffer       m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory m_vk_unique_staging_memory;
-    vk::BufferCopy         m_vk_copy_region;
+    vk::BufferCopy m_vk_copy_region;
 };
 
 } // namespace Methane::Graphics::Vulkan
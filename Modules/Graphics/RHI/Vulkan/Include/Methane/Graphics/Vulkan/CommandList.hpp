@@ -295,6 +295,13 @@ protected:
                                                                 Base::CommandList::GetProgramBindingsPtr(), apply_behavior);
     }
 
+    bool IsDebugGroupTimingSupported() const noexcept final
+    {
+        // Timestamp queries are reset and written in primary command buffer, which is not allowed inside render pass,
+        // while debug groups of render command lists are encoded in secondary render pass command buffer
+        return default_command_buffer_type == CommandBufferType::Primary;
+    }
+
     void SetCommandBufferInheritInfo(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info,
                                     CommandBufferType command_buffer_type) noexcept
     {
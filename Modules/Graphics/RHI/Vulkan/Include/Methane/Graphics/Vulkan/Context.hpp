@@ -33,6 +33,7 @@ Vulkan template implementation of the base context interface.
 #include "Texture.h"
 #include "Sampler.h"
 #include "DescriptorManager.h"
+#include "StagingRing.h"
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
@@ -40,6 +41,7 @@ Vulkan template implementation of the base context interface.
 
 #include <string>
 #include <map>
+#include <mutex>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -62,6 +64,9 @@ public:
         // to release all descriptor sets using live device instance
         ContextBaseT::GetDescriptorManager().Release();
 
+        // Staging ring memory is allocated from the device, which may be changed on context reset
+        m_staging_ring_ptr.reset();
+
         ContextBaseT::Release();
     }
 
@@ -76,7 +81,8 @@ public:
     [[nodiscard]] Ptr<Rhi::IShader> CreateShader(Rhi::ShaderType type, const Rhi::ShaderSettings& settings) const final
     {
         META_FUNCTION_TASK();
-        return std::make_shared<Shader>(type, *this, settings);
+        return ContextBaseT::GetShaderCache().GetShader(type, settings,
+            [this, type, &settings] { return std::make_shared<Shader>(type, *this, settings); });
     }
 
     [[nodiscard]] Ptr<Rhi::IProgram> CreateProgram(const Rhi::ProgramSettings& settings) const final
@@ -125,6 +131,27 @@ public:
     {
         return static_cast<DescriptorManager&>(ContextBaseT::GetDescriptorManager());
     }
+
+    StagingRing& GetVulkanStagingRing() const final
+    {
+        META_FUNCTION_TASK();
+        std::lock_guard lock(m_staging_ring_mutex);
+        if (m_staging_ring_ptr)
+            return *m_staging_ring_ptr;
+
+        // Staging ring is sized by frames in flight, which can be uploading resources at the same time
+        uint32_t frames_count = 1U;
+        if constexpr (std::is_same_v<typename ContextBaseT::Settings, Rhi::RenderContextSettings>)
+        {
+            frames_count = ContextBaseT::GetSettings().frame_buffers_count;
+        }
+        m_staging_ring_ptr = std::make_unique<StagingRing>(GetVulkanDevice(), frames_count);
+        return *m_staging_ring_ptr;
+    }
+
+private:
+    mutable UniquePtr<StagingRing>    m_staging_ring_ptr;
+    mutable TracyLockable(std::mutex, m_staging_ring_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -23,6 +23,8 @@ Vulkan implementation of the device interface.
 
 #pragma once
 
+#include "MemoryAllocator.h"
+
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/Platform/AppEnvironment.h>
@@ -101,6 +103,7 @@ public:
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
     bool                             IsExtensionSupported(std::string_view required_extension) const;
     bool                             IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
+    MemoryAllocator&                 GetMemoryAllocator() const noexcept      { return *m_memory_allocator_ptr; }
 
 private:
     using QueueFamilyReservationByType = std::map<Rhi::CommandListType, Ptr<QueueFamilyReservation>>;
@@ -117,6 +120,7 @@ private:
     const bool                             m_is_dynamic_state_supported = false;
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
+    UniquePtr<MemoryAllocator>             m_memory_allocator_ptr;
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
 };
 
@@ -0,0 +1,152 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.h
+Vulkan device memory allocator with pools of large memory blocks per memory type,
+which are sub-allocated to resources with buddy allocator.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Data/BuddyAllocator.hpp>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class MemoryAllocator;
+
+class MemoryAllocation // NOSONAR - custom move operations
+{
+public:
+    MemoryAllocation() = default;
+    MemoryAllocation(MemoryAllocator& allocator, void* block_ptr, const vk::DeviceMemory& vk_device_memory,
+                     vk::DeviceSize offset, vk::DeviceSize size, Data::RawPtr mapped_data_ptr) noexcept;
+    MemoryAllocation(MemoryAllocation&& other) noexcept;
+    MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+    ~MemoryAllocation();
+
+    MemoryAllocation(const MemoryAllocation&) = delete;
+    MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+
+    explicit operator bool() const noexcept { return m_allocator_ptr != nullptr; }
+
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept { return m_vk_device_memory; }
+    [[nodiscard]] vk::DeviceSize          GetOffset() const noexcept             { return m_offset; }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept               { return m_size; }
+
+    // Host visible memory is persistently mapped, because memory block shared between resources can not be mapped twice;
+    // returned pointer is already offset to the allocation beginning and is null for device local memory
+    [[nodiscard]] Data::RawPtr            GetMappedData() const noexcept         { return m_mapped_data_ptr; }
+
+    void Release();
+
+private:
+    MemoryAllocator* m_allocator_ptr   = nullptr;
+    void*            m_block_ptr       = nullptr; // null for dedicated allocations
+    vk::DeviceMemory m_vk_device_memory;
+    vk::DeviceSize   m_offset          = 0U;
+    vk::DeviceSize   m_size            = 0U;
+    Data::RawPtr     m_mapped_data_ptr = nullptr;
+};
+
+class MemoryAllocator
+{
+public:
+    // Linear (buffers) and optimal (images) resources are placed in separate memory blocks,
+    // so that buffer-image granularity requirement is always satisfied for neighbour resources
+    enum class ResourceTiling : uint32_t
+    {
+        Linear,
+        Optimal
+    };
+
+    struct Statistics
+    {
+        uint32_t                         device_allocations_count    = 0U; // count of vk::DeviceMemory objects allocated at the moment
+        uint32_t                         total_device_allocations    = 0U; // count of vkAllocateMemory calls since allocator creation
+        uint32_t                         blocks_count                = 0U;
+        uint32_t                         dedicated_allocations_count = 0U;
+        uint32_t                         sub_allocations_count       = 0U;
+        vk::DeviceSize                   reserved_size               = 0U; // size of all allocated device memory
+        vk::DeviceSize                   used_size                   = 0U; // size of memory occupied by allocations with alignment padding
+        vk::DeviceSize                   requested_size              = 0U; // size of memory requested by resources
+        Data::BuddyAllocator::Statistics blocks_statistics;                // merged statistics of sub-allocations in all blocks
+
+        [[nodiscard]] double GetUtilization() const noexcept;   // share of reserved memory requested by resources
+        [[nodiscard]] double GetFragmentation() const noexcept; // share of blocks free memory which can not be allocated in one piece of its block
+    };
+
+    static constexpr vk::DeviceSize max_block_size     = 64U * 1024U * 1024U;
+    static constexpr vk::DeviceSize min_block_size     = 1U * 1024U * 1024U;
+    static constexpr vk::DeviceSize min_sub_allocation = 256U;
+
+    MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device);
+    ~MemoryAllocator();
+
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator(MemoryAllocator&&) = delete;
+
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(MemoryAllocator&&) = delete;
+
+    // Returns empty allocation when suitable memory type was not found, throws vk::SystemError when device is out of memory
+    [[nodiscard]] MemoryAllocation Allocate(const vk::MemoryRequirements& vk_memory_requirements,
+                                            vk::MemoryPropertyFlags vk_memory_property_flags,
+                                            ResourceTiling resource_tiling);
+
+    [[nodiscard]] Statistics     GetStatistics() const;
+    [[nodiscard]] vk::DeviceSize GetBlockSize(uint32_t memory_type_index) const noexcept;
+    [[nodiscard]] Opt<uint32_t>  FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept;
+
+private:
+    friend class MemoryAllocation;
+
+    struct Block;
+    struct DedicatedAllocation;
+
+    using PoolKey = std::pair<uint32_t, ResourceTiling>; // memory type index and resource tiling
+    using Pool    = UniquePtrs<Block>;
+    using Pools   = std::map<PoolKey, Pool>;
+    using DedicatedAllocations = std::map<VkDeviceMemory, UniquePtr<DedicatedAllocation>>;
+
+    [[nodiscard]] Block&                 AddBlock(Pool& pool, uint32_t memory_type_index);
+    [[nodiscard]] MemoryAllocation       AllocateDedicated(vk::DeviceSize size, uint32_t memory_type_index);
+    [[nodiscard]] vk::UniqueDeviceMemory AllocateDeviceMemory(vk::DeviceSize size, uint32_t memory_type_index);
+    [[nodiscard]] Data::RawPtr           MapMemoryIfHostVisible(const vk::DeviceMemory& vk_device_memory, uint32_t memory_type_index) const;
+
+    void Free(const MemoryAllocation& allocation);
+
+    const vk::Device                         m_vk_device;
+    const vk::PhysicalDeviceMemoryProperties m_vk_memory_properties;
+    Pools                                    m_pools;
+    DedicatedAllocations                     m_dedicated_allocations;
+    uint32_t                                 m_total_device_allocations = 0U;
+    vk::DeviceSize                           m_requested_size = 0U;
+    mutable TracyLockable(std::mutex,        m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -33,6 +33,7 @@ Vulkan implementation of the program interface.
 #include <vulkan/vulkan.hpp>
 
 #include <array>
+#include <map>
 #include <mutex>
 
 namespace Methane::Graphics::Vulkan
@@ -78,8 +79,12 @@ public:
 
 private:
     using DescriptorSetLayoutInfoByAccessType = std::array<DescriptorSetLayoutInfo, magic_enum::enum_count<ArgumentAccessor::Type>()>;
+    using PatchedByteCodeByShaderType         = std::map<Rhi::ShaderType, Data::MutableChunk>;
+    using ShaderModuleByShaderType            = std::map<Rhi::ShaderType, vk::UniqueShaderModule>;
+    using VertexInputDescriptions             = Shader::VertexInputDescriptions;
 
     void InitializeDescriptorSetLayouts();
+    void InitializePatchedShaderModules(const PatchedByteCodeByShaderType& patched_byte_code_by_shader_type);
     void UpdatePipelineName();
     void UpdateDescriptorSetLayoutNames() const;
     void UpdateConstantDescriptorSetName();
@@ -92,7 +97,9 @@ private:
     vk::UniquePipelineLayout                   m_vk_unique_pipeline_layout;
     std::optional<vk::DescriptorSet>           m_vk_constant_descriptor_set_opt;
     std::vector<vk::DescriptorSet>             m_vk_frame_constant_descriptor_sets;
-    TracyLockable(std::mutex,                  m_mutex);
+    ShaderModuleByShaderType                   m_vk_unique_patched_modules;
+    mutable Opt<VertexInputDescriptions>       m_vertex_input_descriptions_opt;
+    mutable TracyLockable(std::mutex,          m_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -59,11 +59,18 @@ public:
     void Apply(ICommandList& command_list, const Rhi::ICommandQueue& command_queue,
                const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const;
 
+protected:
+    // IProgramBindings::IProgramArgumentBindingCallback
+    void OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding& argument_binding,
+                                                      const Rhi::IResource::Views& old_resource_views,
+                                                      const Rhi::IResource::Views& new_resource_views) override;
+
 private:
     // IObjectCallback interface
     void OnObjectNameChanged(Rhi::IObject&, const std::string&) override; // IProgram name changed
 
     void SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument);
+    void UpdateDynamicOffsets();
 
     template<typename FuncType> // function void(const IProgram::Argument&, ArgumentBinding&)
     void ForEachArgumentBinding(FuncType argument_binding_function) const;
@@ -26,6 +26,7 @@ Vulkan implementation of the resource interface.
 #include "IResource.h"
 #include "IContext.h"
 #include "Device.h"
+#include "MemoryAllocator.h"
 #include "TransferCommandList.h"
 #include "Utils.hpp"
 
@@ -143,7 +144,12 @@ public:
 
     const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept final
     {
-        return m_vk_unique_device_memory.get();
+        return m_memory_allocation.GetNativeDeviceMemory();
+    }
+
+    vk::DeviceSize GetNativeDeviceMemoryOffset() const noexcept final
+    {
+        return m_memory_allocation.GetOffset();
     }
 
     const vk::Device& GetNativeDevice() const noexcept final
@@ -175,30 +181,38 @@ public:
     }
 
 protected:
-    vk::UniqueDeviceMemory AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    // Memory is sub-allocated from the shared device memory block, so resource has to be bound at allocation offset
+    MemoryAllocation AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                          MemoryAllocator::ResourceTiling resource_tiling)
     {
         META_FUNCTION_TASK();
-        const Opt<uint32_t> memory_type_opt = GetVulkanContext().GetVulkanDevice().FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
-        if (!memory_type_opt)
-            throw IResource::AllocationError(*this, "suitable memory type was not found");
-
+        MemoryAllocation memory_allocation;
         try
         {
-            return GetNativeDevice().allocateMemoryUnique(vk::MemoryAllocateInfo(memory_requirements.size, *memory_type_opt));
+            memory_allocation = GetVulkanContext().GetVulkanDevice().GetMemoryAllocator().Allocate(memory_requirements, memory_property_flags, resource_tiling);
         }
         catch(const vk::SystemError& error)
         {
             throw IResource::AllocationError(*this, error.what());
         }
+
+        if (!memory_allocation)
+            throw IResource::AllocationError(*this, "suitable memory type was not found");
+
+        return memory_allocation;
     }
 
     void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
     {
         META_FUNCTION_TASK();
-        m_vk_unique_device_memory.release();
-        m_vk_unique_device_memory = AllocateDeviceMemory(memory_requirements, memory_property_flags);
+        constexpr MemoryAllocator::ResourceTiling resource_tiling = std::is_same_v<NativeResourceType, vk::Image>
+                                                                  ? MemoryAllocator::ResourceTiling::Optimal
+                                                                  : MemoryAllocator::ResourceTiling::Linear;
+        m_memory_allocation = AllocateDeviceMemory(memory_requirements, memory_property_flags, resource_tiling);
     }
 
+    const MemoryAllocation& GetMemoryAllocation() const noexcept { return m_memory_allocation; }
+
     template<typename T = ResourceStorageType>
     void ResetNativeResource(T&& vk_resource)
     {
@@ -260,7 +274,7 @@ private:
     using ViewDescriptorByViewId = std::map<ResourceView::Id, Ptr<ResourceView::ViewDescriptorVariant>>;
 
     vk::Device                   m_vk_device;
-    vk::UniqueDeviceMemory       m_vk_unique_device_memory;
+    MemoryAllocation             m_memory_allocation;
     ResourceStorageType          m_vk_resource;
     ViewDescriptorByViewId       m_view_descriptor_by_view_id;
     Opt<uint32_t>                m_owner_queue_family_index_opt;
@@ -31,6 +31,7 @@ Vulkan implementation of the shader interface.
 #include <vulkan/vulkan.hpp>
 
 #include <string>
+#include <vector>
 #include <mutex>
 
 namespace spirv_cross // NOSONAR
@@ -53,33 +54,35 @@ class Shader final
     : public Base::Shader
 {
 public:
+    struct VertexInputDescriptions
+    {
+        std::vector<vk::VertexInputBindingDescription>   bindings;
+        std::vector<vk::VertexInputAttributeDescription> attributes;
+    };
+
     Shader(Type shader_type, const Base::Context& context, const Settings& settings);
     ~Shader() override;
 
     // Base::Shader interface
     Ptrs<Base::ProgramArgumentBinding> GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const override;
 
-    const Data::Chunk&                     GetNativeByteCode() const noexcept { return m_byte_code_chunk.AsConstChunk(); }
-    const vk::ShaderModule&                GetNativeModule() const;
-    const spirv_cross::Compiler&           GetNativeCompiler() const;
-    vk::PipelineShaderStageCreateInfo      GetNativeStageCreateInfo() const;
-    vk::PipelineVertexInputStateCreateInfo GetNativeVertexInputStateCreateInfo(const Program& program);
-
-    Data::MutableChunk& GetMutableByteCode() noexcept;
+    // Shader byte code and reflection are immutable, since shader may be shared between programs by the context shader cache,
+    // so program patches its own copy of byte code with remapped descriptor bindings and keeps its own vertex input descriptions
+    const Data::Chunk&                GetNativeByteCode() const noexcept { return m_byte_code_chunk.AsConstChunk(); }
+    const vk::ShaderModule&           GetNativeModule() const;
+    const spirv_cross::Compiler&      GetNativeCompiler() const;
+    vk::PipelineShaderStageCreateInfo GetNativeStageCreateInfo() const;
+    vk::PipelineShaderStageCreateInfo GetNativeStageCreateInfo(const vk::ShaderModule& vk_module) const;
+    VertexInputDescriptions           GetNativeVertexInputDescriptions(const Program& program) const;
 
     static vk::ShaderStageFlagBits ConvertTypeToStageFlagBits(Type shader_type);
 
 private:
-    void InitializeVertexInputDescriptions(const Program& program);
-
-    const IContext&                                  m_vk_context;
-    Data::MutableChunk                               m_byte_code_chunk;
-    mutable vk::UniqueShaderModule                   m_vk_unique_module;
-    mutable UniquePtr<spirv_cross::Compiler>         m_spirv_compiler_ptr;
-    std::vector<vk::VertexInputBindingDescription>   m_vertex_input_binding_descriptions;
-    std::vector<vk::VertexInputAttributeDescription> m_vertex_input_attribute_descriptions;
-    bool                                             m_vertex_input_initialized = false;
-    TracyLockable(std::mutex,                        m_mutex);
+    const IContext&                          m_vk_context;
+    const Data::MutableChunk                 m_byte_code_chunk;
+    mutable vk::UniqueShaderModule           m_vk_unique_module;
+    mutable UniquePtr<spirv_cross::Compiler> m_spirv_compiler_ptr;
+    mutable TracyLockable(std::mutex,        m_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
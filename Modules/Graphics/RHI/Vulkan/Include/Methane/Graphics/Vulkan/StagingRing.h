@@ -0,0 +1,109 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/StagingRing.h
+Vulkan persistently mapped staging ring buffer shared by all resources of the context
+for transient data uploads, fenced by upload command list completion.
+
+******************************************************************************/
+
+#pragma once
+
+#include "MemoryAllocator.h"
+
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Data/FencedRingBuffer.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <vector>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+class StagingRing final
+    : private Data::Receiver<Rhi::ICommandListCallback>
+{
+public:
+    struct Region
+    {
+        vk::Buffer     vk_buffer;
+        vk::DeviceSize offset   = 0U;
+        vk::DeviceSize size     = 0U;
+        Data::RawPtr   data_ptr = nullptr;
+    };
+
+    // Read-back buffer is not reclaimed on upload command list completion unlike ring regions,
+    // it is owned by the caller and released only after the read-back data is copied from its mapped memory
+    class ReadBackBuffer
+    {
+    public:
+        ReadBackBuffer(MemoryAllocation&& memory, vk::UniqueBuffer&& vk_unique_buffer, vk::DeviceSize size) noexcept;
+
+        [[nodiscard]] Region GetRegion() const noexcept;
+
+    private:
+        MemoryAllocation m_memory;
+        vk::UniqueBuffer m_vk_unique_buffer;
+        vk::DeviceSize   m_size;
+    };
+
+    static constexpr vk::DeviceSize frame_size       = 8U * 1024U * 1024U;
+    static constexpr vk::DeviceSize region_alignment = 256U; // satisfies buffer to image copy offset alignment for all pixel formats
+
+    StagingRing(const Device& device, uint32_t frames_count);
+
+    // Region is reclaimed when upload command list execution is completed and its state is changed to Pending,
+    // data which does not fit in ring is placed in transient staging buffer released on the same event
+    [[nodiscard]] Region Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size);
+
+    // Read-back data is placed in separate staging buffer, since ring region could be overwritten
+    // by concurrent uploads right after upload command list completion, before its data is copied
+    [[nodiscard]] ReadBackBuffer AllocateReadBack(vk::DeviceSize size) const;
+
+    [[nodiscard]] vk::DeviceSize GetSize() const noexcept { return m_size; }
+    [[nodiscard]] vk::DeviceSize GetUsedSize() const;
+    [[nodiscard]] uint32_t       GetTransientBuffersCount() const;
+
+private:
+    struct TransientBuffer
+    {
+        MemoryAllocation memory;
+        vk::UniqueBuffer vk_unique_buffer;
+    };
+
+    // ICommandListCallback overrides
+    void OnCommandListStateChanged(Rhi::ICommandList& cmd_list) override;
+
+    [[nodiscard]] vk::UniqueBuffer CreateStagingBuffer(vk::DeviceSize size, MemoryAllocation& memory) const;
+
+    const vk::Device                        m_vk_device;
+    MemoryAllocator&                        m_memory_allocator;
+    const vk::DeviceSize                    m_size;
+    MemoryAllocation                        m_memory;
+    vk::UniqueBuffer                        m_vk_unique_buffer;
+    Data::FencedRingBuffer<TransientBuffer> m_ring;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -55,9 +55,6 @@ public:
                         const SubResource::Index& sub_resource_index = {},
                         const BytesRangeOpt& data_range = {}) override;
 
-    // IObject overide
-    bool SetName(std::string_view name) override;
-
     // ITexture overrides
     const vk::Image& GetNativeImage() const noexcept { return GetNativeResource(); }
     vk::ImageSubresourceRange GetNativeSubresourceRange() const;
@@ -75,8 +72,6 @@ private:
     void GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state);
 
     vk::UniqueImage                  m_vk_unique_image;
-    vk::UniqueBuffer                 m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory           m_vk_unique_staging_memory;
     std::vector<vk::BufferImageCopy> m_vk_copy_regions;
 };
 
@@ -23,6 +23,7 @@ Vulkan implementation of the buffer interface.
 
 #include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
+#include <Methane/Graphics/Vulkan/StagingRing.h>
 
 #include <Methane/Graphics/Types.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -78,26 +79,12 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 {
     META_FUNCTION_TASK();
     const bool is_private_storage = settings.storage_mode == Rhi::BufferStorageMode::Private;
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_staging_memory_flags;
+    const vk::MemoryPropertyFlags vk_host_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_host_memory_flags;
 
     // Allocate resource primary memory
     AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
-    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
-
-    if (!is_private_storage)
-        return;
-
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = GetNativeDevice().createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-            settings.size,
-            vk::BufferUsageFlagBits::eTransferSrc,
-            vk::SharingMode::eExclusive)
-    );
-
-    m_vk_unique_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 }
 
 void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResource& sub_resource)
@@ -106,31 +93,23 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResourc
     Base::Buffer::SetData(target_cmd_queue, sub_resource);
 
     const Settings& buffer_settings = GetSettings();
-    const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
-    const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
-
-    const vk::DeviceSize sub_resource_offset = 0U;
-    Data::RawPtr sub_resource_data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    if (is_private_storage)
+    if (buffer_settings.storage_mode != Rhi::IBuffer::StorageMode::Private)
     {
-        m_vk_copy_region = vk::BufferCopy(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
+        // Host visible memory is persistently mapped by memory allocator
+        Data::RawPtr buffer_data_ptr = GetMemoryAllocation().GetMappedData();
+        META_CHECK_ARG_NOT_NULL_DESCR(buffer_data_ptr, "buffer memory is not mapped");
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), buffer_data_ptr);
+        return;
     }
 
-    if (!is_private_storage)
-        return;
+    // In case of private GPU storage, copy buffer data from staging ring region to the device-local GPU resource
+    TransferCommandList&      upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
+    const vk::DeviceSize      data_size       = static_cast<vk::DeviceSize>(sub_resource.GetDataSize());
+    const StagingRing::Region staging_region  = GetVulkanContext().GetVulkanStagingRing().Allocate(upload_cmd_list, data_size);
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_region.data_ptr);
 
-    // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
-    TransferCommandList& upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), 1U, &m_vk_copy_region);
+    m_vk_copy_region = vk::BufferCopy(staging_region.offset, 0U, data_size);
+    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(staging_region.vk_buffer, GetNativeResource(), 1U, &m_vk_copy_region);
     CompleteResourceTransfer(upload_cmd_list, GetTargetResourceStateByBufferType(buffer_settings.type), target_cmd_queue);
     GetContext().RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
 }
@@ -158,17 +137,9 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue& target_cmd_queue, const Byt
 Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
 {
     META_FUNCTION_TASK();
-    Data::RawPtr data_ptr = nullptr;
-    const vk::DeviceMemory& vk_device_memory = GetNativeDeviceMemory();
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, data_range.GetStart(), data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    return data;
+    const Data::RawPtr data_ptr = GetMemoryAllocation().GetMappedData();
+    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "buffer memory is not mapped");
+    return Data::Bytes(data_ptr + data_range.GetStart(), data_ptr + data_range.GetEnd());
 }
 
 Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue)
@@ -176,38 +147,20 @@ Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::
     META_FUNCTION_TASK();
     const State       initial_buffer_state = GetState();
     TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
+    const StagingRing::ReadBackBuffer read_back_buffer = GetVulkanContext().GetVulkanStagingRing().AllocateReadBack(data_range.GetLength());
+    const StagingRing::Region read_back_region = read_back_buffer.GetRegion();
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    const vk::BufferCopy vk_buffer_copy(data_range.GetStart(), 0U, data_range.GetLength());
-    vk_cmd_buffer.copyBuffer(GetNativeResource(), m_vk_unique_staging_buffer.get(), 1U, &vk_buffer_copy);
+    const vk::BufferCopy vk_buffer_copy(data_range.GetStart(), read_back_region.offset, data_range.GetLength());
+    vk_cmd_buffer.copyBuffer(GetNativeResource(), read_back_region.vk_buffer, 1U, &vk_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_buffer_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
+    upload_cmd_list.WaitUntilCompleted();
 
-    // Copy buffer data from mapped staging resource
-    Data::RawPtr data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(m_vk_unique_staging_memory.get(), 0U, data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(m_vk_unique_staging_memory.get());
-
-    return data;
-}
-
-bool Buffer::SetName(std::string_view name)
-{
-    META_FUNCTION_TASK();
-    if (!Resource::SetName(name))
-        return false;
-
-    if (m_vk_unique_staging_buffer)
-    {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
-    }
-    return true;
+    // Copy buffer data from mapped read-back buffer, which is released after that
+    return Data::Bytes(read_back_region.data_ptr, read_back_region.data_ptr + data_range.GetLength());
 }
 
 Ptr<ResourceView::ViewDescriptorVariant> Buffer::CreateNativeViewDescriptor(const ResourceView::Id& view_id)
@@ -278,6 +278,8 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
 
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
+
+    m_memory_allocator_ptr = std::make_unique<MemoryAllocator>(vk_physical_device, m_vk_unique_device.get());
 }
 
 Ptr<Rhi::IRenderContext> Device::CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings)
@@ -344,14 +346,7 @@ Device::SwapChainSupport Device::GetSwapChainSupportForSurface(const vk::Surface
 Opt<uint32_t> Device::FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept
 {
     META_FUNCTION_TASK();
-    const vk::PhysicalDeviceMemoryProperties vk_memory_props = m_vk_physical_device.getMemoryProperties();
-    for(uint32_t type_index = 0U; type_index < vk_memory_props.memoryTypeCount; ++type_index)
-    {
-        if (type_filter & (1 << type_index) &&
-            (vk_memory_props.memoryTypes[type_index].propertyFlags & property_flags) == property_flags)
-            return type_index;
-    }
-    return std::nullopt;
+    return m_memory_allocator_ptr->FindMemoryType(type_filter, property_flags);
 }
 
 const vk::QueueFamilyProperties& Device::GetNativeQueueFamilyProperties(uint32_t queue_family_index) const
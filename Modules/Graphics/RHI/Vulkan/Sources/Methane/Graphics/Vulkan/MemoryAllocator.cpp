@@ -0,0 +1,297 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.cpp
+Vulkan device memory allocator with pools of large memory blocks per memory type,
+which are sub-allocated to resources with buddy allocator.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/MemoryAllocator.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace Methane::Graphics::Vulkan
+{
+
+struct MemoryAllocator::Block
+{
+    Block(vk::UniqueDeviceMemory&& vk_memory, vk::DeviceSize size, Data::RawPtr mapped_data_ptr)
+        : vk_unique_memory(std::move(vk_memory))
+        , buddy_allocator(size, min_sub_allocation)
+        , mapped_data_ptr(mapped_data_ptr)
+    { }
+
+    vk::UniqueDeviceMemory vk_unique_memory;
+    Data::BuddyAllocator   buddy_allocator;
+    Data::RawPtr           mapped_data_ptr;
+};
+
+struct MemoryAllocator::DedicatedAllocation
+{
+    vk::UniqueDeviceMemory vk_unique_memory;
+    vk::DeviceSize         size;
+};
+
+MemoryAllocation::MemoryAllocation(MemoryAllocator& allocator, void* block_ptr, const vk::DeviceMemory& vk_device_memory,
+                                   vk::DeviceSize offset, vk::DeviceSize size, Data::RawPtr mapped_data_ptr) noexcept
+    : m_allocator_ptr(&allocator)
+    , m_block_ptr(block_ptr)
+    , m_vk_device_memory(vk_device_memory)
+    , m_offset(offset)
+    , m_size(size)
+    , m_mapped_data_ptr(mapped_data_ptr)
+{ }
+
+MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept
+    : m_allocator_ptr(std::exchange(other.m_allocator_ptr, nullptr))
+    , m_block_ptr(std::exchange(other.m_block_ptr, nullptr))
+    , m_vk_device_memory(std::exchange(other.m_vk_device_memory, vk::DeviceMemory()))
+    , m_offset(std::exchange(other.m_offset, 0U))
+    , m_size(std::exchange(other.m_size, 0U))
+    , m_mapped_data_ptr(std::exchange(other.m_mapped_data_ptr, nullptr))
+{ }
+
+MemoryAllocation& MemoryAllocation::operator=(MemoryAllocation&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    Release();
+    m_allocator_ptr    = std::exchange(other.m_allocator_ptr, nullptr);
+    m_block_ptr        = std::exchange(other.m_block_ptr, nullptr);
+    m_vk_device_memory = std::exchange(other.m_vk_device_memory, vk::DeviceMemory());
+    m_offset           = std::exchange(other.m_offset, 0U);
+    m_size             = std::exchange(other.m_size, 0U);
+    m_mapped_data_ptr  = std::exchange(other.m_mapped_data_ptr, nullptr);
+    return *this;
+}
+
+MemoryAllocation::~MemoryAllocation()
+{
+    Release();
+}
+
+void MemoryAllocation::Release()
+{
+    META_FUNCTION_TASK();
+    if (!m_allocator_ptr)
+        return;
+
+    m_allocator_ptr->Free(*this);
+    m_allocator_ptr    = nullptr;
+    m_block_ptr        = nullptr;
+    m_vk_device_memory = vk::DeviceMemory();
+    m_offset           = 0U;
+    m_size             = 0U;
+    m_mapped_data_ptr  = nullptr;
+}
+
+double MemoryAllocator::Statistics::GetUtilization() const noexcept
+{
+    return reserved_size ? static_cast<double>(requested_size) / static_cast<double>(reserved_size) : 0.0;
+}
+
+double MemoryAllocator::Statistics::GetFragmentation() const noexcept
+{
+    return blocks_statistics.GetFragmentation();
+}
+
+MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device)
+    : m_vk_device(vk_device)
+    , m_vk_memory_properties(vk_physical_device.getMemoryProperties())
+{ }
+
+MemoryAllocator::~MemoryAllocator() = default;
+
+MemoryAllocation MemoryAllocator::Allocate(const vk::MemoryRequirements& vk_memory_requirements,
+                                           vk::MemoryPropertyFlags vk_memory_property_flags,
+                                           ResourceTiling resource_tiling)
+{
+    META_FUNCTION_TASK();
+    const Opt<uint32_t> memory_type_opt = FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_memory_property_flags);
+    if (!memory_type_opt)
+        return {};
+
+    std::lock_guard lock(m_mutex);
+
+    // Large resources are placed in dedicated memory to avoid wasting block space
+    const uint32_t       memory_type_index = *memory_type_opt;
+    const vk::DeviceSize block_size        = GetBlockSize(memory_type_index);
+    if (vk_memory_requirements.size > block_size / 2U)
+        return AllocateDedicated(vk_memory_requirements.size, memory_type_index);
+
+    Pool& pool = m_pools[PoolKey(memory_type_index, resource_tiling)];
+    Opt<Data::BuddyAllocator::Allocation> block_allocation_opt;
+    Block* block_ptr = nullptr;
+    for(const UniquePtr<Block>& pool_block_ptr : pool)
+    {
+        block_allocation_opt = pool_block_ptr->buddy_allocator.Allocate(vk_memory_requirements.size, vk_memory_requirements.alignment);
+        if (block_allocation_opt)
+        {
+            block_ptr = pool_block_ptr.get();
+            break;
+        }
+    }
+
+    if (!block_ptr)
+    {
+        block_ptr = &AddBlock(pool, memory_type_index);
+        block_allocation_opt = block_ptr->buddy_allocator.Allocate(vk_memory_requirements.size, vk_memory_requirements.alignment);
+        META_CHECK_ARG_TRUE_DESCR(block_allocation_opt.has_value(), "failed to sub-allocate memory in the new block");
+    }
+
+    m_requested_size += vk_memory_requirements.size;
+    return MemoryAllocation(*this, block_ptr, block_ptr->vk_unique_memory.get(),
+                            block_allocation_opt->offset, vk_memory_requirements.size,
+                            block_ptr->mapped_data_ptr ? block_ptr->mapped_data_ptr + block_allocation_opt->offset : nullptr);
+}
+
+MemoryAllocator::Statistics MemoryAllocator::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    Statistics statistics;
+    statistics.total_device_allocations    = m_total_device_allocations;
+    statistics.dedicated_allocations_count = static_cast<uint32_t>(m_dedicated_allocations.size());
+    statistics.requested_size              = m_requested_size;
+    for(const auto& [pool_key, pool] : m_pools)
+    {
+        for(const UniquePtr<Block>& block_ptr : pool)
+        {
+            statistics.blocks_statistics += block_ptr->buddy_allocator.GetStatistics();
+            statistics.blocks_count++;
+        }
+    }
+    statistics.sub_allocations_count = statistics.blocks_statistics.allocations_count;
+    statistics.reserved_size         = statistics.blocks_statistics.total_size;
+    statistics.used_size             = statistics.blocks_statistics.used_size;
+    for(const auto& [vk_device_memory, dedicated_allocation_ptr] : m_dedicated_allocations)
+    {
+        statistics.reserved_size += dedicated_allocation_ptr->size;
+        statistics.used_size     += dedicated_allocation_ptr->size;
+    }
+    statistics.device_allocations_count = statistics.blocks_count + statistics.dedicated_allocations_count;
+    return statistics;
+}
+
+vk::DeviceSize MemoryAllocator::GetBlockSize(uint32_t memory_type_index) const noexcept
+{
+    META_FUNCTION_TASK();
+    // Block size is limited with 1/8 of the memory heap size for small heaps and is rounded down to power of two for buddy allocator
+    const uint32_t       heap_index = m_vk_memory_properties.memoryTypes[memory_type_index].heapIndex;
+    const vk::DeviceSize heap_size  = m_vk_memory_properties.memoryHeaps[heap_index].size;
+    vk::DeviceSize block_size = max_block_size;
+    while (block_size > min_block_size && block_size > heap_size / 8U)
+        block_size /= 2U;
+    return block_size;
+}
+
+Opt<uint32_t> MemoryAllocator::FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept
+{
+    META_FUNCTION_TASK();
+    for(uint32_t type_index = 0U; type_index < m_vk_memory_properties.memoryTypeCount; ++type_index)
+    {
+        if (type_filter & (1 << type_index) &&
+            (m_vk_memory_properties.memoryTypes[type_index].propertyFlags & property_flags) == property_flags)
+            return type_index;
+    }
+    return std::nullopt;
+}
+
+MemoryAllocator::Block& MemoryAllocator::AddBlock(Pool& pool, uint32_t memory_type_index)
+{
+    META_FUNCTION_TASK();
+    const vk::DeviceSize   block_size = GetBlockSize(memory_type_index);
+    vk::UniqueDeviceMemory vk_unique_memory = AllocateDeviceMemory(block_size, memory_type_index);
+    Data::RawPtr           mapped_data_ptr  = MapMemoryIfHostVisible(vk_unique_memory.get(), memory_type_index);
+    return *pool.emplace_back(std::make_unique<Block>(std::move(vk_unique_memory), block_size, mapped_data_ptr));
+}
+
+MemoryAllocation MemoryAllocator::AllocateDedicated(vk::DeviceSize size, uint32_t memory_type_index)
+{
+    META_FUNCTION_TASK();
+    vk::UniqueDeviceMemory vk_unique_memory = AllocateDeviceMemory(size, memory_type_index);
+    const vk::DeviceMemory vk_device_memory = vk_unique_memory.get();
+    Data::RawPtr           mapped_data_ptr  = MapMemoryIfHostVisible(vk_device_memory, memory_type_index);
+
+    m_dedicated_allocations.try_emplace(static_cast<VkDeviceMemory>(vk_device_memory),
+                                        std::make_unique<DedicatedAllocation>(DedicatedAllocation{ std::move(vk_unique_memory), size }));
+    m_requested_size += size;
+    return MemoryAllocation(*this, nullptr, vk_device_memory, 0U, size, mapped_data_ptr);
+}
+
+vk::UniqueDeviceMemory MemoryAllocator::AllocateDeviceMemory(vk::DeviceSize size, uint32_t memory_type_index)
+{
+    META_FUNCTION_TASK();
+    vk::UniqueDeviceMemory vk_unique_memory = m_vk_device.allocateMemoryUnique(vk::MemoryAllocateInfo(size, memory_type_index));
+    m_total_device_allocations++;
+    return vk_unique_memory;
+}
+
+Data::RawPtr MemoryAllocator::MapMemoryIfHostVisible(const vk::DeviceMemory& vk_device_memory, uint32_t memory_type_index) const
+{
+    META_FUNCTION_TASK();
+    if (!(m_vk_memory_properties.memoryTypes[memory_type_index].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible))
+        return nullptr;
+
+    return static_cast<Data::RawPtr>(m_vk_device.mapMemory(vk_device_memory, 0U, VK_WHOLE_SIZE));
+}
+
+void MemoryAllocator::Free(const MemoryAllocation& allocation)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    m_requested_size -= allocation.GetSize();
+
+    if (!allocation.m_block_ptr)
+    {
+        // Dedicated memory is released by unique handle destructor
+        m_dedicated_allocations.erase(static_cast<VkDeviceMemory>(allocation.GetNativeDeviceMemory()));
+        return;
+    }
+
+    auto& block = *static_cast<Block*>(allocation.m_block_ptr);
+    block.buddy_allocator.Free(allocation.GetOffset());
+    if (!block.buddy_allocator.IsEmpty())
+        return;
+
+    // Release empty block only when there is another empty block in the same pool,
+    // so that repeated creation and release of a resource does not allocate device memory each time
+    for(auto& [pool_key, pool] : m_pools)
+    {
+        const auto block_it = std::find_if(pool.begin(), pool.end(),
+                                           [&block](const UniquePtr<Block>& block_ptr) { return block_ptr.get() == &block; });
+        if (block_it == pool.end())
+            continue;
+
+        if (std::any_of(pool.begin(), pool.end(),
+                        [&block](const UniquePtr<Block>& block_ptr) { return block_ptr.get() != &block && block_ptr->buddy_allocator.IsEmpty(); }))
+        {
+            pool.erase(block_it);
+        }
+        return;
+    }
+}
+
+} // namespace Methane::Graphics::Vulkan
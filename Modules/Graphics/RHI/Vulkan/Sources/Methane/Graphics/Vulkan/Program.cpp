@@ -83,7 +83,11 @@ std::vector<vk::PipelineShaderStageCreateInfo> Program::GetNativeShaderStageCrea
     std::vector<vk::PipelineShaderStageCreateInfo> vk_stage_create_infos;
     for(Rhi::ShaderType shader_type : GetShaderTypes())
     {
-        vk_stage_create_infos.emplace_back(GetVulkanShader(shader_type).GetNativeStageCreateInfo());
+        const Shader& shader = GetVulkanShader(shader_type);
+        const auto patched_module_it = m_vk_unique_patched_modules.find(shader_type);
+        vk_stage_create_infos.emplace_back(patched_module_it == m_vk_unique_patched_modules.end()
+                                           ? shader.GetNativeStageCreateInfo()
+                                           : shader.GetNativeStageCreateInfo(patched_module_it->second.get()));
     }
     return vk_stage_create_infos;
 }
@@ -91,8 +95,17 @@ std::vector<vk::PipelineShaderStageCreateInfo> Program::GetNativeShaderStageCrea
 vk::PipelineVertexInputStateCreateInfo Program::GetNativeVertexInputStateCreateInfo() const
 {
     META_FUNCTION_TASK();
-    auto& vertex_shader = static_cast<Shader&>(GetShaderRef(Rhi::ShaderType::Vertex));
-    return vertex_shader.GetNativeVertexInputStateCreateInfo(*this);
+    std::lock_guard lock(m_mutex);
+    if (!m_vertex_input_descriptions_opt)
+    {
+        // Vertex input descriptions depend on program input buffer layouts, so they are kept in program rather than in shared shader
+        m_vertex_input_descriptions_opt = GetVulkanShader(Rhi::ShaderType::Vertex).GetNativeVertexInputDescriptions(*this);
+    }
+    return vk::PipelineVertexInputStateCreateInfo(
+        vk::PipelineVertexInputStateCreateFlags{},
+        m_vertex_input_descriptions_opt->bindings,
+        m_vertex_input_descriptions_opt->attributes
+    );
 }
 
 const std::vector<vk::DescriptorSetLayout>& Program::GetNativeDescriptorSetLayouts() const
@@ -208,6 +221,7 @@ void Program::InitializeDescriptorSetLayouts()
 #endif
 
     const vk::Device& vk_device = GetVulkanContext().GetVulkanDevice().GetNativeDevice();
+    PatchedByteCodeByShaderType patched_byte_code_by_shader_type;
 
     m_vk_unique_descriptor_set_layouts.clear();
     for(DescriptorSetLayoutInfo& layout_info : m_descriptor_set_layout_info_by_access_type)
@@ -223,11 +237,13 @@ void Program::InitializeDescriptorSetLayouts()
         
         for(const vk::DescriptorSetLayoutBinding& layout_binding : layout_info.bindings)
         {
-            // Patch shaders SPIRV byte code with remapped binding and descriptor set decorations
+            // Patch program copy of shaders SPIRV byte code with remapped binding and descriptor set decorations,
+            // since shader objects with original byte code may be shared with other programs
             const ByteCodeMaps& byte_code_maps = layout_info.byte_code_maps_for_arguments.at(layout_binding.binding);
             for(const ByteCodeMap& byte_code_map : byte_code_maps)
             {
-                Data::MutableChunk& spirv_shader_bytecode = GetVulkanShader(byte_code_map.shader_type).GetMutableByteCode();
+                Data::MutableChunk& spirv_shader_bytecode = patched_byte_code_by_shader_type.try_emplace(byte_code_map.shader_type,
+                    GetVulkanShader(byte_code_map.shader_type).GetNativeByteCode()).first->second;
                 spirv_shader_bytecode.PatchData(byte_code_map.descriptor_set_offset, *layout_info.index_opt);
                 spirv_shader_bytecode.PatchData(byte_code_map.binding_offset, layout_binding.binding);
             }
@@ -253,6 +269,25 @@ void Program::InitializeDescriptorSetLayouts()
     m_vk_descriptor_set_layouts = vk::uniqueToRaw(m_vk_unique_descriptor_set_layouts);
 
     UpdateDescriptorSetLayoutNames();
+    InitializePatchedShaderModules(patched_byte_code_by_shader_type);
+}
+
+void Program::InitializePatchedShaderModules(const PatchedByteCodeByShaderType& patched_byte_code_by_shader_type)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = GetVulkanContext().GetVulkanDevice().GetNativeDevice();
+
+    m_vk_unique_patched_modules.clear();
+    for(const auto& [shader_type, patched_byte_code] : patched_byte_code_by_shader_type)
+    {
+        m_vk_unique_patched_modules.try_emplace(shader_type,
+            vk_device.createShaderModuleUnique(
+                vk::ShaderModuleCreateInfo(
+                    vk::ShaderModuleCreateFlags{},
+                    patched_byte_code.GetDataSize(),
+                    patched_byte_code.AsConstChunk().GetDataPtr<uint32_t>())
+            ));
+    }
 }
 
 void Program::UpdatePipelineName()
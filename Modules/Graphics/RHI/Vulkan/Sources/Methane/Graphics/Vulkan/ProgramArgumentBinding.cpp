@@ -27,6 +27,8 @@ Vulkan implementation of the program argument binding interface.
 
 #include <Methane/Graphics/Base/Context.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Vulkan
 {
 
@@ -44,6 +46,24 @@ static Rhi::ResourceUsageMask GetResourceUsageByDescriptorType(vk::DescriptorTyp
     return resource_usage;
 }
 
+static bool IsDynamicDescriptorType(vk::DescriptorType descriptor_type) noexcept
+{
+    return descriptor_type == vk::DescriptorType::eUniformBufferDynamic ||
+           descriptor_type == vk::DescriptorType::eStorageBufferDynamic;
+}
+
+static bool AreResourceViewsDifferentInOffsetsOnly(const Rhi::IResource::Views& left_views, const Rhi::IResource::Views& right_views)
+{
+    META_FUNCTION_TASK();
+    return left_views.size() == right_views.size() &&
+           std::equal(left_views.begin(), left_views.end(), right_views.begin(),
+                      [](const Rhi::IResource::View& left_view, const Rhi::IResource::View& right_view)
+                      {
+                          return left_view.GetResourcePtr() == right_view.GetResourcePtr() &&
+                                 left_view.GetSize() == right_view.GetSize();
+                      });
+}
+
 ProgramArgumentBinding::ProgramArgumentBinding(const Base::Context& context, const Settings& settings)
     : Base::ProgramArgumentBinding(context, settings)
     , m_settings_vk(settings)
@@ -95,9 +115,18 @@ bool AddDescriptor(std::vector<VkDescriptorType>& descriptors, size_t total_desc
 bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resource_views)
 {
     META_FUNCTION_TASK();
+    // Offsets of dynamic buffer descriptors are set with descriptor sets binding in ProgramBindings::Apply,
+    // so descriptor set update is not required when only offsets of the same resource views are changed
+    const bool is_dynamic_descriptor = IsDynamicDescriptorType(m_settings_vk.descriptor_type);
+    const bool is_offsets_change_only = is_dynamic_descriptor && !GetResourceViews().empty() &&
+                                        AreResourceViewsDifferentInOffsetsOnly(GetResourceViews(), resource_views);
+
     if (!Base::ProgramArgumentBinding::SetResourceViews(resource_views))
         return false;
 
+    if (is_offsets_change_only)
+        return true;
+
     META_CHECK_ARG_NOT_NULL(m_vk_descriptor_set_ptr);
 
     m_vk_descriptor_images.clear();
@@ -115,7 +144,12 @@ bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resou
             continue;
 
         if (AddDescriptor(m_vk_descriptor_buffers, total_resources_count, resource_view_vk.GetNativeDescriptorBufferInfoPtr()))
+        {
+            // Resource view offset is applied as dynamic offset, which is added to the descriptor offset
+            if (is_dynamic_descriptor)
+                m_vk_descriptor_buffers.back().offset = 0U;
             continue;
+        }
 
         AddDescriptor(m_vk_buffer_views, total_resources_count, resource_view_vk.GetNativeBufferViewPtr());
     }
@@ -161,7 +161,12 @@ void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& re
 {
     META_FUNCTION_TASK();
     Base::ProgramBindings::SetResourcesForArguments(resource_views_by_argument);
+    UpdateDynamicOffsets();
+}
 
+void ProgramBindings::UpdateDynamicOffsets()
+{
+    META_FUNCTION_TASK();
     auto& program = static_cast<Program&>(GetProgram());
     const Rhi::ProgramArgumentAccessors& program_argument_accessors = program.GetSettings().argument_accessors;
     std::vector<std::vector<uint32_t>> dynamic_offsets_by_set_index;
@@ -265,6 +270,20 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
                                          m_dynamic_offsets.data() + first_dynamic_offset_index);
 }
 
+void ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding& argument_binding,
+                                                                  const Rhi::IResource::Views& old_resource_views,
+                                                                  const Rhi::IResource::Views& new_resource_views)
+{
+    META_FUNCTION_TASK();
+    Base::ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(argument_binding, old_resource_views, new_resource_views);
+
+    // Resource views of addressable arguments are bound with dynamic offsets, which are updated without descriptor set changes
+    if (argument_binding.GetSettings().argument.IsAddressable())
+    {
+        UpdateDynamicOffsets();
+    }
+}
+
 void ProgramBindings::OnObjectNameChanged(IObject&, const std::string&)
 {
     META_FUNCTION_TASK();
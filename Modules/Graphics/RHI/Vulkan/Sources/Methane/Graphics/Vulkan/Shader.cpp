@@ -248,6 +248,7 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
 const vk::ShaderModule& Shader::GetNativeModule() const
 {
     META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
     if (!m_vk_unique_module)
     {
         m_vk_unique_module = m_vk_context.GetVulkanDevice().GetNativeDevice().createShaderModuleUnique(
@@ -263,6 +264,7 @@ const vk::ShaderModule& Shader::GetNativeModule() const
 const spirv_cross::Compiler& Shader::GetNativeCompiler() const
 {
     META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
     if (m_spirv_compiler_ptr)
         return *m_spirv_compiler_ptr;
 
@@ -274,52 +276,34 @@ const spirv_cross::Compiler& Shader::GetNativeCompiler() const
 vk::PipelineShaderStageCreateInfo Shader::GetNativeStageCreateInfo() const
 {
     META_FUNCTION_TASK();
-    return vk::PipelineShaderStageCreateInfo(
-        vk::PipelineShaderStageCreateFlags{},
-        ConvertTypeToStageFlagBits(GetType()),
-        GetNativeModule(),
-        GetSettings().entry_function.function_name.c_str()
-    );
+    return GetNativeStageCreateInfo(GetNativeModule());
 }
 
-vk::PipelineVertexInputStateCreateInfo Shader::GetNativeVertexInputStateCreateInfo(const Program& program)
+vk::PipelineShaderStageCreateInfo Shader::GetNativeStageCreateInfo(const vk::ShaderModule& vk_module) const
 {
     META_FUNCTION_TASK();
-    META_CHECK_ARG_EQUAL(GetType(), Rhi::ShaderType::Vertex);
-    std::lock_guard lock(m_mutex);
-
-    if (!m_vertex_input_initialized)
-        InitializeVertexInputDescriptions(program);
-
-    return vk::PipelineVertexInputStateCreateInfo(
-        vk::PipelineVertexInputStateCreateFlags{},
-        m_vertex_input_binding_descriptions,
-        m_vertex_input_attribute_descriptions
+    return vk::PipelineShaderStageCreateInfo(
+        vk::PipelineShaderStageCreateFlags{},
+        ConvertTypeToStageFlagBits(GetType()),
+        vk_module,
+        GetSettings().entry_function.function_name.c_str()
     );
 }
 
-Data::MutableChunk& Shader::GetMutableByteCode() noexcept
-{
-    META_FUNCTION_TASK();
-    m_vk_unique_module.reset();
-    m_spirv_compiler_ptr.reset();
-    return m_byte_code_chunk;
-}
-
-void Shader::InitializeVertexInputDescriptions(const Program& program)
+Shader::VertexInputDescriptions Shader::GetNativeVertexInputDescriptions(const Program& program) const
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_EQUAL(GetType(), Rhi::ShaderType::Vertex);
-    META_CHECK_ARG_FALSE_DESCR(m_vertex_input_initialized, "vertex input descriptions are already initialized");
 
-    const Rhi::IShader::Settings              & shader_settings      = GetSettings();
+    VertexInputDescriptions vertex_input_descriptions;
+    const Rhi::IShader::Settings           & shader_settings      = GetSettings();
     const Base::Program::InputBufferLayouts& input_buffer_layouts = program.GetSettings().input_buffer_layouts;
-    m_vertex_input_binding_descriptions.reserve(input_buffer_layouts.size());
+    vertex_input_descriptions.bindings.reserve(input_buffer_layouts.size());
 
     uint32_t input_buffer_index = 0U;
     for(const Rhi::IProgram::InputBufferLayout& input_buffer_layout : input_buffer_layouts)
     {
-        m_vertex_input_binding_descriptions.emplace_back(
+        vertex_input_descriptions.bindings.emplace_back(
             input_buffer_index,
             0U, // stride is auto calculated by vertex attributes
             ConvertInputBufferLayoutStepTypeToVertexInputRate(input_buffer_layout.step_type)
@@ -342,7 +326,7 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
     META_UNUSED(shader_settings);
 #endif
 
-    m_vertex_input_attribute_descriptions.reserve(shader_resources.stage_inputs.size());
+    vertex_input_descriptions.attributes.reserve(shader_resources.stage_inputs.size());
     for(const spirv_cross::Resource& input_resource : shader_resources.stage_inputs)
     {
         const bool has_semantic = spirv_compiler.has_decoration(input_resource.id, spv::DecorationHlslSemanticGOOGLE);
@@ -355,10 +339,10 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
         const vk::Format             attribute_format = GetVertexAttributeFormatFromSpirvType(attribute_type);
 
         const uint32_t buffer_index = GetProgramInputBufferIndexByArgumentSemantic(program, semantic_name);
-        META_CHECK_ARG_LESS(buffer_index, m_vertex_input_binding_descriptions.size());
-        vk::VertexInputBindingDescription& input_binding_desc = m_vertex_input_binding_descriptions[buffer_index];
+        META_CHECK_ARG_LESS(buffer_index, vertex_input_descriptions.bindings.size());
+        vk::VertexInputBindingDescription& input_binding_desc = vertex_input_descriptions.bindings[buffer_index];
 
-        m_vertex_input_attribute_descriptions.emplace_back(
+        vertex_input_descriptions.attributes.emplace_back(
             input_location,
             buffer_index,
             attribute_format,
@@ -379,8 +363,7 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
     }
 
     META_LOG("{}", log_ss.str());
-
-    m_vertex_input_initialized = true;
+    return vertex_input_descriptions;
 }
 
 vk::ShaderStageFlagBits Shader::ConvertTypeToStageFlagBits(Rhi::ShaderType shader_type)
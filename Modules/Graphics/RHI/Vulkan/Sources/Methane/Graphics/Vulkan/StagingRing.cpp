@@ -0,0 +1,143 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/StagingRing.cpp
+Vulkan persistently mapped staging ring buffer shared by all resources of the context
+for transient data uploads, fenced by upload command list completion.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/StagingRing.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Vulkan
+{
+
+StagingRing::ReadBackBuffer::ReadBackBuffer(MemoryAllocation&& memory, vk::UniqueBuffer&& vk_unique_buffer, vk::DeviceSize size) noexcept
+    : m_memory(std::move(memory))
+    , m_vk_unique_buffer(std::move(vk_unique_buffer))
+    , m_size(size)
+{ }
+
+StagingRing::Region StagingRing::ReadBackBuffer::GetRegion() const noexcept
+{
+    return Region{ m_vk_unique_buffer.get(), 0U, m_size, m_memory.GetMappedData() };
+}
+
+StagingRing::StagingRing(const Device& device, uint32_t frames_count)
+    : m_vk_device(device.GetNativeDevice())
+    , m_memory_allocator(device.GetMemoryAllocator())
+    , m_size(frame_size * std::max(frames_count, 1U))
+    , m_vk_unique_buffer(CreateStagingBuffer(m_size, m_memory))
+    , m_ring(m_size, region_alignment)
+{ }
+
+StagingRing::Region StagingRing::Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(size, "can not allocate empty staging region");
+    upload_cmd_list.Connect(*this);
+
+    std::lock_guard lock(m_mutex);
+    if (const Opt<vk::DeviceSize> ring_offset_opt = m_ring.Allocate(size);
+        ring_offset_opt)
+    {
+        return Region{ m_vk_unique_buffer.get(), *ring_offset_opt, size, m_memory.GetMappedData() + *ring_offset_opt };
+    }
+
+    // Data which does not fit in free space of the ring is placed in transient buffer,
+    // which is most likely during initial resources loading, when all uploads are executed at once
+    META_LOG("Staging ring is full, allocating transient staging buffer of {} bytes", size);
+    TransientBuffer& transient_buffer = m_ring.AddPayload(TransientBuffer{});
+    transient_buffer.vk_unique_buffer = CreateStagingBuffer(size, transient_buffer.memory);
+    return Region{ transient_buffer.vk_unique_buffer.get(), 0U, size, transient_buffer.memory.GetMappedData() };
+}
+
+StagingRing::ReadBackBuffer StagingRing::AllocateReadBack(vk::DeviceSize size) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(size, "can not allocate empty read-back buffer");
+    MemoryAllocation memory;
+    vk::UniqueBuffer vk_unique_buffer = CreateStagingBuffer(size, memory);
+    return ReadBackBuffer(std::move(memory), std::move(vk_unique_buffer), size);
+}
+
+vk::DeviceSize StagingRing::GetUsedSize() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    return m_ring.GetUsedSize();
+}
+
+uint32_t StagingRing::GetTransientBuffersCount() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    return static_cast<uint32_t>(m_ring.GetPayloadsCount());
+}
+
+// State change is emitted under command list state lock, so execution completion with Pending state
+// is always handled before the next execution of the same command list begins, unlike completion callback
+void StagingRing::OnCommandListStateChanged(Rhi::ICommandList& cmd_list)
+{
+    META_FUNCTION_TASK();
+    switch(cmd_list.GetState())
+    {
+    case Rhi::CommandListState::Executing:
+    {
+        // All regions allocated before execution start are used by the executing upload commands
+        std::lock_guard lock(m_mutex);
+        m_ring.BeginExecution(&cmd_list);
+        break;
+    }
+    case Rhi::CommandListState::Pending:
+    {
+        std::lock_guard lock(m_mutex);
+        m_ring.CompleteExecution(&cmd_list);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+vk::UniqueBuffer StagingRing::CreateStagingBuffer(vk::DeviceSize size, MemoryAllocation& memory) const
+{
+    META_FUNCTION_TASK();
+    vk::UniqueBuffer vk_unique_buffer = m_vk_device.createBufferUnique(
+        vk::BufferCreateInfo(vk::BufferCreateFlags{},
+                             size,
+                             vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst,
+                             vk::SharingMode::eExclusive)
+    );
+
+    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    memory = m_memory_allocator.Allocate(m_vk_device.getBufferMemoryRequirements(vk_unique_buffer.get()), vk_staging_memory_flags,
+                                         MemoryAllocator::ResourceTiling::Linear);
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(memory), "suitable memory type was not found for staging buffer");
+    META_CHECK_ARG_NOT_NULL_DESCR(memory.GetMappedData(), "staging buffer memory is not mapped");
+    m_vk_device.bindBufferMemory(vk_unique_buffer.get(), memory.GetNativeDeviceMemory(), memory.GetOffset());
+    return vk_unique_buffer;
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -25,6 +25,7 @@ Vulkan implementation of the texture interface.
 #include <Methane/Graphics/Vulkan/RenderContext.h>
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
 #include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/StagingRing.h>
 #include <Methane/Graphics/Vulkan/Types.h>
 
 #include <Methane/Data/EnumMaskUtil.hpp>
@@ -267,21 +268,9 @@ void Texture::InitializeAsImage()
 
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
-    const vk::MemoryRequirements vk_image_memory_requirements = vk_device.getImageMemoryRequirements(GetNativeResource());
-    AllocateResourceMemory(vk_image_memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
-
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = vk_device.createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-                             vk_image_memory_requirements.size,
-                             vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst,
-                             vk::SharingMode::eExclusive)
-    );
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
 }
 
 void Texture::InitializeAsRenderTarget()
@@ -293,7 +282,7 @@ void Texture::InitializeAsRenderTarget()
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
     AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 }
 
 void Texture::InitializeAsDepthStencil()
@@ -310,7 +299,7 @@ void Texture::InitializeAsDepthStencil()
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
     AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 }
 
 void Texture::ResetNativeFrameImage()
@@ -338,25 +327,25 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
     m_vk_copy_regions.clear();
     m_vk_copy_regions.reserve(sub_resources.size());
 
-    const SubResource::Count& subresource_count = GetSubresourceCount();
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    vk::DeviceSize sub_resource_offset = 0U;
-
+    // All subresources data is placed in one region of the staging ring
+    vk::DeviceSize sub_resources_data_size = 0U;
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
-        Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                     reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
+        sub_resources_data_size += sub_resource.GetDataSize();
+    }
 
-        META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-        META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
+    TransferCommandList&      upload_cmd_list   = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
+    const StagingRing::Region staging_region    = GetVulkanContext().GetVulkanStagingRing().Allocate(upload_cmd_list, sub_resources_data_size);
+    const SubResource::Count& subresource_count = GetSubresourceCount();
+    vk::DeviceSize sub_resource_offset = 0U;
 
-        GetNativeDevice().unmapMemory(vk_device_memory);
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_region.data_ptr + sub_resource_offset);
 
         m_vk_copy_regions.emplace_back(
-            sub_resource_offset, 0, 0,
+            staging_region.offset + sub_resource_offset, 0, 0,
             vk::ImageSubresourceLayers(
                 vk::ImageAspectFlagBits::eColor,
                 sub_resource.GetIndex().GetMipLevel(),
@@ -370,10 +359,9 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
         sub_resource_offset += sub_resource.GetDataSize();
     }
 
-    // Copy buffer data from staging upload resource to the device-local GPU resource
-    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
+    // Copy buffer data from staging ring region to the device-local GPU resource
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    vk_cmd_buffer.copyBufferToImage(m_vk_unique_staging_buffer.get(), GetNativeResource(),
+    vk_cmd_buffer.copyBufferToImage(staging_region.vk_buffer, GetNativeResource(),
                                     vk::ImageLayout::eTransferDstOptimal, m_vk_copy_regions);
 
     if (GetSettings().mipmapped && sub_resources.size() < GetSubresourceCount().GetRawCount())
@@ -400,9 +388,12 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
     const SubResource::Count& subresource_count = GetSubresourceCount();
     const State           initial_texture_state = GetState();
 
-    // Copy texture data from device-local GPU resource to staging resource for read-back
+    // Copy texture data from device-local GPU resource to read-back staging buffer
+    TransferCommandList&              upload_cmd_list  = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
+    const StagingRing::ReadBackBuffer read_back_buffer = GetVulkanContext().GetVulkanStagingRing().AllocateReadBack(bytes_per_image);
+    const StagingRing::Region         read_back_region = read_back_buffer.GetRegion();
     vk::BufferImageCopy image_to_buffer_copy(
-        0U, 0U, 0U,
+        read_back_region.offset, 0U, 0U,
         vk::ImageSubresourceLayers(
             Texture::GetNativeImageAspectFlags(settings),
             sub_resource_index.GetMipLevel(),
@@ -412,49 +403,29 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
         vk::Offset3D(),
         TypeConverter::FrameSizeToExtent3D(GetSettings().dimensions.AsRectSize())
     );
-    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     vk_cmd_buffer.copyImageToBuffer(GetNativeResource(), vk::ImageLayout::eTransferSrcOptimal,
-                                    m_vk_unique_staging_buffer.get(), image_to_buffer_copy);
+                                    read_back_region.vk_buffer, image_to_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_texture_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
+    upload_cmd_list.WaitUntilCompleted();
 
-    // Map staging buffer memory and copy texture subresource data
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    Data::Size   staging_data_offset = 0U;
-    Data::Size   staging_data_size   = bytes_per_image;
-    Data::RawPtr staging_data_ptr    = nullptr;
+    // Copy texture subresource data from mapped read-back buffer, which is released after that
+    Data::Size staging_data_offset = 0U;
+    Data::Size staging_data_size   = bytes_per_image;
     if (data_range)
     {
         META_CHECK_ARG_LESS_DESCR(data_range->GetEnd(), staging_data_size, "provided texture subresource data range is out of bounds");
         staging_data_offset = data_range->GetStart();
         staging_data_size   = data_range->GetLength();
     }
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, staging_data_offset, staging_data_size, vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&staging_data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(staging_data_ptr, "failed to map buffer subresource");
-    Rhi::SubResource sub_resource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
 
-    GetNativeDevice().unmapMemory(vk_device_memory);
-    return sub_resource;
-}
-
-bool Texture::SetName(std::string_view name)
-{
-    META_FUNCTION_TASK();
-    if (!Resource::SetName(name))
-        return false;
-
-    if (m_vk_unique_staging_buffer)
-    {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
-    }
-    return true;
+    const Data::RawPtr staging_data_ptr = read_back_region.data_ptr;
+    return Rhi::SubResource(Data::Bytes(staging_data_ptr + staging_data_offset, staging_data_ptr + staging_data_offset + staging_data_size),
+                            sub_resource_index, data_range);
 }
 
 void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state)
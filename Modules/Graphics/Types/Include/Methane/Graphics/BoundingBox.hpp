@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/BoundingBox.hpp
+Axis-aligned bounding box type based on HLSL++ vectors
+
+******************************************************************************/
+
+#pragma once
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+
+#include <array>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+struct BoundingBox
+{
+    hlslpp::float3 min{ std::numeric_limits<float>::max() };
+    hlslpp::float3 max{ std::numeric_limits<float>::lowest() };
+
+    BoundingBox() = default;
+    BoundingBox(const hlslpp::float3& in_min, const hlslpp::float3& in_max) noexcept
+        : min(in_min)
+        , max(in_max)
+    { }
+
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return static_cast<float>(min.x) > static_cast<float>(max.x) ||
+               static_cast<float>(min.y) > static_cast<float>(max.y) ||
+               static_cast<float>(min.z) > static_cast<float>(max.z);
+    }
+
+    [[nodiscard]] hlslpp::float3 GetCenter() const noexcept { return (min + max) * 0.5F; }
+    [[nodiscard]] hlslpp::float3 GetExtent() const noexcept { return (max - min) * 0.5F; } // half of the box size
+
+    [[nodiscard]] float GetSurfaceArea() const noexcept
+    {
+        if (IsEmpty())
+            return 0.F;
+
+        const hlslpp::float3 size = max - min;
+        const auto x = static_cast<float>(size.x);
+        const auto y = static_cast<float>(size.y);
+        const auto z = static_cast<float>(size.z);
+        return 2.F * (x * y + y * z + z * x);
+    }
+
+    [[nodiscard]] bool Contains(const hlslpp::float3& point) const noexcept
+    {
+        return static_cast<float>(point.x) >= static_cast<float>(min.x) && static_cast<float>(point.x) <= static_cast<float>(max.x) &&
+               static_cast<float>(point.y) >= static_cast<float>(min.y) && static_cast<float>(point.y) <= static_cast<float>(max.y) &&
+               static_cast<float>(point.z) >= static_cast<float>(min.z) && static_cast<float>(point.z) <= static_cast<float>(max.z);
+    }
+
+    void Add(const hlslpp::float3& point) noexcept
+    {
+        min = hlslpp::min(min, point);
+        max = hlslpp::max(max, point);
+    }
+
+    void Add(const BoundingBox& box) noexcept
+    {
+        min = hlslpp::min(min, box.min);
+        max = hlslpp::max(max, box.max);
+    }
+
+    // Returns bounding box of this box corners transformed with row-vector matrix, like model matrix of mesh instance
+    [[nodiscard]] BoundingBox Transform(const hlslpp::float4x4& matrix) const noexcept
+    {
+        BoundingBox transformed_box;
+        if (IsEmpty())
+            return transformed_box;
+
+        for(uint32_t corner_index = 0U; corner_index < 8U; ++corner_index)
+        {
+            const hlslpp::float4 corner(
+                (corner_index & 1U) ? static_cast<float>(max.x) : static_cast<float>(min.x),
+                (corner_index & 2U) ? static_cast<float>(max.y) : static_cast<float>(min.y),
+                (corner_index & 4U) ? static_cast<float>(max.z) : static_cast<float>(min.z),
+                1.F);
+            const hlslpp::float4 transformed_corner = hlslpp::mul(corner, matrix);
+            transformed_box.Add(transformed_corner.xyz / transformed_corner.w);
+        }
+        return transformed_box;
+    }
+};
+
+} // namespace Methane::Graphics
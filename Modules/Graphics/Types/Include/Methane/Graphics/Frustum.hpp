@@ -0,0 +1,175 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Frustum.hpp
+View frustum planes with bounding volumes visibility tests
+vectorized over planes with HLSL++ SIMD vectors
+
+******************************************************************************/
+
+#pragma once
+
+#include "BoundingBox.hpp"
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+
+#include <array>
+
+namespace Methane::Graphics
+{
+
+class Frustum
+{
+public:
+    enum class Intersection
+    {
+        Outside,
+        Intersects,
+        Inside
+    };
+
+    enum class Plane : size_t
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        Count
+    };
+
+    static constexpr size_t planes_count = static_cast<size_t>(Plane::Count);
+
+    Frustum() = default;
+
+    // Extracts world space planes from row-vector view-projection matrix with [0, 1] clip depth range,
+    // so that plane normals are pointing inside of the frustum
+    explicit Frustum(const hlslpp::float4x4& view_proj_matrix) noexcept
+    {
+        static const std::array<hlslpp::float4, planes_count> s_clip_planes{
+            hlslpp::float4( 1.F,  0.F,  0.F, 1.F), // Left:   x + w >= 0
+            hlslpp::float4(-1.F,  0.F,  0.F, 1.F), // Right:  w - x >= 0
+            hlslpp::float4( 0.F,  1.F,  0.F, 1.F), // Bottom: y + w >= 0
+            hlslpp::float4( 0.F, -1.F,  0.F, 1.F), // Top:    w - y >= 0
+            hlslpp::float4( 0.F,  0.F,  1.F, 0.F), // Near:   z >= 0
+            hlslpp::float4( 0.F,  0.F, -1.F, 1.F), // Far:    w - z >= 0
+        };
+
+        std::array<std::array<float, 8>, 4> planes_soa{ };
+        for(size_t plane_index = 0; plane_index < planes_soa[0].size(); ++plane_index)
+        {
+            if (plane_index >= planes_count)
+            {
+                // Neutral planes are padding the SIMD batches and never reject anything: 0 * p + 1 >= 0
+                planes_soa[3][plane_index] = 1.F;
+                continue;
+            }
+
+            // World point p is inside of clip plane c when dot(p * M, c) >= 0, which equals to dot(p, M * c)
+            const hlslpp::float4 plane = hlslpp::mul(view_proj_matrix, s_clip_planes[plane_index]);
+            const auto normal_length = static_cast<float>(hlslpp::length(plane.xyz));
+            m_planes[plane_index] = normal_length > 0.F ? plane / normal_length : plane;
+            planes_soa[0][plane_index] = static_cast<float>(m_planes[plane_index].x);
+            planes_soa[1][plane_index] = static_cast<float>(m_planes[plane_index].y);
+            planes_soa[2][plane_index] = static_cast<float>(m_planes[plane_index].z);
+            planes_soa[3][plane_index] = static_cast<float>(m_planes[plane_index].w);
+        }
+
+        for(size_t batch_index = 0; batch_index < s_batches_count; ++batch_index)
+        {
+            const size_t offset = batch_index * 4;
+            m_planes_x[batch_index] = hlslpp::float4(planes_soa[0][offset], planes_soa[0][offset + 1], planes_soa[0][offset + 2], planes_soa[0][offset + 3]);
+            m_planes_y[batch_index] = hlslpp::float4(planes_soa[1][offset], planes_soa[1][offset + 1], planes_soa[1][offset + 2], planes_soa[1][offset + 3]);
+            m_planes_z[batch_index] = hlslpp::float4(planes_soa[2][offset], planes_soa[2][offset + 1], planes_soa[2][offset + 2], planes_soa[2][offset + 3]);
+            m_planes_w[batch_index] = hlslpp::float4(planes_soa[3][offset], planes_soa[3][offset + 1], planes_soa[3][offset + 2], planes_soa[3][offset + 3]);
+        }
+    }
+
+    [[nodiscard]] const hlslpp::float4& GetPlane(Plane plane) const noexcept { return m_planes[static_cast<size_t>(plane)]; }
+
+    [[nodiscard]] bool IsPointVisible(const hlslpp::float3& point) const noexcept
+    {
+        return IsSphereVisible(point, 0.F);
+    }
+
+    [[nodiscard]] bool IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept
+    {
+        return TestSphere(center, radius) != Intersection::Outside;
+    }
+
+    [[nodiscard]] bool IsBoxVisible(const BoundingBox& box) const noexcept
+    {
+        return TestBox(box) != Intersection::Outside;
+    }
+
+    [[nodiscard]] Intersection TestSphere(const hlslpp::float3& center, float radius) const noexcept
+    {
+        return Test(center, hlslpp::float3(0.F), radius);
+    }
+
+    // Box is tested by the signed distance of its center to planes compared with the box extent projected to plane normals
+    [[nodiscard]] Intersection TestBox(const BoundingBox& box) const noexcept
+    {
+        return Test(box.GetCenter(), box.GetExtent(), 0.F);
+    }
+
+private:
+    static constexpr size_t s_batches_count = 2U;
+
+    using PlaneBatches = std::array<hlslpp::float4, s_batches_count>;
+
+    [[nodiscard]] Intersection Test(const hlslpp::float3& center, const hlslpp::float3& extent, float radius) const noexcept
+    {
+        const hlslpp::float4 center_x(static_cast<float>(center.x));
+        const hlslpp::float4 center_y(static_cast<float>(center.y));
+        const hlslpp::float4 center_z(static_cast<float>(center.z));
+        const hlslpp::float4 extent_x(static_cast<float>(extent.x));
+        const hlslpp::float4 extent_y(static_cast<float>(extent.y));
+        const hlslpp::float4 extent_z(static_cast<float>(extent.z));
+        const hlslpp::float4 zero(0.F);
+
+        bool is_intersecting = false;
+        for(size_t batch_index = 0; batch_index < s_batches_count; ++batch_index)
+        {
+            const hlslpp::float4 distance = m_planes_x[batch_index] * center_x + m_planes_y[batch_index] * center_y +
+                                            m_planes_z[batch_index] * center_z + m_planes_w[batch_index];
+            const hlslpp::float4 projected_radius = hlslpp::abs(m_planes_x[batch_index]) * extent_x +
+                                                    hlslpp::abs(m_planes_y[batch_index]) * extent_y +
+                                                    hlslpp::abs(m_planes_z[batch_index]) * extent_z + hlslpp::float4(radius);
+            if (hlslpp::any(distance + projected_radius < zero))
+                return Intersection::Outside;
+
+            is_intersecting |= hlslpp::any(distance - projected_radius < zero);
+        }
+        return is_intersecting ? Intersection::Intersects : Intersection::Inside;
+    }
+
+    // Frustum is infinite by default, since all planes are neutral
+    std::array<hlslpp::float4, planes_count> m_planes{
+        hlslpp::float4(0.F, 0.F, 0.F, 1.F), hlslpp::float4(0.F, 0.F, 0.F, 1.F), hlslpp::float4(0.F, 0.F, 0.F, 1.F),
+        hlslpp::float4(0.F, 0.F, 0.F, 1.F), hlslpp::float4(0.F, 0.F, 0.F, 1.F), hlslpp::float4(0.F, 0.F, 0.F, 1.F)
+    };
+    PlaneBatches m_planes_x{ hlslpp::float4(0.F), hlslpp::float4(0.F) };
+    PlaneBatches m_planes_y{ hlslpp::float4(0.F), hlslpp::float4(0.F) };
+    PlaneBatches m_planes_z{ hlslpp::float4(0.F), hlslpp::float4(0.F) };
+    PlaneBatches m_planes_w{ hlslpp::float4(1.F), hlslpp::float4(1.F) };
+};
+
+} // namespace Methane::Graphics
@@ -89,6 +89,9 @@ public:
     bool                    IsMinimized() const noexcept            { return m_is_minimized; }
     bool                    IsResizing() const noexcept             { return m_is_resizing; }
     bool                    HasKeyboardFocus() const noexcept       { return m_has_keyboard_focus; }
+    bool                    IsHeadless() const noexcept             { return m_headless_frames_count > 0U; }
+    uint32_t                GetHeadlessFramesCount() const noexcept { return m_headless_frames_count; }
+    double                  GetTimeToFirstFrameMSec() const noexcept { return m_time_to_first_frame_msec; } // measured in headless mode only
     bool                    HasError() const noexcept;
 
 protected:
@@ -96,6 +99,10 @@ protected:
     virtual AppView GetView() const = 0;
     virtual void ShowAlert(const Message& msg);
 
+    // Runs application without window for the given number of frames, used instead of platform event loop
+    int RunHeadless();
+    void SetHeadlessFramesCount(uint32_t headless_frames_count) noexcept { m_headless_frames_count = headless_frames_count; }
+
     std::string GetControlsHelp() const;
     std::string GetCommandLineHelp() const { return CLI::App::help(); }
 
@@ -148,6 +155,8 @@ private:
     }
 
     Settings        m_settings;
+    uint32_t        m_headless_frames_count = 0U;
+    double          m_time_to_first_frame_msec = 0.0;
     Data::FrameRect m_window_bounds;
     Data::FrameSize m_frame_size;
     Ptr<Message>    m_deferred_message_ptr;
@@ -59,6 +59,7 @@ protected:
     void ShowAlert(const Message& msg) override;
 
 private:
+    void InitDisplay();
     Data::FrameSize InitWindow();
     void SetWindowIcon(const Data::IProvider& icon_provider);
     void ResizeWindow(const Data::FrameSize& frame_size, const Data::FrameSize& min_size, const Data::Point2I* position = nullptr);
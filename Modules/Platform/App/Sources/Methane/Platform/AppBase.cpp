@@ -22,6 +22,7 @@ Base application interface and platform-independent implementation.
 ******************************************************************************/
 
 #include <Methane/Platform/AppBase.h>
+#include <Methane/Platform/AppEnvironment.h>
 #include <Methane/Platform/Utils.h>
 #include <Methane/Platform/Logger.h>
 #include <Methane/Platform/Input/Controller.h>
@@ -34,7 +35,9 @@ Base application interface and platform-independent implementation.
 #include <taskflow/core/async.hpp>
 #include <taskflow/core/executor.hpp>
 
+#include <chrono>
 #include <sstream>
+#include <iostream>
 #include <vector>
 #include <string_view>
 #include <cstdlib>
@@ -42,6 +45,9 @@ Base application interface and platform-independent implementation.
 namespace Methane::Platform
 {
 
+// Window size ratios are applied to the virtual screen size in headless mode, since there is no desktop
+static const Data::FrameSize g_headless_screen_size{ 1920U, 1080U };
+
 static bool WriteControllerHeaderToHelpStream(std::stringstream& help_stream, const Input::Controller& controller, bool is_first_controller)
 {
     if (!is_first_controller)
@@ -159,6 +165,13 @@ AppBase::AppBase(const AppBase::Settings& settings)
 
     AddRectSizeOption(*this, "-w,--wnd-size", m_settings.size, "Window size in pixels or as ratio of desktop size", true);
     add_option("-f,--full-screen", m_settings.is_full_screen, "Full-screen mode");
+    add_option("--headless", m_headless_frames_count, "Render given number of frames without window and exit");
+
+#ifdef METHANE_TRACE_RECORDER_ENABLED
+    add_option_function<std::string>("--trace-file",
+        [](const std::string& trace_file_path) { TraceRecorder::Get().SetExitTraceFilePath(trace_file_path); },
+        "Chrome trace JSON file path to write recorded trace events on exit");
+#endif
 
 #ifdef __APPLE__
     // When application is opened on MacOS with its Bundle,
@@ -194,6 +207,42 @@ int AppBase::Run(const RunArgs& args)
     return 0;
 }
 
+int AppBase::RunHeadless()
+{
+    // Skip instrumentation META_FUNCTION_TASK() since this is the only root function running till application close
+    const auto run_start_time = std::chrono::steady_clock::now();
+    const Data::FrameSize frame_size(
+        GetScaledSize(m_settings.size.GetWidth(),  g_headless_screen_size.GetWidth()),
+        GetScaledSize(m_settings.size.GetHeight(), g_headless_screen_size.GetHeight())
+    );
+
+    // Application Initialization with empty environment makes render context create offscreen frame buffers
+    bool is_success = InitContextWithErrorHandling(AppEnvironment{}, frame_size) &&
+                      InitWithErrorHandling();
+
+    // Main loop is driven by frames count instead of window events
+    for(uint32_t frame_index = 0U; is_success && frame_index < m_headless_frames_count; ++frame_index)
+    {
+        is_success = UpdateAndRenderWithErrorHandling();
+
+        // Time to first frame includes context and application initialization with the first frame update and rendering
+        if (is_success && frame_index == 0U)
+        {
+            m_time_to_first_frame_msec = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - run_start_time).count();
+            std::cout << "Time to first frame: " << fmt::format("{:.2f}", m_time_to_first_frame_msec) << " ms" << std::endl;
+        }
+    }
+
+    if (HasDeferredMessage())
+    {
+        is_success = is_success && !HasError();
+        ShowAlert(GetDeferredMessage());
+        ResetDeferredMessage();
+    }
+
+    return is_success ? 0 : 1;
+}
+
 void AppBase::Init()
 {
     META_FUNCTION_TASK();
@@ -248,9 +297,15 @@ void AppBase::Alert(const Message& msg, bool deferred)
     m_deferred_message_ptr.reset(new Message(msg));
 }
 
-void AppBase::ShowAlert(const Message&)
+void AppBase::ShowAlert(const Message& msg)
 {
     META_FUNCTION_TASK();
+    if (IsHeadless())
+    {
+        // Alerts are printed to console in headless mode, since there is no window to show message box
+        std::ostream& alert_stream = msg.type == Message::Type::Information ? std::cout : std::cerr; // NOSONAR
+        alert_stream << msg.title << ": " << msg.information << std::endl;
+    }
 
     // Message box interrupts message loop so that application looses all key release events
     // We assume that user has released all previously pressed keys and simulate these events
@@ -45,30 +45,14 @@ AppLin::AppLin(const AppBase::Settings& settings)
     : AppBase(settings)
 {
     META_FUNCTION_TASK();
-
-    m_env.display = XOpenDisplay(nullptr);
-    META_CHECK_ARG_NOT_NULL_DESCR(m_env.display, "failed to open X11 display");
-    XSetEventQueueOwner(m_env.display, XCBOwnsEventQueue);
-
-    // Establish connection to X-server
-    m_env.connection = XGetXCBConnection(m_env.display);
-    const int connection_error = xcb_connection_has_error(m_env.connection);
-    META_CHECK_ARG_EQUAL_DESCR(connection_error, 0, "XCB connection to display has failed");
-
-    // Find default screen_id setup
-    const xcb_setup_t*    setup = xcb_get_setup(m_env.connection);
-    xcb_screen_iterator_t screen_iter = xcb_setup_roots_iterator(setup);
-    m_env.screen = screen_iter.data;
-    m_env.primary_screen_rect = Linux::GetPrimaryMonitorRect(m_env.connection, m_env.screen->root);
-
-    // Check X11 event synchronization support
-    const xcb_query_extension_reply_t* reply = xcb_get_extension_data(m_env.connection, &xcb_sync_id);
-    m_is_sync_supported = reply && reply->present;
 }
 
 AppLin::~AppLin()
 {
     META_FUNCTION_TASK();
+    if (!m_env.connection)
+        return;
+
     if (m_env.window)
     {
         xcb_destroy_window(m_env.connection, m_env.window);
@@ -83,6 +67,12 @@ int AppLin::Run(const RunArgs& args)
         base_return_code)
         return base_return_code;
 
+    if (IsHeadless())
+        return RunHeadless();
+
+    // Connect to X display only in windowed mode, so that headless application runs without X server
+    InitDisplay();
+
     // Init window and show on screen
     const Data::FrameSize init_frame_size = InitWindow();
 
@@ -196,6 +186,9 @@ float AppLin::GetContentScalingFactor() const
 uint32_t AppLin::GetFontResolutionDpi() const
 {
     META_FUNCTION_TASK();
+    if (!m_env.display)
+        return 96U; // default resolution is used in headless mode without X display
+
     if (const char* display_res_str = XResourceManagerString(m_env.display);
         display_res_str)
     {
@@ -222,6 +215,12 @@ void AppLin::Close()
 void AppLin::ShowAlert(const Message& message)
 {
     META_FUNCTION_TASK();
+    if (IsHeadless())
+    {
+        AppBase::ShowAlert(message);
+        return;
+    }
+
     GetMessageBox().Show(message);
     AppBase::ShowAlert(message);
 
@@ -231,6 +230,32 @@ void AppLin::ShowAlert(const Message& message)
     }
 }
 
+void AppLin::InitDisplay()
+{
+    META_FUNCTION_TASK();
+    if (m_env.display)
+        return;
+
+    m_env.display = XOpenDisplay(nullptr);
+    META_CHECK_ARG_NOT_NULL_DESCR(m_env.display, "failed to open X11 display");
+    XSetEventQueueOwner(m_env.display, XCBOwnsEventQueue);
+
+    // Establish connection to X-server
+    m_env.connection = XGetXCBConnection(m_env.display);
+    const int connection_error = xcb_connection_has_error(m_env.connection);
+    META_CHECK_ARG_EQUAL_DESCR(connection_error, 0, "XCB connection to display has failed");
+
+    // Find default screen_id setup
+    const xcb_setup_t*    setup = xcb_get_setup(m_env.connection);
+    xcb_screen_iterator_t screen_iter = xcb_setup_roots_iterator(setup);
+    m_env.screen = screen_iter.data;
+    m_env.primary_screen_rect = Linux::GetPrimaryMonitorRect(m_env.connection, m_env.screen->root);
+
+    // Check X11 event synchronization support
+    const xcb_query_extension_reply_t* reply = xcb_get_extension_data(m_env.connection, &xcb_sync_id);
+    m_is_sync_supported = reply && reply->present;
+}
+
 Data::FrameSize AppLin::InitWindow()
 {
     META_FUNCTION_TASK();
@@ -609,6 +634,7 @@ MessageBox& AppLin::GetMessageBox()
     META_FUNCTION_TASK();
     if (!m_message_box_ptr)
     {
+        InitDisplay();
         m_message_box_ptr = std::make_unique<MessageBox>(m_env);
     }
     return *m_message_box_ptr;
@@ -97,6 +97,9 @@ int AppWin::Run(const RunArgs& args)
         base_return_code)
         return base_return_code;
 
+    if (IsHeadless())
+        return RunHeadless();
+
     // Initialize the window class.
     WNDCLASSEX window_class{};
     window_class.cbSize         = sizeof(WNDCLASSEX);
@@ -478,6 +481,11 @@ LRESULT CALLBACK AppWin::WindowProc(HWND h_wnd, UINT msg_id, WPARAM w_param, LPA
 void AppWin::ShowAlert(const Message& msg)
 {
     META_FUNCTION_TASK();
+    if (IsHeadless())
+    {
+        AppBase::ShowAlert(msg);
+        return;
+    }
 
     MessageBox(
         m_env.window_handle,
@@ -563,6 +571,9 @@ bool AppWin::SetFullScreen(bool is_full_screen)
 float AppWin::GetContentScalingFactor() const
 {
     META_FUNCTION_TASK();
+    if (!m_env.window_handle)
+        return 1.F; // default scaling is used in headless mode without window
+
     DEVICE_SCALE_FACTOR device_scale_factor = DEVICE_SCALE_FACTOR_INVALID;
     HMONITOR monitor_handle = MonitorFromWindow(m_env.window_handle, MONITOR_DEFAULTTONEAREST);
     META_CHECK_ARG_FALSE(FAILED(GetScaleFactorForMonitor(monitor_handle, &device_scale_factor)));
@@ -572,6 +583,9 @@ float AppWin::GetContentScalingFactor() const
 uint32_t AppWin::GetFontResolutionDpi() const
 {
     META_FUNCTION_TASK();
+    if (!m_env.window_handle)
+        return 96U; // default resolution is used in headless mode without window
+
     const HDC window_device_context = GetDC(m_env.window_handle);
     const int dpi_y = GetDeviceCaps(window_device_context, LOGPIXELSY);
     META_CHECK_ARG_GREATER_OR_EQUAL(dpi_y, 1);
@@ -0,0 +1,144 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/AsyncLogger.h
+Asynchronous logger with bounded lock-free multi-producer queue of messages,
+which are written to debug output by the background writer thread.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/ILogger.h>
+
+#include <fmt/format.h>
+
+#include <atomic>
+#include <array>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <string_view>
+
+namespace Methane::Platform
+{
+
+// NOTE: Async logger functions must not be instrumented with META_FUNCTION_TASK
+//       to let them be called from any instrumented code without recursion
+class AsyncLogger final // NOSONAR - custom destructor is required
+    : public ILogger
+{
+public:
+    static constexpr size_t max_message_length = 1024U;
+
+    enum class OverflowPolicy
+    {
+        Drop,  // Message is dropped when queue is full and counted in dropped messages
+        Block, // Logging thread waits until writer thread releases space in queue
+    };
+
+    using Writer = std::function<void(std::string_view message)>;
+
+    struct Settings
+    {
+        size_t         queue_capacity  = 1024U; // rounded up to power of 2
+        OverflowPolicy overflow_policy = OverflowPolicy::Drop;
+        Writer         writer;                  // writes to debug output when empty
+    };
+
+    // Global logger used by META_LOG macro
+    [[nodiscard]] static AsyncLogger& Get();
+
+    AsyncLogger();
+    explicit AsyncLogger(Settings settings);
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+    ~AsyncLogger() override;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    // ILogger interface
+    void Log(std::string_view message) override;
+
+    // Message is formatted on the calling thread directly into the queue slot without memory allocations,
+    // messages longer than max_message_length are truncated
+    template<typename... Args>
+    void LogFormat(fmt::format_string<Args...> format, Args&&... args)
+    {
+        Slot* slot_ptr = AcquireSlot();
+        if (!slot_ptr)
+            return;
+
+        try
+        {
+            const auto result = fmt::format_to_n(slot_ptr->text.data(), slot_ptr->text.size(), format, std::forward<Args>(args)...);
+            slot_ptr->length = std::min(result.size, slot_ptr->text.size());
+        }
+        catch(...)
+        {
+            // Acquired slot is released with empty message to let writer thread move past it
+            slot_ptr->length = 0U;
+            ReleaseSlot(*slot_ptr);
+            throw;
+        }
+        ReleaseSlot(*slot_ptr);
+    }
+
+    // Blocks until all messages logged before this call are written
+    void Flush();
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept             { return m_settings; }
+    [[nodiscard]] size_t          GetQueueCapacity() const noexcept        { return m_slots_mask + 1U; }
+    [[nodiscard]] size_t          GetWrittenMessagesCount() const noexcept { return m_dequeue_position; }
+    [[nodiscard]] size_t          GetDroppedMessagesCount() const noexcept { return m_dropped_count; }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t>                  sequence{ 0U };
+        size_t                               position = 0U;
+        size_t                               length   = 0U;
+        std::array<char, max_message_length> text{ };
+    };
+
+    Slot* AcquireSlot();
+    void  ReleaseSlot(Slot& slot) noexcept;
+    bool  HasNextMessage() const noexcept;
+    bool  WriteNextMessage();
+    void  WriterThreadLoop();
+
+    Settings                 m_settings;
+    size_t                   m_slots_mask;
+    std::unique_ptr<Slot[]>  m_slots;
+
+    // Producer and consumer positions are placed in separate cache lines to avoid false sharing
+    alignas(64) std::atomic<size_t> m_enqueue_position{ 0U };
+    alignas(64) std::atomic<size_t> m_dequeue_position{ 0U };
+    alignas(64) std::atomic<size_t> m_dropped_count{ 0U };
+    std::atomic<bool>               m_is_writer_waiting{ false };
+    std::atomic<bool>               m_is_stopping{ false };
+    std::mutex                      m_writer_mutex;
+    std::condition_variable         m_writer_condition;
+    std::thread                     m_writer_thread;
+};
+
+} // namespace Methane::Platform
@@ -0,0 +1,199 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/AsyncLogger.cpp
+Asynchronous logger with bounded lock-free multi-producer queue of messages,
+which are written to debug output by the background writer thread.
+
+******************************************************************************/
+
+#include <Methane/Platform/AsyncLogger.h>
+#include <Methane/Platform/Utils.h>
+#include <Methane/Instrumentation.h>
+
+#include <chrono>
+#include <cstring>
+
+namespace Methane::Platform
+{
+
+static constexpr std::chrono::milliseconds g_writer_wait_timeout(10);
+
+[[nodiscard]]
+static size_t GetPowerOfTwoCapacity(size_t capacity) noexcept
+{
+    size_t power_of_two_capacity = 2U;
+    while (power_of_two_capacity < capacity)
+        power_of_two_capacity *= 2U;
+    return power_of_two_capacity;
+}
+
+AsyncLogger& AsyncLogger::Get()
+{
+    static AsyncLogger s_async_logger;
+    return s_async_logger;
+}
+
+AsyncLogger::AsyncLogger()
+    : AsyncLogger(Settings{})
+{ }
+
+AsyncLogger::AsyncLogger(Settings settings)
+    : m_settings(std::move(settings))
+    , m_slots_mask(GetPowerOfTwoCapacity(m_settings.queue_capacity) - 1U)
+    , m_slots(std::make_unique<Slot[]>(m_slots_mask + 1U))
+{
+    if (!m_settings.writer)
+        m_settings.writer = &PrintToDebugOutput;
+
+    // Slot sequence is equal to its position when it is free for writing in the current queue cycle
+    for(size_t slot_index = 0U; slot_index <= m_slots_mask; ++slot_index)
+    {
+        m_slots[slot_index].sequence.store(slot_index, std::memory_order_relaxed);
+    }
+
+    m_writer_thread = std::thread([this]()
+    {
+        META_THREAD_NAME("Log Writer");
+        WriterThreadLoop();
+    });
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    m_is_stopping = true;
+    m_writer_condition.notify_one();
+    m_writer_thread.join();
+}
+
+void AsyncLogger::Log(std::string_view message)
+{
+    Slot* slot_ptr = AcquireSlot();
+    if (!slot_ptr)
+        return;
+
+    slot_ptr->length = std::min(message.size(), slot_ptr->text.size());
+    std::memcpy(slot_ptr->text.data(), message.data(), slot_ptr->length);
+    ReleaseSlot(*slot_ptr);
+}
+
+void AsyncLogger::Flush()
+{
+    const size_t flush_position = m_enqueue_position.load(std::memory_order_acquire);
+    while (m_dequeue_position.load(std::memory_order_acquire) < flush_position)
+    {
+        m_writer_condition.notify_one();
+        std::this_thread::yield();
+    }
+}
+
+AsyncLogger::Slot* AsyncLogger::AcquireSlot()
+{
+    size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Slot& slot = m_slots[position & m_slots_mask];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto sequence_diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (sequence_diff == 0)
+        {
+            // Slot is free: try to take it by advancing enqueue position
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+            {
+                slot.position = position;
+                return &slot;
+            }
+        }
+        else if (sequence_diff < 0)
+        {
+            // Slot still holds the message from the previous queue cycle, so the queue is full
+            if (m_settings.overflow_policy == OverflowPolicy::Drop)
+            {
+                m_dropped_count.fetch_add(1U, std::memory_order_relaxed);
+                return nullptr;
+            }
+            m_writer_condition.notify_one();
+            std::this_thread::yield();
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // Slot was taken by another producer
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void AsyncLogger::ReleaseSlot(Slot& slot) noexcept
+{
+    slot.sequence.store(slot.position + 1U, std::memory_order_release);
+
+    // Writer may miss this notification without holding mutex, but then it wakes up by timeout
+    if (m_is_writer_waiting.load(std::memory_order_acquire))
+        m_writer_condition.notify_one();
+}
+
+bool AsyncLogger::HasNextMessage() const noexcept
+{
+    const size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    return m_slots[position & m_slots_mask].sequence.load(std::memory_order_acquire) == position + 1U;
+}
+
+bool AsyncLogger::WriteNextMessage()
+{
+    // Dequeue position is modified by the single writer thread only
+    const size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    Slot& slot = m_slots[position & m_slots_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1U)
+        return false;
+
+    m_settings.writer(std::string_view(slot.text.data(), slot.length));
+
+    slot.sequence.store(position + m_slots_mask + 1U, std::memory_order_release);
+    m_dequeue_position.store(position + 1U, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::WriterThreadLoop()
+{
+    size_t reported_dropped_count = 0U;
+    while (true)
+    {
+        while (WriteNextMessage())
+        {
+            // Write all available messages
+        }
+
+        if (const size_t dropped_count = m_dropped_count.load(std::memory_order_relaxed);
+            dropped_count > reported_dropped_count)
+        {
+            m_settings.writer(fmt::format("WARNING: {} log messages were dropped on queue overflow", dropped_count - reported_dropped_count));
+            reported_dropped_count = dropped_count;
+        }
+
+        if (m_is_stopping && !HasNextMessage())
+            break;
+
+        std::unique_lock lock(m_writer_mutex);
+        m_is_writer_waiting.store(true, std::memory_order_release);
+        m_writer_condition.wait_for(lock, g_writer_wait_timeout, [this]() { return m_is_stopping || HasNextMessage(); });
+        m_is_writer_waiting.store(false, std::memory_order_release);
+    }
+}
+
+} // namespace Methane::Platform
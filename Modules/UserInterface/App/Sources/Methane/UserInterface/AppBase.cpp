@@ -145,6 +145,7 @@ bool AppBase::ResizeUI(const gfx::FrameSize& frame_size, bool)
 bool AppBase::UpdateUI() const
 {
     META_FUNCTION_TASK();
+    META_ALLOCATION_TAG_SCOPE("UI");
     if (m_hud_ptr && m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
         m_hud_ptr->Update(m_frame_size);
 
@@ -157,6 +158,7 @@ bool AppBase::UpdateUI() const
 void AppBase::RenderOverlay(const rhi::RenderCommandList& cmd_list) const
 {
     META_FUNCTION_TASK();
+    META_ALLOCATION_TAG_SCOPE("UI");
     META_DEBUG_GROUP_VAR(s_debug_group, "Overlay Rendering");
 
     if (m_hud_ptr && m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
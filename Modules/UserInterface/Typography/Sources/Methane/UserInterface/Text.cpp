@@ -49,6 +49,7 @@ Methane text rendering primitive.
 #include <Methane/Checks.hpp>
 #include <Methane/Pimpl.hpp>
 #include <memory>
+#include <algorithm>
 
 namespace hlslpp // NOSONAR
 {
@@ -82,7 +83,8 @@ private:
     DirtyResourceMask    m_dirty_mask{ ~0U };
     rhi::BufferSet       m_vertex_buffer_set;
     rhi::Buffer          m_index_buffer;
-    rhi::Buffer          m_uniforms_buffer;
+    hlslpp::TextUniforms m_uniforms{};
+    rhi::ContextDynamicConstants m_uniforms_constants; // uniforms location bound to program bindings
     rhi::Texture         m_atlas_texture;
     rhi::ProgramBindings m_program_bindings;
 
@@ -221,40 +223,47 @@ public:
         m_dirty_mask.SetBitOff(DirtyResource::Mesh);
     }
 
-    void UpdateUniformsBuffer(const rhi::RenderContext& render_context, const TextMesh& text_mesh, std::string_view text_name)
+    void UpdateUniforms(const TextMesh& text_mesh)
     {
         META_FUNCTION_TASK();
 
         const gfx::FrameSize& content_size = text_mesh.GetContentSize();
-        META_CHECK_ARG_NOT_ZERO_DESCR(content_size, "text uniforms buffer can not be updated when one of content size dimensions is zero");
+        META_CHECK_ARG_NOT_ZERO_DESCR(content_size, "text uniforms can not be updated when one of content size dimensions is zero");
 
-        hlslpp::TextUniforms uniforms{
+        m_uniforms = hlslpp::TextUniforms{
             hlslpp::mul(
                 hlslpp::float4x4::scale(2.F / static_cast<float>(content_size.GetWidth()),
                                         2.F / static_cast<float>(content_size.GetHeight()),
                                         1.F),
                 hlslpp::float4x4::translation(-1.F, 1.F, 0.F))
         };
+        m_dirty_mask.SetBitOff(DirtyResource::Uniforms);
+    }
 
-        const auto uniforms_data_size = static_cast<Data::Size>(sizeof(uniforms));
+    // Uniforms are written to dynamic constants of the current frame on every draw,
+    // program bindings are updated only when constants are allocated at different location
+    void WriteUniforms(const rhi::RenderContext& render_context)
+    {
+        META_FUNCTION_TASK();
+        const auto uniforms_data_size = static_cast<Data::Size>(sizeof(m_uniforms));
+        const rhi::RenderContext::DynamicConstants uniforms_constants = render_context.AllocateDynamicConstants(uniforms_data_size);
+        std::copy_n(reinterpret_cast<Data::ConstRawPtr>(&m_uniforms), uniforms_data_size, uniforms_constants.data_ptr); // NOSONAR
 
-        if (!m_uniforms_buffer.IsInitialized())
-        {
-            m_uniforms_buffer = render_context.CreateBuffer(rhi::BufferSettings::ForConstantBuffer(uniforms_data_size));
-            m_uniforms_buffer.SetName(fmt::format("{} Text Uniforms Buffer {}", text_name, m_frame_index));
+        if (m_uniforms_constants.buffer_ptr == uniforms_constants.buffer_ptr &&
+            m_uniforms_constants.offset == uniforms_constants.offset)
+            return;
 
-            if (m_program_bindings.IsInitialized())
-            {
-                m_program_bindings.Get({ rhi::ShaderType::Vertex, "g_uniforms" }).SetResourceViews({ { m_uniforms_buffer.GetInterface() } });
-            }
+        m_uniforms_constants = uniforms_constants;
+        if (m_program_bindings.IsInitialized())
+        {
+            m_program_bindings.Get({ rhi::ShaderType::Vertex, "g_uniforms" }).SetResourceViews({
+                { *m_uniforms_constants.buffer_ptr, m_uniforms_constants.offset, m_uniforms_constants.size }
+            });
         }
-        m_uniforms_buffer.SetData(render_context.GetRenderCommandKit().GetQueue(),
-                                  { reinterpret_cast<Data::ConstRawPtr>(&uniforms), uniforms_data_size }); // NOSONAR
-        m_dirty_mask.SetBitOff(DirtyResource::Uniforms);
     }
 
-    void InitializeProgramBindings(const rhi::RenderState& state, const rhi::Buffer& const_buffer,
-                                   const rhi::Sampler& atlas_sampler, std::string_view text_name)
+    void InitializeProgramBindings(const rhi::RenderContext& render_context, const rhi::RenderState& state,
+                                   const rhi::Buffer& const_buffer, const rhi::Sampler& atlas_sampler, std::string_view text_name)
     {
         META_FUNCTION_TASK();
         if (m_program_bindings.IsInitialized())
@@ -263,10 +272,14 @@ public:
         META_CHECK_ARG_TRUE(const_buffer.IsInitialized());
         META_CHECK_ARG_TRUE(atlas_sampler.IsInitialized());
         META_CHECK_ARG_TRUE(m_atlas_texture.IsInitialized());
-        META_CHECK_ARG_TRUE(m_uniforms_buffer.IsInitialized());
+
+        if (!m_uniforms_constants.buffer_ptr)
+        {
+            WriteUniforms(render_context);
+        }
 
         m_program_bindings = state.GetProgram().CreateBindings({
-            { { rhi::ShaderType::Vertex, "g_uniforms" },  { { m_uniforms_buffer.GetInterface() } } },
+            { { rhi::ShaderType::Vertex, "g_uniforms" },  { { *m_uniforms_constants.buffer_ptr, m_uniforms_constants.offset, m_uniforms_constants.size } } },
             { { rhi::ShaderType::Pixel,  "g_constants" }, { { const_buffer.GetInterface() } } },
             { { rhi::ShaderType::Pixel,  "g_texture" },   { { m_atlas_texture.GetInterface() } } },
             { { rhi::ShaderType::Pixel,  "g_sampler" },   { { atlas_sampler.GetInterface() } } },
@@ -340,7 +353,7 @@ public:
                         },
                         rhi::ProgramArgumentAccessors
                         {
-                            { { rhi::ShaderType::Vertex, "g_uniforms" },  rhi::ProgramArgumentAccessor::Type::Mutable },
+                            { { rhi::ShaderType::Vertex, "g_uniforms" },  rhi::ProgramArgumentAccessor::Type::Mutable, true },
                             { { rhi::ShaderType::Pixel,  "g_constants" }, rhi::ProgramArgumentAccessor::Type::Mutable },
                             { { rhi::ShaderType::Pixel,  "g_texture" },   rhi::ProgramArgumentAccessor::Type::Mutable },
                             { { rhi::ShaderType::Pixel,  "g_sampler" },   rhi::ProgramArgumentAccessor::Type::Constant },
@@ -582,11 +595,11 @@ public:
         }
         if (frame_resources.IsDirty(FrameResources::DirtyResource::Uniforms) && m_text_mesh_ptr)
         {
-            frame_resources.UpdateUniformsBuffer(m_ui_context.GetRenderContext(), *m_text_mesh_ptr, m_settings.name);
+            frame_resources.UpdateUniforms(*m_text_mesh_ptr);
         }
         if (m_render_state.IsInitialized())
         {
-            frame_resources.InitializeProgramBindings(m_render_state, m_const_buffer, m_atlas_sampler, m_settings.name);
+            frame_resources.InitializeProgramBindings(m_ui_context.GetRenderContext(), m_render_state, m_const_buffer, m_atlas_sampler, m_settings.name);
         }
         assert(!frame_resources.IsDirty() || !m_text_mesh_ptr);
     }
@@ -597,10 +610,11 @@ public:
         if (m_frame_resources.empty())
             return;
 
-        const FrameResources& frame_resources = GetCurrentFrameResources();
+        FrameResources& frame_resources = GetCurrentFrameResources();
         if (!frame_resources.IsInitialized())
             return;
 
+        frame_resources.WriteUniforms(m_ui_context.GetRenderContext());
         cmd_list.ResetWithStateOnce(m_render_state, debug_group_ptr);
         cmd_list.SetViewState(m_view_state);
         cmd_list.SetProgramBindings(frame_resources.GetProgramBindings());
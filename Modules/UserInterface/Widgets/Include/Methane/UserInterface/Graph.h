@@ -0,0 +1,101 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/Graph.h
+Graph widget rendering rolling plots of sample series with line strips
+from a single dynamic vertex buffer per frame buffer.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/UserInterface/Item.h>
+#include <Methane/UserInterface/Context.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Data/Vector.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+
+class RenderCommandList;
+class CommandListDebugGroup;
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::UserInterface
+{
+
+class Graph final
+    : public Item
+{
+public:
+    struct Settings
+    {
+        std::string          name;
+        uint32_t             samples_count = 240U;
+        float                max_value     = 1.F;
+        std::vector<Color4F> series_colors { Color4F(1.F, 1.F, 1.F, 1.F) };
+    };
+
+    Graph(Context& ui_context, const UnitRect& ui_rect, Settings settings);
+
+    const Settings& GetGraphSettings() const noexcept { return m_settings; }
+    uint32_t        GetSeriesCount() const noexcept   { return static_cast<uint32_t>(m_settings.series_colors.size()); }
+    float           GetLastSample(uint32_t series_index) const;
+
+    void SetMaxValue(float max_value);
+
+    // Adds sample to the rolling series window replacing the oldest sample without memory allocations
+    void AddSample(uint32_t series_index, float value);
+
+    void Update(const FrameSize& render_attachment_size);
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
+
+    // Item overrides
+    bool SetRect(const UnitRect& ui_rect) override;
+
+private:
+    struct Vertex
+    {
+        Data::RawVector2F position;
+        Data::RawVector4F color;
+    };
+
+    using Vertices = std::vector<Vertex>;
+    using Samples  = std::vector<float>;
+
+    void UpdateVertices();
+    const rhi::BufferSet& GetFrameVertexBufferSet(uint32_t frame_index) const;
+    void CreateFrameVertexBufferSets(uint32_t frame_buffers_count);
+
+    Settings                    m_settings;
+    Samples                     m_samples; // ring buffers of samples series placed one after another
+    std::vector<uint32_t>       m_series_begin_indices;
+    Vertices                    m_vertices;
+    rhi::RenderState            m_render_state;
+    rhi::ViewState              m_view_state;
+    std::vector<rhi::BufferSet> m_frame_vertex_buffer_sets;
+    bool                        m_is_viewport_dirty = true;
+};
+
+} // namespace Methane::UserInterface
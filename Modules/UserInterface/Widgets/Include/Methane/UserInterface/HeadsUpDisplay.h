@@ -25,6 +25,7 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
 
 #include <Methane/UserInterface/Panel.h>
 #include <Methane/UserInterface/TextItem.h>
+#include <Methane/UserInterface/Graph.h>
 #include <Methane/UserInterface/FontLibrary.h>
 #include <Methane/Graphics/Color.hpp>
 #include <Methane/Platform/Input/Keyboard.h>
@@ -55,6 +56,14 @@ public:
         Color4F              background_color    { 0.F,  0.F,  0.F,  0.66F };
         pin::Keyboard::State help_shortcut       { pin::Keyboard::Key::F1 };
         double               update_interval_sec = 0.33;
+        bool                 frame_graph_enabled = true;
+        uint32_t             frame_graph_samples_count = 240U;
+        uint32_t             frame_graph_height  = 48U; // in dots
+        double               frame_graph_max_time_msec = 1000.0 / 30.0;
+        Color4F              frame_time_graph_color { 0.3F, 1.F,  0.3F, 1.F };
+        Color4F              cpu_time_graph_color   { 1.F,  1.F,  0.F,  1.F };
+        Color4F              gpu_time_graph_color   { 0.3F, 0.6F, 1.F,  1.F };
+        uint32_t             gpu_time_graphs_count = 0U; // one GPU time graph per command queue
 
         Settings& SetMajorFont(const Font::Description& new_major_font) noexcept;
         Settings& SetMinorFont(const Font::Description& new_minor_font) noexcept;
@@ -67,6 +76,10 @@ public:
         Settings& SetBackgroundColor(const Color4F& new_background_color) noexcept;
         Settings& SetHelpShortcut(const pin::Keyboard::State& new_help_shortcut) noexcept;
         Settings& SetUpdateIntervalSec(double new_update_interval_sec) noexcept;
+        Settings& SetFrameGraphEnabled(bool new_frame_graph_enabled) noexcept;
+        Settings& SetFrameGraphSamplesCount(uint32_t new_frame_graph_samples_count) noexcept;
+        Settings& SetFrameGraphMaxTimeMSec(double new_frame_graph_max_time_msec) noexcept;
+        Settings& SetGpuTimeGraphsCount(uint32_t new_gpu_time_graphs_count) noexcept;
     };
 
     HeadsUpDisplay(Context& ui_context, const FontContext& font_context, const Settings& settings);
@@ -76,6 +89,9 @@ public:
     void SetTextColor(const Color4F& text_color);
     void SetUpdateInterval(double update_interval_sec);
 
+    // GPU time of the command queue is shown on the frame graph, when GPU time graphs are enabled in settings
+    void SetGpuTime(uint32_t gpu_time_graph_index, double gpu_time_msec);
+
     void Update(const FrameSize& render_attachment_size);
     void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const override;
 
@@ -98,11 +114,14 @@ private:
 
     void LayoutTextBlocks();
     void UpdateAllTextBlocks(const FrameSize& render_attachment_size) const;
+    void UpdateFrameGraph(const FrameSize& render_attachment_size);
 
     Settings           m_settings;
     const Font         m_major_font;
     const Font         m_minor_font;
     const TextItemPtrs m_text_blocks;
+    Ptr<Graph>         m_frame_graph_ptr;
+    std::vector<float> m_gpu_times_msec;
     Timer              m_update_timer;
 };
 
@@ -24,4 +24,5 @@ Methane user interface widgets headers.
 #pragma once
 
 #include "Badge.h"
+#include "Graph.h"
 #include "HeadsUpDisplay.h"
\ No newline at end of file
@@ -0,0 +1,47 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: MethaneKit/Modules/UserInterface/Widgets/Shaders/Graph.hlsl
+Shaders for graph lines rendering from normalized vertex positions in graph viewport
+
+******************************************************************************/
+
+struct VSInput
+{
+    float2 position : POSITION;
+    float4 color    : COLOR;
+};
+
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float4 color    : COLOR;
+};
+
+PSInput GraphVS(VSInput input)
+{
+    PSInput output;
+    output.position = float4(input.position * 2.F - 1.F, 0.F, 1.F);
+    output.color    = input.color;
+    return output;
+}
+
+float4 GraphPS(PSInput input) : SV_TARGET
+{
+    return input.color;
+}
@@ -0,0 +1,237 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/Graph.cpp
+Graph widget rendering rolling plots of sample series with line strips
+from a single dynamic vertex buffer per frame buffer.
+
+******************************************************************************/
+
+#include <Methane/UserInterface/Graph.h>
+#include <Methane/UserInterface/Context.h>
+
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Data/AppResourceProviders.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace Methane::UserInterface
+{
+
+static const std::string g_graph_state_name = "Graph Render State";
+
+Graph::Graph(Context& ui_context, const UnitRect& ui_rect, Settings settings)
+    : Item(ui_context, ui_rect)
+    , m_settings(std::move(settings))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_settings.samples_count, 2U, "graph should have at least 2 samples");
+    META_CHECK_ARG_NOT_EMPTY_DESCR(m_settings.series_colors, "graph should have at least one series");
+    META_CHECK_ARG_GREATER(m_settings.max_value, 0.F);
+
+    // All memory is allocated once on construction and reused for every frame update
+    m_samples.resize(static_cast<size_t>(GetSeriesCount()) * m_settings.samples_count, 0.F);
+    m_series_begin_indices.resize(GetSeriesCount(), 0U);
+    m_vertices.resize(m_samples.size());
+
+    const rhi::RenderContext& render_context = ui_context.GetRenderContext();
+    const rhi::RenderPattern& render_pattern = ui_context.GetRenderPattern();
+    rhi::IObjectRegistry& gfx_objects_registry = render_context.GetObjectRegistry();
+    if (const auto render_state_ptr = std::dynamic_pointer_cast<rhi::IRenderState>(gfx_objects_registry.GetGraphicsObject(g_graph_state_name));
+        render_state_ptr)
+    {
+        m_render_state = rhi::RenderState(render_state_ptr);
+    }
+    else
+    {
+        rhi::RenderState::Settings state_settings
+        {
+            rhi::Program(
+                render_context,
+                rhi::Program::Settings
+                {
+                    rhi::Program::ShaderSet
+                    {
+                        { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Graph", "GraphVS" }, {} } },
+                        { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Graph", "GraphPS" }, {} } },
+                    },
+                    rhi::ProgramInputBufferLayouts
+                    {
+                        rhi::Program::InputBufferLayout
+                        {
+                            rhi::Program::InputBufferLayout::ArgumentSemantics{ "POSITION", "COLOR" }
+                        }
+                    },
+                    rhi::ProgramArgumentAccessors{ },
+                    render_pattern.GetAttachmentFormats()
+                }),
+            render_pattern
+        };
+        state_settings.program.SetName("Graph Shading");
+        state_settings.depth.enabled                                        = false;
+        state_settings.depth.write_enabled                                  = false;
+        state_settings.blending.render_targets[0].blend_enabled             = true;
+        state_settings.blending.render_targets[0].source_rgb_blend_factor   = rhi::IRenderState::Blending::Factor::SourceAlpha;
+        state_settings.blending.render_targets[0].dest_rgb_blend_factor     = rhi::IRenderState::Blending::Factor::OneMinusSourceAlpha;
+        state_settings.blending.render_targets[0].source_alpha_blend_factor = rhi::IRenderState::Blending::Factor::Zero;
+        state_settings.blending.render_targets[0].dest_alpha_blend_factor   = rhi::IRenderState::Blending::Factor::Zero;
+
+        m_render_state = render_context.CreateRenderState(state_settings);
+        m_render_state.SetName(g_graph_state_name);
+
+        gfx_objects_registry.AddGraphicsObject(m_render_state.GetInterface());
+    }
+
+    const FrameRect graph_rect = GetRectInPixels().AsBase();
+    m_view_state = rhi::ViewState({
+        { gfx::GetFrameViewport(graph_rect) },
+        { gfx::GetFrameScissorRect(graph_rect) }
+    });
+
+    CreateFrameVertexBufferSets(render_context.GetSettings().frame_buffers_count);
+}
+
+float Graph::GetLastSample(uint32_t series_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(series_index, GetSeriesCount());
+    const uint32_t last_sample_index = (m_series_begin_indices[series_index] + m_settings.samples_count - 1U) % m_settings.samples_count;
+    return m_samples[series_index * m_settings.samples_count + last_sample_index];
+}
+
+void Graph::SetMaxValue(float max_value)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER(max_value, 0.F);
+    m_settings.max_value = max_value;
+}
+
+void Graph::AddSample(uint32_t series_index, float value)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(series_index, GetSeriesCount());
+    uint32_t& series_begin_index = m_series_begin_indices[series_index];
+    m_samples[series_index * m_settings.samples_count + series_begin_index] = value;
+    series_begin_index = (series_begin_index + 1U) % m_settings.samples_count;
+}
+
+void Graph::Update(const FrameSize& render_attachment_size)
+{
+    META_FUNCTION_TASK();
+    if (m_is_viewport_dirty)
+    {
+        const FrameRect graph_rect = GetRectInPixels().AsBase();
+        m_view_state.SetViewports({ gfx::GetFrameViewport(graph_rect) });
+        m_view_state.SetScissorRects({ gfx::GetFrameScissorRect(graph_rect, render_attachment_size) });
+        m_is_viewport_dirty = false;
+    }
+
+    UpdateVertices();
+
+    const rhi::RenderContext& render_context = GetUIContext().GetRenderContext();
+    const uint32_t frame_index = render_context.GetFrameBufferIndex();
+    if (frame_index >= m_frame_vertex_buffer_sets.size())
+    {
+        CreateFrameVertexBufferSets(render_context.GetSettings().frame_buffers_count);
+    }
+
+    GetFrameVertexBufferSet(frame_index)[0].SetData(render_context.GetRenderCommandKit().GetQueue(), {
+        reinterpret_cast<Data::ConstRawPtr>(m_vertices.data()), // NOSONAR
+        static_cast<Data::Size>(m_vertices.size() * sizeof(Vertex))
+    });
+}
+
+void Graph::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const
+{
+    META_FUNCTION_TASK();
+    cmd_list.ResetWithStateOnce(m_render_state, debug_group_ptr);
+    cmd_list.SetViewState(m_view_state);
+    cmd_list.SetVertexBuffers(GetFrameVertexBufferSet(GetUIContext().GetRenderContext().GetFrameBufferIndex()));
+
+    // Each series is drawn with a separate line strip from the same vertex buffer
+    for(uint32_t series_index = 0U; series_index < GetSeriesCount(); ++series_index)
+    {
+        cmd_list.Draw(rhi::RenderPrimitive::LineStrip, m_settings.samples_count, series_index * m_settings.samples_count);
+    }
+}
+
+bool Graph::SetRect(const UnitRect& ui_rect)
+{
+    META_FUNCTION_TASK();
+    if (!Item::SetRect(ui_rect))
+        return false;
+
+    m_is_viewport_dirty = true;
+    return true;
+}
+
+void Graph::UpdateVertices()
+{
+    META_FUNCTION_TASK();
+    // Samples are laid out from the oldest on the left to the newest on the right side of the graph
+    const float x_step = 1.F / static_cast<float>(m_settings.samples_count - 1U);
+    for(uint32_t series_index = 0U; series_index < GetSeriesCount(); ++series_index)
+    {
+        const Color4F&   series_color  = m_settings.series_colors[series_index];
+        const uint32_t   series_offset = series_index * m_settings.samples_count;
+        const uint32_t   begin_index   = m_series_begin_indices[series_index];
+        const Data::RawVector4F color{ series_color.GetRed(), series_color.GetGreen(), series_color.GetBlue(), series_color.GetAlpha() };
+        for(uint32_t sample_index = 0U; sample_index < m_settings.samples_count; ++sample_index)
+        {
+            const float sample = m_samples[series_offset + (begin_index + sample_index) % m_settings.samples_count];
+            Vertex& vertex = m_vertices[series_offset + sample_index];
+            vertex.position = Data::RawVector2F{ x_step * static_cast<float>(sample_index), std::clamp(sample / m_settings.max_value, 0.F, 1.F) };
+            vertex.color    = color;
+        }
+    }
+}
+
+const rhi::BufferSet& Graph::GetFrameVertexBufferSet(uint32_t frame_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS_DESCR(frame_index, m_frame_vertex_buffer_sets.size(), "no graph vertex buffer available for the current frame buffer index");
+    return m_frame_vertex_buffer_sets[frame_index];
+}
+
+void Graph::CreateFrameVertexBufferSets(uint32_t frame_buffers_count)
+{
+    META_FUNCTION_TASK();
+    // Volatile vertex buffers are mapped to CPU memory, so they are updated without upload command lists
+    const rhi::RenderContext& render_context = GetUIContext().GetRenderContext();
+    const auto vertex_buffer_size = static_cast<Data::Size>(m_vertices.size() * sizeof(Vertex));
+    m_frame_vertex_buffer_sets.clear();
+    m_frame_vertex_buffer_sets.reserve(frame_buffers_count);
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        rhi::Buffer vertex_buffer = render_context.CreateBuffer(
+            rhi::BufferSettings::ForVertexBuffer(vertex_buffer_size, static_cast<Data::Size>(sizeof(Vertex)), true));
+        vertex_buffer.SetName(fmt::format("{} Graph Vertex Buffer {}", m_settings.name, frame_index));
+        m_frame_vertex_buffer_sets.push_back(rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer }));
+    }
+}
+
+} // namespace Methane::UserInterface
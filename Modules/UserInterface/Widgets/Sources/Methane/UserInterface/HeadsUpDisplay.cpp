@@ -26,6 +26,8 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
  | CPU Time %    |                                |
  |-------------- |--------------------------------|
  | VSync ON/OFF  | W x H       N FB      GFX API  |
+ |------------------------------------------------|
+ | Frame, CPU and GPU time graphs                 |
  --------------------------------------------------
 
 ******************************************************************************/
@@ -141,6 +143,56 @@ HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetUpdateIntervalSec(double
     return *this;
 }
 
+HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetFrameGraphEnabled(bool new_frame_graph_enabled) noexcept
+{
+    META_FUNCTION_TASK();
+    frame_graph_enabled = new_frame_graph_enabled;
+    return *this;
+}
+
+HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetFrameGraphSamplesCount(uint32_t new_frame_graph_samples_count) noexcept
+{
+    META_FUNCTION_TASK();
+    frame_graph_samples_count = new_frame_graph_samples_count;
+    return *this;
+}
+
+HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetFrameGraphMaxTimeMSec(double new_frame_graph_max_time_msec) noexcept
+{
+    META_FUNCTION_TASK();
+    frame_graph_max_time_msec = new_frame_graph_max_time_msec;
+    return *this;
+}
+
+HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetGpuTimeGraphsCount(uint32_t new_gpu_time_graphs_count) noexcept
+{
+    META_FUNCTION_TASK();
+    gpu_time_graphs_count = new_gpu_time_graphs_count;
+    return *this;
+}
+
+[[nodiscard]]
+static Graph::Settings GetFrameGraphSettings(const HeadsUpDisplay::Settings& hud_settings)
+{
+    META_FUNCTION_TASK();
+    Graph::Settings graph_settings{
+        "Frame Timings",
+        hud_settings.frame_graph_samples_count,
+        static_cast<float>(hud_settings.frame_graph_max_time_msec),
+        { hud_settings.frame_time_graph_color, hud_settings.cpu_time_graph_color }
+    };
+
+    // GPU time graphs of multiple command queues are distinguished by fading color
+    for(uint32_t gpu_graph_index = 0U; gpu_graph_index < hud_settings.gpu_time_graphs_count; ++gpu_graph_index)
+    {
+        const float color_scale = 1.F - 0.5F * static_cast<float>(gpu_graph_index) / static_cast<float>(hud_settings.gpu_time_graphs_count);
+        const Color4F& gpu_color = hud_settings.gpu_time_graph_color;
+        graph_settings.series_colors.emplace_back(gpu_color.GetRed() * color_scale, gpu_color.GetGreen() * color_scale,
+                                                  gpu_color.GetBlue() * color_scale, gpu_color.GetAlpha());
+    }
+    return graph_settings;
+}
+
 HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const FontContext& font_context, const Settings& settings)
     : Panel(ui_context, { }, { "Heads Up Display" })
     , m_settings(settings)
@@ -242,6 +294,15 @@ HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const FontContext& font_cont
         AddChild(*text_item_ptr); // NOSONAR - method is not overridable in final class
     }
 
+    if (m_settings.frame_graph_enabled)
+    {
+        m_frame_graph_ptr = std::make_shared<Graph>(ui_context,
+            UnitRect{ Units::Dots, gfx::Point2I{ }, gfx::FrameSize{ 1U, m_settings.frame_graph_height } },
+            GetFrameGraphSettings(m_settings));
+        m_gpu_times_msec.resize(m_settings.gpu_time_graphs_count, 0.F);
+        AddChild(*m_frame_graph_ptr); // NOSONAR - method is not overridable in final class
+    }
+
     // Reset timer behind so that HUD is filled with actual values on first update
     m_update_timer.ResetToSeconds(m_settings.update_interval_sec);
 }
@@ -266,9 +327,18 @@ void HeadsUpDisplay::SetUpdateInterval(double update_interval_sec)
     m_settings.update_interval_sec = update_interval_sec;
 }
 
+void HeadsUpDisplay::SetGpuTime(uint32_t gpu_time_graph_index, double gpu_time_msec)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(gpu_time_graph_index, m_gpu_times_msec.size());
+    m_gpu_times_msec[gpu_time_graph_index] = static_cast<float>(gpu_time_msec);
+}
+
 void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
 {
     META_FUNCTION_TASK();
+    UpdateFrameGraph(render_attachment_size);
+
     if (m_update_timer.GetElapsedSecondsD() < m_settings.update_interval_sec)
     {
         UpdateAllTextBlocks(render_attachment_size);
@@ -304,6 +374,11 @@ void HeadsUpDisplay::Draw(const rhi::RenderCommandList& cmd_list, const rhi::Com
     {
         text_ptr->Draw(cmd_list, debug_group_ptr);
     }
+
+    if (m_frame_graph_ptr)
+    {
+        m_frame_graph_ptr->Draw(cmd_list, debug_group_ptr);
+    }
 }
 
 TextItem& HeadsUpDisplay::GetTextBlock(TextBlock block) const
@@ -356,15 +431,32 @@ void HeadsUpDisplay::LayoutTextBlocks()
     position.SetY(position.GetY() + gpu_name_size.GetHeight() + text_margins_in_dots.GetHeight());
     GetTextBlock(TextBlock::Fps).SetRelOrigin(position);
 
+    const gfx::FrameSize text_blocks_size(
+        right_bottom_position.GetX() + right_column_width + text_margins_in_dots.GetWidth(),
+        right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight()
+    );
+
+    if (!m_frame_graph_ptr)
+    {
+        Panel::SetRect(UnitRect{ Units::Dots, m_settings.position, text_blocks_size });
+        return;
+    }
+
+    // Layout frame graph below text blocks across the whole panel width
+    const UnitSize graph_size(Units::Dots, text_blocks_size.GetWidth() - 2 * text_margins_in_dots.GetWidth(), m_settings.frame_graph_height);
+    m_frame_graph_ptr->SetRelOrigin(UnitPoint(Units::Dots, text_margins_in_dots.GetWidth(), text_blocks_size.GetHeight()));
+    m_frame_graph_ptr->SetSize(graph_size);
+
     Panel::SetRect(UnitRect{
         Units::Dots,
         m_settings.position,
         gfx::FrameSize
         {
-            right_bottom_position.GetX() + right_column_width + text_margins_in_dots.GetWidth(),
-            right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight()
+            text_blocks_size.GetWidth(),
+            text_blocks_size.GetHeight() + graph_size.GetHeight() + text_margins_in_dots.GetHeight()
         }
     });
+    m_frame_graph_ptr->SetOrigin(GetRectInPixels().GetUnitOrigin() + m_frame_graph_ptr->GetRelOriginInPixels());
 }
 
 void HeadsUpDisplay::UpdateAllTextBlocks(const FrameSize& render_attachment_size) const
@@ -376,4 +468,21 @@ void HeadsUpDisplay::UpdateAllTextBlocks(const FrameSize& render_attachment_size
     }
 }
 
+void HeadsUpDisplay::UpdateFrameGraph(const FrameSize& render_attachment_size)
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_graph_ptr)
+        return;
+
+    // Graph samples are added on every update to show all frame time spikes between text updates
+    const Data::FrameTiming last_frame_timing = GetUIContext().GetRenderContext().GetFpsCounter().GetLastFrameTiming();
+    m_frame_graph_ptr->AddSample(0U, static_cast<float>(last_frame_timing.GetTotalTimeMSec()));
+    m_frame_graph_ptr->AddSample(1U, static_cast<float>(last_frame_timing.GetCpuTimeMSec()));
+    for(uint32_t gpu_graph_index = 0U; gpu_graph_index < m_gpu_times_msec.size(); ++gpu_graph_index)
+    {
+        m_frame_graph_ptr->AddSample(2U + gpu_graph_index, m_gpu_times_msec[gpu_graph_index]);
+    }
+    m_frame_graph_ptr->Update(render_attachment_size);
+}
+
 } // namespace Methane::UserInterface
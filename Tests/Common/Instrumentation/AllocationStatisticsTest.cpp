@@ -0,0 +1,127 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/AllocationStatisticsTest.cpp
+Unit tests of the heap allocation statistics collected by tags with thread-local counters
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/AllocationStatistics.h>
+
+#include <string_view>
+#include <thread>
+#include <new>
+
+using namespace Methane;
+
+TEST_CASE("Allocation statistics tags", "[allocations]")
+{
+    SECTION("Untagged id is registered by default")
+    {
+        CHECK(AllocationStatistics::GetTagsCount() >= 1U);
+        CHECK(std::string_view(AllocationStatistics::GetTagName(AllocationStatistics::untagged_id)) == AllocationStatistics::untagged_name);
+        CHECK(AllocationStatistics::RegisterTag(AllocationStatistics::untagged_name) == AllocationStatistics::untagged_id);
+    }
+
+    SECTION("Registering the same tag name returns the same id")
+    {
+        const AllocationStatistics::TagId tag_id = AllocationStatistics::RegisterTag("Test Tag");
+        CHECK(tag_id != AllocationStatistics::untagged_id);
+        CHECK(AllocationStatistics::RegisterTag("Test Tag") == tag_id);
+        CHECK(std::string_view(AllocationStatistics::GetTagName(tag_id)) == "Test Tag");
+    }
+
+    SECTION("Tag scopes set and restore thread tag")
+    {
+        const AllocationStatistics::TagId outer_tag_id = AllocationStatistics::RegisterTag("Outer Tag");
+        const AllocationStatistics::TagId inner_tag_id = AllocationStatistics::RegisterTag("Inner Tag");
+        CHECK(AllocationStatistics::GetThreadTag() == AllocationStatistics::untagged_id);
+        {
+            const AllocationStatistics::TagScope outer_scope(outer_tag_id);
+            CHECK(AllocationStatistics::GetThreadTag() == outer_tag_id);
+            {
+                const AllocationStatistics::TagScope inner_scope(inner_tag_id);
+                CHECK(AllocationStatistics::GetThreadTag() == inner_tag_id);
+            }
+            CHECK(AllocationStatistics::GetThreadTag() == outer_tag_id);
+        }
+        CHECK(AllocationStatistics::GetThreadTag() == AllocationStatistics::untagged_id);
+    }
+}
+
+TEST_CASE("Allocation statistics counters", "[allocations]")
+{
+    const AllocationStatistics::TagId tag_id = AllocationStatistics::RegisterTag("Counted Tag");
+
+    SECTION("Allocations are counted by tag of the current thread")
+    {
+        const AllocationStatistics::ThreadScopeCounter allocations_counter;
+        AllocationStatistics::AddAllocation(16U);
+        {
+            const AllocationStatistics::TagScope tag_scope(tag_id);
+            AllocationStatistics::AddAllocation(32U);
+            AllocationStatistics::AddAllocation(64U);
+            AllocationStatistics::AddDeallocation();
+        }
+
+        const AllocationStatistics::TagCounters tag_counters = allocations_counter.GetTagCounters();
+        CHECK(tag_counters[AllocationStatistics::untagged_id] == AllocationStatistics::Counters{ 1U, 16U, 0U });
+        CHECK(tag_counters[tag_id] == AllocationStatistics::Counters{ 2U, 96U, 1U });
+        CHECK(allocations_counter.GetCounters() == AllocationStatistics::Counters{ 3U, 112U, 1U });
+    }
+
+    SECTION("Allocations of other threads are counted in total counters only")
+    {
+        const AllocationStatistics::ThreadScopeCounter allocations_counter;
+        const AllocationStatistics::TagCounters begin_total_counters = AllocationStatistics::GetTotalCounters();
+
+        std::thread allocating_thread([tag_id]()
+        {
+            const AllocationStatistics::TagScope tag_scope(tag_id);
+            AllocationStatistics::AddAllocation(128U);
+        });
+        allocating_thread.join();
+
+        const AllocationStatistics::TagCounters total_counters = AllocationStatistics::GetTotalCounters() - begin_total_counters;
+        CHECK(allocations_counter.GetTagCounters()[tag_id] == AllocationStatistics::Counters{});
+        CHECK(total_counters[tag_id].allocations_count >= 1U);
+        CHECK(total_counters[tag_id].allocated_bytes >= 128U);
+    }
+
+    SECTION("Heap allocations with new operator are counted when tracking is enabled")
+    {
+        const AllocationStatistics::ThreadScopeCounter allocations_counter;
+        {
+            const AllocationStatistics::TagScope tag_scope(tag_id);
+            void* memory_ptr = ::operator new(256U);
+            ::operator delete(memory_ptr);
+        }
+
+        const AllocationStatistics::Counters tag_counters = allocations_counter.GetTagCounters()[tag_id];
+        if constexpr (AllocationStatistics::IsTrackingEnabled())
+        {
+            CHECK(tag_counters == AllocationStatistics::Counters{ 1U, 256U, 1U });
+        }
+        else
+        {
+            CHECK(tag_counters == AllocationStatistics::Counters{});
+        }
+    }
+}
@@ -0,0 +1,217 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/TraceRecorderTest.cpp
+Unit tests of the trace recorder with per-thread ring buffers and Chrome trace writing
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/TraceRecorder.h>
+
+#include <array>
+#include <thread>
+#include <sstream>
+#include <string>
+#include <functional>
+
+using namespace Methane;
+
+// Each test records events in a new thread to get a new thread buffer with requested capacity
+static TraceRecorder::Events RecordThreadEvents(const std::function<void()>& record_events,
+                                                size_t events_capacity = TraceRecorder::default_thread_events_capacity)
+{
+    TraceRecorder& trace_recorder = TraceRecorder::Get();
+    trace_recorder.SetThreadEventsCapacity(events_capacity);
+
+    TraceRecorder::Events events;
+    std::thread recording_thread([&record_events, &events, &trace_recorder]()
+    {
+        record_events();
+        events = trace_recorder.GetThreadEvents();
+    });
+    recording_thread.join();
+
+    trace_recorder.SetThreadEventsCapacity(TraceRecorder::default_thread_events_capacity);
+    return events;
+}
+
+TEST_CASE("Trace recorder scope events", "[trace]")
+{
+    SECTION("Scope records complete event on destruction")
+    {
+        const TraceRecorder::Nanoseconds begin_ns = TraceRecorder::GetTimestamp();
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            const TraceRecorder::Scope trace_scope("Test Scope");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+        const TraceRecorder::Nanoseconds end_ns = TraceRecorder::GetTimestamp();
+
+        REQUIRE(events.size() == 1U);
+        CHECK(std::string_view(events[0].name) == "Test Scope");
+        CHECK(events[0].type == TraceRecorder::EventType::Complete);
+        CHECK(events[0].timestamp_ns >= begin_ns);
+        CHECK(events[0].duration_ns >= 1000000U);
+        CHECK(events[0].timestamp_ns + events[0].duration_ns <= end_ns);
+    }
+
+    SECTION("Nested scopes are recorded in order of completion")
+    {
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            const TraceRecorder::Scope outer_scope("Outer Scope");
+            {
+                const TraceRecorder::Scope inner_scope("Inner Scope");
+            }
+        });
+
+        REQUIRE(events.size() == 2U);
+        CHECK(std::string_view(events[0].name) == "Inner Scope");
+        CHECK(std::string_view(events[1].name) == "Outer Scope");
+        CHECK(events[1].timestamp_ns <= events[0].timestamp_ns);
+        CHECK(events[1].timestamp_ns + events[1].duration_ns >= events[0].timestamp_ns + events[0].duration_ns);
+    }
+
+    SECTION("Events are not recorded when recording is disabled")
+    {
+        TraceRecorder::Get().SetRecording(false);
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            const TraceRecorder::Scope trace_scope("Test Scope");
+            TraceRecorder::Get().AddInstantEvent("Test Marker");
+            TraceRecorder::Get().AddFrameDelimiter(0U, 1U);
+        });
+        TraceRecorder::Get().SetRecording(true);
+
+        CHECK(events.empty());
+    }
+}
+
+TEST_CASE("Trace recorder thread ring buffer", "[trace]")
+{
+    static constexpr std::array<const char*, 6> s_marker_names{ "M0", "M1", "M2", "M3", "M4", "M5" };
+
+    SECTION("Ring buffer keeps all events below capacity")
+    {
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            for(size_t i = 0; i < 3; ++i)
+                TraceRecorder::Get().AddInstantEvent(s_marker_names[i]);
+        }, 4U);
+
+        REQUIRE(events.size() == 3U);
+        for(size_t i = 0; i < events.size(); ++i)
+        {
+            CHECK(events[i].name == s_marker_names[i]);
+            CHECK(events[i].type == TraceRecorder::EventType::Instant);
+        }
+    }
+
+    SECTION("Ring buffer keeps only latest events above capacity")
+    {
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            for(const char* marker_name : s_marker_names)
+                TraceRecorder::Get().AddInstantEvent(marker_name);
+        }, 4U);
+
+        REQUIRE(events.size() == 4U);
+        for(size_t i = 0; i < events.size(); ++i)
+        {
+            CHECK(events[i].name == s_marker_names[i + 2]);
+        }
+    }
+
+    SECTION("Frame start and end names are copied")
+    {
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            std::string frame_name = "Frame 1";
+            TraceRecorder::Get().AddFrameStart(frame_name);
+            TraceRecorder::Get().AddFrameEnd(frame_name);
+            frame_name = "Overwritten";
+        });
+
+        REQUIRE(events.size() == 2U);
+        CHECK(std::string_view(events[0].name) == "Frame 1");
+        CHECK(events[0].type == TraceRecorder::EventType::FrameStart);
+        CHECK(events[1].name == events[0].name);
+        CHECK(events[1].type == TraceRecorder::EventType::FrameEnd);
+    }
+
+    SECTION("Frame names are interned once")
+    {
+        const TraceRecorder::Events events = RecordThreadEvents([]()
+        {
+            for(uint32_t frame_index = 0U; frame_index < 2U; ++frame_index)
+            {
+                TraceRecorder::Get().AddFrameStart(std::string("Frame"));
+                TraceRecorder::Get().AddFrameEnd(std::string("Frame"));
+            }
+        });
+
+        REQUIRE(events.size() == 4U);
+        for(const TraceRecorder::Event& event : events)
+        {
+            CHECK(event.name == events[0].name);
+        }
+    }
+}
+
+TEST_CASE("Trace recorder thread buffers reuse", "[trace]")
+{
+    SECTION("Buffers of exited threads are reused above buffers count limit")
+    {
+        for(size_t thread_index = 0U; thread_index < TraceRecorder::max_thread_buffers_count + 8U; ++thread_index)
+        {
+            const TraceRecorder::Events events = RecordThreadEvents([]()
+            {
+                TraceRecorder::Get().SetThreadName("Short Thread");
+                TraceRecorder::Get().AddInstantEvent("Short Thread Marker");
+            }, 4U);
+
+            REQUIRE(events.size() == 1U);
+            CHECK(std::string_view(events[0].name) == "Short Thread Marker");
+        }
+        CHECK(TraceRecorder::Get().GetThreadsCount() <= TraceRecorder::max_thread_buffers_count);
+    }
+}
+
+TEST_CASE("Trace recorder Chrome trace writing", "[trace]")
+{
+    TraceRecorder::Get().Clear();
+    RecordThreadEvents([]()
+    {
+        TraceRecorder::Get().SetThreadName("Test \"Worker\"");
+        const TraceRecorder::Scope trace_scope("Traced Scope");
+        TraceRecorder::Get().AddFrameDelimiter(2U, 42U);
+    });
+
+    std::stringstream trace_stream;
+    TraceRecorder::Get().WriteChromeTrace(trace_stream);
+    const std::string trace_json = trace_stream.str();
+
+    CHECK(trace_json.find(R"("traceEvents":[)") != std::string::npos);
+    CHECK(trace_json.find(R"("args":{"name":"Test \"Worker\""})") != std::string::npos);
+    CHECK(trace_json.find(R"({"name":"Traced Scope",)") != std::string::npos);
+    CHECK(trace_json.find(R"("ph":"X","dur":)") != std::string::npos);
+    CHECK(trace_json.find(R"("args":{"frame_buffer_index":2,"frame_index":42})") != std::string::npos);
+    CHECK(trace_json.rfind("]}") != std::string::npos);
+}
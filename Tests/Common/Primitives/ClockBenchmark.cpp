@@ -0,0 +1,86 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Primitives/ClockBenchmark.cpp
+Benchmarks of per-call overhead of the clocks used in timers
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <Methane/TscClock.h>
+#include <Methane/Timer.hpp>
+
+#include <chrono>
+
+using namespace Methane;
+
+static constexpr int g_clock_calls_count = 1000;
+
+template<typename ClockType>
+static auto CallClock()
+{
+    typename ClockType::duration duration_sum{ 0 };
+    for(int i = 0; i < g_clock_calls_count; ++i)
+    {
+        duration_sum += ClockType::now().time_since_epoch();
+    }
+    return duration_sum.count();
+}
+
+TEST_CASE("Clocks benchmark", "[timer][benchmark]")
+{
+    const std::string benchmark_suffix = " clock calls " + std::to_string(g_clock_calls_count) + " times";
+
+    BENCHMARK("Steady" + benchmark_suffix)
+    {
+        return CallClock<std::chrono::steady_clock>();
+    };
+
+    BENCHMARK("High resolution" + benchmark_suffix)
+    {
+        return CallClock<std::chrono::high_resolution_clock>();
+    };
+
+    BENCHMARK("TSC" + benchmark_suffix)
+    {
+        return CallClock<TscClock>();
+    };
+
+    BENCHMARK("TSC counter reads " + std::to_string(g_clock_calls_count) + " times")
+    {
+        uint64_t counter_sum = 0U;
+        for(int i = 0; i < g_clock_calls_count; ++i)
+        {
+            counter_sum += TscClock::ReadCounter();
+        }
+        return counter_sum;
+    };
+
+    BENCHMARK("Timer elapsed time gets " + std::to_string(g_clock_calls_count) + " times")
+    {
+        const Timer timer;
+        double elapsed_sec_sum = 0.0;
+        for(int i = 0; i < g_clock_calls_count; ++i)
+        {
+            elapsed_sec_sum += timer.GetElapsedSecondsD();
+        }
+        return elapsed_sec_sum;
+    };
+}
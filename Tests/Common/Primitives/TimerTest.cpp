@@ -0,0 +1,100 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Primitives/TimerTest.cpp
+Unit tests of the animation timer with virtual time advanced by fixed steps
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Timer.hpp>
+
+#include <thread>
+
+using namespace Methane;
+
+static Timer::TimeDuration GetDuration(std::chrono::milliseconds duration)
+{
+    return std::chrono::duration_cast<Timer::TimeDuration>(duration);
+}
+
+TEST_CASE("Timer virtual time", "[timer][virtual]")
+{
+    Timer::EnableVirtualTime();
+
+    SECTION("Virtual time is enabled")
+    {
+        CHECK(Timer::IsVirtualTimeEnabled());
+    }
+
+    SECTION("Virtual time does not advance with clock")
+    {
+        const Timer timer(Timer::TimeSource::Virtual);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        CHECK(timer.GetElapsedDuration() == Timer::TimeDuration::zero());
+    }
+
+    SECTION("Virtual time is advanced by given steps")
+    {
+        const Timer timer(Timer::TimeSource::Virtual);
+        Timer::AdvanceVirtualTime(GetDuration(std::chrono::milliseconds(250)));
+        CHECK(timer.GetElapsedSecondsD() == 0.25);
+        Timer::AdvanceVirtualTime(GetDuration(std::chrono::milliseconds(750)));
+        CHECK(timer.GetElapsedSecondsU() == 1U);
+    }
+
+    SECTION("Timer reset to seconds is relative to virtual time")
+    {
+        Timer timer(Timer::TimeSource::Virtual);
+        timer.ResetToSeconds(2.0);
+        CHECK(timer.GetElapsedSecondsD() == 2.0);
+        Timer::AdvanceVirtualTime(GetDuration(std::chrono::milliseconds(500)));
+        CHECK(timer.GetElapsedSecondsD() == 2.5);
+    }
+
+    SECTION("Timers started at the same virtual time are synchronized")
+    {
+        const Timer first_timer(Timer::TimeSource::Virtual);
+        const Timer second_timer(Timer::TimeSource::Virtual);
+        Timer::AdvanceVirtualTime(GetDuration(std::chrono::milliseconds(100)));
+        CHECK(first_timer.GetElapsedDuration() == second_timer.GetElapsedDuration());
+    }
+
+    SECTION("Clock timer ignores virtual time")
+    {
+        const Timer timer;
+        CHECK(timer.GetTimeSource() == Timer::TimeSource::Clock);
+        Timer::AdvanceVirtualTime(GetDuration(std::chrono::milliseconds(500)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        CHECK(timer.GetElapsedDuration() >= GetDuration(std::chrono::milliseconds(2)));
+        CHECK(timer.GetElapsedDuration() < GetDuration(std::chrono::milliseconds(500)));
+    }
+
+    SECTION("Clock time is used after virtual time is disabled")
+    {
+        Timer::DisableVirtualTime();
+        CHECK_FALSE(Timer::IsVirtualTimeEnabled());
+
+        const Timer timer(Timer::TimeSource::Virtual);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        CHECK(timer.GetElapsedDuration() >= GetDuration(std::chrono::milliseconds(2)));
+    }
+
+    Timer::DisableVirtualTime();
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Primitives/TscClockTest.cpp
+Unit tests of the CPU time stamp counter clock calibrated against steady clock
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/TscClock.h>
+#include <Methane/Timer.hpp>
+
+#include <thread>
+
+using namespace Methane;
+
+TEST_CASE("TSC clock time points", "[timer][tsc]")
+{
+    SECTION("Counter frequency is known when counter is available")
+    {
+        if (TscClock::IsCounterAvailable())
+        {
+            CHECK(TscClock::GetCounterFrequency() > 1E6);
+        }
+        else
+        {
+            CHECK(TscClock::GetCounterFrequency() == 0.0);
+        }
+    }
+
+    SECTION("Clock is monotonic")
+    {
+        TscClock::time_point prev_time = TscClock::now();
+        for(int i = 0; i < 10000; ++i)
+        {
+            const TscClock::time_point curr_time = TscClock::now();
+            REQUIRE(curr_time >= prev_time);
+            prev_time = curr_time;
+        }
+    }
+
+    SECTION("Clock time is close to steady clock time")
+    {
+        const auto tsc_time_ns    = TscClock::now().time_since_epoch();
+        const auto steady_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch());
+        CHECK(std::chrono::abs(tsc_time_ns - steady_time_ns) < std::chrono::milliseconds(1));
+    }
+
+    SECTION("Measured duration matches steady clock duration")
+    {
+        const auto steady_begin_time = std::chrono::steady_clock::now();
+        const auto tsc_begin_time    = TscClock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const auto tsc_duration    = TscClock::now() - tsc_begin_time;
+        const auto steady_duration = std::chrono::steady_clock::now() - steady_begin_time;
+
+        CHECK(tsc_duration >= std::chrono::milliseconds(50));
+        CHECK(tsc_duration <= steady_duration);
+        CHECK(std::chrono::duration<double>(tsc_duration).count() / std::chrono::duration<double>(steady_duration).count() > 0.99);
+    }
+}
+
+TEST_CASE("Timer with TSC clock", "[timer][tsc]")
+{
+    const Timer timer;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK(timer.GetElapsedSecondsD() >= 0.01);
+#ifdef METHANE_TSC_CLOCK_ENABLED
+    CHECK(std::is_same_v<Timer::Clock, TscClock>);
+#endif
+}
@@ -0,0 +1,211 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/BuddyAllocatorTest.cpp
+Unit tests of the buddy allocator of offset ranges
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/BuddyAllocator.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Data;
+using Catch::Approx;
+
+static constexpr BuddyAllocator::Size g_total_size     = 1024U;
+static constexpr BuddyAllocator::Size g_min_block_size = 16U;
+
+TEST_CASE("Buddy allocator construction", "[buddy][allocator]")
+{
+    SECTION("Empty allocator has whole free block")
+    {
+        const BuddyAllocator allocator(g_total_size, g_min_block_size);
+        const BuddyAllocator::Statistics statistics = allocator.GetStatistics();
+        CHECK(allocator.IsEmpty());
+        CHECK(statistics.total_size == g_total_size);
+        CHECK(statistics.used_size == 0U);
+        CHECK(statistics.largest_free_block_size == g_total_size);
+        CHECK(statistics.allocations_count == 0U);
+        CHECK(statistics.GetUtilization() == 0.0);
+        CHECK(statistics.GetFragmentation() == 0.0);
+    }
+
+    SECTION("Non power-of-two sizes are not allowed")
+    {
+        CHECK_THROWS(BuddyAllocator(1000U, g_min_block_size));
+        CHECK_THROWS(BuddyAllocator(g_total_size, 10U));
+        CHECK_THROWS(BuddyAllocator(g_min_block_size, g_total_size));
+    }
+}
+
+TEST_CASE("Buddy allocator allocations", "[buddy][allocator]")
+{
+    BuddyAllocator allocator(g_total_size, g_min_block_size);
+
+    SECTION("Allocation size is rounded up to power of two and minimum block size")
+    {
+        CHECK(allocator.Allocate(100U) == BuddyAllocator::Allocation{ 0U, 128U });
+        CHECK(allocator.Allocate(1U)   == BuddyAllocator::Allocation{ 128U, 16U });
+        CHECK(allocator.GetUsedSize() == 144U);
+    }
+
+    SECTION("Allocation offsets respect alignment")
+    {
+        const Opt<BuddyAllocator::Allocation> small_allocation = allocator.Allocate(16U);
+        const Opt<BuddyAllocator::Allocation> aligned_allocation = allocator.Allocate(16U, 256U);
+        REQUIRE(small_allocation);
+        REQUIRE(aligned_allocation);
+        CHECK(small_allocation->offset == 0U);
+        CHECK(aligned_allocation->offset % 256U == 0U);
+        CHECK(aligned_allocation->offset == 256U);
+    }
+
+    SECTION("Allocations do not overlap")
+    {
+        std::vector<BuddyAllocator::Allocation> allocations;
+        while (const Opt<BuddyAllocator::Allocation> allocation_opt = allocator.Allocate(48U))
+        {
+            for(const BuddyAllocator::Allocation& allocation : allocations)
+            {
+                CHECK((allocation_opt->offset >= allocation.offset + allocation.size ||
+                       allocation.offset >= allocation_opt->offset + allocation_opt->size));
+            }
+            allocations.push_back(*allocation_opt);
+        }
+        CHECK(allocations.size() == g_total_size / 64U);
+        CHECK(allocator.GetStatistics().GetUtilization() == 1.0);
+    }
+
+    SECTION("Too large or empty allocations fail")
+    {
+        CHECK_FALSE(allocator.Allocate(g_total_size + 1U));
+        CHECK_FALSE(allocator.Allocate(0U));
+        CHECK(allocator.Allocate(g_total_size));
+        CHECK_FALSE(allocator.Allocate(1U));
+    }
+}
+
+TEST_CASE("Buddy allocator deallocations", "[buddy][allocator]")
+{
+    BuddyAllocator allocator(g_total_size, g_min_block_size);
+
+    SECTION("Freed buddies are merged back to whole block")
+    {
+        std::vector<BuddyAllocator::Allocation> allocations;
+        for(BuddyAllocator::Size size : { 16U, 32U, 64U, 128U, 256U, 16U })
+        {
+            const Opt<BuddyAllocator::Allocation> allocation_opt = allocator.Allocate(size);
+            REQUIRE(allocation_opt);
+            allocations.push_back(*allocation_opt);
+        }
+        for(const BuddyAllocator::Allocation& allocation : allocations)
+        {
+            allocator.Free(allocation);
+        }
+        CHECK(allocator.IsEmpty());
+        CHECK(allocator.GetLargestFreeBlockSize() == g_total_size);
+        CHECK(allocator.Allocate(g_total_size) == BuddyAllocator::Allocation{ 0U, g_total_size });
+    }
+
+    SECTION("Freed block is reused by the next allocation")
+    {
+        const Opt<BuddyAllocator::Allocation> first_allocation = allocator.Allocate(64U);
+        const Opt<BuddyAllocator::Allocation> second_allocation = allocator.Allocate(64U);
+        REQUIRE(first_allocation);
+        REQUIRE(second_allocation);
+        allocator.Free(*first_allocation);
+        CHECK(allocator.Allocate(64U) == first_allocation);
+    }
+
+    SECTION("Freeing not allocated offset throws")
+    {
+        CHECK_THROWS(allocator.Free(64U));
+    }
+
+    SECTION("Fragmentation is reported for split free space")
+    {
+        std::vector<BuddyAllocator::Allocation> allocations;
+        while (const Opt<BuddyAllocator::Allocation> allocation_opt = allocator.Allocate(g_min_block_size))
+        {
+            allocations.push_back(*allocation_opt);
+        }
+
+        // Free every second block, so that free space can not be merged
+        for(size_t index = 0U; index < allocations.size(); index += 2U)
+        {
+            allocator.Free(allocations[index]);
+        }
+
+        const BuddyAllocator::Statistics statistics = allocator.GetStatistics();
+        CHECK(statistics.used_size == g_total_size / 2U);
+        CHECK(statistics.largest_free_block_size == g_min_block_size);
+        CHECK(statistics.GetUtilization() == Approx(0.5));
+        CHECK(statistics.GetFragmentation() == Approx(1.0 - static_cast<double>(g_min_block_size) / (g_total_size / 2U)));
+        CHECK_FALSE(allocator.Allocate(2U * g_min_block_size));
+    }
+}
+
+TEST_CASE("Buddy allocator merged statistics", "[buddy][allocator]")
+{
+    BuddyAllocator first_allocator(g_total_size, g_min_block_size);
+    BuddyAllocator second_allocator(g_total_size, g_min_block_size);
+
+    SECTION("Merged statistics of empty allocators are not fragmented")
+    {
+        BuddyAllocator::Statistics statistics = first_allocator.GetStatistics();
+        statistics += second_allocator.GetStatistics();
+        CHECK(statistics.total_size == 2U * g_total_size);
+        CHECK(statistics.GetFreeSize() == 2U * g_total_size);
+        CHECK(statistics.largest_free_block_size == g_total_size);
+        CHECK(statistics.GetFragmentation() == 0.0);
+    }
+
+    SECTION("Merged statistics of allocators with contiguous free space are not fragmented")
+    {
+        REQUIRE(second_allocator.Allocate(g_total_size / 2U));
+        BuddyAllocator::Statistics statistics = first_allocator.GetStatistics();
+        statistics += second_allocator.GetStatistics();
+        CHECK(statistics.allocations_count == 1U);
+        CHECK(statistics.GetFreeSize() == g_total_size + g_total_size / 2U);
+        CHECK(statistics.GetFragmentation() == 0.0);
+    }
+
+    SECTION("Fragmentation of merged statistics is weighted by free size of allocators")
+    {
+        std::vector<BuddyAllocator::Allocation> allocations;
+        while (const Opt<BuddyAllocator::Allocation> allocation_opt = second_allocator.Allocate(g_min_block_size))
+        {
+            allocations.push_back(*allocation_opt);
+        }
+        for(size_t index = 0U; index < allocations.size(); index += 2U)
+        {
+            second_allocator.Free(allocations[index]);
+        }
+
+        BuddyAllocator::Statistics statistics = first_allocator.GetStatistics();
+        statistics += second_allocator.GetStatistics();
+        const BuddyAllocator::Size fragmented_free_size = g_total_size / 2U - g_min_block_size;
+        CHECK(statistics.fragmented_free_size == fragmented_free_size);
+        CHECK(statistics.GetFragmentation() == Approx(static_cast<double>(fragmented_free_size) / (g_total_size + g_total_size / 2U)));
+    }
+}
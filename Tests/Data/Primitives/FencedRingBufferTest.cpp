@@ -0,0 +1,156 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/FencedRingBufferTest.cpp
+Unit tests of the ring buffer fenced by executions
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/FencedRingBuffer.hpp>
+
+#include <memory>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+using TestRingBuffer = FencedRingBuffer<std::unique_ptr<int>>;
+
+static constexpr TestRingBuffer::Size g_ring_size      = 1024U;
+static constexpr TestRingBuffer::Size g_ring_alignment = 256U;
+
+static const int g_first_execution  = 1;
+static const int g_second_execution = 2;
+
+TEST_CASE("Fenced ring buffer allocation", "[fenced-ring][allocator]")
+{
+    TestRingBuffer ring(g_ring_size, g_ring_alignment);
+
+    SECTION("Ranges are aligned and allocated sequentially")
+    {
+        CHECK(ring.Allocate(100U) == 0U);
+        CHECK(ring.Allocate(300U) == 256U);
+        CHECK(ring.GetUsedSize() == 768U);
+    }
+
+    SECTION("Empty range and range larger than ring are not allocated")
+    {
+        CHECK_FALSE(ring.Allocate(0U));
+        CHECK_FALSE(ring.Allocate(g_ring_size + 1U));
+        CHECK(ring.GetUsedSize() == 0U);
+    }
+
+    SECTION("Range is not allocated when ring is full")
+    {
+        CHECK(ring.Allocate(g_ring_size));
+        CHECK_FALSE(ring.Allocate(1U));
+    }
+
+    SECTION("Range does not wrap around ring end")
+    {
+        REQUIRE(ring.Allocate(768U));
+        ring.BeginExecution(&g_first_execution);
+        ring.CompleteExecution(&g_first_execution);
+        CHECK(ring.Allocate(512U) == 0U);
+        CHECK(ring.GetUsedSize() == 768U);
+    }
+}
+
+TEST_CASE("Fenced ring buffer executions", "[fenced-ring][allocator]")
+{
+    TestRingBuffer ring(g_ring_size, g_ring_alignment);
+
+    SECTION("Ranges and payloads are reclaimed on execution completion")
+    {
+        REQUIRE(ring.Allocate(512U));
+        ring.AddPayload(std::make_unique<int>(1));
+        ring.BeginExecution(&g_first_execution);
+        CHECK(ring.GetUsedSize() == 512U);
+        CHECK(ring.GetPayloadsCount() == 1U);
+
+        ring.CompleteExecution(&g_first_execution);
+        CHECK(ring.GetUsedSize() == 0U);
+        CHECK(ring.GetPayloadsCount() == 0U);
+        CHECK(ring.GetExecutionsCount() == 0U);
+    }
+
+    SECTION("Ranges allocated after execution begin are not reclaimed on its completion")
+    {
+        REQUIRE(ring.Allocate(256U));
+        ring.BeginExecution(&g_first_execution);
+        REQUIRE(ring.Allocate(256U));
+        ring.AddPayload(std::make_unique<int>(1));
+
+        ring.CompleteExecution(&g_first_execution);
+        CHECK(ring.GetUsedSize() == 256U);
+        CHECK(ring.GetPayloadsCount() == 1U);
+    }
+
+    SECTION("Back to back executions of the same command list are reclaimed one per completion")
+    {
+        REQUIRE(ring.Allocate(256U));
+        ring.AddPayload(std::make_unique<int>(1));
+        ring.BeginExecution(&g_first_execution);
+        ring.CompleteExecution(&g_first_execution);
+
+        REQUIRE(ring.Allocate(256U));
+        ring.AddPayload(std::make_unique<int>(2));
+        ring.BeginExecution(&g_first_execution);
+        REQUIRE(ring.Allocate(512U));
+        ring.AddPayload(std::make_unique<int>(3));
+        ring.BeginExecution(&g_first_execution);
+        CHECK(ring.GetExecutionsCount() == 2U);
+        CHECK(ring.GetUsedSize() == 768U);
+
+        ring.CompleteExecution(&g_first_execution);
+        CHECK(ring.GetUsedSize() == 512U);
+        CHECK(ring.GetPayloadsCount() == 1U);
+
+        ring.CompleteExecution(&g_first_execution);
+        CHECK(ring.GetUsedSize() == 0U);
+        CHECK(ring.GetPayloadsCount() == 0U);
+    }
+
+    SECTION("Out of order completion is reclaimed after all earlier executions are completed")
+    {
+        REQUIRE(ring.Allocate(256U));
+        ring.AddPayload(std::make_unique<int>(1));
+        ring.BeginExecution(&g_first_execution);
+        REQUIRE(ring.Allocate(256U));
+        ring.AddPayload(std::make_unique<int>(2));
+        ring.BeginExecution(&g_second_execution);
+
+        ring.CompleteExecution(&g_second_execution);
+        CHECK(ring.GetUsedSize() == 512U);
+        CHECK(ring.GetPayloadsCount() == 2U);
+
+        ring.CompleteExecution(&g_first_execution);
+        CHECK(ring.GetUsedSize() == 0U);
+        CHECK(ring.GetPayloadsCount() == 0U);
+    }
+
+    SECTION("Completion of unknown execution is ignored")
+    {
+        REQUIRE(ring.Allocate(256U));
+        ring.BeginExecution(&g_first_execution);
+        ring.CompleteExecution(&g_second_execution);
+        CHECK(ring.GetUsedSize() == 256U);
+        CHECK(ring.GetExecutionsCount() == 1U);
+    }
+}
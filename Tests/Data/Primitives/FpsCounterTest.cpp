@@ -0,0 +1,147 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/FpsCounterTest.cpp
+Unit tests of the FPS counter with frame time statistics
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/FpsCounter.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace Methane;
+using namespace Methane::Data;
+using Catch::Approx;
+
+static constexpr double g_frame_budget_msec = 1000.0 / 60.0;
+
+TEST_CASE("FPS counter averaging window", "[fps]")
+{
+    FpsCounter fps_counter(4U);
+
+    SECTION("Empty counter")
+    {
+        CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+        CHECK(fps_counter.GetFramesPerSecond() == 0U);
+        CHECK(fps_counter.GetFrameStatistics(g_frame_budget_msec).frames_count == 0U);
+    }
+
+    SECTION("Window is not filled")
+    {
+        fps_counter.AddFrameTiming(FrameTiming(0.010, 0.0, 0.0));
+        fps_counter.AddFrameTiming(FrameTiming(0.030, 0.0, 0.0));
+        CHECK(fps_counter.GetAveragedTimingsCount() == 2U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() == Approx(20.0));
+        CHECK(fps_counter.GetFramesPerSecond() == 50U);
+    }
+
+    SECTION("Oldest timings are replaced in the full window")
+    {
+        for(uint32_t frame_index = 1U; frame_index <= 10U; ++frame_index)
+        {
+            fps_counter.AddFrameTiming(FrameTiming(0.001 * frame_index, 0.0, 0.0));
+        }
+        CHECK(fps_counter.GetAveragedTimingsCount() == 4U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() == Approx(8.5));
+        CHECK(fps_counter.GetLastFrameTiming().GetTotalTimeMSec() == Approx(10.0));
+        CHECK(fps_counter.GetFrameStatistics(g_frame_budget_msec).frame_time.max_msec == Approx(10.0));
+    }
+
+    SECTION("Reset clears timings and changes window size")
+    {
+        fps_counter.AddFrameTiming(FrameTiming(0.010, 0.0, 0.0));
+        fps_counter.Reset(2U);
+        CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+        for(uint32_t frame_index = 1U; frame_index <= 3U; ++frame_index)
+        {
+            fps_counter.AddFrameTiming(FrameTiming(0.010 * frame_index, 0.0, 0.0));
+        }
+        CHECK(fps_counter.GetAveragedTimingsCount() == 2U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() == Approx(25.0));
+    }
+}
+
+TEST_CASE("FPS counter frame statistics", "[fps]")
+{
+    FpsCounter fps_counter(200U);
+    for(uint32_t frame_index = 0U; frame_index < 198U; ++frame_index)
+    {
+        fps_counter.AddFrameTiming(FrameTiming(0.010, 0.002, 0.004));
+    }
+    fps_counter.AddFrameTiming(FrameTiming(0.040, 0.002, 0.004));
+    fps_counter.AddFrameTiming(FrameTiming(0.050, 0.002, 0.004));
+
+    const FrameStatistics statistics = fps_counter.GetFrameStatistics(g_frame_budget_msec);
+
+    SECTION("Frame time percentiles")
+    {
+        CHECK(statistics.frames_count == 200U);
+        CHECK(statistics.frame_time.p50_msec == Approx(10.0).epsilon(1.0 / 16.0));
+        CHECK(statistics.frame_time.p95_msec == Approx(10.0).epsilon(1.0 / 16.0));
+        CHECK(statistics.frame_time.p99_msec == Approx(10.0).epsilon(1.0 / 16.0));
+        CHECK(statistics.frame_time.max_msec == Approx(50.0));
+    }
+
+    SECTION("CPU time percentiles")
+    {
+        CHECK(statistics.cpu_time.p50_msec == Approx(4.0).epsilon(1.0 / 16.0));
+        CHECK(statistics.cpu_time.p99_msec == Approx(4.0).epsilon(1.0 / 16.0));
+        CHECK(statistics.cpu_time.max_msec == Approx(44.0));
+    }
+
+    SECTION("Frames over budget")
+    {
+        CHECK(statistics.over_budget_frames_count == 2U);
+        CHECK(fps_counter.GetFrameStatistics(45.0).over_budget_frames_count == 1U);
+    }
+
+    SECTION("One percent lows")
+    {
+        CHECK(statistics.one_percent_low_fps == Approx(1000.0 / 45.0).epsilon(1.0 / 16.0));
+    }
+}
+
+TEST_CASE("FPS counter with frame timers", "[fps]")
+{
+    // Frame timers measure clock time even when virtual time is enabled for animations
+    Timer::EnableVirtualTime();
+    FpsCounter fps_counter(10U);
+    fps_counter.Reset(10U);
+
+    for(uint32_t frame_index = 0U; frame_index < 4U; ++frame_index)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+        fps_counter.OnCpuFrameReadyToPresent();
+        Timer::AdvanceVirtualTime(std::chrono::milliseconds(100));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        fps_counter.OnCpuFramePresented();
+    }
+    Timer::DisableVirtualTime();
+
+    const FrameStatistics statistics = fps_counter.GetFrameStatistics(g_frame_budget_msec);
+    CHECK(fps_counter.GetAveragedTimingsCount() == 4U);
+    CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() >= 4.0);
+    CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() < 100.0);
+    CHECK(fps_counter.GetAverageFrameTiming().GetPresentTimeMSec() >= 1.0);
+    CHECK(statistics.frame_time.max_msec < 100.0);
+}
@@ -0,0 +1,130 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/LogHistogramTest.cpp
+Unit tests of the log histogram with linear sub-buckets
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/LogHistogram.hpp>
+
+#include <algorithm>
+#include <limits>
+
+using namespace Methane::Data;
+using Catch::Approx;
+
+TEST_CASE("Log histogram buckets", "[histogram]")
+{
+    SECTION("Small values have exact buckets")
+    {
+        for(uint32_t value = 0U; value < LogHistogram::sub_buckets_count; ++value)
+        {
+            CHECK(LogHistogram::GetBucketIndex(value) == value);
+            CHECK(LogHistogram::GetBucketLowValue(value) == value);
+            CHECK(LogHistogram::GetBucketWidth(value) == 1U);
+        }
+    }
+
+    SECTION("Values are contained in their buckets with bounded relative error")
+    {
+        for(uint32_t value = 1U; value < LogHistogram::max_value; value = value * 3U / 2U + 1U)
+        {
+            const uint32_t bucket_index = LogHistogram::GetBucketIndex(value);
+            const uint32_t bucket_low   = LogHistogram::GetBucketLowValue(bucket_index);
+            const uint32_t bucket_width = LogHistogram::GetBucketWidth(bucket_index);
+            CHECK(bucket_index < LogHistogram::buckets_count);
+            CHECK(bucket_low <= value);
+            CHECK(value < bucket_low + bucket_width);
+            CHECK(bucket_width * LogHistogram::sub_buckets_count <= std::max(bucket_low, LogHistogram::sub_buckets_count));
+        }
+    }
+
+    SECTION("Bucket indices are monotonic")
+    {
+        uint32_t prev_bucket_index = 0U;
+        for(uint32_t value = 0U; value < 100000U; ++value)
+        {
+            const uint32_t bucket_index = LogHistogram::GetBucketIndex(value);
+            CHECK(bucket_index >= prev_bucket_index);
+            CHECK(bucket_index <= prev_bucket_index + 1U);
+            prev_bucket_index = bucket_index;
+        }
+    }
+
+    SECTION("Too large values are clamped to the last bucket")
+    {
+        CHECK(LogHistogram::GetBucketIndex(LogHistogram::max_value) == LogHistogram::buckets_count - 1U);
+        CHECK(LogHistogram::GetBucketIndex(std::numeric_limits<uint32_t>::max()) == LogHistogram::buckets_count - 1U);
+    }
+}
+
+TEST_CASE("Log histogram values", "[histogram]")
+{
+    LogHistogram histogram;
+    for(uint32_t value = 1U; value <= 1000U; ++value)
+    {
+        histogram.Add(value * 10U);
+    }
+
+    SECTION("Values count")
+    {
+        CHECK(histogram.GetCount() == 1000U);
+    }
+
+    SECTION("Percentiles")
+    {
+        CHECK(histogram.GetValueAtPercentile(0.0) == Approx(10.0).epsilon(1.0 / 16.0));
+        CHECK(histogram.GetValueAtPercentile(50.0) == Approx(5000.0).epsilon(1.0 / 16.0));
+        CHECK(histogram.GetValueAtPercentile(95.0) == Approx(9500.0).epsilon(1.0 / 16.0));
+        CHECK(histogram.GetValueAtPercentile(99.0) == Approx(9900.0).epsilon(1.0 / 16.0));
+        CHECK(histogram.GetValueAtPercentile(100.0) == Approx(10000.0).epsilon(1.0 / 16.0));
+    }
+
+    SECTION("Mean of highest values")
+    {
+        CHECK(histogram.GetHighestValuesMean(10U) == Approx(9955.0).epsilon(1.0 / 16.0));
+        CHECK(histogram.GetHighestValuesMean(0U) == 0.0);
+    }
+
+    SECTION("Remove values")
+    {
+        for(uint32_t value = 501U; value <= 1000U; ++value)
+        {
+            histogram.Remove(value * 10U);
+        }
+        CHECK(histogram.GetCount() == 500U);
+        CHECK(histogram.GetValueAtPercentile(100.0) == Approx(5000.0).epsilon(1.0 / 16.0));
+    }
+
+    SECTION("Remove missing value does not change histogram")
+    {
+        histogram.Remove(1U);
+        CHECK(histogram.GetCount() == 1000U);
+    }
+
+    SECTION("Clear")
+    {
+        histogram.Clear();
+        CHECK(histogram.GetCount() == 0U);
+        CHECK(histogram.GetValueAtPercentile(50.0) == 0U);
+    }
+}
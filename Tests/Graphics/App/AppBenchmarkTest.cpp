@@ -0,0 +1,250 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/App/AppBenchmarkTest.cpp
+Unit tests of the graphics application benchmark with fixed time step
+
+******************************************************************************/
+
+#include <Methane/Graphics/AppBenchmark.h>
+#include <Methane/ScopeTimer.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <thread>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using Catch::Matchers::ContainsSubstring;
+using Catch::Matchers::StartsWith;
+using Catch::Matchers::EndsWith;
+
+static size_t CountSubstrings(const std::string& str, std::string_view sub_str)
+{
+    size_t count = 0U;
+    for(size_t pos = str.find(sub_str); pos != std::string::npos; pos = str.find(sub_str, pos + sub_str.size()))
+        ++count;
+    return count;
+}
+
+static void RenderBenchmarkFrame(AppBenchmark& benchmark, std::chrono::milliseconds stage_duration = std::chrono::milliseconds(0))
+{
+    benchmark.BeginFrame();
+    std::this_thread::sleep_for(stage_duration);
+    benchmark.BeginPresentWait();
+    std::this_thread::sleep_for(stage_duration);
+    benchmark.EndPresentWait();
+    std::this_thread::sleep_for(stage_duration);
+}
+
+TEST_CASE("Application Benchmark Timing Statistics", "[app][benchmark]")
+{
+    SECTION("Statistics of empty timings are zero")
+    {
+        const AppBenchmark::TimingStatistics statistics = AppBenchmark::GetTimingStatistics({});
+        CHECK(statistics.mean_msec == 0.0);
+        CHECK(statistics.min_msec == 0.0);
+        CHECK(statistics.max_msec == 0.0);
+        CHECK(statistics.p99_msec == 0.0);
+    }
+
+    SECTION("Statistics of single timing are equal to it")
+    {
+        const AppBenchmark::TimingStatistics statistics = AppBenchmark::GetTimingStatistics({ 4.0 });
+        CHECK(statistics.mean_msec == 4.0);
+        CHECK(statistics.min_msec == 4.0);
+        CHECK(statistics.max_msec == 4.0);
+        CHECK(statistics.p50_msec == 4.0);
+        CHECK(statistics.p99_msec == 4.0);
+    }
+
+    SECTION("Nearest-rank percentiles of unsorted timings")
+    {
+        std::vector<double> timings_msec;
+        for(int timing = 100; timing > 0; --timing)
+            timings_msec.push_back(static_cast<double>(timing));
+
+        const AppBenchmark::TimingStatistics statistics = AppBenchmark::GetTimingStatistics(timings_msec);
+        CHECK(statistics.mean_msec == 50.5);
+        CHECK(statistics.min_msec == 1.0);
+        CHECK(statistics.max_msec == 100.0);
+        CHECK(statistics.p50_msec == 50.0);
+        CHECK(statistics.p90_msec == 90.0);
+        CHECK(statistics.p95_msec == 95.0);
+        CHECK(statistics.p99_msec == 99.0);
+    }
+
+    SECTION("Percentiles of small timings count are rounded up to the next rank")
+    {
+        const AppBenchmark::TimingStatistics statistics = AppBenchmark::GetTimingStatistics({ 3.0, 1.0, 2.0 });
+        CHECK(statistics.p50_msec == 2.0);
+        CHECK(statistics.p90_msec == 3.0);
+        CHECK(statistics.p99_msec == 3.0);
+    }
+}
+
+TEST_CASE("Application Benchmark Frame Timings", "[app][benchmark]")
+{
+    SECTION("Benchmark is completed after measuring given frames count")
+    {
+        AppBenchmark benchmark(2U, 0.01);
+        CHECK_FALSE(benchmark.IsCompleted());
+        RenderBenchmarkFrame(benchmark);
+        RenderBenchmarkFrame(benchmark);
+        CHECK_FALSE(benchmark.IsCompleted());
+        benchmark.BeginFrame();
+        CHECK(benchmark.IsCompleted());
+        CHECK(benchmark.GetFrameTimings().size() == 2U);
+    }
+
+    SECTION("Frames without render stage are not measured")
+    {
+        AppBenchmark benchmark(2U, 0.01);
+        benchmark.BeginFrame();
+        benchmark.BeginFrame();
+        benchmark.BeginPresentWait();
+        benchmark.BeginFrame();
+        CHECK(benchmark.GetFrameTimings().empty());
+    }
+
+    SECTION("Frame stage timings are measured with real clock")
+    {
+        const auto stage_duration = std::chrono::milliseconds(2);
+        AppBenchmark benchmark(1U, 1.0);
+        RenderBenchmarkFrame(benchmark, stage_duration);
+        benchmark.BeginFrame();
+
+        REQUIRE(benchmark.GetFrameTimings().size() == 1U);
+        const AppBenchmark::FrameTiming& frame_timing = benchmark.GetFrameTimings().front();
+        CHECK(frame_timing.update_msec >= 2.0);
+        CHECK(frame_timing.present_wait_msec >= 2.0);
+        CHECK(frame_timing.render_msec >= 2.0);
+        CHECK(frame_timing.GetTotalMSec() == frame_timing.update_msec + frame_timing.present_wait_msec + frame_timing.render_msec);
+    }
+}
+
+TEST_CASE("Application Benchmark Virtual Time", "[app][benchmark][timer]")
+{
+    SECTION("Virtual time is enabled while benchmark exists")
+    {
+        {
+            const AppBenchmark benchmark(1U, 0.01);
+            CHECK(Timer::IsVirtualTimeEnabled());
+        }
+        CHECK_FALSE(Timer::IsVirtualTimeEnabled());
+    }
+
+    SECTION("Virtual time is advanced by fixed time step on every frame begin")
+    {
+        AppBenchmark benchmark(3U, 0.5);
+        const Timer timer(Timer::TimeSource::Virtual);
+        CHECK(timer.GetElapsedSecondsD() == 0.0);
+
+        benchmark.BeginFrame();
+        CHECK(timer.GetElapsedSecondsD() == 0.5);
+
+        RenderBenchmarkFrame(benchmark);
+        RenderBenchmarkFrame(benchmark);
+        CHECK(timer.GetElapsedSecondsD() == 1.5);
+    }
+
+    SECTION("Virtual time is not advanced after benchmark completion")
+    {
+        AppBenchmark benchmark(1U, 0.5);
+        const Timer timer(Timer::TimeSource::Virtual);
+        RenderBenchmarkFrame(benchmark);
+        benchmark.BeginFrame();
+        benchmark.BeginFrame();
+        REQUIRE(benchmark.IsCompleted());
+        CHECK(timer.GetElapsedSecondsD() == 0.5);
+    }
+
+    SECTION("Clock timers measure real time while benchmark exists")
+    {
+        AppBenchmark benchmark(2U, 10.0);
+        const Timer timer;
+        const ScopeTimer scope_timer("Benchmark Test Scope");
+        benchmark.BeginFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        CHECK(timer.GetElapsedSecondsD() >= 0.002);
+        CHECK(timer.GetElapsedSecondsD() < 10.0);
+        CHECK(scope_timer.GetElapsedSecondsD() >= 0.002);
+        CHECK(scope_timer.GetElapsedSecondsD() < 10.0);
+    }
+}
+
+TEST_CASE("Application Benchmark JSON Report", "[app][benchmark][report]")
+{
+    AppBenchmark benchmark(2U, 0.02);
+    RenderBenchmarkFrame(benchmark);
+    RenderBenchmarkFrame(benchmark);
+    benchmark.BeginFrame();
+    REQUIRE(benchmark.IsCompleted());
+
+    const AppBenchmark::ReportInfo report_info{ "Test \"App\"", "Null", "Test Adapter" };
+
+    SECTION("Report header contains application info")
+    {
+        const std::string report = benchmark.GetReport(report_info);
+        CHECK_THAT(report, ContainsSubstring(R"("application": "Test \"App\"")"));
+        CHECK_THAT(report, ContainsSubstring(R"("graphics_api": "Null")"));
+        CHECK_THAT(report, ContainsSubstring(R"("adapter": "Test Adapter")"));
+        CHECK_THAT(report, ContainsSubstring(R"("frames_count": 2)"));
+        CHECK_THAT(report, ContainsSubstring(R"("time_step_sec": 0.020000)"));
+    }
+
+    SECTION("Report summary contains statistics of all timings")
+    {
+        const std::string report = benchmark.GetReport(report_info);
+        CHECK_THAT(report, ContainsSubstring(R"("summary": {)"));
+        CHECK_THAT(report, ContainsSubstring(R"("update_msec": { "mean": )"));
+        CHECK_THAT(report, ContainsSubstring(R"("present_wait_msec": { "mean": )"));
+        CHECK_THAT(report, ContainsSubstring(R"("render_msec": { "mean": )"));
+        CHECK_THAT(report, ContainsSubstring(R"("total_msec": { "mean": )"));
+        CHECK(CountSubstrings(report, R"("p99": )") == 4U);
+    }
+
+    SECTION("Report contains timings of every frame")
+    {
+        const std::string report = benchmark.GetReport(report_info);
+        CHECK_THAT(report, ContainsSubstring(R"("frames": [)"));
+        CHECK(CountSubstrings(report, R"({ "update_msec": )") == 2U);
+        CHECK_THAT(report, StartsWith("{\n"));
+        CHECK_THAT(report, EndsWith("\n  ]\n}\n"));
+    }
+
+    SECTION("Time to first frame is reported only when measured")
+    {
+        CHECK(benchmark.GetReport(report_info).find("time_to_first_frame_msec") == std::string::npos);
+
+        AppBenchmark::ReportInfo headless_report_info = report_info;
+        headless_report_info.time_to_first_frame_msec = 12.5;
+        CHECK_THAT(benchmark.GetReport(headless_report_info), ContainsSubstring(R"("time_to_first_frame_msec": 12.5000)"));
+    }
+
+    SECTION("GPU debug group timings are reported only when available")
+    {
+        CHECK(benchmark.GetReport(report_info).find("gpu_debug_group_timings") == std::string::npos);
+
+        AppBenchmark::ReportInfo gpu_timings_report_info = report_info;
+        gpu_timings_report_info.gpu_debug_group_timings = "\nGPU timings of 'Render Queue' debug groups in 1 command lists:\n  - Frame: 0.007000 ms.";
+        CHECK_THAT(benchmark.GetReport(gpu_timings_report_info),
+                   ContainsSubstring(R"("gpu_debug_group_timings": "\nGPU timings of 'Render Queue' debug groups in 1 command lists:\n  - Frame: 0.007000 ms.",)"));
+    }
+}
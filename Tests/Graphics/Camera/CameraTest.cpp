@@ -0,0 +1,93 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/CameraTest.cpp
+Camera unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Data/Types.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+static const FloatSize           g_test_screen_size { 640.f, 480.f };
+static const Camera::Orientation g_test_orientation { { 0.f, 0.f, -10.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f } };
+
+inline Camera SetupCamera(Camera::Projection projection)
+{
+    Camera camera;
+    camera.Resize(g_test_screen_size);
+    camera.SetProjection(projection);
+    camera.SetParameters({ 0.01F, 100.F, 90.F });
+    camera.ResetOrientation(g_test_orientation);
+    return camera;
+}
+
+TEST_CASE("Camera projected screen size", "[camera][lod]")
+{
+    SECTION("Perspective projection")
+    {
+        const Camera camera = SetupCamera(Camera::Projection::Perspective);
+        CHECK(camera.GetProjectedScreenSize({ 0.f, 0.f, 0.f }, 1.F) == Catch::Approx(g_test_screen_size.GetHeight() / 10.F));
+        CHECK(camera.GetProjectedScreenSize({ 0.f, 0.f, 10.f }, 1.F) == Catch::Approx(g_test_screen_size.GetHeight() / 20.F));
+        CHECK(camera.GetProjectedScreenSize({ 3.f, 2.f, 0.f }, 2.F) == Catch::Approx(g_test_screen_size.GetHeight() / 5.F));
+    }
+
+    SECTION("Perspective projection of sphere around camera")
+    {
+        const Camera camera = SetupCamera(Camera::Projection::Perspective);
+        CHECK(camera.GetProjectedScreenSize({ 0.f, 0.f, -10.f }, 1.F) == g_test_screen_size.GetHeight());
+        CHECK(camera.GetProjectedScreenSize({ 0.f, 0.f, -20.f }, 1.F) == g_test_screen_size.GetHeight());
+    }
+
+    SECTION("Orthogonal projection")
+    {
+        const Camera camera = SetupCamera(Camera::Projection::Orthogonal);
+        CHECK(camera.GetProjectedScreenSize({ 0.f, 0.f, 0.f }, 1.F) == Catch::Approx(2.F));
+        CHECK(camera.GetProjectedScreenSize({ 0.f, 0.f, 50.f }, 5.F) == Catch::Approx(10.F));
+    }
+}
+
+TEST_CASE("Camera frustum", "[camera][frustum]")
+{
+    SECTION("Perspective projection")
+    {
+        const Camera camera = SetupCamera(Camera::Projection::Perspective);
+        const Frustum frustum = camera.GetFrustum();
+        CHECK(frustum.IsPointVisible({ 0.f, 0.f, 0.f }));
+        CHECK(frustum.IsPointVisible({ 0.f, 0.f, 50.f }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.f, 0.f, -20.f }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.f, 0.f, 100.f }));
+        CHECK_FALSE(frustum.IsPointVisible({ 50.f, 0.f, 0.f }));
+        CHECK(frustum.IsSphereVisible({ 12.f, 0.f, 0.f }, 3.F));
+    }
+
+    SECTION("Orthogonal projection")
+    {
+        const Camera camera = SetupCamera(Camera::Projection::Orthogonal);
+        const Frustum frustum = camera.GetFrustum();
+        CHECK(frustum.IsPointVisible({ 300.f, 200.f, 0.f }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.f, 250.f, 0.f }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.f, 0.f, -20.f }));
+    }
+}
@@ -0,0 +1,138 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/BvhBenchmark.cpp
+Benchmark of bounding volume hierarchy build, refit, frustum culling and ray picking
+over the cubes field of the ParallelRendering tutorial compared with brute force.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Bvh.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+#include <cmath>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr float g_scene_scale = 22.F;
+
+// Cubes are positioned in a grid with random scales same as in ParallelRendering tutorial
+static Bvh::PrimitiveBoxes GenerateCubeFieldBoxes(uint32_t cubes_grid_size, float time_sec = 0.F)
+{
+    const uint32_t cubes_count     = cubes_grid_size * cubes_grid_size * cubes_grid_size;
+    const uint32_t grid_size_sqr   = cubes_grid_size * cubes_grid_size;
+    const float    grid_size_half  = static_cast<float>(cubes_grid_size - 1) / 2.F;
+    const float    ts              = g_scene_scale / static_cast<float>(cubes_grid_size);
+    const float    median_scale    = ts / 2.F;
+    const float    scale_delta     = median_scale / 3.F;
+
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> cube_scale_distribution(median_scale - scale_delta, median_scale + scale_delta);
+
+    const BoundingBox cube_box(hlslpp::float3(-0.5F), hlslpp::float3(0.5F));
+    Bvh::PrimitiveBoxes cube_boxes(cubes_count);
+    for(uint32_t cube_index = 0U; cube_index < cubes_count; ++cube_index)
+    {
+        const float tx = static_cast<float>(cube_index % cubes_grid_size) - grid_size_half;
+        const float ty = static_cast<float>(cube_index % grid_size_sqr / cubes_grid_size) - grid_size_half;
+        const float tz = static_cast<float>(cube_index / grid_size_sqr) - grid_size_half;
+        const float cs = cube_scale_distribution(rng);
+        const hlslpp::float4x4 rotation_matrix    = hlslpp::float4x4::rotation_y(time_sec * static_cast<float>(cube_index % 7U) * 0.1F);
+        const hlslpp::float4x4 scale_matrix       = hlslpp::float4x4::scale(cs);
+        const hlslpp::float4x4 translation_matrix = hlslpp::float4x4::translation(tx * ts, ty * ts, tz * ts);
+        cube_boxes[cube_index] = cube_box.Transform(hlslpp::mul(hlslpp::mul(rotation_matrix, scale_matrix), translation_matrix));
+    }
+    return cube_boxes;
+}
+
+// Frustum looking at the cubes field corner from the camera position of ParallelRendering tutorial
+static Frustum GetCubeFieldFrustum()
+{
+    const hlslpp::float4x4 view_matrix = hlslpp::float4x4::look_at(hlslpp::float3(13.F, 13.F, -13.F), hlslpp::float3(5.F, 0.F, 0.F), hlslpp::float3(0.F, 1.F, 0.F));
+    const hlslpp::float4x4 proj_matrix = hlslpp::float4x4::perspective(
+        hlslpp::projection(hlslpp::frustum::field_of_view_y(1.F, 16.F / 9.F, 0.01F, 125.F), hlslpp::zclip::zero));
+    return Frustum(hlslpp::mul(view_matrix, proj_matrix));
+}
+
+TEST_CASE("Benchmark bounding volume hierarchy over cubes field", "[bvh][benchmark]")
+{
+    tf::Executor parallel_executor;
+    const Bvh::PrimitiveBoxes cube_boxes = GenerateCubeFieldBoxes(32U);
+    const Frustum             frustum    = GetCubeFieldFrustum();
+
+    SECTION("Build")
+    {
+        BENCHMARK_ADVANCED("Serial build of 32^3 cubes")(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&cube_boxes]() { return Bvh(cube_boxes).GetNodes().size(); });
+        };
+        BENCHMARK_ADVANCED("Parallel build of 32^3 cubes")(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&cube_boxes, &parallel_executor]() { return Bvh(cube_boxes, {}, &parallel_executor).GetNodes().size(); });
+        };
+        BENCHMARK_ADVANCED("Refit of 32^3 animated cubes")(Catch::Benchmark::Chronometer meter)
+        {
+            Bvh bvh(cube_boxes);
+            const Bvh::PrimitiveBoxes animated_cube_boxes = GenerateCubeFieldBoxes(32U, 1.F);
+            meter.measure([&bvh, &animated_cube_boxes]() { bvh.Refit(animated_cube_boxes); return bvh.GetBounds().GetSurfaceArea(); });
+        };
+    }
+
+    SECTION("Frustum culling")
+    {
+        const Bvh bvh(cube_boxes, {}, &parallel_executor);
+        BENCHMARK("Brute force culling of 32^3 cubes")
+        {
+            Data::Size visible_count = 0U;
+            for(const BoundingBox& cube_box : cube_boxes)
+            {
+                visible_count += frustum.IsBoxVisible(cube_box) ? 1U : 0U;
+            }
+            return visible_count;
+        };
+        BENCHMARK("BVH culling of 32^3 cubes")
+        {
+            return bvh.Query(frustum).size();
+        };
+    }
+
+    SECTION("Ray picking")
+    {
+        const Bvh bvh(cube_boxes, {}, &parallel_executor);
+        const Ray ray{ hlslpp::float3(13.F, 13.F, -13.F), hlslpp::normalize(hlslpp::float3(-13.F, -12.F, 13.F)) };
+        const hlslpp::float3 inverse_direction = hlslpp::float3(1.F) / ray.direction;
+        BENCHMARK("Brute force picking of 32^3 cubes")
+        {
+            float closest_distance = ray.max_distance;
+            for(const BoundingBox& cube_box : cube_boxes)
+            {
+                if (const std::optional<float> distance = Bvh::IntersectBox(cube_box, ray.origin, inverse_direction, closest_distance); distance)
+                    closest_distance = *distance;
+            }
+            return closest_distance;
+        };
+        BENCHMARK("BVH picking of 32^3 cubes")
+        {
+            return bvh.Intersect(ray).has_value();
+        };
+    }
+}
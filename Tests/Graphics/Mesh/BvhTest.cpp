@@ -0,0 +1,223 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/BvhTest.cpp
+Unit tests of bounding volume hierarchy build, refit, ray and frustum queries
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/Bvh.h>
+#include <Methane/Graphics/MeshBvh.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <random>
+#include <set>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static Bvh::PrimitiveBoxes GenerateRandomBoxes(size_t boxes_count, uint32_t seed)
+{
+    std::mt19937 rng(seed); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-50.F, 50.F);
+    std::uniform_real_distribution<float> size_distribution(0.1F, 2.F);
+
+    Bvh::PrimitiveBoxes boxes(boxes_count);
+    for(BoundingBox& box : boxes)
+    {
+        const hlslpp::float3 position(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 size(size_distribution(rng), size_distribution(rng), size_distribution(rng));
+        box = BoundingBox(position, position + size);
+    }
+    return boxes;
+}
+
+static bool IsBoxContained(const BoundingBox& outer_box, const BoundingBox& inner_box)
+{
+    return outer_box.Contains(inner_box.min) && outer_box.Contains(inner_box.max);
+}
+
+static void CheckBvhStructure(const Bvh& bvh)
+{
+    const Bvh::Nodes& nodes = bvh.GetNodes();
+    const Bvh::PrimitiveIndices& primitive_indices = bvh.GetPrimitiveIndices();
+    CHECK(std::set<Data::Index>(primitive_indices.begin(), primitive_indices.end()).size() == bvh.GetPrimitiveCount());
+    CHECK(bvh.GetDepth() <= Bvh::max_depth);
+
+    Data::Size leaf_primitives_count = 0U;
+    for(size_t node_index = 0; node_index < nodes.size(); ++node_index)
+    {
+        const Bvh::Node& node = nodes[node_index];
+        const BoundingBox node_bounds = node.GetBounds();
+        if (node.IsLeaf())
+        {
+            leaf_primitives_count += node.count;
+            for(uint32_t offset = node.offset; offset < node.offset + node.count; ++offset)
+            {
+                CHECK(IsBoxContained(node_bounds, bvh.GetPrimitiveBoxes()[primitive_indices[offset]]));
+            }
+            continue;
+        }
+
+        REQUIRE(node.offset > node_index);
+        REQUIRE(node.offset + 1 < nodes.size());
+        CHECK(IsBoxContained(node_bounds, nodes[node.offset].GetBounds()));
+        CHECK(IsBoxContained(node_bounds, nodes[node.offset + 1].GetBounds()));
+    }
+    CHECK(leaf_primitives_count == bvh.GetPrimitiveCount());
+}
+
+static std::set<Data::Index> QueryBruteForce(const Bvh::PrimitiveBoxes& boxes, const Frustum& frustum)
+{
+    std::set<Data::Index> visible_primitives;
+    for(Data::Index primitive_index = 0U; primitive_index < boxes.size(); ++primitive_index)
+    {
+        if (frustum.IsBoxVisible(boxes[primitive_index]))
+            visible_primitives.insert(primitive_index);
+    }
+    return visible_primitives;
+}
+
+static std::optional<float> IntersectBruteForce(const Bvh::PrimitiveBoxes& boxes, const Ray& ray)
+{
+    const hlslpp::float3 inverse_direction = hlslpp::float3(1.F) / ray.direction;
+    std::optional<float> closest_distance;
+    for(const BoundingBox& box : boxes)
+    {
+        const std::optional<float> distance = Bvh::IntersectBox(box, ray.origin, inverse_direction, ray.max_distance);
+        if (distance && (!closest_distance || *distance < *closest_distance))
+            closest_distance = distance;
+    }
+    return closest_distance;
+}
+
+// Frustum of identity view-projection matrix is the clip space box [-1, 1] x [-1, 1] x [0, 1], scaled here to world units
+static const Frustum g_test_frustum(hlslpp::float4x4::scale(1.F / 20.F, 1.F / 20.F, 1.F / 40.F));
+
+TEST_CASE("Bounding Volume Hierarchy", "[bvh]")
+{
+    const Bvh::PrimitiveBoxes boxes = GenerateRandomBoxes(5000U, 1234U);
+
+    SECTION("Empty hierarchy")
+    {
+        const Bvh bvh;
+        CHECK(bvh.IsEmpty());
+        CHECK(bvh.Query(g_test_frustum).empty());
+        CHECK_FALSE(bvh.Intersect(Ray{ hlslpp::float3(0.F), hlslpp::float3(0.F, 0.F, 1.F) }).has_value());
+    }
+
+    SECTION("Serial build")
+    {
+        const Bvh bvh(boxes);
+        CheckBvhStructure(bvh);
+    }
+
+    SECTION("Parallel build")
+    {
+        tf::Executor parallel_executor;
+        Bvh::Settings settings;
+        settings.parallel_build_size = 256U;
+        const Bvh bvh(boxes, settings, &parallel_executor);
+        CheckBvhStructure(bvh);
+    }
+
+    SECTION("Frustum query equals brute force culling")
+    {
+        const Bvh bvh(boxes);
+        const Bvh::PrimitiveIndices visible_primitives = bvh.Query(g_test_frustum);
+        const std::set<Data::Index> visible_primitives_set(visible_primitives.begin(), visible_primitives.end());
+        CHECK(visible_primitives_set.size() == visible_primitives.size());
+        CHECK(!visible_primitives_set.empty());
+        CHECK(visible_primitives_set.size() < boxes.size());
+        CHECK(visible_primitives_set == QueryBruteForce(boxes, g_test_frustum));
+    }
+
+    SECTION("Ray intersection equals brute force closest hit")
+    {
+        const Bvh bvh(boxes);
+        std::mt19937 rng(4321U); // NOSONAR - using pseudorandom generator is safe here
+        std::uniform_real_distribution<float> direction_distribution(-1.F, 1.F);
+        for(uint32_t ray_index = 0U; ray_index < 100U; ++ray_index)
+        {
+            const Ray ray{
+                hlslpp::float3(0.F, 0.F, -100.F),
+                hlslpp::normalize(hlslpp::float3(direction_distribution(rng) / 2.F, direction_distribution(rng) / 2.F, 1.F))
+            };
+            const std::optional<Bvh::Hit> hit = bvh.Intersect(ray);
+            const std::optional<float> reference_distance = IntersectBruteForce(boxes, ray);
+            REQUIRE(hit.has_value() == reference_distance.has_value());
+            if (hit)
+            {
+                CHECK(hit->distance == Catch::Approx(*reference_distance));
+            }
+        }
+    }
+
+    SECTION("Refit with moved primitives")
+    {
+        Bvh bvh(boxes);
+        Bvh::PrimitiveBoxes moved_boxes = boxes;
+        for(BoundingBox& box : moved_boxes)
+        {
+            const hlslpp::float3 offset(static_cast<float>(box.min.y) / 10.F, 0.F, 5.F);
+            box = BoundingBox(box.min + offset, box.max + offset);
+        }
+
+        bvh.Refit(moved_boxes);
+        CheckBvhStructure(bvh);
+
+        const Bvh::PrimitiveIndices visible_primitives = bvh.Query(g_test_frustum);
+        CHECK(std::set<Data::Index>(visible_primitives.begin(), visible_primitives.end()) == QueryBruteForce(moved_boxes, g_test_frustum));
+    }
+}
+
+TEST_CASE("Mesh Bounding Volume Hierarchy", "[bvh][mesh]")
+{
+    const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 32U, 32U);
+    const MeshBvh mesh_bvh(sphere_mesh);
+    CHECK(mesh_bvh.GetTriangleCount() == sphere_mesh.GetIndexCount() / 3);
+
+    SECTION("Ray hits the closest triangle")
+    {
+        const std::optional<MeshBvh::Hit> hit = mesh_bvh.Intersect(Ray{ hlslpp::float3(0.1F, 0.2F, -5.F), hlslpp::float3(0.F, 0.F, 1.F) });
+        REQUIRE(hit.has_value());
+        CHECK(hit->distance == Catch::Approx(4.F).margin(0.05F));
+        CHECK(hit->barycentric_u >= 0.F);
+        CHECK(hit->barycentric_v >= 0.F);
+        CHECK(hit->barycentric_u + hit->barycentric_v <= 1.F);
+    }
+
+    SECTION("Ray from inside hits the sphere once")
+    {
+        const std::optional<MeshBvh::Hit> hit = mesh_bvh.Intersect(Ray{ hlslpp::float3(0.F), hlslpp::float3(1.F, 0.F, 0.F) });
+        REQUIRE(hit.has_value());
+        CHECK(hit->distance == Catch::Approx(1.F).margin(0.05F));
+    }
+
+    SECTION("Ray misses the sphere")
+    {
+        CHECK_FALSE(mesh_bvh.Intersect(Ray{ hlslpp::float3(2.F, 0.F, -5.F), hlslpp::float3(0.F, 0.F, 1.F) }).has_value());
+        CHECK_FALSE(mesh_bvh.Intersect(Ray{ hlslpp::float3(0.F, 0.F, -5.F), hlslpp::float3(0.F, 0.F, 1.F), 3.F }).has_value());
+    }
+}
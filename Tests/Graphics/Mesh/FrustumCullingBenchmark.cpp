@@ -0,0 +1,136 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/FrustumCullingBenchmark.cpp
+Benchmark of SIMD batch frustum culling of instance bounding spheres and boxes
+compared with scalar culling on 100K and 1M instances.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCulling.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr float g_scene_scale = 100.F;
+
+static std::vector<BoundingBox> GenerateInstanceBoxes(Data::Size instances_count)
+{
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-g_scene_scale, g_scene_scale);
+    std::uniform_real_distribution<float> size_distribution(0.1F, 1.F);
+
+    std::vector<BoundingBox> boxes(instances_count);
+    for(BoundingBox& box : boxes)
+    {
+        const hlslpp::float3 position(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 size(size_distribution(rng), size_distribution(rng), size_distribution(rng));
+        box = BoundingBox(position, position + size);
+    }
+    return boxes;
+}
+
+static Frustum GetSceneFrustum()
+{
+    const hlslpp::float4x4 view_matrix = hlslpp::float4x4::look_at(hlslpp::float3(0.F, 20.F, -g_scene_scale), hlslpp::float3(0.F), hlslpp::float3(0.F, 1.F, 0.F));
+    const hlslpp::float4x4 proj_matrix = hlslpp::float4x4::perspective(
+        hlslpp::projection(hlslpp::frustum::field_of_view_y(1.F, 16.F / 9.F, 0.01F, 2.F * g_scene_scale), hlslpp::zclip::zero));
+    return Frustum(hlslpp::mul(view_matrix, proj_matrix));
+}
+
+static void BenchmarkFrustumCulling(Data::Size instances_count, const std::string& count_name)
+{
+    tf::Executor parallel_executor;
+    const Frustum frustum = GetSceneFrustum();
+    const std::vector<BoundingBox> boxes = GenerateInstanceBoxes(instances_count);
+
+    BoundingSpheres bounding_spheres(instances_count);
+    BoundingBoxes   bounding_boxes(instances_count);
+    for(Data::Index instance_index = 0U; instance_index < instances_count; ++instance_index)
+    {
+        const BoundingBox& box = boxes[instance_index];
+        bounding_spheres.Set(instance_index, box.GetCenter(), static_cast<float>(hlslpp::length(box.GetExtent())));
+        bounding_boxes.Set(instance_index, box);
+    }
+
+    FrustumCulling::VisibleIndices visible_indices;
+    visible_indices.reserve(instances_count);
+
+    BENCHMARK("Scalar culling of " + count_name + " spheres")
+    {
+        visible_indices.clear();
+        for(Data::Index instance_index = 0U; instance_index < instances_count; ++instance_index)
+        {
+            const hlslpp::float3 center(bounding_spheres.GetCentersX()[instance_index],
+                                        bounding_spheres.GetCentersY()[instance_index],
+                                        bounding_spheres.GetCentersZ()[instance_index]);
+            if (frustum.IsSphereVisible(center, bounding_spheres.GetRadiuses()[instance_index]))
+                visible_indices.push_back(instance_index);
+        }
+        return visible_indices.size();
+    };
+    BENCHMARK("SIMD culling of " + count_name + " spheres")
+    {
+        FrustumCulling::Cull(frustum, bounding_spheres, visible_indices);
+        return visible_indices.size();
+    };
+    BENCHMARK("Parallel SIMD culling of " + count_name + " spheres")
+    {
+        FrustumCulling::Cull(frustum, bounding_spheres, visible_indices, &parallel_executor);
+        return visible_indices.size();
+    };
+    BENCHMARK("Scalar culling of " + count_name + " boxes")
+    {
+        visible_indices.clear();
+        for(Data::Index instance_index = 0U; instance_index < instances_count; ++instance_index)
+        {
+            if (frustum.IsBoxVisible(boxes[instance_index]))
+                visible_indices.push_back(instance_index);
+        }
+        return visible_indices.size();
+    };
+    BENCHMARK("SIMD culling of " + count_name + " boxes")
+    {
+        FrustumCulling::Cull(frustum, bounding_boxes, visible_indices);
+        return visible_indices.size();
+    };
+    BENCHMARK("Parallel SIMD culling of " + count_name + " boxes")
+    {
+        FrustumCulling::Cull(frustum, bounding_boxes, visible_indices, &parallel_executor);
+        return visible_indices.size();
+    };
+}
+
+TEST_CASE("Benchmark frustum culling of instances", "[frustum-culling][benchmark]")
+{
+    SECTION("100K instances")
+    {
+        BenchmarkFrustumCulling(100'000U, "100K");
+    }
+
+    SECTION("1M instances")
+    {
+        BenchmarkFrustumCulling(1'000'000U, "1M");
+    }
+}
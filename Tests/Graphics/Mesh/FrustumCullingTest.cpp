@@ -0,0 +1,177 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/FrustumCullingTest.cpp
+Unit tests of SIMD batch frustum culling of bounding spheres and boxes.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCulling.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <random>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static const Frustum g_test_frustum(hlslpp::mul(
+    hlslpp::float4x4::look_at(hlslpp::float3(0.F, 0.F, -20.F), hlslpp::float3(3.F, 2.F, 0.F), hlslpp::float3(0.F, 1.F, 0.F)),
+    hlslpp::float4x4::perspective(hlslpp::projection(hlslpp::frustum::field_of_view_y(1.F, 4.F / 3.F, 0.1F, 50.F), hlslpp::zclip::zero))
+));
+
+static BoundingSpheres GenerateRandomSpheres(Data::Size spheres_count, uint32_t seed)
+{
+    std::mt19937 rng(seed); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-40.F, 40.F);
+    std::uniform_real_distribution<float> radius_distribution(0.F, 3.F);
+
+    BoundingSpheres spheres(spheres_count);
+    for(Data::Index sphere_index = 0U; sphere_index < spheres_count; ++sphere_index)
+    {
+        const hlslpp::float3 center(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        spheres.Set(sphere_index, center, radius_distribution(rng));
+    }
+    return spheres;
+}
+
+static std::vector<BoundingBox> GenerateRandomBoxes(Data::Size boxes_count, uint32_t seed)
+{
+    std::mt19937 rng(seed); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-40.F, 40.F);
+    std::uniform_real_distribution<float> size_distribution(0.1F, 5.F);
+
+    std::vector<BoundingBox> boxes(boxes_count);
+    for(BoundingBox& box : boxes)
+    {
+        const hlslpp::float3 position(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 size(size_distribution(rng), size_distribution(rng), size_distribution(rng));
+        box = BoundingBox(position, position + size);
+    }
+    return boxes;
+}
+
+static FrustumCulling::VisibleIndices CullSpheresScalar(const Frustum& frustum, const BoundingSpheres& spheres)
+{
+    FrustumCulling::VisibleIndices visible_indices;
+    for(Data::Index sphere_index = 0U; sphere_index < spheres.GetCount(); ++sphere_index)
+    {
+        const hlslpp::float3 center(spheres.GetCentersX()[sphere_index], spheres.GetCentersY()[sphere_index], spheres.GetCentersZ()[sphere_index]);
+        if (frustum.IsSphereVisible(center, spheres.GetRadiuses()[sphere_index]))
+            visible_indices.push_back(sphere_index);
+    }
+    return visible_indices;
+}
+
+static FrustumCulling::VisibleIndices CullBoxesScalar(const Frustum& frustum, const std::vector<BoundingBox>& boxes)
+{
+    FrustumCulling::VisibleIndices visible_indices;
+    for(Data::Index box_index = 0U; box_index < boxes.size(); ++box_index)
+    {
+        if (frustum.IsBoxVisible(boxes[box_index]))
+            visible_indices.push_back(box_index);
+    }
+    return visible_indices;
+}
+
+static BoundingBoxes MakeBoundingBoxes(const std::vector<BoundingBox>& boxes)
+{
+    BoundingBoxes bounding_boxes(static_cast<Data::Size>(boxes.size()));
+    for(Data::Index box_index = 0U; box_index < boxes.size(); ++box_index)
+    {
+        bounding_boxes.Set(box_index, boxes[box_index]);
+    }
+    return bounding_boxes;
+}
+
+TEST_CASE("Frustum culling of bounding spheres", "[frustum-culling]")
+{
+    SECTION("Empty spheres set is culled to empty visible list")
+    {
+        FrustumCulling::VisibleIndices visible_indices{ 1U, 2U, 3U };
+        FrustumCulling::Cull(g_test_frustum, BoundingSpheres(), visible_indices);
+        CHECK(visible_indices.empty());
+    }
+
+    SECTION("Sphere in front of camera is visible and sphere behind camera is not")
+    {
+        BoundingSpheres spheres(2U);
+        spheres.Set(0U, hlslpp::float3(3.F, 2.F, 0.F), 1.F);
+        spheres.Set(1U, hlslpp::float3(0.F, 0.F, -40.F), 1.F);
+
+        FrustumCulling::VisibleIndices visible_indices;
+        FrustumCulling::Cull(g_test_frustum, spheres, visible_indices);
+        CHECK(visible_indices == FrustumCulling::VisibleIndices{ 0U });
+    }
+
+    SECTION("Infinite frustum keeps all spheres visible")
+    {
+        const BoundingSpheres spheres = GenerateRandomSpheres(13U, 1U);
+        FrustumCulling::VisibleIndices visible_indices;
+        FrustumCulling::Cull(Frustum(), spheres, visible_indices);
+        CHECK(visible_indices.size() == spheres.GetCount());
+    }
+
+    SECTION("Batch culling matches scalar culling for count not multiple of SIMD width")
+    {
+        const BoundingSpheres spheres = GenerateRandomSpheres(1027U, 2U);
+        FrustumCulling::VisibleIndices visible_indices;
+        FrustumCulling::Cull(g_test_frustum, spheres, visible_indices);
+        CHECK_FALSE(visible_indices.empty());
+        CHECK(visible_indices.size() < spheres.GetCount());
+        CHECK(visible_indices == CullSpheresScalar(g_test_frustum, spheres));
+    }
+
+    SECTION("Parallel culling by chunks matches serial culling")
+    {
+        tf::Executor parallel_executor(4U);
+        const BoundingSpheres spheres = GenerateRandomSpheres(10001U, 3U);
+        FrustumCulling::VisibleIndices serial_visible_indices;
+        FrustumCulling::VisibleIndices parallel_visible_indices;
+        FrustumCulling::Cull(g_test_frustum, spheres, serial_visible_indices);
+        FrustumCulling::Cull(g_test_frustum, spheres, parallel_visible_indices, &parallel_executor, 255U);
+        CHECK(parallel_visible_indices == serial_visible_indices);
+        CHECK(std::is_sorted(parallel_visible_indices.begin(), parallel_visible_indices.end()));
+    }
+}
+
+TEST_CASE("Frustum culling of bounding boxes", "[frustum-culling]")
+{
+    SECTION("Batch culling matches scalar culling for count not multiple of SIMD width")
+    {
+        const std::vector<BoundingBox> boxes = GenerateRandomBoxes(1025U, 4U);
+        FrustumCulling::VisibleIndices visible_indices;
+        FrustumCulling::Cull(g_test_frustum, MakeBoundingBoxes(boxes), visible_indices);
+        CHECK_FALSE(visible_indices.empty());
+        CHECK(visible_indices.size() < boxes.size());
+        CHECK(visible_indices == CullBoxesScalar(g_test_frustum, boxes));
+    }
+
+    SECTION("Parallel culling by chunks matches serial culling")
+    {
+        tf::Executor parallel_executor(4U);
+        const BoundingBoxes boxes = MakeBoundingBoxes(GenerateRandomBoxes(10003U, 5U));
+        FrustumCulling::VisibleIndices serial_visible_indices;
+        FrustumCulling::VisibleIndices parallel_visible_indices;
+        FrustumCulling::Cull(g_test_frustum, boxes, serial_visible_indices);
+        FrustumCulling::Cull(g_test_frustum, boxes, parallel_visible_indices, &parallel_executor, 1000U);
+        CHECK(parallel_visible_indices == serial_visible_indices);
+        CHECK(std::is_sorted(parallel_visible_indices.begin(), parallel_visible_indices.end()));
+    }
+}
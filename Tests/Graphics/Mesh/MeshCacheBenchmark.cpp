@@ -0,0 +1,91 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshCacheBenchmark.cpp
+Benchmark of mesh loading from binary cache compared to procedural generation.
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/MeshCache.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+TEST_CASE("Benchmark mesh cache loading", "[mesh][cache][benchmark]")
+{
+    SECTION("Sphere mesh 256x256")
+    {
+        const Data::Bytes mesh_data = MeshCache::Serialize(SphereMesh<TestNormalVertex>(TestNormalVertex::layout, 1.F, 256U, 256U));
+
+        BENCHMARK_ADVANCED("Procedural sphere generation")(Catch::Benchmark::Chronometer meter)
+        {
+            Data::Size vertex_count = 0U;
+            meter.measure([&vertex_count]()
+            {
+                const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 256U, 256U);
+                vertex_count += sphere_mesh.GetVertexCount();
+            });
+            return vertex_count;
+        };
+
+        BENCHMARK_ADVANCED("Sphere loading from mesh cache")(Catch::Benchmark::Chronometer meter)
+        {
+            Data::Size vertex_count = 0U;
+            meter.measure([&vertex_count, &mesh_data]()
+            {
+                const MeshCache mesh_cache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size())));
+                vertex_count += mesh_cache.GetVertexCount();
+            });
+            return vertex_count;
+        };
+    }
+
+    SECTION("Icosahedron mesh with 6 subdivisions")
+    {
+        const Data::Bytes mesh_data = MeshCache::Serialize(IcosahedronMesh<TestNormalVertex>(TestNormalVertex::layout, 1.F, 6U, true));
+
+        BENCHMARK_ADVANCED("Procedural icosahedron generation")(Catch::Benchmark::Chronometer meter)
+        {
+            Data::Size vertex_count = 0U;
+            meter.measure([&vertex_count]()
+            {
+                const IcosahedronMesh<TestNormalVertex> ico_mesh(TestNormalVertex::layout, 1.F, 6U, true);
+                vertex_count += ico_mesh.GetVertexCount();
+            });
+            return vertex_count;
+        };
+
+        BENCHMARK_ADVANCED("Icosahedron loading from mesh cache")(Catch::Benchmark::Chronometer meter)
+        {
+            Data::Size vertex_count = 0U;
+            meter.measure([&vertex_count, &mesh_data]()
+            {
+                const MeshCache mesh_cache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size())));
+                vertex_count += mesh_cache.GetVertexCount();
+            });
+            return vertex_count;
+        };
+    }
+}
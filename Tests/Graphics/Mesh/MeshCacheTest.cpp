@@ -0,0 +1,198 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshCacheTest.cpp
+Unit tests of binary mesh cache serialization and loading
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/MeshCache.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <cmath>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+// Provides non-owning chunks of in-memory data, similar to memory mapped files
+class TestMemoryProvider : public Data::IProvider
+{
+public:
+    explicit TestMemoryProvider(const Data::Bytes& data) : m_data(data) { }
+
+    bool HasData(const std::string& path) const noexcept override { return path == "mesh.bin"; }
+    Data::Chunk GetData(const std::string&) const override        { return Data::Chunk(m_data.data(), static_cast<Data::Size>(m_data.size())); }
+    std::vector<std::string> GetFiles(const std::string&) const override { return { "mesh.bin" }; }
+
+private:
+    const Data::Bytes& m_data;
+};
+
+static void CheckMeshCacheEqualsMesh(const MeshCache& mesh_cache, const Mesh& mesh)
+{
+    CHECK(mesh_cache.GetType() == mesh.GetType());
+    CHECK(mesh_cache.GetVertexLayout() == mesh.GetVertexLayout());
+    CHECK(mesh_cache.GetVertexSize() == mesh.GetVertexSize());
+    CHECK(mesh_cache.GetVertexCount() == mesh.GetVertexCount());
+    CHECK(mesh_cache.GetIndexFormat() == mesh.GetIndexFormat());
+    CHECK(mesh_cache.GetIndexDataSize() == mesh.GetIndexDataSize(mesh.GetIndexFormat()));
+    CHECK(mesh_cache.GetIndices() == mesh.GetIndices());
+    REQUIRE(mesh_cache.GetVertexDataSize() == mesh.GetVertexDataSize());
+    CHECK(!std::memcmp(mesh_cache.GetVertexData(), mesh.GetVertexData(), mesh.GetVertexDataSize()));
+}
+
+TEST_CASE("Mesh Cache Round Trip", "[mesh][cache]")
+{
+    SECTION("Sphere mesh with 16-bit indices")
+    {
+        const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 2.F, 32U, 32U);
+        const Data::Bytes mesh_data = MeshCache::Serialize(sphere_mesh);
+        const MeshCache mesh_cache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size())));
+
+        CheckMeshCacheEqualsMesh(mesh_cache, sphere_mesh);
+        CHECK(mesh_cache.GetIndexFormat() == PixelFormat::R16Uint);
+        CHECK(mesh_cache.GetSubsets().empty());
+
+        const MeshCache::Bounds& bounds = mesh_cache.GetBounds();
+        CHECK(std::abs(bounds.min.GetY() + 2.F) < 0.001F);
+        CHECK(std::abs(bounds.max.GetY() - 2.F) < 0.001F);
+        CHECK(bounds.min.GetX() >= -2.001F);
+        CHECK(bounds.max.GetX() <= 2.001F);
+    }
+
+    SECTION("Sphere mesh with 32-bit indices")
+    {
+        const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 258U, 258U);
+        const MeshCache mesh_cache(Data::Chunk(MeshCache::Serialize(sphere_mesh)));
+        CheckMeshCacheEqualsMesh(mesh_cache, sphere_mesh);
+        CHECK(mesh_cache.GetIndexFormat() == PixelFormat::R32Uint);
+    }
+
+    SECTION("Uber mesh with subsets")
+    {
+        UberMesh<TestNormalVertex> uber_mesh(TestNormalVertex::layout);
+        uber_mesh.AddSubMesh(CubeMesh<TestNormalVertex>(TestNormalVertex::layout), false);
+        uber_mesh.AddSubMesh(SphereMesh<TestNormalVertex>(TestNormalVertex::layout, 1.F, 16U, 16U), true);
+
+        const Data::Bytes mesh_data = MeshCache::Serialize(uber_mesh, uber_mesh.GetSubsets());
+        const MeshCache mesh_cache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size())));
+        CheckMeshCacheEqualsMesh(mesh_cache, uber_mesh);
+
+        REQUIRE(mesh_cache.GetSubsets().size() == uber_mesh.GetSubsetCount());
+        for(size_t subset_index = 0; subset_index < uber_mesh.GetSubsetCount(); ++subset_index)
+        {
+            const Mesh::Subset& cache_subset = mesh_cache.GetSubsets()[subset_index];
+            const Mesh::Subset& mesh_subset  = uber_mesh.GetSubset(subset_index);
+            CHECK(cache_subset.mesh_type == mesh_subset.mesh_type);
+            CHECK(cache_subset.vertices.offset == mesh_subset.vertices.offset);
+            CHECK(cache_subset.vertices.count == mesh_subset.vertices.count);
+            CHECK(cache_subset.indices.offset == mesh_subset.indices.offset);
+            CHECK(cache_subset.indices.count == mesh_subset.indices.count);
+            CHECK(cache_subset.indices_adjusted == mesh_subset.indices_adjusted);
+        }
+    }
+
+    SECTION("Mesh cache references provider data without copying")
+    {
+        const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+        const Data::Bytes mesh_data = MeshCache::Serialize(cube_mesh);
+        const TestMemoryProvider data_provider(mesh_data);
+        const MeshCache mesh_cache(data_provider, "mesh.bin");
+
+        CheckMeshCacheEqualsMesh(mesh_cache, cube_mesh);
+        CHECK(mesh_cache.GetVertexData() > mesh_data.data());
+        CHECK(mesh_cache.GetIndexData() + mesh_cache.GetIndexDataSize() <= mesh_data.data() + mesh_data.size());
+    }
+
+    SECTION("Copied and moved mesh cache references its own data")
+    {
+        const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+        MeshCache source_cache(Data::Chunk(MeshCache::Serialize(cube_mesh)));
+        const MeshCache copied_cache(source_cache);
+        const MeshCache moved_cache(std::move(source_cache));
+
+        CheckMeshCacheEqualsMesh(copied_cache, cube_mesh);
+        CheckMeshCacheEqualsMesh(moved_cache, cube_mesh);
+        CHECK(copied_cache.GetVertexData() != moved_cache.GetVertexData());
+    }
+}
+
+TEST_CASE("Mesh Cache Validation", "[mesh][cache]")
+{
+    const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+    Data::Bytes mesh_data = MeshCache::Serialize(cube_mesh);
+
+    SECTION("Empty data is rejected")
+    {
+        CHECK_THROWS_AS(MeshCache(Data::Chunk()), MeshCache::FormatException);
+    }
+
+    SECTION("Truncated data is rejected")
+    {
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size() - 2U))), MeshCache::FormatException);
+    }
+
+    SECTION("Invalid signature is rejected")
+    {
+        mesh_data[0] = Data::Byte{ 'X' };
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(std::move(mesh_data))), MeshCache::FormatException);
+    }
+
+    SECTION("Unsupported version is rejected")
+    {
+        const uint32_t next_version = MeshCache::format_version + 1U;
+        std::memcpy(mesh_data.data() + 4, &next_version, sizeof(next_version));
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(std::move(mesh_data))), MeshCache::FormatException);
+    }
+
+    SECTION("Unknown mesh type is rejected")
+    {
+        const uint32_t unknown_mesh_type = 1000U;
+        std::memcpy(mesh_data.data() + 8, &unknown_mesh_type, sizeof(unknown_mesh_type));
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(std::move(mesh_data))), MeshCache::FormatException);
+    }
+
+    SECTION("Unknown subset mesh type is rejected")
+    {
+        UberMesh<TestNormalVertex> uber_mesh(TestNormalVertex::layout);
+        uber_mesh.AddSubMesh(CubeMesh<TestNormalVertex>(TestNormalVertex::layout), false);
+        Data::Bytes uber_mesh_data = MeshCache::Serialize(uber_mesh, uber_mesh.GetSubsets());
+
+        uint32_t subsets_offset = 0U;
+        std::memcpy(&subsets_offset, uber_mesh_data.data() + 124, sizeof(subsets_offset));
+        const uint32_t unknown_mesh_type = 1000U;
+        std::memcpy(uber_mesh_data.data() + subsets_offset, &unknown_mesh_type, sizeof(unknown_mesh_type));
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(std::move(uber_mesh_data))), MeshCache::FormatException);
+    }
+
+    SECTION("Index out of vertices range is rejected")
+    {
+        const MeshCache mesh_cache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size())));
+        REQUIRE(mesh_cache.GetIndexFormat() == PixelFormat::R16Uint);
+        const auto index_offset = static_cast<size_t>(mesh_cache.GetIndexData() - mesh_data.data());
+        const auto out_of_range_index = static_cast<Mesh::Index16>(mesh_cache.GetVertexCount());
+        std::memcpy(mesh_data.data() + index_offset, &out_of_range_index, sizeof(out_of_range_index));
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(std::move(mesh_data))), MeshCache::FormatException);
+    }
+}
@@ -0,0 +1,167 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshOptimizerTest.cpp
+Unit tests of mesh vertex cache, overdraw and vertex fetch optimizations
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <set>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using TrianglePositions = std::array<float, 9>;
+
+static std::multiset<TrianglePositions> GetMeshTriangles(const Mesh& mesh)
+{
+    // Triangles are identified by vertex positions with rotation to the smallest first vertex to ignore index renumbering
+    std::multiset<TrianglePositions> triangles;
+    for(Data::Index triangle_index = 0U; triangle_index < mesh.GetIndexCount() / 3; ++triangle_index)
+    {
+        std::array<Mesh::Position, 3> positions{
+            mesh.GetVertexPosition(mesh.GetIndex(triangle_index * 3)),
+            mesh.GetVertexPosition(mesh.GetIndex(triangle_index * 3 + 1)),
+            mesh.GetVertexPosition(mesh.GetIndex(triangle_index * 3 + 2))
+        };
+        const auto position_less = [](const Mesh::Position& left, const Mesh::Position& right)
+        {
+            return std::make_tuple(left.GetX(), left.GetY(), left.GetZ()) < std::make_tuple(right.GetX(), right.GetY(), right.GetZ());
+        };
+        std::rotate(positions.begin(), std::min_element(positions.begin(), positions.end(), position_less), positions.end());
+
+        TrianglePositions triangle{};
+        for(size_t corner = 0; corner < positions.size(); ++corner)
+        {
+            triangle[corner * 3]     = positions[corner].GetX();
+            triangle[corner * 3 + 1] = positions[corner].GetY();
+            triangle[corner * 3 + 2] = positions[corner].GetZ();
+        }
+        triangles.insert(triangle);
+    }
+    return triangles;
+}
+
+TEST_CASE("Vertex Cache Analysis", "[mesh][optimizer]")
+{
+    SECTION("Triangle strip order with FIFO cache")
+    {
+        const Mesh::Indices indices{ 0, 1, 2,  2, 1, 3,  2, 3, 4,  4, 3, 5 };
+        const MeshOptimizer::VertexCacheStatistics statistics = MeshOptimizer::AnalyzeVertexCache(indices, 6U, 16U);
+        CHECK(statistics.triangles_count == 4U);
+        CHECK(statistics.vertices_count == 6U);
+        CHECK(statistics.vertices_transformed == 6U);
+        CHECK(statistics.acmr == 1.5F);
+        CHECK(statistics.atvr == 1.F);
+    }
+
+    SECTION("Tiny cache reloads vertices")
+    {
+        const Mesh::Indices indices{ 0, 1, 2,  3, 4, 5,  0, 1, 2 };
+        const MeshOptimizer::VertexCacheStatistics statistics = MeshOptimizer::AnalyzeVertexCache(indices, 6U, 3U);
+        CHECK(statistics.vertices_transformed == 9U);
+        CHECK(statistics.atvr == 1.5F);
+    }
+
+    SECTION("Out of range index")
+    {
+        const Mesh::Indices indices{ 0, 1, 6 };
+        CHECK_THROWS(MeshOptimizer::AnalyzeVertexCache(indices, 6U));
+    }
+}
+
+TEST_CASE("Vertex Fetch Optimization", "[mesh][optimizer]")
+{
+    Mesh::Indices indices{ 5, 3, 1,  1, 3, 0 };
+    const MeshOptimizer::VertexRemap vertex_remap = MeshOptimizer::OptimizeVertexFetch(indices, 6U);
+    CHECK(indices == Mesh::Indices{ 0, 1, 2,  2, 1, 3 });
+    CHECK(vertex_remap == MeshOptimizer::VertexRemap{ 3, 2, 4, 1, 5, 0 });
+}
+
+TEST_CASE("Mesh Optimization", "[mesh][optimizer]")
+{
+    SECTION("Sphere mesh optimization reduces ACMR")
+    {
+        SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 64U, 64U);
+        const std::multiset<TrianglePositions> original_triangles = GetMeshTriangles(sphere_mesh);
+
+        const MeshOptimizer::Statistics statistics = sphere_mesh.Optimize();
+        CHECK(statistics.before.triangles_count == statistics.after.triangles_count);
+        CHECK(statistics.before.vertices_count == statistics.after.vertices_count);
+        CHECK(statistics.after.acmr < statistics.before.acmr);
+        CHECK(statistics.after.acmr < 1.F);
+        CHECK(GetMeshTriangles(sphere_mesh) == original_triangles);
+    }
+
+    SECTION("Icosahedron mesh optimization without overdraw and fetch passes")
+    {
+        IcosahedronMesh<TestNormalVertex> ico_mesh(TestNormalVertex::layout, 1.F, 4U, true);
+        const Mesh::Indices original_indices = ico_mesh.GetIndices();
+        const std::multiset<TrianglePositions> original_triangles = GetMeshTriangles(ico_mesh);
+
+        const MeshOptimizer::Statistics statistics = ico_mesh.Optimize({ 32U, false, false });
+        CHECK(statistics.after.acmr <= statistics.before.acmr);
+        CHECK(std::is_permutation(original_indices.begin(), original_indices.end(), ico_mesh.GetIndices().begin()));
+        CHECK(GetMeshTriangles(ico_mesh) == original_triangles);
+    }
+
+    SECTION("Vertex fetch order follows index order")
+    {
+        SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 32U, 32U);
+        sphere_mesh.Optimize();
+
+        Mesh::Index max_referenced_index = 0U;
+        for(const Mesh::Index index : sphere_mesh.GetIndices())
+        {
+            REQUIRE(index <= max_referenced_index + 1U);
+            max_referenced_index = std::max(max_referenced_index, index);
+        }
+    }
+
+    SECTION("Uber mesh subsets are optimized separately")
+    {
+        const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 64U, 64U);
+        const CubeMesh<TestNormalVertex>   cube_mesh(TestNormalVertex::layout);
+        UberMesh<TestNormalVertex> uber_mesh(TestNormalVertex::layout);
+        uber_mesh.AddSubMesh(sphere_mesh, true);
+        uber_mesh.AddSubMesh(cube_mesh, false);
+
+        const MeshOptimizer::Statistics statistics = uber_mesh.Optimize();
+        CHECK(statistics.after.acmr < statistics.before.acmr);
+
+        const auto [cube_indices_ptr, cube_indices_count] = uber_mesh.GetSubsetIndices(1);
+        CHECK(*std::max_element(cube_indices_ptr, cube_indices_ptr + cube_indices_count) < cube_mesh.GetVertexCount());
+        CHECK(uber_mesh.GetIndexCount() == sphere_mesh.GetIndexCount() + cube_mesh.GetIndexCount());
+
+        const auto [sphere_indices_ptr, sphere_indices_count] = uber_mesh.GetSubsetIndices(0);
+        CHECK(*std::max_element(sphere_indices_ptr, sphere_indices_ptr + sphere_indices_count) < sphere_mesh.GetVertexCount());
+        CHECK(sphere_indices_count == sphere_mesh.GetIndexCount());
+    }
+}
@@ -0,0 +1,181 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshSimplifierTest.cpp
+Unit tests of quadric edge-collapse mesh simplification and levels of detail mesh
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/MeshSimplifier.h>
+#include <Methane/Graphics/LodMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <set>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static void CheckIndicesInRange(const Mesh::Indices& indices, Data::Size vertex_count)
+{
+    CHECK(indices.size() % 3 == 0);
+    CHECK(std::all_of(indices.begin(), indices.end(), [vertex_count](Mesh::Index index) { return index < vertex_count; }));
+}
+
+TEST_CASE("Mesh Simplifier", "[mesh][simplify]")
+{
+    const IcosahedronMesh<TestNormalVertex> ico_mesh(TestNormalVertex::layout, 1.F, 4U, true);
+    const Mesh::Indices& ico_indices = ico_mesh.GetIndices();
+
+    SECTION("Simplify to triangles budget")
+    {
+        MeshSimplifier::Settings settings;
+        settings.target_index_count = static_cast<Data::Size>(ico_indices.size() / 2);
+        settings.target_error       = 0.05F;
+
+        const MeshSimplifier::Result result = MeshSimplifier::Simplify(ico_mesh, ico_indices, settings);
+        CHECK(result.indices.size() <= settings.target_index_count);
+        CHECK(result.indices.size() > settings.target_index_count / 2);
+        CHECK(result.error > 0.F);
+        CHECK(result.error <= settings.target_error);
+        CheckIndicesInRange(result.indices, ico_mesh.GetVertexCount());
+    }
+
+    SECTION("Simplification is limited by target error")
+    {
+        MeshSimplifier::Settings settings;
+        settings.target_error = 0.F;
+
+        const MeshSimplifier::Result result = MeshSimplifier::Simplify(ico_mesh, ico_indices, settings);
+        CHECK(result.indices == ico_indices);
+        CHECK(result.error == 0.F);
+    }
+
+    SECTION("Larger error allows stronger simplification")
+    {
+        MeshSimplifier::Settings fine_settings;
+        fine_settings.target_error = 0.002F;
+        MeshSimplifier::Settings coarse_settings;
+        coarse_settings.target_error = 0.02F;
+
+        const MeshSimplifier::Result fine_result   = MeshSimplifier::Simplify(ico_mesh, ico_indices, fine_settings);
+        const MeshSimplifier::Result coarse_result = MeshSimplifier::Simplify(ico_mesh, ico_indices, coarse_settings);
+        CHECK(fine_result.indices.size() < ico_indices.size());
+        CHECK(coarse_result.indices.size() < fine_result.indices.size());
+        CHECK(fine_result.error <= coarse_result.error);
+        CHECK(coarse_result.error <= coarse_settings.target_error);
+    }
+
+    SECTION("Attribute seam vertices are preserved")
+    {
+        const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 32U, 32U);
+        const Mesh::Indices& sphere_indices = sphere_mesh.GetIndices();
+
+        MeshSimplifier::Settings settings;
+        settings.target_index_count = static_cast<Data::Size>(sphere_indices.size() / 4);
+        settings.target_error       = 0.1F;
+
+        const MeshSimplifier::Result result = MeshSimplifier::Simplify(sphere_mesh, sphere_indices, settings);
+        CHECK(result.indices.size() < sphere_indices.size());
+        CheckIndicesInRange(result.indices, sphere_mesh.GetVertexCount());
+
+        std::map<std::array<float, 3>, Data::Size> vertices_count_by_position;
+        for(Mesh::Index vertex_index : sphere_indices)
+        {
+            const Mesh::Position position = sphere_mesh.GetVertexPosition(vertex_index);
+            vertices_count_by_position[{ position.GetX(), position.GetY(), position.GetZ() }]++;
+        }
+
+        const std::set<Mesh::Index> original_vertices(sphere_indices.begin(), sphere_indices.end());
+        const std::set<Mesh::Index> simplified_vertices(result.indices.begin(), result.indices.end());
+        for(Mesh::Index vertex_index : original_vertices)
+        {
+            const Mesh::Position position = sphere_mesh.GetVertexPosition(vertex_index);
+            if (vertices_count_by_position[{ position.GetX(), position.GetY(), position.GetZ() }] > 1U)
+            {
+                CHECK(simplified_vertices.count(vertex_index) == 1U);
+            }
+        }
+    }
+}
+
+TEST_CASE("Levels of Detail Mesh", "[mesh][lod]")
+{
+    const IcosahedronMesh<TestNormalVertex> ico_mesh(TestNormalVertex::layout, 1.F, 4U, true);
+
+    MeshSimplifier::LodSettings lod_settings;
+    lod_settings.max_lods_count  = 4U;
+    lod_settings.triangles_ratio = 0.5F;
+    lod_settings.max_error       = 0.1F;
+
+    LodMesh<TestNormalVertex> lod_mesh(ico_mesh, lod_settings);
+
+    SECTION("Levels of detail chain")
+    {
+        REQUIRE(lod_mesh.GetLodCount() > 1U);
+        CHECK(lod_mesh.GetLodCount() <= lod_settings.max_lods_count);
+        CHECK(lod_mesh.GetSubsetCount() == lod_mesh.GetLodCount());
+        CHECK(lod_mesh.GetLodTriangleCount(0U) == ico_mesh.GetIndexCount() / 3);
+        CHECK(lod_mesh.GetLodError(0U) == 0.F);
+
+        for(Data::Index lod_index = 1U; lod_index < lod_mesh.GetLodCount(); ++lod_index)
+        {
+            CHECK(lod_mesh.GetLodTriangleCount(lod_index) <= lod_mesh.GetLodTriangleCount(lod_index - 1) / 2);
+            CHECK(lod_mesh.GetLodError(lod_index) >= lod_mesh.GetLodError(lod_index - 1));
+            CHECK(lod_mesh.GetLodError(lod_index) <= lod_settings.max_error);
+            CHECK(lod_mesh.GetSubset(lod_index).vertices.offset == lod_mesh.GetSubset(0U).vertices.offset);
+            CHECK(lod_mesh.GetSubset(lod_index).vertices.count == ico_mesh.GetVertexCount());
+
+            const auto [lod_indices_ptr, lod_indices_count] = lod_mesh.GetSubsetIndices(lod_index);
+            CheckIndicesInRange(Mesh::Indices(lod_indices_ptr, lod_indices_ptr + lod_indices_count), ico_mesh.GetVertexCount());
+        }
+    }
+
+    SECTION("Level of detail selection by projected screen size")
+    {
+        const Data::Index last_lod_index = lod_mesh.GetLodCount() - 1;
+        CHECK(lod_mesh.SelectLod(100000.F) == 0U);
+        CHECK(lod_mesh.SelectLod(1.F) == last_lod_index);
+
+        Data::Index prev_lod_index = last_lod_index;
+        for(float screen_size = 1.F; screen_size < 100000.F; screen_size *= 2.F)
+        {
+            const Data::Index lod_index = lod_mesh.SelectLod(screen_size);
+            CHECK(lod_index <= prev_lod_index);
+            CHECK((lod_index == 0U || lod_mesh.GetLodError(lod_index) * screen_size <= 1.F));
+            prev_lod_index = lod_index;
+        }
+    }
+
+    SECTION("Optimization keeps shared vertices order")
+    {
+        const std::vector<TestNormalVertex> vertices_before = lod_mesh.GetVertices();
+        lod_mesh.Optimize();
+        const std::vector<TestNormalVertex>& vertices_after = lod_mesh.GetVertices();
+        REQUIRE(vertices_after.size() == vertices_before.size());
+        CHECK(std::equal(vertices_before.begin(), vertices_before.end(), vertices_after.begin(),
+                         [](const TestNormalVertex& left, const TestNormalVertex& right)
+                         { return left.position == right.position; }));
+    }
+}
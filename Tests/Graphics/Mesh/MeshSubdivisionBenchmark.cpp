@@ -0,0 +1,90 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshSubdivisionBenchmark.cpp
+Benchmark of serial and parallel icosahedron mesh subdivision.
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static Data::Size MeasureIcosahedronSubdivision(uint32_t subdivisions_count, tf::Executor* parallel_executor_ptr,
+                                                Catch::Benchmark::Chronometer meter)
+{
+    Data::Size vertex_count = 0U;
+    meter.measure([&]()
+    {
+        const IcosahedronMesh<TestNormalVertex> ico_mesh(TestNormalVertex::layout, 1.F, subdivisions_count, true, parallel_executor_ptr);
+        vertex_count += ico_mesh.GetVertexCount();
+    });
+    return vertex_count;
+}
+
+TEST_CASE("Benchmark icosahedron mesh subdivision", "[mesh][subdivision][benchmark]")
+{
+    tf::Executor parallel_executor;
+
+    SECTION("Serial subdivision")
+    {
+        BENCHMARK_ADVANCED("Serial subdivision level 4")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(4U, nullptr, meter);
+        };
+        BENCHMARK_ADVANCED("Serial subdivision level 5")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(5U, nullptr, meter);
+        };
+        BENCHMARK_ADVANCED("Serial subdivision level 6")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(6U, nullptr, meter);
+        };
+        BENCHMARK_ADVANCED("Serial subdivision level 7")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(7U, nullptr, meter);
+        };
+    }
+
+    SECTION("Parallel subdivision")
+    {
+        BENCHMARK_ADVANCED("Parallel subdivision level 4")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(4U, &parallel_executor, meter);
+        };
+        BENCHMARK_ADVANCED("Parallel subdivision level 5")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(5U, &parallel_executor, meter);
+        };
+        BENCHMARK_ADVANCED("Parallel subdivision level 6")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(6U, &parallel_executor, meter);
+        };
+        BENCHMARK_ADVANCED("Parallel subdivision level 7")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureIcosahedronSubdivision(7U, &parallel_executor, meter);
+        };
+    }
+}
@@ -0,0 +1,113 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshSubdivisionTest.cpp
+Unit tests of edge hash map and serial/parallel mesh subdivision
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/EdgeHashMap.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+#include <cstring>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+template<typename VType>
+static bool AreMeshVerticesEqual(const BaseMesh<VType>& left, const BaseMesh<VType>& right)
+{
+    return left.GetVertexDataSize() == right.GetVertexDataSize() &&
+           !std::memcmp(left.GetVertexData(), right.GetVertexData(), left.GetVertexDataSize());
+}
+
+TEST_CASE("Edge Hash Map", "[mesh][edge]")
+{
+    EdgeHashMap edge_midpoints;
+
+    SECTION("Edge key does not depend on vertices order")
+    {
+        CHECK(EdgeHashMap::GetKey(1U, 2U) == EdgeHashMap::GetKey(2U, 1U));
+        CHECK(EdgeHashMap::GetKey(1U, 2U) != EdgeHashMap::GetKey(1U, 3U));
+    }
+
+    SECTION("Insert and find edges")
+    {
+        CHECK(edge_midpoints.TryEmplace(1U, 2U, 10U) == std::make_pair(Mesh::Index(10U), true));
+        CHECK(edge_midpoints.TryEmplace(2U, 1U, 11U) == std::make_pair(Mesh::Index(10U), false));
+        CHECK(edge_midpoints.GetSize() == 1U);
+        CHECK(edge_midpoints.Find(2U, 1U) == Mesh::Index(10U));
+        CHECK_FALSE(edge_midpoints.Find(2U, 3U).has_value());
+    }
+
+    SECTION("Map grows with many edges")
+    {
+        constexpr Mesh::Index edges_count = 100000U;
+        for(Mesh::Index edge_index = 0U; edge_index < edges_count; ++edge_index)
+        {
+            REQUIRE(edge_midpoints.TryEmplace(edge_index, edge_index + 1U, edge_index).second);
+        }
+        CHECK(edge_midpoints.GetSize() == edges_count);
+        CHECK(edge_midpoints.GetCapacity() >= edges_count * 2U);
+        for(Mesh::Index edge_index = 0U; edge_index < edges_count; ++edge_index)
+        {
+            REQUIRE(edge_midpoints.Find(edge_index + 1U, edge_index) == edge_index);
+        }
+
+        edge_midpoints.Clear();
+        CHECK(edge_midpoints.GetSize() == 0U);
+        CHECK_FALSE(edge_midpoints.Find(0U, 1U).has_value());
+    }
+}
+
+TEST_CASE("Icosahedron Mesh Subdivision", "[mesh][subdivision]")
+{
+    SECTION("Subdivision levels produce expected vertices and faces count")
+    {
+        for(uint32_t subdivisions_count = 0U; subdivisions_count <= 4U; ++subdivisions_count)
+        {
+            const IcosahedronMesh<TestNormalVertex> ico_mesh(TestNormalVertex::layout, 1.F, subdivisions_count, true);
+            const uint32_t faces_count = 20U << (2U * subdivisions_count);
+            CHECK(ico_mesh.GetIndexCount() == faces_count * 3U);
+            CHECK(ico_mesh.GetVertexCount() == 10U * (1U << (2U * subdivisions_count)) + 2U);
+        }
+    }
+
+    SECTION("Parallel subdivision is equal to serial subdivision")
+    {
+        tf::Executor parallel_executor;
+        const IcosahedronMesh<TestNormalVertex> serial_mesh(TestNormalVertex::layout, 1.F, 5U, true);
+        const IcosahedronMesh<TestNormalVertex> parallel_mesh(TestNormalVertex::layout, 1.F, 5U, true, &parallel_executor);
+        CHECK(serial_mesh.GetIndices() == parallel_mesh.GetIndices());
+        CHECK(AreMeshVerticesEqual(serial_mesh, parallel_mesh));
+    }
+}
+
+TEST_CASE("Sphere Mesh Parallel Generation", "[mesh][sphere]")
+{
+    tf::Executor parallel_executor;
+    const SphereMesh<TestNormalVertex> serial_mesh(TestNormalVertex::layout, 2.F, 64U, 64U);
+    const SphereMesh<TestNormalVertex> parallel_mesh(TestNormalVertex::layout, 2.F, 64U, 64U, &parallel_executor);
+    CHECK(serial_mesh.GetIndices() == parallel_mesh.GetIndices());
+    CHECK(AreMeshVerticesEqual(serial_mesh, parallel_mesh));
+}
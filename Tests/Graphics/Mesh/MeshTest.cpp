@@ -0,0 +1,86 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshTest.cpp
+Unit tests of procedural meshes generation and index format selection
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <limits>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+TEST_CASE("Mesh Index Format Selection", "[mesh][index]")
+{
+    SECTION("Small mesh uses 16-bit indices")
+    {
+        const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+        CHECK(cube_mesh.GetIndexFormat() == PixelFormat::R16Uint);
+        CHECK(cube_mesh.GetIndexDataSize(PixelFormat::R16Uint) == cube_mesh.GetIndexCount() * sizeof(Mesh::Index16));
+
+        const Mesh::Indices16 indices_16 = cube_mesh.GetIndices16();
+        REQUIRE(indices_16.size() == cube_mesh.GetIndexCount());
+        CHECK(std::equal(indices_16.begin(), indices_16.end(), cube_mesh.GetIndices().begin()));
+    }
+
+    SECTION("High-tessellation sphere uses 32-bit indices")
+    {
+        const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 258U, 258U);
+        REQUIRE(sphere_mesh.GetVertexCount() > std::numeric_limits<Mesh::Index16>::max() + 1U);
+        CHECK(sphere_mesh.GetIndexFormat() == PixelFormat::R32Uint);
+        CHECK(sphere_mesh.GetIndexDataSize(PixelFormat::R32Uint) == sphere_mesh.GetIndexDataSize());
+
+        const Mesh::Indices& indices = sphere_mesh.GetIndices();
+        CHECK(*std::max_element(indices.begin(), indices.end()) == sphere_mesh.GetVertexCount() - 1);
+        CHECK_THROWS(sphere_mesh.GetIndices16());
+    }
+}
+
+TEST_CASE("Uber Mesh With 32-bit Indices", "[mesh][uber]")
+{
+    const SphereMesh<TestNormalVertex> sphere_mesh(TestNormalVertex::layout, 1.F, 200U, 200U);
+    UberMesh<TestNormalVertex> uber_mesh(TestNormalVertex::layout);
+    uber_mesh.AddSubMesh(sphere_mesh, true);
+    uber_mesh.AddSubMesh(sphere_mesh, true);
+
+    REQUIRE(uber_mesh.GetSubsetCount() == 2U);
+    CHECK(uber_mesh.GetVertexCount() == sphere_mesh.GetVertexCount() * 2);
+    CHECK(uber_mesh.GetIndexFormat() == PixelFormat::R32Uint);
+
+    const auto [subset_indices_ptr, subset_indices_count] = uber_mesh.GetSubsetIndices(1);
+    REQUIRE(subset_indices_count == sphere_mesh.GetIndexCount());
+    CHECK(subset_indices_ptr[0] == sphere_mesh.GetIndex(0) + sphere_mesh.GetVertexCount());
+}
+
+TEST_CASE("Mesh Vertex Layout Fields", "[mesh][layout]")
+{
+    const Mesh::VertexLayout vertex_layout{ Mesh::VertexField::Position, Mesh::VertexField::PackedNormal };
+    CHECK(vertex_layout.HasField(Mesh::VertexField::Position));
+    CHECK(vertex_layout.HasField(Mesh::VertexField::PackedNormal));
+    CHECK_FALSE(vertex_layout.HasField(Mesh::VertexField::Normal));
+    CHECK_FALSE(Mesh::VertexLayout().HasField(Mesh::VertexField::Position));
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshTestHelpers.hpp
+Mesh test helper types
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Mesh.h>
+
+namespace Methane::Graphics
+{
+
+struct TestPositionVertex
+{
+    Mesh::Position position;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+    };
+};
+
+struct TestNormalVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,124 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshletsTest.cpp
+Unit tests of meshlets builder
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static void CheckMeshletsCoverMesh(const Meshlets& meshlets, const Mesh& mesh)
+{
+    const Meshlets::Settings& settings = meshlets.GetSettings();
+    Data::Size triangles_count = 0U;
+    for(const Meshlet& meshlet : meshlets.GetList())
+    {
+        CHECK(meshlet.vertex_count <= settings.max_vertices);
+        CHECK(meshlet.triangle_count <= settings.max_triangles);
+        CHECK(meshlet.triangle_offset == triangles_count);
+
+        for(Data::Index triangle_index = 0U; triangle_index < meshlet.triangle_count; ++triangle_index)
+        {
+            const Meshlets::Triangle& triangle = meshlets.GetTriangles()[meshlet.triangle_offset + triangle_index];
+            const Data::Index mesh_index_offset = (meshlet.triangle_offset + triangle_index) * 3;
+            for(size_t corner = 0; corner < triangle.size(); ++corner)
+            {
+                REQUIRE(meshlets.GetMeshVertexIndex(meshlet, triangle[corner]) == mesh.GetIndex(mesh_index_offset + static_cast<Data::Index>(corner)));
+            }
+        }
+
+        // Bounding sphere must contain all meshlet vertices
+        for(Data::Index local_index = 0U; local_index < meshlet.vertex_count; ++local_index)
+        {
+            const Mesh::Position& position = mesh.GetVertexPosition(meshlets.GetMeshVertexIndex(meshlet, static_cast<Meshlets::LocalIndex>(local_index)));
+            const float distance = hlslpp::length(position.AsHlsl() - meshlet.bounding_center.AsHlsl());
+            CHECK(distance <= meshlet.bounding_radius + 0.0001F);
+        }
+
+        triangles_count += meshlet.triangle_count;
+    }
+    CHECK(triangles_count * 3 == mesh.GetIndexCount());
+}
+
+TEST_CASE("Meshlets Building", "[mesh][meshlets]")
+{
+    SECTION("Cube mesh fits in one meshlet")
+    {
+        const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+        const Meshlets meshlets(cube_mesh);
+        REQUIRE(meshlets.GetCount() == 1U);
+        CHECK(meshlets.Get(0).vertex_count == cube_mesh.GetVertexCount());
+        CHECK(meshlets.Get(0).triangle_count * 3 == cube_mesh.GetIndexCount());
+        CHECK(meshlets.Get(0).cone_cutoff == 1.F);
+        CheckMeshletsCoverMesh(meshlets, cube_mesh);
+    }
+
+    SECTION("High-tessellation sphere meshlets with default limits")
+    {
+        const SphereMesh<TestPositionVertex> sphere_mesh(TestPositionVertex::layout, 1.F, 256U, 256U);
+        const Meshlets meshlets(sphere_mesh);
+        CHECK(meshlets.GetCount() >= sphere_mesh.GetIndexCount() / 3 / meshlets.GetSettings().max_triangles);
+        CheckMeshletsCoverMesh(meshlets, sphere_mesh);
+    }
+
+    SECTION("High-tessellation sphere meshlets with custom limits")
+    {
+        const SphereMesh<TestPositionVertex> sphere_mesh(TestPositionVertex::layout, 1.F, 128U, 128U);
+        const Meshlets meshlets(sphere_mesh, Meshlets::Settings{ 128U, 256U });
+        CheckMeshletsCoverMesh(meshlets, sphere_mesh);
+    }
+
+    SECTION("Invalid meshlet vertices limit")
+    {
+        const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+        CHECK_THROWS(Meshlets(cube_mesh, Meshlets::Settings{ 512U, 124U }));
+        CHECK_THROWS(Meshlets(cube_mesh, Meshlets::Settings{ 2U, 124U }));
+    }
+}
+
+TEST_CASE("Meshlets Cone Culling", "[mesh][meshlets][culling]")
+{
+    const SphereMesh<TestPositionVertex> sphere_mesh(TestPositionVertex::layout, 1.F, 128U, 128U);
+    const Meshlets meshlets(sphere_mesh, Meshlets::Settings{ 64U, 32U });
+    const Mesh::Position camera_position(0.F, 0.F, 10.F);
+
+    Data::Size back_facing_count = 0U;
+    for(const Meshlet& meshlet : meshlets.GetList())
+    {
+        CHECK(meshlet.cone_cutoff <= 1.F);
+        if (!meshlet.IsBackFacing(camera_position))
+            continue;
+
+        // Back-facing meshlets are located on the far side of the sphere
+        CHECK(meshlet.bounding_center.GetZ() < 0.F);
+        back_facing_count++;
+    }
+
+    CHECK(back_facing_count > 0U);
+    CHECK(back_facing_count < meshlets.GetCount());
+}
@@ -0,0 +1,222 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/VertexPackingTest.cpp
+Unit tests of vertex fields packing and packed mesh conversion
+
+******************************************************************************/
+
+#include "MeshTestHelpers.hpp"
+
+#include <Methane/Graphics/VertexPacking.h>
+#include <Methane/Graphics/PackedMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/MeshCache.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include <limits>
+#include <cmath>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+struct TestFullVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+    Mesh::TexCoord texcoord;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+        Mesh::VertexField::TexCoord,
+    };
+};
+
+struct TestPackedVertex
+{
+    Mesh::PackedPosition position;
+    Mesh::PackedNormal   normal;
+    Mesh::PackedTexCoord texcoord;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::PackedPosition,
+        Mesh::VertexField::PackedNormal,
+        Mesh::VertexField::PackedTexCoord,
+    };
+};
+
+static constexpr float g_half_relative_error = 1.F / 2048.F; // half of 10-bit mantissa precision
+static constexpr float g_normal_max_error    = 2E-4F;
+static constexpr float g_texcoord_max_error  = 0.5F / 65535.F + std::numeric_limits<float>::epsilon();
+
+static float GetDistance(const Mesh::Position& left, const Mesh::Position& right)
+{
+    return hlslpp::length(left.AsHlsl() - right.AsHlsl());
+}
+
+TEST_CASE("Half-Float Conversion", "[mesh][packing]")
+{
+    SECTION("Exactly representable values")
+    {
+        for(const float value : { 0.F, 1.F, -2.F, 0.5F, 1024.F, 65504.F, -65504.F, 6.103515625E-05F })
+        {
+            CHECK(VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(value)) == value);
+        }
+        CHECK(VertexPacking::FloatToHalf(1.F) == 0x3C00U);
+        CHECK(VertexPacking::FloatToHalf(-2.F) == 0xC000U);
+    }
+
+    SECTION("Subnormal values")
+    {
+        const float min_subnormal = std::ldexp(1.F, -24);
+        CHECK(VertexPacking::FloatToHalf(min_subnormal) == 0x0001U);
+        CHECK(VertexPacking::HalfToFloat(0x0001U) == min_subnormal);
+        CHECK(VertexPacking::FloatToHalf(min_subnormal / 2.F) == 0x0000U);
+        CHECK(VertexPacking::HalfToFloat(0x03FFU) == std::ldexp(1023.F, -24));
+    }
+
+    SECTION("Overflow and special values")
+    {
+        CHECK(VertexPacking::FloatToHalf(65520.F) == 0x7C00U);
+        CHECK(VertexPacking::FloatToHalf(-1E10F) == 0xFC00U);
+        CHECK(std::isinf(VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(std::numeric_limits<float>::infinity()))));
+        CHECK(std::isnan(VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+    }
+
+    SECTION("Rounding error is bounded by half of mantissa precision")
+    {
+        for(float value = -1000.F; value <= 1000.F; value += 0.37F)
+        {
+            const float unpacked_value = VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(value));
+            REQUIRE(std::abs(unpacked_value - value) <= std::abs(value) * g_half_relative_error + std::ldexp(1.F, -25));
+        }
+    }
+}
+
+TEST_CASE("Vertex Fields Packing", "[mesh][packing]")
+{
+    const SphereMesh<TestFullVertex> sphere_mesh(TestFullVertex::layout, 3.F, 64U, 64U);
+
+    SECTION("Position round-trip error")
+    {
+        for(const TestFullVertex& vertex : sphere_mesh.GetVertices())
+        {
+            const Mesh::Position unpacked_position = VertexPacking::UnpackPosition(VertexPacking::PackPosition(vertex.position));
+            REQUIRE(GetDistance(unpacked_position, vertex.position) <= hlslpp::length(vertex.position.AsHlsl()) * g_half_relative_error);
+        }
+    }
+
+    SECTION("Octahedral normal round-trip error")
+    {
+        for(const TestFullVertex& vertex : sphere_mesh.GetVertices())
+        {
+            const Mesh::Normal unpacked_normal = VertexPacking::UnpackNormal(VertexPacking::PackNormal(vertex.normal));
+            REQUIRE(GetDistance(unpacked_normal, vertex.normal) <= g_normal_max_error);
+        }
+
+        for(const Mesh::Normal& axis_normal : { Mesh::Normal(1.F, 0.F, 0.F), Mesh::Normal(0.F, -1.F, 0.F),
+                                                Mesh::Normal(0.F, 0.F, 1.F), Mesh::Normal(0.F, 0.F, -1.F) })
+        {
+            const Mesh::Normal unpacked_normal = VertexPacking::UnpackNormal(VertexPacking::PackNormal(axis_normal));
+            CHECK(GetDistance(unpacked_normal, axis_normal) <= g_normal_max_error);
+        }
+    }
+
+    SECTION("Texture coordinates round-trip error")
+    {
+        for(const TestFullVertex& vertex : sphere_mesh.GetVertices())
+        {
+            const Mesh::TexCoord unpacked_texcoord = VertexPacking::UnpackTexCoord(VertexPacking::PackTexCoord(vertex.texcoord));
+            REQUIRE(std::abs(unpacked_texcoord.GetX() - vertex.texcoord.GetX()) <= g_texcoord_max_error);
+            REQUIRE(std::abs(unpacked_texcoord.GetY() - vertex.texcoord.GetY()) <= g_texcoord_max_error);
+        }
+    }
+}
+
+TEST_CASE("Packed Mesh", "[mesh][packing]")
+{
+    SECTION("Packed vertex layout semantics")
+    {
+        const std::vector<std::string_view> semantics = TestPackedVertex::layout.GetSemantics();
+        const std::vector<std::string_view> expected_semantics{ "PACKED_POSITION", "PACKED_NORMAL", "PACKED_TEXCOORD" };
+        CHECK(semantics == expected_semantics);
+    }
+
+    SECTION("Packed sphere mesh conversion")
+    {
+        const SphereMesh<TestFullVertex> sphere_mesh(TestFullVertex::layout, 2.F, 64U, 64U);
+        const PackedMesh<TestPackedVertex> packed_mesh(TestPackedVertex::layout, sphere_mesh);
+
+        CHECK(packed_mesh.GetType() == sphere_mesh.GetType());
+        CHECK(packed_mesh.GetIndices() == sphere_mesh.GetIndices());
+        REQUIRE(packed_mesh.GetVertexCount() == sphere_mesh.GetVertexCount());
+        CHECK(packed_mesh.GetVertexSize() == 16U);
+        CHECK(sphere_mesh.GetVertexSize() == 32U);
+
+        for(Data::Index vertex_index = 0U; vertex_index < packed_mesh.GetVertexCount(); ++vertex_index)
+        {
+            REQUIRE(GetDistance(packed_mesh.GetVertexPosition(vertex_index), sphere_mesh.GetVertexPosition(vertex_index)) <= 2.F * g_half_relative_error);
+        }
+
+        const Data::Size full_buffers_size   = sphere_mesh.GetVertexDataSize() + sphere_mesh.GetIndexDataSize(sphere_mesh.GetIndexFormat());
+        const Data::Size packed_buffers_size = packed_mesh.GetVertexDataSize() + packed_mesh.GetIndexDataSize(packed_mesh.GetIndexFormat());
+        CHECK(packed_mesh.GetVertexDataSize() * 2U == sphere_mesh.GetVertexDataSize());
+        SUCCEED(fmt::format("Sphere mesh buffers size reduced from {} to {} bytes ({:.1f}% saved)",
+                            full_buffers_size, packed_buffers_size,
+                            100.F * static_cast<float>(full_buffers_size - packed_buffers_size) / static_cast<float>(full_buffers_size)));
+    }
+
+    SECTION("Packed mesh with full-precision position and packed normals")
+    {
+        const CubeMesh<TestNormalVertex> cube_mesh(TestNormalVertex::layout);
+        struct CubeVertex
+        {
+            Mesh::Position     position;
+            Mesh::PackedNormal normal;
+        };
+        const Mesh::VertexLayout cube_layout{ Mesh::VertexField::Position, Mesh::VertexField::PackedNormal };
+        const PackedMesh<CubeVertex> packed_mesh(cube_layout, cube_mesh);
+
+        REQUIRE(packed_mesh.GetVertexCount() == cube_mesh.GetVertexCount());
+        for(Data::Index vertex_index = 0U; vertex_index < packed_mesh.GetVertexCount(); ++vertex_index)
+        {
+            const CubeVertex& vertex = packed_mesh.GetVertices()[vertex_index];
+            CHECK(vertex.position == cube_mesh.GetVertices()[vertex_index].position);
+            CHECK(GetDistance(VertexPacking::UnpackNormal(vertex.normal), cube_mesh.GetVertices()[vertex_index].normal) <= g_normal_max_error);
+        }
+    }
+
+    SECTION("Packed mesh requires source fields")
+    {
+        const CubeMesh<TestPositionVertex> cube_mesh(TestPositionVertex::layout);
+        CHECK_THROWS_AS(PackedMesh<TestPackedVertex>(TestPackedVertex::layout, cube_mesh), Mesh::VertexLayout::IncompatibleException);
+    }
+
+    SECTION("Packed mesh cache round-trip")
+    {
+        const SphereMesh<TestFullVertex> sphere_mesh(TestFullVertex::layout, 1.F, 16U, 16U);
+        const PackedMesh<TestPackedVertex> packed_mesh(TestPackedVertex::layout, sphere_mesh);
+        const MeshCache mesh_cache(Data::Chunk(MeshCache::Serialize(packed_mesh)));
+        CHECK(mesh_cache.GetVertexLayout() == TestPackedVertex::layout);
+        CHECK(mesh_cache.GetVertexSize() == packed_mesh.GetVertexSize());
+        CHECK(mesh_cache.GetVertexDataSize() == packed_mesh.GetVertexDataSize());
+    }
+}
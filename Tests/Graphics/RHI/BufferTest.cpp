@@ -31,6 +31,7 @@ Unit-tests of the RHI Buffer
 #include <Methane/Graphics/RHI/CommandQueue.h>
 
 #include <memory>
+#include <algorithm>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -169,3 +170,84 @@ TEST_CASE("RHI Buffer Functions", "[rhi][buffer][resource]")
         CHECK_NOTHROW(buffer.GetData(compute_context.GetUploadCommandKit().GetQueue()));
     }
 }
+
+TEST_CASE("RHI Buffer Data Retained in Null Backend", "[rhi][buffer][resource][data]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor,
+        Rhi::ComputeContextSettings{ Rhi::ContextOptionMask{ Rhi::ContextOption::RetainNullResourceData } });
+    const Rhi::CommandQueue& upload_cmd_queue = compute_context.GetUploadCommandKit().GetQueue();
+    const Rhi::BufferSettings readback_buffer_settings = Rhi::BufferSettings::ForReadBackBuffer(1024);
+    const Rhi::Buffer readback_buffer = compute_context.CreateBuffer(readback_buffer_settings);
+
+    Data::Bytes test_data(512);
+    for(size_t i = 0; i < test_data.size(); ++i)
+        test_data[i] = static_cast<std::byte>(i % 251);
+
+    REQUIRE_NOTHROW(readback_buffer.SetData(upload_cmd_queue, {
+        test_data.data(), static_cast<Data::Size>(test_data.size())
+    }));
+
+    SECTION("Get Full Data")
+    {
+        const Rhi::SubResource sub_resource = readback_buffer.GetData(upload_cmd_queue);
+        REQUIRE(sub_resource.GetDataSize() == readback_buffer_settings.size);
+        CHECK(std::equal(test_data.begin(), test_data.end(), sub_resource.GetDataPtr()));
+        CHECK(std::all_of(sub_resource.GetDataPtr() + test_data.size(), sub_resource.GetDataEndPtr(),
+                          [](std::byte b) { return b == std::byte{}; }));
+    }
+
+    SECTION("Get Data Range")
+    {
+        const Rhi::SubResource sub_resource = readback_buffer.GetData(upload_cmd_queue, Rhi::BytesRange(100U, 200U));
+        REQUIRE(sub_resource.GetDataSize() == 100U);
+        CHECK(std::equal(test_data.begin() + 100, test_data.begin() + 200, sub_resource.GetDataPtr()));
+    }
+
+    SECTION("Get Data Out of Range")
+    {
+        CHECK_THROWS(readback_buffer.GetData(upload_cmd_queue, Rhi::BytesRange(1000U, 1100U)));
+    }
+
+    SECTION("Set Data Range")
+    {
+        const Data::Bytes range_data(100, std::byte{ 0xAB });
+        REQUIRE_NOTHROW(readback_buffer.SetData(upload_cmd_queue, {
+            range_data.data(), static_cast<Data::Size>(range_data.size()), {}, Rhi::BytesRange(600U, 700U)
+        }));
+
+        const Rhi::SubResource sub_resource = readback_buffer.GetData(upload_cmd_queue);
+        CHECK(std::equal(test_data.begin(), test_data.end(), sub_resource.GetDataPtr()));
+        CHECK(std::equal(range_data.begin(), range_data.end(), sub_resource.GetDataPtr() + 600));
+    }
+
+    SECTION("Set Data Range Out of Bounds")
+    {
+        const Data::Bytes range_data(100, std::byte{ 0xAB });
+        CHECK_THROWS(readback_buffer.SetData(upload_cmd_queue, {
+            range_data.data(), static_cast<Data::Size>(range_data.size()), {}, Rhi::BytesRange(1000U, 1100U)
+        }));
+    }
+
+    SECTION("Get Data while Another Upload is Pending")
+    {
+        const Rhi::Buffer upload_buffer = compute_context.CreateBuffer(readback_buffer_settings);
+        const Data::Bytes upload_data(readback_buffer_settings.size, std::byte{ 0xCD });
+        REQUIRE_NOTHROW(upload_buffer.SetData(upload_cmd_queue, {
+            upload_data.data(), static_cast<Data::Size>(upload_data.size())
+        }));
+
+        const Rhi::SubResource sub_resource = readback_buffer.GetData(upload_cmd_queue);
+        REQUIRE(sub_resource.GetDataSize() == readback_buffer_settings.size);
+        CHECK(std::equal(test_data.begin(), test_data.end(), sub_resource.GetDataPtr()));
+
+        const Rhi::SubResource upload_sub_resource = upload_buffer.GetData(upload_cmd_queue);
+        CHECK(std::equal(upload_data.begin(), upload_data.end(), upload_sub_resource.GetDataPtr()));
+        CHECK(std::equal(test_data.begin(), test_data.end(), sub_resource.GetDataPtr()));
+    }
+
+    SECTION("Get Data of Buffer without Read-back Usage")
+    {
+        const Rhi::Buffer constant_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(1024));
+        CHECK_THROWS(constant_buffer.GetData(upload_cmd_queue));
+    }
+}
@@ -31,7 +31,11 @@ Unit-tests of the RHI Command Queue
 #include <Methane/Graphics/RHI/TransferCommandList.h>
 #include <Methane/Graphics/RHI/ComputeCommandList.h>
 #include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/IQueryPool.h>
+#include <Methane/Data/TimeRange.hpp>
 #include <Methane/Graphics/Null/CommandListSet.h>
+#include <Methane/Graphics/Null/QueryPool.h>
 
 #include <memory>
 #include <taskflow/taskflow.hpp>
@@ -153,3 +157,161 @@ TEST_CASE("RHI Compute Command Queue Factory", "[rhi][compute][context][factory]
         CHECK(compute_cmd_list.GetCommandQueue().GetInterfacePtr().get() == compute_cmd_queue.GetInterfacePtr().get());
     }
 }
+
+TEST_CASE("RHI Timestamp Queries Retained in Null Backend", "[rhi][queue][query]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor,
+        Rhi::ComputeContextSettings{ Rhi::ContextOptionMask{ Rhi::ContextOption::RetainNullResourceData } });
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+
+    const Ptr<Rhi::ITimestampQueryPool> query_pool_ptr = compute_cmd_queue.GetInterface().CreateTimestampQueryPool(16U);
+    REQUIRE(query_pool_ptr);
+    CHECK(query_pool_ptr->GetGpuFrequency() == Data::g_one_sec_in_nanoseconds);
+
+    const Ptr<Rhi::ITimestampQuery> begin_query_ptr = query_pool_ptr->CreateTimestampQuery(compute_cmd_list.GetInterface());
+    const Ptr<Rhi::ITimestampQuery> end_query_ptr   = query_pool_ptr->CreateTimestampQuery(compute_cmd_list.GetInterface());
+    REQUIRE(begin_query_ptr);
+    REQUIRE(end_query_ptr);
+
+    REQUIRE_NOTHROW(begin_query_ptr->InsertTimestamp());
+    REQUIRE_NOTHROW(end_query_ptr->InsertTimestamp());
+    REQUIRE_NOTHROW(begin_query_ptr->ResolveTimestamp());
+    REQUIRE_NOTHROW(end_query_ptr->ResolveTimestamp());
+
+    CHECK(begin_query_ptr->GetGpuTimestamp() > 0U);
+    CHECK(end_query_ptr->GetGpuTimestamp() >= begin_query_ptr->GetGpuTimestamp());
+    CHECK(end_query_ptr->GetCpuNanoseconds() == end_query_ptr->GetGpuTimestamp());
+}
+
+TEST_CASE("RHI Debug Group GPU Timings in Null Backend", "[rhi][queue][query]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor,
+        Rhi::ComputeContextSettings{ Rhi::ContextOptionMask({ Rhi::ContextOption::RetainNullResourceData, Rhi::ContextOption::GpuDebugGroupTimings }) });
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::CommandListDebugGroup frame_debug_group("Frame");
+    const Rhi::CommandListDebugGroup pass_debug_group("Pass");
+    const Rhi::CommandListDebugGroup dispatch_debug_group("Dispatch");
+    constexpr Timestamp timestamp_step = Null::TimestampQueryPool::synthetic_timestamp_step;
+    REQUIRE_NOTHROW(compute_cmd_queue.SetName("Compute Queue"));
+
+    const auto execute_frame = [&](const Rhi::CommandListSet& cmd_list_set)
+    {
+        compute_cmd_list.Reset(&frame_debug_group);
+        compute_cmd_list.PushDebugGroup(pass_debug_group);
+        compute_cmd_list.PushDebugGroup(dispatch_debug_group);
+        compute_cmd_list.PopDebugGroup();
+        compute_cmd_list.PushDebugGroup(dispatch_debug_group);
+        compute_cmd_list.PopDebugGroup();
+        compute_cmd_list.PopDebugGroup();
+        compute_cmd_list.Commit();
+        compute_cmd_queue.Execute(cmd_list_set);
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+    };
+
+    const Rhi::CommandListSet frame_0_cmd_list_set({ compute_cmd_list.GetInterface() }, 0U);
+    const Rhi::CommandListSet frame_1_cmd_list_set({ compute_cmd_list.GetInterface() }, 1U);
+
+    SECTION("Nested Debug Group Timings are Aggregated")
+    {
+        REQUIRE_NOTHROW(execute_frame(frame_0_cmd_list_set));
+
+        const Rhi::CommandQueueDebugGroupTiming queue_timing = compute_cmd_queue.GetDebugGroupTiming(0U);
+        CHECK(queue_timing.name == "Compute Queue");
+        CHECK(queue_timing.count == 1U);
+        CHECK(queue_timing.duration_ns == 7U * timestamp_step);
+        REQUIRE(queue_timing.children.size() == 1U);
+
+        const Rhi::CommandQueueDebugGroupTiming* frame_timing_ptr = queue_timing.GetChild("Frame");
+        REQUIRE(frame_timing_ptr);
+        CHECK(frame_timing_ptr->count == 1U);
+        CHECK(frame_timing_ptr->duration_ns == 7U * timestamp_step);
+        REQUIRE(frame_timing_ptr->children.size() == 1U);
+
+        const Rhi::CommandQueueDebugGroupTiming* pass_timing_ptr = frame_timing_ptr->GetChild("Pass");
+        REQUIRE(pass_timing_ptr);
+        CHECK(pass_timing_ptr->count == 1U);
+        CHECK(pass_timing_ptr->duration_ns == 5U * timestamp_step);
+        REQUIRE(pass_timing_ptr->children.size() == 1U);
+
+        const Rhi::CommandQueueDebugGroupTiming* dispatch_timing_ptr = pass_timing_ptr->GetChild("Dispatch");
+        REQUIRE(dispatch_timing_ptr);
+        CHECK(dispatch_timing_ptr->count == 2U);
+        CHECK(dispatch_timing_ptr->duration_ns == 2U * timestamp_step);
+        CHECK(dispatch_timing_ptr->children.empty());
+    }
+
+    SECTION("Debug Group Timings are Accumulated within Frame")
+    {
+        REQUIRE_NOTHROW(execute_frame(frame_0_cmd_list_set));
+        REQUIRE_NOTHROW(execute_frame(frame_0_cmd_list_set));
+
+        const Rhi::CommandQueueDebugGroupTiming queue_timing = compute_cmd_queue.GetDebugGroupTiming(0U);
+        CHECK(queue_timing.count == 2U);
+        const Rhi::CommandQueueDebugGroupTiming* frame_timing_ptr = queue_timing.GetChild("Frame");
+        REQUIRE(frame_timing_ptr);
+        CHECK(frame_timing_ptr->count == 2U);
+        CHECK(frame_timing_ptr->duration_ns == 14U * timestamp_step);
+    }
+
+    SECTION("Frame Debug Group Timings are Reset on Next Frame Execution")
+    {
+        REQUIRE_NOTHROW(execute_frame(frame_0_cmd_list_set));
+        REQUIRE_NOTHROW(execute_frame(frame_1_cmd_list_set));
+        REQUIRE_NOTHROW(execute_frame(frame_0_cmd_list_set));
+
+        CHECK(compute_cmd_queue.GetDebugGroupTiming(0U).count == 1U);
+        CHECK(compute_cmd_queue.GetDebugGroupTiming(1U).count == 1U);
+        CHECK(compute_cmd_queue.GetDebugGroupTiming(2U).children.empty());
+    }
+
+    SECTION("Debug Group Timings Report")
+    {
+        REQUIRE_NOTHROW(execute_frame(frame_0_cmd_list_set));
+
+        const std::string timings_report = static_cast<std::string>(compute_cmd_queue.GetDebugGroupTiming(0U));
+        CHECK(timings_report.find("GPU timings of 'Compute Queue' debug groups in 1 command lists:") != std::string::npos);
+        CHECK(timings_report.find("\n  - Frame: 0.007000 ms. with 1 invocations count;") != std::string::npos);
+        CHECK(timings_report.find("\n    - Pass: 0.005000 ms. with 1 invocations count;") != std::string::npos);
+        CHECK(timings_report.find("\n      - Dispatch: 0.001000 ms. with 2 invocations count;") != std::string::npos);
+    }
+
+    SECTION("Debug Group Timings are Skipped when Queries are Exhausted")
+    {
+        constexpr uint32_t dispatch_groups_count = 1000U;
+        compute_cmd_list.Reset(&frame_debug_group);
+        for(uint32_t dispatch_index = 0U; dispatch_index < dispatch_groups_count; ++dispatch_index)
+        {
+            REQUIRE_NOTHROW(compute_cmd_list.PushDebugGroup(dispatch_debug_group));
+            REQUIRE_NOTHROW(compute_cmd_list.PopDebugGroup());
+        }
+        REQUIRE_NOTHROW(compute_cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(frame_0_cmd_list_set));
+        dynamic_cast<Null::CommandListSet&>(frame_0_cmd_list_set.GetInterface()).Complete();
+
+        // Frame debug group is not timed, because its end timestamp query can not be created after exhaustion
+        const Rhi::CommandQueueDebugGroupTiming queue_timing = compute_cmd_queue.GetDebugGroupTiming(0U);
+        CHECK(queue_timing.count == 1U);
+        CHECK(queue_timing.GetChild("Frame") == nullptr);
+    }
+}
+
+TEST_CASE("RHI Debug Group GPU Timings are Disabled by Default", "[rhi][queue][query]")
+{
+    const Rhi::ComputeContext compute_context(GetTestDevice(), g_parallel_executor,
+        Rhi::ComputeContextSettings{ Rhi::ContextOptionMask{ Rhi::ContextOption::RetainNullResourceData } });
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::CommandListSet compute_cmd_list_set({ compute_cmd_list.GetInterface() }, 0U);
+    const Rhi::CommandListDebugGroup frame_debug_group("Frame");
+
+    compute_cmd_list.Reset(&frame_debug_group);
+    compute_cmd_list.Commit();
+    compute_cmd_queue.Execute(compute_cmd_list_set);
+    dynamic_cast<Null::CommandListSet&>(compute_cmd_list_set.GetInterface()).Complete();
+
+    const Rhi::CommandQueueDebugGroupTiming queue_timing = compute_cmd_queue.GetDebugGroupTiming(0U);
+    CHECK(queue_timing.count == 0U);
+    CHECK(queue_timing.children.empty());
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: CommandStreamBenchmark.cpp
+Benchmarks of command list encoding cost with direct calls and replay of the recorded command stream
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/ComputeState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/Base/CommandStream.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static void EncodeDispatches(const Rhi::ComputeCommandList& cmd_list, const Rhi::ComputeState& compute_state, uint32_t dispatch_count)
+{
+    cmd_list.ResetWithState(compute_state);
+    for(uint32_t dispatch_index = 0U; dispatch_index < dispatch_count; ++dispatch_index)
+    {
+        cmd_list.SetComputeState(compute_state);
+        cmd_list.Dispatch(Rhi::ThreadGroupsCount(dispatch_index % 64U + 1U, 1U, 1U));
+    }
+}
+
+static void BenchmarkCommandStream(uint32_t dispatch_count)
+{
+    const Rhi::ComputeContext compute_context   = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue   compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ProgramArgumentAccessor buffer_accessor{ Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+    const Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors{ buffer_accessor }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { buffer_accessor, { Rhi::ResourceType::Buffer, 1U } },
+    });
+
+    const Rhi::ComputeState       compute_state = compute_context.CreateComputeState({ compute_program, Rhi::ThreadGroupSize(16, 16, 1) });
+    const Rhi::ComputeCommandList cmd_list      = compute_cmd_queue.CreateComputeCommandList();
+    auto& base_cmd_list = dynamic_cast<Base::CommandList&>(cmd_list.GetInterface());
+
+    Base::CommandStream command_stream;
+    base_cmd_list.SetCommandStream(&command_stream);
+    EncodeDispatches(cmd_list, compute_state, dispatch_count);
+    base_cmd_list.SetCommandStream(nullptr);
+
+    const std::string dispatches_name = std::to_string(dispatch_count) + " dispatches";
+    BENCHMARK("Direct encoding of " + dispatches_name)
+    {
+        EncodeDispatches(cmd_list, compute_state, dispatch_count);
+    };
+    BENCHMARK("Recording of " + dispatches_name)
+    {
+        Base::CommandStream recorded_stream;
+        base_cmd_list.SetCommandStream(&recorded_stream);
+        EncodeDispatches(cmd_list, compute_state, dispatch_count);
+        base_cmd_list.SetCommandStream(nullptr);
+        return recorded_stream.GetCommandsCount();
+    };
+    BENCHMARK("Replay of " + dispatches_name)
+    {
+        command_stream.Replay(cmd_list.GetInterface());
+    };
+}
+
+TEST_CASE("RHI Command Stream Benchmark", "[rhi][list][stream][benchmark]")
+{
+    BenchmarkCommandStream(1000U);
+    BenchmarkCommandStream(10000U);
+}
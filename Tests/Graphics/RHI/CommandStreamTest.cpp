@@ -0,0 +1,172 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: CommandStreamTest.cpp
+Unit-tests of the command list calls recording to command stream and its replay
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/TransferCommandList.h>
+#include <Methane/Graphics/RHI/ComputeState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Base/CommandStream.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+#include <Methane/Graphics/Null/ComputeCommandList.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static Rhi::Program CreateComputeProgram(const Rhi::ComputeContext& compute_context)
+{
+    const Rhi::ProgramArgumentAccessor buffer_accessor{ Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+    Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors{ buffer_accessor }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { buffer_accessor, { Rhi::ResourceType::Buffer, 1U } },
+    });
+    return compute_program;
+}
+
+static Base::CommandList& GetBaseCommandList(const Rhi::ComputeCommandList& cmd_list)
+{
+    return dynamic_cast<Base::CommandList&>(cmd_list.GetInterface());
+}
+
+TEST_CASE("RHI Command Stream Recording and Replay", "[rhi][list][stream]")
+{
+    const Rhi::ComputeContext     compute_context   = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue       compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::Program            compute_program   = CreateComputeProgram(compute_context);
+    const Rhi::ComputeState       compute_state     = compute_context.CreateComputeState({ compute_program, Rhi::ThreadGroupSize(16, 16, 1) });
+    const Rhi::ComputeCommandList cmd_list          = compute_cmd_queue.CreateComputeCommandList();
+    Base::CommandStream           command_stream;
+
+    SECTION("Command Stream is Empty by Default")
+    {
+        CHECK(command_stream.IsEmpty());
+        CHECK(command_stream.GetCommandsCount() == 0U);
+        CHECK(command_stream.GetObjects().empty());
+        CHECK(GetBaseCommandList(cmd_list).GetCommandStreamPtr() == nullptr);
+    }
+
+    SECTION("Record Command List Calls")
+    {
+        const Rhi::CommandListDebugGroup debug_group("Test");
+        GetBaseCommandList(cmd_list).SetCommandStream(&command_stream);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state, &debug_group));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        REQUIRE_NOTHROW(cmd_list.PopDebugGroup());
+        GetBaseCommandList(cmd_list).SetCommandStream(nullptr);
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+
+        CHECK_FALSE(command_stream.IsEmpty());
+        CHECK(command_stream.GetCommandsCount() == 3U);
+        REQUIRE(command_stream.GetObjects().size() == 2U);
+        CHECK(command_stream.GetObjects()[0].get() == compute_state.GetInterfacePtr().get());
+        CHECK(command_stream.GetObjects()[1].get() == debug_group.GetInterfacePtr().get());
+    }
+
+    SECTION("Recorded Objects are Referenced Once")
+    {
+        GetBaseCommandList(cmd_list).SetCommandStream(&command_stream);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetComputeState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetComputeState(compute_state));
+        CHECK(command_stream.GetCommandsCount() == 3U);
+        CHECK(command_stream.GetObjects().size() == 1U);
+    }
+
+    SECTION("Clear Command Stream")
+    {
+        GetBaseCommandList(cmd_list).SetCommandStream(&command_stream);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(command_stream.Clear());
+        CHECK(command_stream.IsEmpty());
+        CHECK(command_stream.GetCommandsCount() == 0U);
+        CHECK(command_stream.GetObjects().empty());
+    }
+
+    SECTION("Replay Command Stream to Another Command List")
+    {
+        const Rhi::CommandListDebugGroup debug_group("Test");
+        GetBaseCommandList(cmd_list).SetCommandStream(&command_stream);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state, &debug_group));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        GetBaseCommandList(cmd_list).SetCommandStream(nullptr);
+        CHECK(command_stream.GetCommandsCount() == 2U);
+
+        const Rhi::ComputeCommandList replay_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+        REQUIRE_NOTHROW(command_stream.Replay(replay_cmd_list.GetInterface()));
+        CHECK(replay_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+
+        auto& null_cmd_list = dynamic_cast<Null::ComputeCommandList&>(replay_cmd_list.GetInterface());
+        CHECK(&null_cmd_list.GetComputeState() == compute_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetTopOpenDebugGroup()->GetName() == "Test");
+    }
+
+    SECTION("Replay Command Stream Repeatedly")
+    {
+        GetBaseCommandList(cmd_list).SetCommandStream(&command_stream);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        GetBaseCommandList(cmd_list).SetCommandStream(nullptr);
+
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+        for(uint32_t replay_index = 0U; replay_index < 3U; ++replay_index)
+        {
+            REQUIRE_NOTHROW(compute_cmd_queue.Execute(cmd_list_set));
+            dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+            REQUIRE_NOTHROW(command_stream.Replay(cmd_list.GetInterface()));
+            CHECK(cmd_list.GetState() == Rhi::CommandListState::Committed);
+        }
+    }
+
+    SECTION("Can not Replay to Command List of Incompatible Type")
+    {
+        GetBaseCommandList(cmd_list).SetCommandStream(&command_stream);
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        GetBaseCommandList(cmd_list).SetCommandStream(nullptr);
+
+        const Rhi::CommandQueue transfer_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Transfer);
+        const Rhi::TransferCommandList transfer_cmd_list = transfer_cmd_queue.CreateTransferCommandList();
+        CHECK_THROWS(command_stream.Replay(transfer_cmd_list.GetInterface()));
+    }
+}
@@ -41,6 +41,9 @@ Unit-tests of the RHI ComputeContext
 #include <magic_enum.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <algorithm>
+
 using namespace Methane;
 using namespace Methane::Graphics;
 
@@ -189,6 +192,50 @@ TEST_CASE("RHI Compute Context Functions", "[rhi][compute][context]")
         CHECK_NOTHROW(compute_context.WaitForGpu(Rhi::ContextWaitFor::ComputeComplete));
         //FIXME: CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
     }
+
+    SECTION("Context Dynamic Constants Allocation")
+    {
+        const std::array<uint32_t, 4> constants{ 1U, 2U, 3U, 4U };
+        Rhi::ContextDynamicConstants first_constants;
+        REQUIRE_NOTHROW(first_constants = compute_context.AllocateDynamicConstants(sizeof(constants)));
+        REQUIRE(first_constants.buffer_ptr);
+        REQUIRE(first_constants.data_ptr);
+        CHECK(first_constants.size == sizeof(constants));
+        CHECK(first_constants.buffer_ptr->GetSettings().type == Rhi::BufferType::Constant);
+        CHECK(first_constants.buffer_ptr->GetSettings().usage_mask.HasAnyBit(Rhi::ResourceUsage::Addressable));
+        CHECK_NOTHROW(std::copy(constants.begin(), constants.end(), reinterpret_cast<uint32_t*>(first_constants.data_ptr))); // NOSONAR
+
+        const Rhi::ContextDynamicConstants second_constants = compute_context.AllocateDynamicConstants(sizeof(constants));
+        CHECK(second_constants.buffer_ptr == first_constants.buffer_ptr);
+        CHECK(second_constants.offset >= first_constants.offset + sizeof(constants));
+        CHECK(second_constants.offset % 256U == 0U);
+        CHECK(second_constants.data_ptr == first_constants.data_ptr + (second_constants.offset - first_constants.offset));
+    }
+
+    SECTION("Context Dynamic Constants Reuse After GPU Wait")
+    {
+        const Rhi::ContextDynamicConstants frame_constants = compute_context.AllocateDynamicConstants(64U);
+        CHECK_NOTHROW(compute_context.WaitForGpu(Rhi::ContextWaitFor::ComputeComplete));
+        const Rhi::ContextDynamicConstants next_frame_constants = compute_context.AllocateDynamicConstants(64U);
+        CHECK(next_frame_constants.buffer_ptr == frame_constants.buffer_ptr);
+        CHECK(next_frame_constants.offset == frame_constants.offset);
+        CHECK(next_frame_constants.data_ptr == frame_constants.data_ptr);
+    }
+
+    SECTION("Context Dynamic Constants Large Allocation")
+    {
+        const Rhi::ContextDynamicConstants small_constants = compute_context.AllocateDynamicConstants(64U);
+        const Data::Size large_constants_size = 1024U * 1024U;
+        const Rhi::ContextDynamicConstants large_constants = compute_context.AllocateDynamicConstants(large_constants_size);
+        REQUIRE(large_constants.buffer_ptr);
+        CHECK(large_constants.buffer_ptr != small_constants.buffer_ptr);
+        CHECK(large_constants.buffer_ptr->GetSettings().size >= large_constants.offset + large_constants_size);
+    }
+
+    SECTION("Context Dynamic Constants Empty Allocation Fails")
+    {
+        CHECK_THROWS(compute_context.AllocateDynamicConstants(0U));
+    }
 }
 
 TEST_CASE("RHI Compute Context Factory", "[rhi][compute][context][factory]")
@@ -58,6 +58,29 @@ TEST_CASE("RHI Compute State Functions", "[rhi][compute][state]")
         CHECK(compute_state.GetProgram().GetInterfacePtr().get() == compute_state_settings.program.GetInterfacePtr().get());
     }
 
+    SECTION("Asynchronous Construction")
+    {
+        Rhi::ComputeState compute_state;
+        REQUIRE_NOTHROW(compute_state = compute_context.CreateComputeStateAsync(compute_state_settings).get());
+        REQUIRE(compute_state.IsInitialized());
+        CHECK(compute_state.GetSettings().thread_group_size == compute_state_settings.thread_group_size);
+        CHECK(compute_state.GetProgram().GetInterfacePtr().get() == compute_state_settings.program.GetInterfacePtr().get());
+    }
+
+    SECTION("Asynchronous Construction with Program Settings")
+    {
+        const Rhi::ProgramSettingsImpl program_settings{
+            { { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Shader", "Main" } } } },
+        };
+        Rhi::ComputeState compute_state;
+        REQUIRE_NOTHROW(compute_state = compute_context.CreateComputeStateAsync(program_settings,
+                                                                                Rhi::ComputeStateSettingsImpl{ {}, compute_state_settings.thread_group_size }).get());
+        REQUIRE(compute_state.IsInitialized());
+        REQUIRE(compute_state.GetProgram().IsInitialized());
+        CHECK(compute_state.GetProgram().GetShaderTypes() == Rhi::ShaderTypes{ Rhi::ShaderType::Compute });
+        CHECK(compute_state.GetSettings().thread_group_size == compute_state_settings.thread_group_size);
+    }
+
     SECTION("Object Destroyed Callback")
     {
         auto compute_state_ptr = std::make_unique<Rhi::ComputeState>(compute_context, compute_state_settings);
@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: ProgramBindingsBenchmark.cpp
+Benchmarks of program bindings creation, copying and descriptor manager initialization with Null backend
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/RHI/IDescriptorManager.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static Rhi::Program CreateComputeProgram(const Rhi::ComputeContext& compute_context)
+{
+    const Rhi::ProgramArgumentAccessor texture_accessor{ Rhi::ShaderType::Compute, "InTexture", Rhi::ProgramArgumentAccessType::Constant };
+    const Rhi::ProgramArgumentAccessor sampler_accessor{ Rhi::ShaderType::Compute, "InSampler", Rhi::ProgramArgumentAccessType::Constant };
+    const Rhi::ProgramArgumentAccessor buffer_accessor { Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+    Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors
+            {
+                texture_accessor,
+                sampler_accessor,
+                buffer_accessor
+            }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { texture_accessor, { Rhi::ResourceType::Texture, 1U } },
+        { sampler_accessor, { Rhi::ResourceType::Sampler, 1U } },
+        { buffer_accessor,  { Rhi::ResourceType::Buffer,  1U } },
+    });
+    return compute_program;
+}
+
+static void BenchmarkProgramBindings(uint32_t bindings_count)
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Program compute_program = CreateComputeProgram(compute_context);
+    const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+        rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+    });
+    const Rhi::Buffer buffer1 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+    const Rhi::Buffer buffer2 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(64000, false, true));
+
+    const Rhi::Program::ResourceViewsByArgument compute_resource_views{
+        { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer1.GetInterface() } } },
+    };
+    const Rhi::Program::ResourceViewsByArgument replace_resource_views{
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer2.GetInterface() } } },
+    };
+
+    const std::string bindings_name = std::to_string(bindings_count) + " program bindings";
+    BENCHMARK("Creation of " + bindings_name)
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings;
+        program_bindings.reserve(bindings_count);
+        for(uint32_t bindings_index = 0U; bindings_index < bindings_count; ++bindings_index)
+        {
+            program_bindings.emplace_back(compute_program.CreateBindings(compute_resource_views, bindings_index));
+        }
+        return program_bindings.size();
+    };
+
+    const Rhi::ProgramBindings source_program_bindings = compute_program.CreateBindings(compute_resource_views);
+    BENCHMARK("Copy of " + bindings_name)
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings;
+        program_bindings.reserve(bindings_count);
+        for(uint32_t bindings_index = 0U; bindings_index < bindings_count; ++bindings_index)
+        {
+            program_bindings.emplace_back(source_program_bindings, replace_resource_views, bindings_index);
+        }
+        return program_bindings.size();
+    };
+
+    // Null program bindings are not registered in descriptor manager automatically, so they are added explicitly
+    Rhi::IDescriptorManager& descriptor_manager = dynamic_cast<Base::Context&>(compute_context.GetInterface()).GetDescriptorManager();
+    std::vector<Rhi::ProgramBindings> program_bindings;
+    program_bindings.reserve(bindings_count);
+    for(uint32_t bindings_index = 0U; bindings_index < bindings_count; ++bindings_index)
+    {
+        descriptor_manager.AddProgramBindings(program_bindings.emplace_back(compute_program.CreateBindings(compute_resource_views, bindings_index)).GetInterface());
+    }
+
+    BENCHMARK("Descriptor manager initialization completion of " + bindings_name)
+    {
+        descriptor_manager.CompleteInitialization();
+    };
+
+    descriptor_manager.Release();
+}
+
+TEST_CASE("RHI Program Bindings Benchmark", "[rhi][program][bindings][benchmark]")
+{
+    BenchmarkProgramBindings(1000U);
+    BenchmarkProgramBindings(10000U);
+}
+
+TEST_CASE("RHI Program Bindings Large Scale Benchmark", "[.][rhi][program][bindings][benchmark][large]")
+{
+    BenchmarkProgramBindings(100000U);
+    BenchmarkProgramBindings(1000000U);
+}
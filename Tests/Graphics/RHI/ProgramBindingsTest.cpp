@@ -265,4 +265,45 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
               "  - Compute shaders argument 'InTexture' (Constant) is bound to Texture 'T' subresources from index(d:0, a:0, m:0) for count(d:1, a:1, m:1) with offset 0;\n" \
               "  - Compute shaders argument 'OutBuffer' (Mutable) is bound to Buffer 'B1' subresources from index(d:0, a:0, m:0) for count(d:1, a:1, m:1) with offset 0.");
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("RHI Program Bindings Without Shader Reflection", "[rhi][program][bindings]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+
+    // Argument bindings are not initialized explicitly, so resource types are deduced from bound resources
+    const Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors
+            {
+                { Rhi::ShaderType::Compute, "InTexture", Rhi::ProgramArgumentAccessType::Constant },
+                { Rhi::ShaderType::All,     "InSampler", Rhi::ProgramArgumentAccessType::Constant },
+                { Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable  },
+            }
+        });
+
+    const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+        rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+    });
+    const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+
+    Rhi::ProgramBindings program_bindings;
+    REQUIRE_NOTHROW(program_bindings = compute_program.CreateBindings({
+        { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+    }));
+    REQUIRE(program_bindings.IsInitialized());
+    CHECK(program_bindings.GetArguments().size() == 3U);
+    CHECK(program_bindings.Get({ Rhi::ShaderType::Compute, "InTexture" }).GetSettings().resource_type == Rhi::ResourceType::Texture);
+    CHECK(program_bindings.Get({ Rhi::ShaderType::Compute, "InSampler" }).GetSettings().resource_type == Rhi::ResourceType::Sampler);
+    CHECK(program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }).GetSettings().resource_type == Rhi::ResourceType::Buffer);
+}
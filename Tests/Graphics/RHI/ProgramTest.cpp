@@ -30,6 +30,8 @@ Unit-tests of the RHI Program
 #include <Methane/Graphics/RHI/Shader.h>
 
 #include <memory>
+#include <future>
+#include <vector>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -129,4 +131,29 @@ TEST_CASE("RHI Program Factory", "[rhi][program][factory]")
         REQUIRE(program_bindings.IsInitialized());
         CHECK(program_bindings.GetInterfacePtr());
     }
+
+    SECTION("Can Create Program Asynchronously")
+    {
+        std::future<Rhi::Program> compute_program_future = compute_context.CreateProgramAsync(compute_program_settings);
+        Rhi::Program async_compute_program;
+        REQUIRE_NOTHROW(async_compute_program = compute_program_future.get());
+        REQUIRE(async_compute_program.IsInitialized());
+        CHECK(async_compute_program.GetShaderTypes() == Rhi::ShaderTypes{ Rhi::ShaderType::Compute });
+        CheckShaderSettings(async_compute_program.GetSettings().shaders, compute_program_settings.shader_set);
+    }
+
+    SECTION("Can Create Multiple Programs Asynchronously")
+    {
+        std::vector<std::future<Rhi::Program>> compute_program_futures;
+        for(size_t program_index = 0U; program_index < 8U; ++program_index)
+        {
+            compute_program_futures.emplace_back(compute_context.CreateProgramAsync(compute_program_settings));
+        }
+        for(std::future<Rhi::Program>& compute_program_future : compute_program_futures)
+        {
+            const Rhi::Program async_compute_program = compute_program_future.get();
+            REQUIRE(async_compute_program.IsInitialized());
+            CHECK(async_compute_program.GetShaderTypes() == Rhi::ShaderTypes{ Rhi::ShaderType::Compute });
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,140 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: RenderCommandListBenchmark.cpp
+Benchmarks of render commands encoding and parallel render command list reset and commit with Null backend
+
+******************************************************************************/
+
+#include "RenderCommandListFixture.hpp"
+
+#include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static void EncodeAndExecuteDraws(const RenderCommandListFixture& fixture, const Rhi::RenderCommandList& cmd_list, const Rhi::CommandListSet& cmd_list_set,
+                                  uint32_t draws_count, bool change_program_bindings, bool change_vertex_buffers)
+{
+    cmd_list.ResetWithState(fixture.GetRenderState());
+    cmd_list.SetViewState(fixture.GetViewState());
+    EncodeDraws(fixture, cmd_list, draws_count, change_program_bindings, change_vertex_buffers);
+    cmd_list.Commit();
+
+    // Command list is executed after every encoding to release resources retained by commands
+    fixture.Execute(cmd_list_set);
+}
+
+static void BenchmarkRenderCommandList(uint32_t draws_count)
+{
+    const RenderCommandListFixture  fixture(g_parallel_executor);
+    const Rhi::RenderCommandList    cmd_list = fixture.GetRenderCommandQueue().CreateRenderCommandList(fixture.GetRenderPass());
+    const Rhi::CommandListSet       cmd_list_set({ cmd_list.GetInterface() });
+    const std::string draws_name = std::to_string(draws_count) + " indexed draws";
+
+    BENCHMARK("Encoding of " + draws_name + " with validation")
+    {
+        EncodeAndExecuteDraws(fixture, cmd_list, cmd_list_set, draws_count, false, false);
+    };
+
+    cmd_list.SetValidationEnabled(false);
+    BENCHMARK("Encoding of " + draws_name + " without validation")
+    {
+        EncodeAndExecuteDraws(fixture, cmd_list, cmd_list_set, draws_count, false, false);
+    };
+    cmd_list.SetValidationEnabled(true);
+
+    BENCHMARK("Encoding of " + draws_name + " with program bindings changes")
+    {
+        EncodeAndExecuteDraws(fixture, cmd_list, cmd_list_set, draws_count, true, false);
+    };
+
+    BENCHMARK("Encoding of " + draws_name + " with vertex buffers changes")
+    {
+        EncodeAndExecuteDraws(fixture, cmd_list, cmd_list_set, draws_count, false, true);
+    };
+}
+
+static void BenchmarkParallelRenderCommandList(uint32_t draws_count, uint32_t parallel_lists_count)
+{
+    const RenderCommandListFixture       fixture(g_parallel_executor);
+    const Rhi::ParallelRenderCommandList parallel_cmd_list = fixture.GetRenderCommandQueue().CreateParallelRenderCommandList(fixture.GetRenderPass());
+    parallel_cmd_list.SetParallelCommandListsCount(parallel_lists_count);
+
+    const Rhi::CommandListSet cmd_list_set({ parallel_cmd_list.GetInterface() });
+    const std::string lists_name = std::to_string(parallel_lists_count) + " parallel render command lists";
+
+    BENCHMARK("Reset and commit of " + lists_name)
+    {
+        parallel_cmd_list.ResetWithState(fixture.GetRenderState());
+        parallel_cmd_list.SetViewState(fixture.GetViewState());
+        parallel_cmd_list.Commit();
+        fixture.Execute(cmd_list_set);
+    };
+
+    const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    const uint32_t thread_draws_count = draws_count / parallel_lists_count;
+    BENCHMARK("Parallel encoding of " + std::to_string(draws_count) + " indexed draws in " + lists_name)
+    {
+        parallel_cmd_list.ResetWithState(fixture.GetRenderState());
+        parallel_cmd_list.SetViewState(fixture.GetViewState());
+
+        tf::Taskflow task_flow;
+        task_flow.for_each(render_cmd_lists.begin(), render_cmd_lists.end(),
+            [&fixture, thread_draws_count](const Rhi::RenderCommandList& render_cmd_list)
+            {
+                EncodeDraws(fixture, render_cmd_list, thread_draws_count, true, false);
+            });
+        g_parallel_executor.run(task_flow).get();
+
+        parallel_cmd_list.Commit();
+        fixture.Execute(cmd_list_set);
+    };
+}
+
+TEST_CASE("RHI Render Command List Benchmark", "[rhi][list][render][benchmark]")
+{
+    BenchmarkRenderCommandList(1000U);
+    BenchmarkRenderCommandList(10000U);
+}
+
+TEST_CASE("RHI Render Command List Large Scale Benchmark", "[.][rhi][list][render][benchmark][large]")
+{
+    BenchmarkRenderCommandList(100000U);
+    BenchmarkRenderCommandList(1000000U);
+}
+
+TEST_CASE("RHI Parallel Render Command List Benchmark", "[rhi][list][render][parallel][benchmark]")
+{
+    BenchmarkParallelRenderCommandList(10000U, 8U);
+    BenchmarkParallelRenderCommandList(10000U, 32U);
+}
+
+TEST_CASE("RHI Parallel Render Command List Large Scale Benchmark", "[.][rhi][list][render][parallel][benchmark][large]")
+{
+    BenchmarkParallelRenderCommandList(1000000U, 8U);
+    BenchmarkParallelRenderCommandList(1000000U, 32U);
+}
@@ -0,0 +1,182 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandListFixture.hpp
+Render command list fixture with render state, buffers and program bindings in Null backend,
+which is used for draws encoding in tests and benchmarks
+
+******************************************************************************/
+
+#pragma once
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <taskflow/taskflow.hpp>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+class RenderCommandListFixture
+{
+public:
+    static constexpr uint32_t vertex_count           = 1024U;
+    static constexpr uint32_t index_count            = 3072U;
+    static constexpr uint32_t draw_index_count       = 36U;
+    static constexpr uint32_t program_bindings_count = 64U;
+    static constexpr uint32_t vertex_buffers_count   = 16U;
+
+    explicit RenderCommandListFixture(tf::Executor& parallel_executor)
+    {
+        const FrameSize frame_size(640U, 480U);
+        m_render_context = GetTestDevice().CreateRenderContext(Platform::AppEnvironment{}, parallel_executor,
+                                                               Rhi::RenderContextSettings{ frame_size });
+        m_render_cmd_queue = m_render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+
+        m_render_pattern = m_render_context.CreateRenderPattern(
+            Rhi::RenderPattern::Settings
+            {
+                Rhi::RenderPassColorAttachments
+                {
+                    Rhi::RenderPassColorAttachment(0U, m_render_context.GetSettings().color_format, 1U)
+                },
+                std::nullopt, std::nullopt,
+                Rhi::RenderPassAccessMask{},
+                true
+            });
+        m_frame_buffer = m_render_context.CreateTexture(Rhi::TextureSettings::ForFrameBuffer(m_render_context.GetSettings(), 0U));
+        m_render_pass  = m_render_pattern.CreateRenderPass({ { Rhi::TextureView(m_frame_buffer.GetInterface()) }, frame_size });
+
+        const Rhi::ProgramArgumentAccessor constants_accessor{ Rhi::ShaderType::Vertex, "g_constants", Rhi::ProgramArgumentAccessType::Mutable };
+        const Rhi::Program program = m_render_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Benchmark", "MainVS" } } },
+                    { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Benchmark", "MainPS" } } }
+                },
+                Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::ProgramInputBufferLayout{ Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" } }
+                },
+                Rhi::ProgramArgumentAccessors{ constants_accessor },
+                m_render_pattern.GetAttachmentFormats()
+            });
+        dynamic_cast<Null::Program&>(program.GetInterface()).SetArgumentBindings({
+            { constants_accessor, { Rhi::ResourceType::Buffer, 1U } }
+        });
+
+        m_render_state = m_render_context.CreateRenderState({ program, m_render_pattern });
+        m_view_state   = Rhi::ViewState({
+            { GetFrameViewport(frame_size)    },
+            { GetFrameScissorRect(frame_size) }
+        });
+
+        constexpr Data::Size vertex_size = sizeof(float) * 3U;
+        for(uint32_t buffer_index = 0U; buffer_index < vertex_buffers_count; ++buffer_index)
+        {
+            const Rhi::Buffer vertex_buffer = m_render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(vertex_count * vertex_size, vertex_size));
+            m_vertex_buffer_sets.emplace_back(Rhi::BufferType::Vertex, Refs<Rhi::Buffer>{ vertex_buffer });
+        }
+        m_index_buffer = m_render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(index_count * sizeof(uint32_t), PixelFormat::R32Uint));
+
+        const Rhi::Buffer constants_buffer = m_render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U, false, true));
+        const Rhi::ProgramBindings program_bindings = program.CreateBindings({
+            { { Rhi::ShaderType::Vertex, "g_constants" }, { { constants_buffer.GetInterface() } } }
+        });
+        for(uint32_t bindings_index = 0U; bindings_index < program_bindings_count; ++bindings_index)
+        {
+            m_program_bindings.emplace_back(program_bindings, Rhi::ProgramBindings::ResourceViewsByArgument{}, bindings_index);
+        }
+
+        m_render_context.CompleteInitialization();
+    }
+
+    [[nodiscard]] const Rhi::CommandQueue&      GetRenderCommandQueue() const noexcept { return m_render_cmd_queue; }
+    [[nodiscard]] const Rhi::RenderPass&        GetRenderPass() const noexcept         { return m_render_pass; }
+    [[nodiscard]] const Rhi::RenderState&       GetRenderState() const noexcept        { return m_render_state; }
+    [[nodiscard]] const Rhi::ViewState&         GetViewState() const noexcept          { return m_view_state; }
+    [[nodiscard]] const Rhi::Buffer&            GetIndexBuffer() const noexcept        { return m_index_buffer; }
+
+    [[nodiscard]] const Rhi::BufferSet& GetVertexBufferSet(uint32_t draw_index) const
+    { return m_vertex_buffer_sets[draw_index % vertex_buffers_count]; }
+
+    [[nodiscard]] const Rhi::ProgramBindings& GetProgramBindings(uint32_t draw_index) const
+    { return m_program_bindings[draw_index % program_bindings_count]; }
+
+    void Execute(const Rhi::CommandListSet& cmd_list_set) const
+    {
+        m_render_cmd_queue.Execute(cmd_list_set);
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+    }
+
+private:
+    Rhi::RenderContext                 m_render_context;
+    Rhi::CommandQueue                  m_render_cmd_queue;
+    Rhi::RenderPattern                 m_render_pattern;
+    Rhi::Texture                       m_frame_buffer;
+    Rhi::RenderPass                    m_render_pass;
+    Rhi::RenderState                   m_render_state;
+    Rhi::ViewState                     m_view_state;
+    std::vector<Rhi::BufferSet>        m_vertex_buffer_sets;
+    Rhi::Buffer                        m_index_buffer;
+    std::vector<Rhi::ProgramBindings>  m_program_bindings;
+};
+
+// Render state and view state are expected to be set in command list before draws encoding
+inline void EncodeDraws(const RenderCommandListFixture& fixture, const Rhi::RenderCommandList& cmd_list,
+                        uint32_t draws_count, bool change_program_bindings, bool change_vertex_buffers)
+{
+    cmd_list.SetProgramBindings(fixture.GetProgramBindings(0U));
+    cmd_list.SetVertexBuffers(fixture.GetVertexBufferSet(0U));
+    cmd_list.SetIndexBuffer(fixture.GetIndexBuffer());
+
+    for(uint32_t draw_index = 0U; draw_index < draws_count; ++draw_index)
+    {
+        if (change_program_bindings)
+            cmd_list.SetProgramBindings(fixture.GetProgramBindings(draw_index));
+
+        if (change_vertex_buffers)
+            cmd_list.SetVertexBuffers(fixture.GetVertexBufferSet(draw_index));
+
+        const uint32_t start_index = (draw_index * RenderCommandListFixture::draw_index_count) % (RenderCommandListFixture::index_count - RenderCommandListFixture::draw_index_count);
+        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, RenderCommandListFixture::draw_index_count, start_index);
+    }
+}
+
+} // namespace Methane::Graphics
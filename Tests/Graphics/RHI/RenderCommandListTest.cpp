@@ -0,0 +1,66 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandListTest.cpp
+Unit-tests of the RHI RenderCommandList using Null backend,
+checks of heap allocations absence in steady-state render commands encoding
+
+******************************************************************************/
+
+#include "RenderCommandListFixture.hpp"
+
+#include <Methane/AllocationStatistics.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Render Command List Steady-State Draws Allocations", "[rhi][list][render][allocations]")
+{
+    if (!AllocationStatistics::IsTrackingEnabled())
+        SKIP("heap allocations tracking is disabled with METHANE_ALLOCATION_STATS_ENABLED=OFF");
+#ifdef METHANE_LOGGING_ENABLED
+    SKIP("draw calls logging allocates memory for formatted names of command list and buffers");
+#endif
+
+    const RenderCommandListFixture fixture(g_parallel_executor);
+    const Rhi::RenderCommandList cmd_list = fixture.GetRenderCommandQueue().CreateRenderCommandList(fixture.GetRenderPass());
+    const Rhi::CommandListSet    cmd_list_set({ cmd_list.GetInterface() });
+
+    // First draws are encoded to warm up lazily initialized drawing state and instrumentation buffers
+    cmd_list.ResetWithState(fixture.GetRenderState());
+    cmd_list.SetViewState(fixture.GetViewState());
+    EncodeDraws(fixture, cmd_list, 16U, false, false);
+
+    const AllocationStatistics::ThreadScopeCounter allocations_counter;
+    for(uint32_t draw_index = 0U; draw_index < 1000U; ++draw_index)
+    {
+        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, RenderCommandListFixture::draw_index_count, 0U);
+    }
+    const AllocationStatistics::Counters draw_allocations = allocations_counter.GetCounters();
+
+    cmd_list.Commit();
+    fixture.Execute(cmd_list_set);
+
+    CHECK(draw_allocations.allocations_count == 0U);
+    CHECK(draw_allocations.allocated_bytes == 0U);
+}
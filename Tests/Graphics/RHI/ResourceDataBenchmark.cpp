@@ -0,0 +1,94 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: ResourceDataBenchmark.cpp
+Benchmarks of resource data upload and read-back with Null backend retaining resource data in host memory
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static Rhi::ComputeContext CreateDataRetainingContext()
+{
+    return Rhi::ComputeContext(GetTestDevice(), g_parallel_executor,
+                               Rhi::ComputeContextSettings{ Rhi::ContextOptionMask{ Rhi::ContextOption::RetainNullResourceData } });
+}
+
+static void BenchmarkBufferData(Data::Size buffer_size, const std::string& size_name)
+{
+    const Rhi::ComputeContext compute_context = CreateDataRetainingContext();
+    const Rhi::CommandQueue&  upload_cmd_queue = compute_context.GetUploadCommandKit().GetQueue();
+    const Rhi::Buffer         buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForReadBackBuffer(buffer_size));
+    const Data::Bytes         buffer_data(buffer_size, std::byte(1));
+
+    BENCHMARK("Upload of " + size_name + " buffer data")
+    {
+        buffer.SetData(upload_cmd_queue, { buffer_data.data(), buffer_size });
+    };
+    BENCHMARK("Read-back of " + size_name + " buffer data")
+    {
+        return buffer.GetData(upload_cmd_queue).GetDataSize();
+    };
+}
+
+static void BenchmarkTextureData(uint32_t texture_size, const std::string& size_name)
+{
+    const Rhi::ComputeContext compute_context = CreateDataRetainingContext();
+    const Rhi::CommandQueue&  compute_cmd_queue = compute_context.GetComputeCommandKit().GetQueue();
+    const Rhi::Texture        texture = compute_context.CreateTexture(
+        Rhi::TextureSettings::ForImage(Dimensions(texture_size, texture_size), {}, PixelFormat::RGBA8, false,
+                                       { Rhi::ResourceUsage::ShaderRead, Rhi::ResourceUsage::ReadBack }));
+    const Data::Bytes texture_data(texture.GetDataSize(), std::byte(1));
+
+    BENCHMARK("Upload of " + size_name + " texture data")
+    {
+        texture.SetData(compute_cmd_queue, { Rhi::SubResource(texture_data.data(), static_cast<Data::Size>(texture_data.size())) });
+    };
+    BENCHMARK("Read-back of " + size_name + " texture data")
+    {
+        return texture.GetData(compute_cmd_queue).GetDataSize();
+    };
+}
+
+TEST_CASE("RHI Buffer Data Benchmark", "[rhi][buffer][data][benchmark]")
+{
+    BenchmarkBufferData(1024U * 1024U,       "1 MB");
+    BenchmarkBufferData(64U * 1024U * 1024U, "64 MB");
+}
+
+TEST_CASE("RHI Texture Data Benchmark", "[rhi][texture][data][benchmark]")
+{
+    BenchmarkTextureData(1024U, "1024x1024 RGBA8");
+    BenchmarkTextureData(4096U, "4096x4096 RGBA8");
+}
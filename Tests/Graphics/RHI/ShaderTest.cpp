@@ -55,6 +55,49 @@ TEST_CASE("RHI Shader Functions", "[rhi][shader]")
         CHECK(compute_shader.GetSettings() == shader_settings);
     }
 
+    SECTION("Shader Deduplication by Context Shader Cache")
+    {
+        const Rhi::Shader compute_shader = compute_context.CreateShader(Rhi::ShaderType::Compute, shader_settings);
+        const Rhi::Shader same_shader    = compute_context.CreateShader(Rhi::ShaderType::Compute, shader_settings);
+        CHECK(same_shader.GetInterfacePtr() == compute_shader.GetInterfacePtr());
+
+        const Rhi::ContextShaderCacheStatistics statistics = compute_context.GetShaderCacheStatistics();
+        CHECK(statistics.hits_count == 1U);
+        CHECK(statistics.misses_count == 1U);
+        CHECK(statistics.shaders_count == 1U);
+    }
+
+    SECTION("Shader Deduplication with Reordered Macro-definitions")
+    {
+        const Rhi::ShaderSettings reordered_shader_settings{
+            Data::ShaderProvider::Get(),
+            Rhi::ShaderEntryFunction{ "Shader", "Main" },
+            Rhi::ShaderMacroDefinitions{ { "MACRO_BAR", "2" }, { "MACRO_FOO", "1" } }
+        };
+        const Rhi::Shader compute_shader   = compute_context.CreateShader(Rhi::ShaderType::Compute, shader_settings);
+        const Rhi::Shader reordered_shader = compute_context.CreateShader(Rhi::ShaderType::Compute, reordered_shader_settings);
+        CHECK(reordered_shader.GetInterfacePtr() == compute_shader.GetInterfacePtr());
+    }
+
+    SECTION("Different Shaders are not Deduplicated")
+    {
+        const Rhi::ShaderSettings other_shader_settings{
+            Data::ShaderProvider::Get(),
+            Rhi::ShaderEntryFunction{ "Shader", "Main" },
+            Rhi::ShaderMacroDefinitions{ { "MACRO_FOO", "3" } }
+        };
+        const Rhi::Shader compute_shader = compute_context.CreateShader(Rhi::ShaderType::Compute, shader_settings);
+        const Rhi::Shader other_shader   = compute_context.CreateShader(Rhi::ShaderType::Compute, other_shader_settings);
+        const Rhi::Shader vertex_shader  = compute_context.CreateShader(Rhi::ShaderType::Vertex, shader_settings);
+        CHECK(other_shader.GetInterfacePtr() != compute_shader.GetInterfacePtr());
+        CHECK(vertex_shader.GetInterfacePtr() != compute_shader.GetInterfacePtr());
+
+        const Rhi::ContextShaderCacheStatistics statistics = compute_context.GetShaderCacheStatistics();
+        CHECK(statistics.hits_count == 0U);
+        CHECK(statistics.misses_count == 3U);
+        CHECK(statistics.shaders_count == 3U);
+    }
+
     SECTION("Macro-definitions to string")
     {
         CHECK(Rhi::ShaderMacroDefinition::ToString(shader_settings.compile_definitions, "; ") ==
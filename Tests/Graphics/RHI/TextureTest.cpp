@@ -32,6 +32,7 @@ Unit-tests of the RHI Texture
 #include <Methane/Graphics/RHI/CommandQueue.h>
 
 #include <memory>
+#include <algorithm>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -175,3 +176,54 @@ TEST_CASE("RHI Texture Functions", "[rhi][texture][resource]")
                                       Rhi::SubResource::Index{}, Rhi::BytesRangeOpt{}));
     }
 }
+
+TEST_CASE("RHI Texture Data Retained in Null Backend", "[rhi][texture][resource][data]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor,
+        Rhi::ComputeContextSettings{ Rhi::ContextOptionMask{ Rhi::ContextOption::RetainNullResourceData } });
+    const Rhi::CommandQueue& compute_cmd_queue = compute_context.GetComputeCommandKit().GetQueue();
+    const Rhi::TextureSettings readback_texture_settings = Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::RGBA8, true,
+                                                                                         { Rhi::ResourceUsage::ShaderRead, Rhi::ResourceUsage::ReadBack });
+    const Rhi::Texture texture = compute_context.CreateTexture(readback_texture_settings);
+    const Rhi::SubResource::Index mip_0_index(0U, 0U, 0U);
+    const Rhi::SubResource::Index mip_1_index(0U, 0U, 1U);
+
+    Data::Bytes mip_0_data(64 * 64 * 4, std::byte(1));
+    Data::Bytes mip_1_data(32 * 32 * 4, std::byte(2));
+    REQUIRE_NOTHROW(texture.SetData(compute_cmd_queue, {
+        Rhi::SubResource(mip_0_data.data(), static_cast<Data::Size>(mip_0_data.size()), mip_0_index),
+        Rhi::SubResource(mip_1_data.data(), static_cast<Data::Size>(mip_1_data.size()), mip_1_index)
+    }));
+
+    SECTION("Get Sub-Resources Data")
+    {
+        const Rhi::SubResource mip_0_sub_resource = texture.GetData(compute_cmd_queue, mip_0_index);
+        REQUIRE(mip_0_sub_resource.GetDataSize() == mip_0_data.size());
+        CHECK(mip_0_sub_resource.GetIndex() == mip_0_index);
+        CHECK(std::equal(mip_0_data.begin(), mip_0_data.end(), mip_0_sub_resource.GetDataPtr()));
+
+        const Rhi::SubResource mip_1_sub_resource = texture.GetData(compute_cmd_queue, mip_1_index);
+        REQUIRE(mip_1_sub_resource.GetDataSize() == mip_1_data.size());
+        CHECK(mip_1_sub_resource.GetIndex() == mip_1_index);
+        CHECK(std::equal(mip_1_data.begin(), mip_1_data.end(), mip_1_sub_resource.GetDataPtr()));
+    }
+
+    SECTION("Get Sub-Resource Data Range")
+    {
+        const Rhi::SubResource sub_resource = texture.GetData(compute_cmd_queue, mip_1_index, Rhi::BytesRange(16U, 48U));
+        REQUIRE(sub_resource.GetDataSize() == 32U);
+        CHECK(std::all_of(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), [](std::byte b) { return b == std::byte(2); }));
+    }
+
+    SECTION("Get Data of Not Initialized Sub-Resource")
+    {
+        const Rhi::SubResource sub_resource = texture.GetData(compute_cmd_queue, Rhi::SubResource::Index(0U, 0U, 2U));
+        REQUIRE(sub_resource.GetDataSize() == 16U * 16U * 4U);
+        CHECK(std::all_of(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), [](std::byte b) { return b == std::byte{}; }));
+    }
+
+    SECTION("Get Data of Out of Range Sub-Resource")
+    {
+        CHECK_THROWS(texture.GetData(compute_cmd_queue, Rhi::SubResource::Index(0U, 1U, 0U)));
+    }
+}
@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Types/FrustumTest.cpp
+Unit-tests of the BoundingBox and Frustum types
+
+******************************************************************************/
+
+#include <Methane/Graphics/Frustum.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane::Graphics;
+using Catch::Approx;
+
+TEST_CASE("Bounding box", "[bounding-box]")
+{
+    SECTION("Default box is empty")
+    {
+        const BoundingBox box;
+        CHECK(box.IsEmpty());
+        CHECK(box.GetSurfaceArea() == 0.F);
+    }
+
+    SECTION("Box grows with added points")
+    {
+        BoundingBox box;
+        box.Add(hlslpp::float3(1.F, 2.F, 3.F));
+        box.Add(hlslpp::float3(-1.F, 0.F, 1.F));
+        CHECK_FALSE(box.IsEmpty());
+        CHECK(box.GetSurfaceArea() == Approx(2.F * (2.F * 2.F + 2.F * 2.F + 2.F * 2.F)));
+        CHECK(box.Contains(hlslpp::float3(0.F, 1.F, 2.F)));
+        CHECK_FALSE(box.Contains(hlslpp::float3(0.F, 3.F, 2.F)));
+    }
+
+    SECTION("Transformed box contains transformed corners")
+    {
+        const BoundingBox box(hlslpp::float3(-1.F), hlslpp::float3(1.F));
+        const BoundingBox transformed_box = box.Transform(hlslpp::mul(hlslpp::float4x4::scale(2.F), hlslpp::float4x4::translation(10.F, 0.F, 0.F)));
+        CHECK(static_cast<float>(transformed_box.min.x) == Approx(8.F));
+        CHECK(static_cast<float>(transformed_box.max.x) == Approx(12.F));
+        CHECK(static_cast<float>(transformed_box.min.y) == Approx(-2.F));
+        CHECK(static_cast<float>(transformed_box.max.z) == Approx(2.F));
+    }
+}
+
+TEST_CASE("View frustum", "[frustum]")
+{
+    // Frustum of identity view-projection matrix is the clip space box [-1, 1] x [-1, 1] x [0, 1]
+    const Frustum frustum(hlslpp::float4x4::identity());
+
+    SECTION("Default frustum is infinite")
+    {
+        const Frustum infinite_frustum;
+        CHECK(infinite_frustum.IsPointVisible(hlslpp::float3(1000.F, -1000.F, 1000.F)));
+        CHECK(infinite_frustum.TestBox(BoundingBox(hlslpp::float3(-1.F), hlslpp::float3(1.F))) == Frustum::Intersection::Inside);
+    }
+
+    SECTION("Planes are normalized and directed inside")
+    {
+        CHECK(static_cast<float>(hlslpp::length(frustum.GetPlane(Frustum::Plane::Left).xyz)) == Approx(1.F));
+        CHECK(static_cast<float>(frustum.GetPlane(Frustum::Plane::Left).x) == Approx(1.F));
+        CHECK(static_cast<float>(frustum.GetPlane(Frustum::Plane::Near).z) == Approx(1.F));
+        CHECK(static_cast<float>(frustum.GetPlane(Frustum::Plane::Far).z) == Approx(-1.F));
+    }
+
+    SECTION("Point visibility")
+    {
+        CHECK(frustum.IsPointVisible(hlslpp::float3(0.F, 0.F, 0.5F)));
+        CHECK(frustum.IsPointVisible(hlslpp::float3(-0.9F, 0.9F, 0.1F)));
+        CHECK_FALSE(frustum.IsPointVisible(hlslpp::float3(0.F, 0.F, -0.1F)));
+        CHECK_FALSE(frustum.IsPointVisible(hlslpp::float3(0.F, 0.F, 1.1F)));
+        CHECK_FALSE(frustum.IsPointVisible(hlslpp::float3(1.1F, 0.F, 0.5F)));
+        CHECK_FALSE(frustum.IsPointVisible(hlslpp::float3(0.F, -1.1F, 0.5F)));
+    }
+
+    SECTION("Sphere visibility")
+    {
+        CHECK(frustum.TestSphere(hlslpp::float3(0.F, 0.F, 0.5F), 0.2F) == Frustum::Intersection::Inside);
+        CHECK(frustum.TestSphere(hlslpp::float3(1.1F, 0.F, 0.5F), 0.2F) == Frustum::Intersection::Intersects);
+        CHECK(frustum.TestSphere(hlslpp::float3(1.5F, 0.F, 0.5F), 0.2F) == Frustum::Intersection::Outside);
+    }
+
+    SECTION("Box visibility")
+    {
+        CHECK(frustum.TestBox(BoundingBox(hlslpp::float3(-0.5F, -0.5F, 0.2F), hlslpp::float3(0.5F, 0.5F, 0.8F))) == Frustum::Intersection::Inside);
+        CHECK(frustum.TestBox(BoundingBox(hlslpp::float3(0.5F, 0.5F, 0.5F), hlslpp::float3(1.5F, 1.5F, 1.5F))) == Frustum::Intersection::Intersects);
+        CHECK(frustum.TestBox(BoundingBox(hlslpp::float3(-2.F, -2.F, 0.2F), hlslpp::float3(2.F, 2.F, 0.8F))) == Frustum::Intersection::Intersects);
+        CHECK(frustum.TestBox(BoundingBox(hlslpp::float3(1.5F, -0.5F, 0.2F), hlslpp::float3(2.5F, 0.5F, 0.8F))) == Frustum::Intersection::Outside);
+        CHECK_FALSE(frustum.IsBoxVisible(BoundingBox(hlslpp::float3(-0.5F, -0.5F, -2.F), hlslpp::float3(0.5F, 0.5F, -1.F))));
+    }
+}
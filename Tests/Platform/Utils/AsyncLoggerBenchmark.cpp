@@ -0,0 +1,126 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/Utils/AsyncLoggerBenchmark.cpp
+Benchmarks of logging from multiple threads with synchronous and asynchronous loggers
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <Methane/Platform/AsyncLogger.h>
+
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <functional>
+
+using namespace Methane;
+using namespace Methane::Platform;
+
+static constexpr size_t g_threads_count     = 16U;
+static constexpr size_t g_thread_logs_count = 1000U;
+
+// Log file stream is flushed on every message to resemble synchronous writing to console with std::endl
+class LogFile
+{
+public:
+    explicit LogFile(const std::string& file_name)
+        : m_file_path(std::filesystem::temp_directory_path() / file_name)
+        , m_file_stream(m_file_path, std::ios::out | std::ios::trunc)
+    { }
+
+    ~LogFile()
+    {
+        m_file_stream.close();
+        std::error_code error_code;
+        std::filesystem::remove(m_file_path, error_code);
+    }
+
+    void Write(std::string_view message)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_file_stream << message << std::endl;
+    }
+
+private:
+    std::filesystem::path m_file_path;
+    std::ofstream         m_file_stream;
+    std::mutex            m_mutex;
+};
+
+static void LogFromThreads(const std::function<void(size_t thread_index, size_t log_index)>& log_message)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(g_threads_count);
+    for(size_t thread_index = 0U; thread_index < g_threads_count; ++thread_index)
+    {
+        threads.emplace_back([&log_message, thread_index]()
+        {
+            for(size_t log_index = 0U; log_index < g_thread_logs_count; ++log_index)
+                log_message(thread_index, log_index);
+        });
+    }
+    for(std::thread& thread : threads)
+        thread.join();
+}
+
+TEST_CASE("Logging benchmark from 16 threads", "[log][benchmark]")
+{
+    static constexpr std::string_view s_log_format = "Command list '{}' encoded draw call {} with {} vertices";
+    const std::string benchmark_suffix = " of " + std::to_string(g_threads_count * g_thread_logs_count) + " messages";
+
+    LogFile sync_log_file("MethaneSyncLoggerBenchmark.log");
+    BENCHMARK("Synchronous logging" + benchmark_suffix)
+    {
+        LogFromThreads([&sync_log_file](size_t thread_index, size_t log_index)
+        {
+            sync_log_file.Write(fmt::format(s_log_format, thread_index, log_index, 42U));
+        });
+    };
+
+    LogFile async_drop_log_file("MethaneAsyncDropLoggerBenchmark.log");
+    AsyncLogger async_drop_logger({ 1024U, AsyncLogger::OverflowPolicy::Drop,
+                                    [&async_drop_log_file](std::string_view message) { async_drop_log_file.Write(message); } });
+    BENCHMARK("Asynchronous logging with drop on overflow" + benchmark_suffix)
+    {
+        LogFromThreads([&async_drop_logger](size_t thread_index, size_t log_index)
+        {
+            async_drop_logger.LogFormat(s_log_format, thread_index, log_index, 42U);
+        });
+    };
+
+    LogFile async_block_log_file("MethaneAsyncBlockLoggerBenchmark.log");
+    AsyncLogger async_block_logger({ 1024U, AsyncLogger::OverflowPolicy::Block,
+                                     [&async_block_log_file](std::string_view message) { async_block_log_file.Write(message); } });
+    BENCHMARK("Asynchronous logging with block on overflow" + benchmark_suffix)
+    {
+        LogFromThreads([&async_block_logger](size_t thread_index, size_t log_index)
+        {
+            async_block_logger.LogFormat(s_log_format, thread_index, log_index, 42U);
+        });
+    };
+    async_block_logger.Flush();
+
+    CHECK(async_block_logger.GetDroppedMessagesCount() == 0U);
+}
@@ -0,0 +1,176 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/Utils/AsyncLoggerTest.cpp
+Unit tests of the asynchronous logger with bounded multi-producer queue
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Platform/AsyncLogger.h>
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Platform;
+
+struct ThrowingFormatValue { };
+
+template<>
+struct fmt::formatter<ThrowingFormatValue> : fmt::formatter<std::string_view>
+{
+    template<typename FormatContext>
+    auto format(const ThrowingFormatValue&, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        throw std::runtime_error("Test format error");
+    }
+};
+
+class LogCollector
+{
+public:
+    AsyncLogger::Writer GetWriter()
+    {
+        return [this](std::string_view message)
+        {
+            std::scoped_lock lock(m_mutex);
+            m_messages.emplace_back(message);
+        };
+    }
+
+    std::vector<std::string> GetMessages() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_messages;
+    }
+
+private:
+    mutable std::mutex       m_mutex;
+    std::vector<std::string> m_messages;
+};
+
+TEST_CASE("Async logger messages writing", "[log]")
+{
+    LogCollector log_collector;
+
+    SECTION("Queue capacity is rounded up to power of two")
+    {
+        const AsyncLogger logger({ 100U, AsyncLogger::OverflowPolicy::Drop, log_collector.GetWriter() });
+        CHECK(logger.GetQueueCapacity() == 128U);
+    }
+
+    SECTION("Messages are written in order of logging from one thread")
+    {
+        AsyncLogger logger({ 16U, AsyncLogger::OverflowPolicy::Block, log_collector.GetWriter() });
+        logger.Log("First message");
+        logger.LogFormat("Message {} of {}", 2, "formatted");
+        logger.Flush();
+
+        CHECK(logger.GetWrittenMessagesCount() == 2U);
+        CHECK(log_collector.GetMessages() == std::vector<std::string>{ "First message", "Message 2 of formatted" });
+    }
+
+    SECTION("Long messages are truncated")
+    {
+        AsyncLogger logger({ 16U, AsyncLogger::OverflowPolicy::Block, log_collector.GetWriter() });
+        const std::string long_message(AsyncLogger::max_message_length * 2U, 'x');
+        logger.Log(long_message);
+        logger.LogFormat("{}", long_message);
+        logger.Flush();
+
+        const std::vector<std::string> messages = log_collector.GetMessages();
+        REQUIRE(messages.size() == 2U);
+        CHECK(messages[0] == long_message.substr(0U, AsyncLogger::max_message_length));
+        CHECK(messages[1] == messages[0]);
+    }
+
+    SECTION("Queue slot is released when message formatting throws")
+    {
+        AsyncLogger logger({ 2U, AsyncLogger::OverflowPolicy::Block, log_collector.GetWriter() });
+        CHECK_THROWS_AS(logger.LogFormat("Value {}", ThrowingFormatValue{}), std::runtime_error);
+        CHECK_THROWS_AS(logger.LogFormat("Value {}", ThrowingFormatValue{}), std::runtime_error);
+        logger.LogFormat("Message {}", 3);
+        logger.Flush();
+
+        CHECK(logger.GetWrittenMessagesCount() == 3U);
+        CHECK(log_collector.GetMessages() == std::vector<std::string>{ "", "", "Message 3" });
+    }
+
+    SECTION("Remaining messages are written on logger destruction")
+    {
+        {
+            AsyncLogger logger({ 64U, AsyncLogger::OverflowPolicy::Block, log_collector.GetWriter() });
+            for(int i = 0; i < 50; ++i)
+                logger.LogFormat("Message {}", i);
+        }
+        const std::vector<std::string> messages = log_collector.GetMessages();
+        REQUIRE(messages.size() == 50U);
+        CHECK(messages.back() == "Message 49");
+    }
+}
+
+TEST_CASE("Async logger multi-threaded logging", "[log]")
+{
+    constexpr size_t threads_count       = 8U;
+    constexpr size_t thread_logs_count   = 1000U;
+    constexpr size_t total_logs_count    = threads_count * thread_logs_count;
+
+    LogCollector log_collector;
+
+    const auto log_from_threads = [](AsyncLogger& logger)
+    {
+        std::vector<std::thread> threads;
+        for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&logger, thread_index]()
+            {
+                for(size_t log_index = 0U; log_index < thread_logs_count; ++log_index)
+                    logger.LogFormat("{}:{}", thread_index, log_index);
+            });
+        }
+        for(std::thread& thread : threads)
+            thread.join();
+        logger.Flush();
+    };
+
+    SECTION("All messages are written with blocking overflow policy")
+    {
+        AsyncLogger logger({ 64U, AsyncLogger::OverflowPolicy::Block, log_collector.GetWriter() });
+        log_from_threads(logger);
+
+        const std::vector<std::string> messages = log_collector.GetMessages();
+        CHECK(logger.GetDroppedMessagesCount() == 0U);
+        CHECK(logger.GetWrittenMessagesCount() == total_logs_count);
+        CHECK(messages.size() == total_logs_count);
+        CHECK(std::set<std::string>(messages.begin(), messages.end()).size() == total_logs_count);
+    }
+
+    SECTION("Messages are dropped with dropping overflow policy, but all are accounted")
+    {
+        AsyncLogger logger({ 4U, AsyncLogger::OverflowPolicy::Drop, log_collector.GetWriter() });
+        log_from_threads(logger);
+
+        CHECK(logger.GetWrittenMessagesCount() + logger.GetDroppedMessagesCount() == total_logs_count);
+    }
+}
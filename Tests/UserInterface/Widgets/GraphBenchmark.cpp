@@ -0,0 +1,84 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Widgets/GraphBenchmark.cpp
+Benchmarks of graph widget update and rendering commands encoding on Null graphics backend
+
+******************************************************************************/
+
+#include "GraphTestFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+
+using namespace Methane;
+using namespace Methane::UserInterface;
+
+static Graph::Settings GetGraphSettings(uint32_t samples_count, uint32_t series_count)
+{
+    Graph::Settings graph_settings{ "Benchmark", samples_count, 33.3F, {} };
+    graph_settings.series_colors.resize(series_count, Color4F(1.F, 1.F, 1.F, 1.F));
+    return graph_settings;
+}
+
+static void AddSamples(Graph& graph, uint32_t sample_index)
+{
+    for(uint32_t series_index = 0U; series_index < graph.GetSeriesCount(); ++series_index)
+    {
+        graph.AddSample(series_index, static_cast<float>((sample_index + series_index * 7U) % 33U));
+    }
+}
+
+static void BenchmarkGraph(uint32_t samples_count, uint32_t series_count)
+{
+    GraphTestFixture fixture;
+    Graph graph(fixture.GetUIContext(),
+                UnitRect{ Units::Pixels, gfx::Point2I{ 20, 20 }, gfx::FrameSize{ 480U, 64U } },
+                GetGraphSettings(samples_count, series_count));
+    const rhi::RenderCommandList cmd_list = fixture.CreateRenderCommandList();
+    const rhi::CommandListSet    cmd_list_set({ cmd_list.GetInterface() });
+    const std::string graph_name = std::to_string(series_count) + " series of " + std::to_string(samples_count) + " samples";
+
+    uint32_t sample_index = 0U;
+    BENCHMARK("Graph samples addition for " + graph_name)
+    {
+        AddSamples(graph, sample_index++);
+        return graph.GetLastSample(0U);
+    };
+
+    BENCHMARK("Graph update with " + graph_name)
+    {
+        AddSamples(graph, sample_index++);
+        graph.Update(fixture.GetFrameSize());
+    };
+
+    BENCHMARK("Graph rendering of " + graph_name)
+    {
+        graph.Draw(cmd_list);
+        cmd_list.Commit();
+        fixture.Execute(cmd_list_set);
+    };
+}
+
+TEST_CASE("Graph Widget Benchmark", "[ui][widget][graph][benchmark]")
+{
+    BenchmarkGraph(240U, 3U);
+    BenchmarkGraph(1024U, 8U);
+}
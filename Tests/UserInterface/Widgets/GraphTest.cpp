@@ -0,0 +1,122 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Widgets/GraphTest.cpp
+Unit tests of the graph widget on Null graphics backend
+
+******************************************************************************/
+
+#include "GraphTestFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane;
+using namespace Methane::UserInterface;
+
+static const UnitRect g_graph_rect{ Units::Pixels, gfx::Point2I{ 10, 20 }, gfx::FrameSize{ 300U, 60U } };
+
+TEST_CASE("Graph Widget Initialization", "[ui][widget][graph]")
+{
+    GraphTestFixture fixture;
+
+    SECTION("Graph with default settings")
+    {
+        const Graph graph(fixture.GetUIContext(), g_graph_rect, Graph::Settings{ "Test" });
+        CHECK(graph.GetSeriesCount() == 1U);
+        CHECK(graph.GetGraphSettings().samples_count == 240U);
+        CHECK(graph.GetRectInPixels() == g_graph_rect);
+        CHECK(graph.GetLastSample(0U) == 0.F);
+    }
+
+    SECTION("Graph with single sample can not be created")
+    {
+        CHECK_THROWS_AS(Graph(fixture.GetUIContext(), g_graph_rect, Graph::Settings{ "Test", 1U }), Methane::ArgumentExceptionBase<std::out_of_range>);
+    }
+
+    SECTION("Graph without series can not be created")
+    {
+        CHECK_THROWS(Graph(fixture.GetUIContext(), g_graph_rect, Graph::Settings{ "Test", 16U, 1.F, {} }));
+    }
+}
+
+TEST_CASE("Graph Widget Samples", "[ui][widget][graph]")
+{
+    GraphTestFixture fixture;
+    Graph graph(fixture.GetUIContext(), g_graph_rect,
+                Graph::Settings{ "Test", 4U, 10.F, { Color4F(1.F, 0.F, 0.F, 1.F), Color4F(0.F, 1.F, 0.F, 1.F) } });
+
+    SECTION("Samples are added to series independently")
+    {
+        graph.AddSample(0U, 1.F);
+        graph.AddSample(1U, 2.F);
+        graph.AddSample(0U, 3.F);
+        CHECK(graph.GetLastSample(0U) == Catch::Approx(3.F));
+        CHECK(graph.GetLastSample(1U) == Catch::Approx(2.F));
+    }
+
+    SECTION("Oldest samples are replaced in full series")
+    {
+        for(uint32_t sample_index = 1U; sample_index <= 10U; ++sample_index)
+        {
+            graph.AddSample(0U, static_cast<float>(sample_index));
+        }
+        CHECK(graph.GetLastSample(0U) == Catch::Approx(10.F));
+    }
+
+    SECTION("Sample can not be added to missing series")
+    {
+        CHECK_THROWS_AS(graph.AddSample(2U, 1.F), Methane::ArgumentExceptionBase<std::out_of_range>);
+    }
+
+    SECTION("Max value must be positive")
+    {
+        CHECK_THROWS(graph.SetMaxValue(0.F));
+        CHECK_NOTHROW(graph.SetMaxValue(20.F));
+        CHECK(graph.GetGraphSettings().max_value == Catch::Approx(20.F));
+    }
+}
+
+TEST_CASE("Graph Widget Rendering", "[ui][widget][graph]")
+{
+    GraphTestFixture fixture;
+    Graph graph(fixture.GetUIContext(), g_graph_rect,
+                Graph::Settings{ "Test", 16U, 10.F, { Color4F(1.F, 0.F, 0.F, 1.F), Color4F(0.F, 1.F, 0.F, 1.F) } });
+    const rhi::RenderCommandList cmd_list = fixture.CreateRenderCommandList();
+    const rhi::CommandListSet    cmd_list_set({ cmd_list.GetInterface() });
+
+    SECTION("Graph update and draw")
+    {
+        graph.AddSample(0U, 5.F);
+        graph.AddSample(1U, 15.F);
+        CHECK_NOTHROW(graph.Update(fixture.GetFrameSize()));
+        CHECK_NOTHROW(graph.Draw(cmd_list));
+        CHECK(cmd_list.GetState() == rhi::CommandListState::Encoding);
+        cmd_list.Commit();
+        CHECK_NOTHROW(fixture.Execute(cmd_list_set));
+    }
+
+    SECTION("Graph rect change")
+    {
+        const UnitRect new_graph_rect{ Units::Pixels, gfx::Point2I{ 40, 50 }, gfx::FrameSize{ 200U, 30U } };
+        CHECK(graph.SetRect(new_graph_rect));
+        CHECK_FALSE(graph.SetRect(new_graph_rect));
+        CHECK(graph.GetRectInPixels() == new_graph_rect);
+        CHECK_NOTHROW(graph.Update(fixture.GetFrameSize()));
+    }
+}
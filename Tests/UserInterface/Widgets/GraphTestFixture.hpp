@@ -0,0 +1,87 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Widgets/GraphTestFixture.hpp
+Null render context and UI context fixture for graph widget tests and benchmarks
+
+******************************************************************************/
+
+#pragma once
+
+#include "FakePlatformApp.hpp"
+
+#include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/Graph.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <taskflow/taskflow.hpp>
+
+namespace Methane::UserInterface
+{
+
+class GraphTestFixture
+{
+public:
+    GraphTestFixture()
+        : m_render_context(Platform::AppEnvironment{}, GetDevice(), m_parallel_executor, rhi::RenderContextSettings{ m_frame_size })
+        , m_render_cmd_queue(m_render_context, rhi::CommandListType::Render)
+        , m_render_pattern(m_render_context, rhi::RenderPatternSettings{})
+        , m_render_pass(m_render_pattern.CreateRenderPass({ {}, m_frame_size }))
+        , m_ui_context(m_fake_app, m_render_cmd_queue, m_render_pattern)
+    { }
+
+    [[nodiscard]] Context& GetUIContext() noexcept { return m_ui_context; }
+    [[nodiscard]] const FrameSize& GetFrameSize() const noexcept { return m_frame_size; }
+
+    [[nodiscard]] rhi::RenderCommandList CreateRenderCommandList() const
+    {
+        return m_render_cmd_queue.CreateRenderCommandList(m_render_pass);
+    }
+
+    // Command list is executed and completed to release resources retained by encoded commands
+    void Execute(const rhi::CommandListSet& cmd_list_set) const
+    {
+        m_render_cmd_queue.Execute(cmd_list_set);
+        dynamic_cast<Graphics::Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+    }
+
+private:
+    static rhi::Device GetDevice()
+    {
+        return rhi::System::Get().UpdateGpuDevices().at(0);
+    }
+
+    const FrameSize          m_frame_size{ 1920U, 1080U };
+    const Platform::FakeApp  m_fake_app{ 1.F, 96U };
+    tf::Executor             m_parallel_executor;
+    const rhi::RenderContext m_render_context;
+    const rhi::CommandQueue  m_render_cmd_queue;
+    const rhi::RenderPattern m_render_pattern;
+    const rhi::RenderPass    m_render_pass;
+    Context                  m_ui_context;
+};
+
+} // namespace Methane::UserInterface